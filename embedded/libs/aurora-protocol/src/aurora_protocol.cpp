@@ -4,7 +4,7 @@
 
 AuroraProtocol Aurora;
 
-AuroraProtocol::AuroraProtocol() : currentAngle(0), multiPacketInProgress(false), debugEnabled(false) {}
+AuroraProtocol::AuroraProtocol() : currentAngle(0), multiPacketInProgress(false), debugEnabled(false), stats() {}
 
 void AuroraProtocol::clear() {
     rawBuffer.clear();
@@ -18,6 +18,14 @@ void AuroraProtocol::setDebug(bool enabled) {
     debugEnabled = enabled;
 }
 
+const AuroraProtocolStats& AuroraProtocol::getStats() const {
+    return stats;
+}
+
+void AuroraProtocol::resetStats() {
+    stats = AuroraProtocolStats();
+}
+
 const std::vector<LedCommand>& AuroraProtocol::getLedCommands() const {
     return ledCommands;
 }
@@ -72,6 +80,7 @@ bool AuroraProtocol::tryProcessBuffer() {
             }
             // Skip this byte and try again
             rawBuffer.erase(rawBuffer.begin());
+            stats.bytesDiscarded++;
             continue;
         }
 
@@ -104,6 +113,8 @@ bool AuroraProtocol::tryProcessBuffer() {
             }
             // Skip SOH and try again
             rawBuffer.erase(rawBuffer.begin());
+            stats.bytesDiscarded++;
+            stats.framingErrors++;
             continue;
         }
 
@@ -115,6 +126,8 @@ bool AuroraProtocol::tryProcessBuffer() {
             }
             // Skip SOH and try again
             rawBuffer.erase(rawBuffer.begin());
+            stats.bytesDiscarded++;
+            stats.framingErrors++;
             continue;
         }
 
@@ -133,10 +146,13 @@ bool AuroraProtocol::tryProcessBuffer() {
             }
             // Skip SOH and try again (checksum mismatch)
             rawBuffer.erase(rawBuffer.begin());
+            stats.bytesDiscarded++;
+            stats.checksumErrors++;
             continue;
         }
 
         // Valid frame! Extract command and LED data
+        stats.framesDecoded++;
         if (dataLength >= 1) {
             uint8_t command = messageData[0];
             const uint8_t* ledData = messageData + 1;
@@ -150,6 +166,7 @@ bool AuroraProtocol::tryProcessBuffer() {
             // Process the message
             if (processMessage(command, ledData, ledDataLength)) {
                 ledUpdateReady = true;
+                stats.updatesCompleted++;
             }
         }
 
@@ -57,6 +57,17 @@ inline uint8_t colorToRole(uint8_t r, uint8_t g, uint8_t b) {
 #define CMD_V3_PACKET_MIDDLE 'Q'  // 81 - Middle packet of multi-packet sequence
 #define CMD_V3_PACKET_LAST 'S'    // 83 - Last packet of multi-packet sequence
 
+/**
+ * Decoder counters, for judging throughput and resync behaviour on real traffic.
+ */
+struct AuroraProtocolStats {
+    uint32_t framesDecoded;     // Frames with valid framing and checksum
+    uint32_t updatesCompleted;  // Complete LED updates (single or multi-packet)
+    uint32_t bytesDiscarded;    // Bytes skipped while hunting for a valid frame
+    uint32_t framingErrors;     // SOH without matching STX/ETX
+    uint32_t checksumErrors;
+};
+
 /**
  * Aurora Protocol Decoder
  * Decodes LED data packets from official Kilter/Tension apps
@@ -108,6 +119,10 @@ class AuroraProtocol {
     // Enable/disable debug output
     void setDebug(bool enabled);
 
+    // Decoder counters (not reset by clear())
+    const AuroraProtocolStats& getStats() const;
+    void resetStats();
+
     /**
      * Encode LED commands into Aurora protocol format for sending to a board.
      * Creates one or more BLE packets in the proper framed format.
@@ -132,6 +147,7 @@ class AuroraProtocol {
     int currentAngle;
     bool multiPacketInProgress;
     bool debugEnabled;
+    AuroraProtocolStats stats;
 
     // Try to extract and process a complete framed message from the buffer
     // Returns true if a complete LED update is ready
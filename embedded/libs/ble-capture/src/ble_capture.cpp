@@ -0,0 +1,185 @@
+#include "ble_capture.h"
+
+#include <log_buffer.h>
+
+#if defined(ESP_PLATFORM) && !defined(UNIT_TEST)
+#include <LittleFS.h>
+
+static portMUX_TYPE captureLock = portMUX_INITIALIZER_UNLOCKED;
+static File captureFile;
+#define CAPTURE_LOCK() portENTER_CRITICAL(&captureLock)
+#define CAPTURE_UNLOCK() portEXIT_CRITICAL(&captureLock)
+#else
+#define CAPTURE_LOCK()
+#define CAPTURE_UNLOCK()
+#endif
+
+BLECapture Capture;
+
+BLECapture::BLECapture()
+    : activeBuffer(0), stats(), sink(nullptr), maxSize(BLE_CAPTURE_MAX_FILE_SIZE), reservedBytes(0),
+      limitReached(false), lastFlushMs(0), recording(false) {
+    stagingLength[0] = 0;
+    stagingLength[1] = 0;
+    strncpy(path, BLE_CAPTURE_DEFAULT_PATH, sizeof(path) - 1);
+    path[sizeof(path) - 1] = '\0';
+}
+
+bool BLECapture::start(const char* filePath) {
+    if (recording) {
+        stop();
+    }
+
+    strncpy(path, filePath, sizeof(path) - 1);
+    path[sizeof(path) - 1] = '\0';
+    if (!openOutput()) {
+        Logger.logln("BLECapture: Cannot create %s", path);
+        return false;
+    }
+
+    uint8_t header[BLE_CAPTURE_HEADER_SIZE];
+    writeOutput(header, BLECaptureEncoder::writeHeader(header));
+
+    stats = BLECaptureStats();
+    stats.fileBytes = BLE_CAPTURE_HEADER_SIZE;
+    stagingLength[0] = 0;
+    stagingLength[1] = 0;
+    activeBuffer = 0;
+    reservedBytes = BLE_CAPTURE_HEADER_SIZE;
+    limitReached = false;
+    lastFlushMs = millis();
+    encoder.reset(micros());
+    recording = true;
+
+    Logger.logln("BLECapture: Recording to %s", path);
+    return true;
+}
+
+void BLECapture::stop() {
+    if (!recording) {
+        return;
+    }
+    recording = false;
+
+    // Both buffers may hold data if a record landed after the last swap
+    flush();
+    flush();
+    closeOutput();
+
+    Logger.logln("BLECapture: Stopped, %u records, %u bytes, %u dropped", stats.records, stats.fileBytes,
+                 stats.recordsDropped);
+}
+
+bool BLECapture::isRecording() const {
+    return recording;
+}
+
+void BLECapture::record(BLECaptureDirection direction, const uint8_t* data, size_t len) {
+    if (!recording) {
+        return;
+    }
+
+    CAPTURE_LOCK();
+    // Timestamp under the lock so records reach the delta encoder in time
+    // order even when the NimBLE host and loop tasks record concurrently
+    uint32_t now = micros();
+    size_t& used = stagingLength[activeBuffer];
+    size_t needed = BLECaptureEncoder::maxRecordSize(len);
+    if (reservedBytes + needed > maxSize) {
+        limitReached = true;
+        stats.recordsDropped++;
+    } else if (used + needed > BLE_CAPTURE_STAGING_SIZE) {
+        stats.recordsDropped++;
+    } else {
+        size_t written = encoder.encodeRecord(staging[activeBuffer] + used, BLE_CAPTURE_STAGING_SIZE - used, now,
+                                              direction, data, len);
+        used += written;
+        reservedBytes += written;
+        stats.records++;
+        stats.payloadBytes += len;
+    }
+    CAPTURE_UNLOCK();
+}
+
+void BLECapture::loop() {
+    if (!recording) {
+        return;
+    }
+
+    unsigned long now = millis();
+    if (stagingLength[activeBuffer] >= BLE_CAPTURE_STAGING_SIZE / 2 ||
+        now - lastFlushMs >= BLE_CAPTURE_FLUSH_INTERVAL_MS) {
+        flush();
+        lastFlushMs = now;
+    }
+
+    if (limitReached) {
+        Logger.logln("BLECapture: Size limit of %u bytes reached", (unsigned)maxSize);
+        stop();
+    }
+}
+
+void BLECapture::setSink(BLECaptureSink callback) {
+    sink = callback;
+}
+
+void BLECapture::setMaxSize(size_t bytes) {
+    maxSize = bytes;
+}
+
+const BLECaptureStats& BLECapture::getStats() const {
+    return stats;
+}
+
+const char* BLECapture::getPath() const {
+    return path;
+}
+
+void BLECapture::flush() {
+    CAPTURE_LOCK();
+    int full = activeBuffer;
+    activeBuffer ^= 1;
+    CAPTURE_UNLOCK();
+
+    // record() now fills the other buffer, so this one is ours until the
+    // next swap
+    if (stagingLength[full] > 0) {
+        writeOutput(staging[full], stagingLength[full]);
+        stats.fileBytes += stagingLength[full];
+        stagingLength[full] = 0;
+    }
+}
+
+bool BLECapture::openOutput() {
+    if (sink) {
+        return true;
+    }
+#if defined(ESP_PLATFORM) && !defined(UNIT_TEST)
+    if (!LittleFS.begin(true)) {
+        return false;
+    }
+    captureFile = LittleFS.open(path, "w");
+    return (bool)captureFile;
+#else
+    return false;
+#endif
+}
+
+void BLECapture::writeOutput(const uint8_t* data, size_t len) {
+    if (sink) {
+        sink(data, len);
+        return;
+    }
+#if defined(ESP_PLATFORM) && !defined(UNIT_TEST)
+    captureFile.write(data, len);
+    captureFile.flush();
+#endif
+}
+
+void BLECapture::closeOutput() {
+#if defined(ESP_PLATFORM) && !defined(UNIT_TEST)
+    if (!sink) {
+        captureFile.close();
+    }
+#endif
+}
@@ -0,0 +1,108 @@
+#ifndef BLE_CAPTURE_H
+#define BLE_CAPTURE_H
+
+#include "ble_capture_format.h"
+
+#include <Arduino.h>
+
+// Each staging buffer; two alternate so BLE callbacks never wait on flash
+#define BLE_CAPTURE_STAGING_SIZE 2048
+
+// Capture stops once the file reaches this size
+#define BLE_CAPTURE_MAX_FILE_SIZE (256 * 1024)
+
+#define BLE_CAPTURE_DEFAULT_PATH "/ble_capture.bin"
+
+// Flush a partly filled staging buffer after this long
+#define BLE_CAPTURE_FLUSH_INTERVAL_MS 500
+
+/**
+ * Capture statistics.
+ */
+struct BLECaptureStats {
+    uint32_t records;
+    uint32_t payloadBytes;
+    uint32_t fileBytes;
+    uint32_t recordsDropped;  // Staging buffer full or size limit reached
+};
+
+/**
+ * Output for flushed capture bytes. Replaces the LittleFS file when set.
+ */
+typedef void (*BLECaptureSink)(const uint8_t* data, size_t len);
+
+/**
+ * BLECapture records raw BLE traffic in both directions with microsecond
+ * timestamps, for offline replay through the protocol and proxy code.
+ *
+ * record() is safe to call from NimBLE callbacks: it only appends to a RAM
+ * staging buffer under a spinlock. loop() swaps buffers and writes the full
+ * one to LittleFS (or the sink), so flash latency never reaches the BLE
+ * path. Records that do not fit before the next flush are counted as
+ * dropped rather than blocking.
+ *
+ * Only used when the firmware is built with ENABLE_BLE_CAPTURE.
+ */
+class BLECapture {
+  public:
+    BLECapture();
+
+    /**
+     * Start a new capture, replacing any previous file.
+     * @return false if the file could not be created
+     */
+    bool start(const char* path = BLE_CAPTURE_DEFAULT_PATH);
+
+    /**
+     * Flush pending records and close the capture.
+     */
+    void stop();
+
+    bool isRecording() const;
+
+    /**
+     * Record one BLE write or notification.
+     */
+    void record(BLECaptureDirection direction, const uint8_t* data, size_t len);
+
+    /**
+     * Flush staged records (call from loop).
+     */
+    void loop();
+
+    /**
+     * Send flushed bytes to a sink instead of a file (tests, other storage).
+     */
+    void setSink(BLECaptureSink sink);
+
+    /**
+     * Set the capture size limit in bytes.
+     */
+    void setMaxSize(size_t bytes);
+
+    const BLECaptureStats& getStats() const;
+    const char* getPath() const;
+
+  private:
+    uint8_t staging[2][BLE_CAPTURE_STAGING_SIZE];
+    size_t stagingLength[2];
+    int activeBuffer;
+    BLECaptureEncoder encoder;
+    BLECaptureStats stats;
+    BLECaptureSink sink;
+    char path[32];
+    size_t maxSize;
+    size_t reservedBytes;  // Header plus everything staged so far
+    volatile bool limitReached;
+    unsigned long lastFlushMs;
+    volatile bool recording;
+
+    void flush();
+    bool openOutput();
+    void writeOutput(const uint8_t* data, size_t len);
+    void closeOutput();
+};
+
+extern BLECapture Capture;
+
+#endif
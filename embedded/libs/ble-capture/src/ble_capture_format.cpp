@@ -0,0 +1,120 @@
+#include "ble_capture_format.h"
+
+// =============================================================================
+// BLECaptureEncoder
+// =============================================================================
+
+BLECaptureEncoder::BLECaptureEncoder() : lastTimestampUs(0) {}
+
+size_t BLECaptureEncoder::writeHeader(uint8_t* out) {
+    memcpy(out, BLE_CAPTURE_MAGIC, 4);
+    out[4] = BLE_CAPTURE_VERSION;
+    out[5] = 0;
+    out[6] = BLE_CAPTURE_HEADER_SIZE & 0xFF;
+    out[7] = BLE_CAPTURE_HEADER_SIZE >> 8;
+    return BLE_CAPTURE_HEADER_SIZE;
+}
+
+size_t BLECaptureEncoder::encodeRecord(uint8_t* out, size_t capacity, uint32_t timestampUs,
+                                       BLECaptureDirection direction, const uint8_t* data, size_t length) {
+    if (capacity < maxRecordSize(length)) {
+        return 0;
+    }
+
+    // Unsigned subtraction keeps deltas correct across micros() wrap-around
+    size_t pos = writeVarint(out, timestampUs - lastTimestampUs);
+    out[pos++] = (uint8_t)direction;
+    pos += writeVarint(out + pos, (uint32_t)length);
+    memcpy(out + pos, data, length);
+    pos += length;
+
+    lastTimestampUs = timestampUs;
+    return pos;
+}
+
+void BLECaptureEncoder::reset(uint32_t startUs) {
+    lastTimestampUs = startUs;
+}
+
+size_t BLECaptureEncoder::maxRecordSize(size_t length) {
+    return BLE_CAPTURE_MAX_RECORD_OVERHEAD + length;
+}
+
+size_t BLECaptureEncoder::writeVarint(uint8_t* out, uint32_t value) {
+    size_t pos = 0;
+    while (value >= 0x80) {
+        out[pos++] = (uint8_t)(value | 0x80);
+        value >>= 7;
+    }
+    out[pos++] = (uint8_t)value;
+    return pos;
+}
+
+// =============================================================================
+// BLECaptureReader
+// =============================================================================
+
+BLECaptureReader::BLECaptureReader(const uint8_t* data, size_t length)
+    : buffer(data), bufferLength(length), position(0), timestampUs(0), valid(false), truncated(false) {
+    valid = length >= BLE_CAPTURE_HEADER_SIZE && memcmp(data, BLE_CAPTURE_MAGIC, 4) == 0 &&
+            data[4] == BLE_CAPTURE_VERSION;
+    rewind();
+}
+
+bool BLECaptureReader::isValid() const {
+    return valid;
+}
+
+bool BLECaptureReader::next(BLECaptureRecord& record) {
+    if (!valid || truncated || position >= bufferLength) {
+        return false;
+    }
+
+    size_t start = position;
+    uint32_t delta;
+    uint32_t length;
+    if (!readVarint(delta) || position >= bufferLength) {
+        position = start;
+        truncated = true;
+        return false;
+    }
+    uint8_t direction = buffer[position++];
+    if (!readVarint(length) || bufferLength - position < length) {
+        position = start;
+        truncated = true;
+        return false;
+    }
+
+    timestampUs += delta;
+    record.timestampUs = timestampUs;
+    record.direction = direction == 0 ? BLECaptureDirection::APP_TO_BOARD : BLECaptureDirection::BOARD_TO_APP;
+    record.data = buffer + position;
+    record.length = length;
+    position += length;
+    return true;
+}
+
+bool BLECaptureReader::isTruncated() const {
+    return truncated;
+}
+
+void BLECaptureReader::rewind() {
+    position = valid ? (buffer[6] | (buffer[7] << 8)) : 0;
+    timestampUs = 0;
+    truncated = false;
+}
+
+bool BLECaptureReader::readVarint(uint32_t& value) {
+    value = 0;
+    for (int shift = 0; shift < 35; shift += 7) {
+        if (position >= bufferLength) {
+            return false;
+        }
+        uint8_t byte = buffer[position++];
+        value |= (uint32_t)(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) {
+            return true;
+        }
+    }
+    return false;
+}
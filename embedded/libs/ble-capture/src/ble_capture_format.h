@@ -0,0 +1,122 @@
+#ifndef BLE_CAPTURE_FORMAT_H
+#define BLE_CAPTURE_FORMAT_H
+
+#include <Arduino.h>
+
+/**
+ * BLE capture file format (version 1), little-endian:
+ *
+ * Header (8 bytes):
+ *   "BSCP"      magic
+ *   u8          version
+ *   u8          flags (reserved, 0)
+ *   u16         header size (8)
+ *
+ * Records, back to back:
+ *   varint      microseconds since the previous record (first: since start)
+ *   u8          direction (0 = app→board, 1 = board→app)
+ *   varint      payload length
+ *   bytes       payload
+ *
+ * Varints are unsigned LEB128. A 20-byte BLE write usually costs 3-4 bytes
+ * of overhead. A file cut short mid-record (power loss) is still readable
+ * up to the last complete record.
+ */
+
+#define BLE_CAPTURE_MAGIC "BSCP"
+#define BLE_CAPTURE_VERSION 1
+#define BLE_CAPTURE_HEADER_SIZE 8
+
+// Worst-case record overhead: 5-byte delta + direction + 5-byte length
+#define BLE_CAPTURE_MAX_RECORD_OVERHEAD 11
+
+enum class BLECaptureDirection : uint8_t { APP_TO_BOARD = 0, BOARD_TO_APP = 1 };
+
+/**
+ * One decoded record. data points into the capture buffer.
+ */
+struct BLECaptureRecord {
+    uint64_t timestampUs;  // Since capture start
+    BLECaptureDirection direction;
+    const uint8_t* data;
+    size_t length;
+};
+
+/**
+ * Encodes capture records into caller-provided buffers.
+ */
+class BLECaptureEncoder {
+  public:
+    BLECaptureEncoder();
+
+    /**
+     * Write the file header.
+     * @param out Buffer of at least BLE_CAPTURE_HEADER_SIZE bytes
+     * @return Bytes written
+     */
+    static size_t writeHeader(uint8_t* out);
+
+    /**
+     * Encode one record.
+     * @param timestampUs Capture clock in microseconds (wraps are handled)
+     * @return Bytes written, or 0 if the record does not fit
+     */
+    size_t encodeRecord(uint8_t* out, size_t capacity, uint32_t timestampUs, BLECaptureDirection direction,
+                        const uint8_t* data, size_t length);
+
+    /**
+     * Restart delta encoding from the given capture start time.
+     */
+    void reset(uint32_t startUs);
+
+    /**
+     * Upper bound on the encoded size of a record with this payload.
+     */
+    static size_t maxRecordSize(size_t length);
+
+  private:
+    uint32_t lastTimestampUs;
+
+    static size_t writeVarint(uint8_t* out, uint32_t value);
+};
+
+/**
+ * Iterates over the records of a capture held in memory.
+ */
+class BLECaptureReader {
+  public:
+    BLECaptureReader(const uint8_t* data, size_t length);
+
+    /**
+     * Check the header magic and version.
+     */
+    bool isValid() const;
+
+    /**
+     * Read the next record.
+     * @return false at the end of the capture or at a truncated record
+     */
+    bool next(BLECaptureRecord& record);
+
+    /**
+     * True if reading stopped at an incomplete trailing record.
+     */
+    bool isTruncated() const;
+
+    /**
+     * Start again from the first record.
+     */
+    void rewind();
+
+  private:
+    const uint8_t* buffer;
+    size_t bufferLength;
+    size_t position;
+    uint64_t timestampUs;
+    bool valid;
+    bool truncated;
+
+    bool readVarint(uint32_t& value);
+};
+
+#endif
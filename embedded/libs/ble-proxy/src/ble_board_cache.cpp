@@ -0,0 +1,120 @@
+#include "ble_board_cache.h"
+
+#include <strings.h>
+
+const CachedBoard& BoardCache::update(const NimBLEAddress& address, const String& name, int rssi,
+                                      unsigned long nowMs) {
+    CachedBoard* entry = findSlot(address);
+
+    if (!entry) {
+        entry = allocateSlot();
+        entry->address = address;
+        entry->name = name.length() > 0 ? name : String("Unknown Board");
+        entry->smoothedRssi = (float)rssi;
+        entry->firstSeenMs = nowMs;
+        entry->seenCount = 0;
+        entry->valid = true;
+    } else {
+        if (name.length() > 0) {
+            entry->name = name;
+        }
+        entry->smoothedRssi += BOARD_CACHE_RSSI_ALPHA * ((float)rssi - entry->smoothedRssi);
+    }
+
+    entry->lastRssi = rssi;
+    entry->lastSeenMs = nowMs;
+    entry->seenCount++;
+    return *entry;
+}
+
+const CachedBoard* BoardCache::find(const NimBLEAddress& address) const {
+    for (const auto& entry : entries) {
+        if (entry.valid && entry.address == address) {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+const CachedBoard* BoardCache::findByMac(const String& mac) const {
+    for (const auto& entry : entries) {
+        if (entry.valid && strcasecmp(mac.c_str(), entry.address.toString().c_str()) == 0) {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+const CachedBoard* BoardCache::getBest(unsigned long nowMs, unsigned long maxAgeMs) const {
+    const CachedBoard* best = nullptr;
+    for (const auto& entry : entries) {
+        if (!entry.valid || nowMs - entry.lastSeenMs > maxAgeMs) {
+            continue;
+        }
+        if (!best || entry.smoothedRssi > best->smoothedRssi) {
+            best = &entry;
+        }
+    }
+    return best;
+}
+
+bool BoardCache::seenSince(const NimBLEAddress& address, unsigned long sinceMs) const {
+    const CachedBoard* entry = find(address);
+    // Signed difference so the check survives millis() wrap-around
+    return entry && (long)(entry->lastSeenMs - sinceMs) >= 0;
+}
+
+int BoardCache::prune(unsigned long nowMs, unsigned long maxAgeMs) {
+    int removed = 0;
+    for (auto& entry : entries) {
+        if (entry.valid && nowMs - entry.lastSeenMs > maxAgeMs) {
+            entry = CachedBoard();
+            removed++;
+        }
+    }
+    return removed;
+}
+
+void BoardCache::clear() {
+    for (auto& entry : entries) {
+        entry = CachedBoard();
+    }
+}
+
+int BoardCache::size() const {
+    int count = 0;
+    for (const auto& entry : entries) {
+        if (entry.valid) {
+            count++;
+        }
+    }
+    return count;
+}
+
+const CachedBoard& BoardCache::at(int index) const {
+    return entries[index];
+}
+
+CachedBoard* BoardCache::findSlot(const NimBLEAddress& address) {
+    for (auto& entry : entries) {
+        if (entry.valid && entry.address == address) {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+CachedBoard* BoardCache::allocateSlot() {
+    // Prefer an empty slot, otherwise evict the least recently seen board
+    CachedBoard* oldest = &entries[0];
+    for (auto& entry : entries) {
+        if (!entry.valid) {
+            return &entry;
+        }
+        if ((long)(entry.lastSeenMs - oldest->lastSeenMs) < 0) {
+            oldest = &entry;
+        }
+    }
+    *oldest = CachedBoard();
+    return oldest;
+}
@@ -0,0 +1,107 @@
+#ifndef BLE_BOARD_CACHE_H
+#define BLE_BOARD_CACHE_H
+
+#include <Arduino.h>
+#include <NimBLEDevice.h>
+
+// Maximum number of boards remembered between scans
+#define BOARD_CACHE_MAX_ENTRIES 8
+
+// EWMA weight given to each new RSSI sample (0..1). Lower = smoother.
+#define BOARD_CACHE_RSSI_ALPHA 0.25f
+
+// A board seen within this window is considered reachable without a new scan
+#define BOARD_CACHE_FRESH_MS 10000
+
+/**
+ * A deduplicated, RSSI-smoothed record of an Aurora board seen while scanning.
+ */
+struct CachedBoard {
+    NimBLEAddress address;
+    String name;
+    float smoothedRssi;     // Exponentially weighted moving average of RSSI
+    int lastRssi;           // Most recent raw RSSI sample
+    unsigned long firstSeenMs;
+    unsigned long lastSeenMs;
+    uint32_t seenCount;     // Number of advertisements observed
+    bool valid;
+
+    CachedBoard() : smoothedRssi(0), lastRssi(0), firstSeenMs(0), lastSeenMs(0), seenCount(0), valid(false) {}
+};
+
+/**
+ * BoardCache keeps a small table of Aurora boards observed by the scanner.
+ *
+ * Every advertisement updates the entry for its address in place, so the
+ * cache never contains duplicates. RSSI is smoothed with an EWMA so one
+ * faded packet does not flip the "best board" choice. When the table is
+ * full, the entry that was seen least recently is replaced.
+ *
+ * The cache has no NimBLE scan dependency and takes timestamps explicitly,
+ * which keeps it usable from native unit tests.
+ */
+class BoardCache {
+  public:
+    /**
+     * Record an advertisement.
+     * @param address Board address
+     * @param name Advertised name (empty keeps the previous name)
+     * @param rssi Raw RSSI in dBm
+     * @param nowMs Current time in milliseconds
+     * @return The updated entry
+     */
+    const CachedBoard& update(const NimBLEAddress& address, const String& name, int rssi, unsigned long nowMs);
+
+    /**
+     * Find a board by address.
+     * @return Pointer to entry, or nullptr if not cached
+     */
+    const CachedBoard* find(const NimBLEAddress& address) const;
+
+    /**
+     * Find a board by MAC address string (case-insensitive).
+     * @return Pointer to entry, or nullptr if not cached
+     */
+    const CachedBoard* findByMac(const String& mac) const;
+
+    /**
+     * Get the board with the strongest smoothed RSSI seen within maxAgeMs.
+     * @return Pointer to entry, or nullptr if no board is fresh enough
+     */
+    const CachedBoard* getBest(unsigned long nowMs, unsigned long maxAgeMs = BOARD_CACHE_FRESH_MS) const;
+
+    /**
+     * Check whether a board was seen at or after the given time.
+     */
+    bool seenSince(const NimBLEAddress& address, unsigned long sinceMs) const;
+
+    /**
+     * Drop entries not seen within maxAgeMs.
+     * @return Number of entries removed
+     */
+    int prune(unsigned long nowMs, unsigned long maxAgeMs);
+
+    /**
+     * Remove all entries.
+     */
+    void clear();
+
+    /**
+     * Number of valid entries.
+     */
+    int size() const;
+
+    /**
+     * Access an entry slot by index (0..BOARD_CACHE_MAX_ENTRIES-1).
+     * Slots may be invalid; check CachedBoard::valid.
+     */
+    const CachedBoard& at(int index) const;
+
+  private:
+    CachedBoard entries[BOARD_CACHE_MAX_ENTRIES];
+
+    CachedBoard* findSlot(const NimBLEAddress& address);
+    CachedBoard* allocateSlot();
+};
+
+#endif
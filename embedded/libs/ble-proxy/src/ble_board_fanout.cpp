@@ -0,0 +1,430 @@
+#include "ble_board_fanout.h"
+
+#include <log_buffer.h>
+
+BLEBoardFanout Fanout;
+
+// =============================================================================
+// BoardWriteQueue
+// =============================================================================
+
+BoardWriteQueue::BoardWriteQueue() : head(0), count(0) {}
+
+bool BoardWriteQueue::push(const uint8_t* data, size_t len) {
+    if (count >= BLE_FANOUT_QUEUE_CHUNKS || len == 0 || len > BLE_FANOUT_CHUNK_SIZE) {
+        return false;
+    }
+    Chunk& chunk = chunks[(head + count) % BLE_FANOUT_QUEUE_CHUNKS];
+    memcpy(chunk.data, data, len);
+    chunk.len = (uint8_t)len;
+    count++;
+    return true;
+}
+
+const uint8_t* BoardWriteQueue::front(size_t& len) const {
+    if (count == 0) {
+        len = 0;
+        return nullptr;
+    }
+    len = chunks[head].len;
+    return chunks[head].data;
+}
+
+void BoardWriteQueue::pop() {
+    if (count > 0) {
+        head = (head + 1) % BLE_FANOUT_QUEUE_CHUNKS;
+        count--;
+    }
+}
+
+void BoardWriteQueue::clear() {
+    head = 0;
+    count = 0;
+}
+
+int BoardWriteQueue::size() const {
+    return count;
+}
+
+int BoardWriteQueue::available() const {
+    return BLE_FANOUT_QUEUE_CHUNKS - count;
+}
+
+bool BoardWriteQueue::isEmpty() const {
+    return count == 0;
+}
+
+// =============================================================================
+// BLEBoardFanout
+// =============================================================================
+
+BLEBoardFanout::BLEBoardFanout()
+    : connectCursor(0), writeGapMs(BLE_FANOUT_WRITE_GAP_MS), connectCallback(nullptr), dataCallback(nullptr),
+      responder(-1) {
+    for (auto& link : links) {
+        link.used = false;
+        link.wasConnected = false;
+        link.connecting = false;
+        link.failures = 0;
+        link.writeRetries = 0;
+        link.nextAttemptMs = 0;
+        link.lastWriteMs = 0;
+        link.stats = FanoutBoardStats();
+    }
+}
+
+int BLEBoardFanout::addBoard(const NimBLEAddress& address) {
+    if (findBoard(address) >= 0) {
+        return -1;
+    }
+
+    for (int i = 0; i < BLE_FANOUT_MAX_BOARDS; i++) {
+        BoardLink& link = links[i];
+        if (link.used) {
+            continue;
+        }
+        link.used = true;
+        link.address = address;
+        link.wasConnected = false;
+        link.connecting = false;
+        link.failures = 0;
+        link.writeRetries = 0;
+        link.nextAttemptMs = millis();
+        link.queue.clear();
+        link.stats = FanoutBoardStats();
+        // Answers the app only once elected responder
+        link.client.setDataCallback(nullptr);
+        Logger.logln("BLEFanout: Added board %d (%s)", i, address.toString().c_str());
+        return i;
+    }
+
+    Logger.logln("BLEFanout: Cannot add %s, %d boards max", address.toString().c_str(), BLE_FANOUT_MAX_BOARDS);
+    return -1;
+}
+
+int BLEBoardFanout::findBoard(const NimBLEAddress& address) const {
+    for (int i = 0; i < BLE_FANOUT_MAX_BOARDS; i++) {
+        if (links[i].used && links[i].address == address) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+void BLEBoardFanout::clear() {
+    for (auto& link : links) {
+        if (link.used) {
+            link.client.disconnect();
+        }
+        link.used = false;
+        link.wasConnected = false;
+        link.connecting = false;
+        link.queue.clear();
+    }
+    connectCursor = 0;
+    responder = -1;
+}
+
+void BLEBoardFanout::loop(bool allowConnect) {
+    unsigned long now = millis();
+
+    for (int i = 0; i < BLE_FANOUT_MAX_BOARDS; i++) {
+        if (links[i].used) {
+            pollConnect(i, now);
+            updateConnection(i, now);
+            links[i].client.pollLinkUpdate();
+        }
+    }
+
+    // Keep one connect in flight and rotate the starting point so a board
+    // that never answers cannot starve the rest
+    if (allowConnect && !isConnecting()) {
+        for (int n = 0; n < BLE_FANOUT_MAX_BOARDS; n++) {
+            int index = (connectCursor + n) % BLE_FANOUT_MAX_BOARDS;
+            if (wantsConnect(links[index], now)) {
+                connectCursor = (index + 1) % BLE_FANOUT_MAX_BOARDS;
+                startConnect(index, now);
+                break;
+            }
+        }
+    }
+
+    for (auto& link : links) {
+        if (link.used && link.wasConnected) {
+            drainQueue(link, now);
+        }
+    }
+}
+
+bool BLEBoardFanout::hasPendingConnect() const {
+    if (isConnecting()) {
+        return true;
+    }
+    unsigned long now = millis();
+    for (const auto& link : links) {
+        if (wantsConnect(link, now)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool BLEBoardFanout::isConnecting() const {
+    for (const auto& link : links) {
+        if (link.used && link.connecting) {
+            return true;
+        }
+    }
+    return false;
+}
+
+int BLEBoardFanout::sendPackets(const std::vector<std::vector<uint8_t>>& packets) {
+    size_t chunksNeeded = 0;
+    for (const auto& packet : packets) {
+        chunksNeeded += (packet.size() + BLE_FANOUT_CHUNK_SIZE - 1) / BLE_FANOUT_CHUNK_SIZE;
+    }
+
+    int queued = 0;
+    for (auto& link : links) {
+        if (!link.used || !link.wasConnected) {
+            continue;
+        }
+
+        // The new update carries the full climb; anything still queued is stale
+        if (!link.queue.isEmpty()) {
+            link.queue.clear();
+            link.stats.updatesSuperseded++;
+        }
+
+        if (chunksNeeded > (size_t)link.queue.available()) {
+            link.stats.updatesDropped++;
+            continue;
+        }
+
+        for (const auto& packet : packets) {
+            enqueue(link, packet.data(), packet.size());
+        }
+        queued++;
+    }
+    return queued;
+}
+
+int BLEBoardFanout::forward(const uint8_t* data, size_t len) {
+    size_t chunksNeeded = (len + BLE_FANOUT_CHUNK_SIZE - 1) / BLE_FANOUT_CHUNK_SIZE;
+
+    int queued = 0;
+    for (auto& link : links) {
+        if (!link.used || !link.wasConnected) {
+            continue;
+        }
+        if (chunksNeeded > (size_t)link.queue.available()) {
+            link.stats.updatesDropped++;
+            continue;
+        }
+        enqueue(link, data, len);
+        queued++;
+    }
+    return queued;
+}
+
+int BLEBoardFanout::getBoardCount() const {
+    int count = 0;
+    for (const auto& link : links) {
+        if (link.used) {
+            count++;
+        }
+    }
+    return count;
+}
+
+int BLEBoardFanout::getConnectedCount() const {
+    int count = 0;
+    for (const auto& link : links) {
+        if (link.used && link.client.isConnected()) {
+            count++;
+        }
+    }
+    return count;
+}
+
+bool BLEBoardFanout::isBoardConnected(int index) const {
+    return links[index].used && links[index].client.isConnected();
+}
+
+NimBLEAddress BLEBoardFanout::getBoardAddress(int index) const {
+    return links[index].address;
+}
+
+int BLEBoardFanout::getQueueDepth(int index) const {
+    return links[index].queue.size();
+}
+
+const FanoutBoardStats& BLEBoardFanout::getStats(int index) const {
+    return links[index].stats;
+}
+
+BLEClientConnection& BLEBoardFanout::getClient(int index) {
+    return links[index].client;
+}
+
+void BLEBoardFanout::setWriteGap(unsigned long gapMs) {
+    writeGapMs = gapMs;
+}
+
+void BLEBoardFanout::setConnectCallback(FanoutConnectCallback callback) {
+    connectCallback = callback;
+}
+
+void BLEBoardFanout::setDataCallback(ClientDataCallback callback) {
+    dataCallback = callback;
+    electResponder();
+}
+
+void BLEBoardFanout::updateConnection(int index, unsigned long now) {
+    BoardLink& link = links[index];
+    bool connected = link.client.isConnected();
+    if (connected == link.wasConnected) {
+        return;
+    }
+    link.wasConnected = connected;
+
+    if (connected) {
+        link.failures = 0;
+        link.writeRetries = 0;
+        link.stats.connects++;
+        Logger.logln("BLEFanout: Board %d connected (%d/%d)", index, getConnectedCount(), getBoardCount());
+    } else {
+        // Whatever was queued belongs to a climb the board never finished
+        link.queue.clear();
+        link.stats.disconnects++;
+        link.nextAttemptMs = now + BLE_FANOUT_RECONNECT_MIN_MS;
+        Logger.logln("BLEFanout: Board %d disconnected, retry in %lums", index,
+                     (unsigned long)BLE_FANOUT_RECONNECT_MIN_MS);
+    }
+
+    electResponder();
+
+    if (connectCallback) {
+        connectCallback(index, connected);
+    }
+}
+
+void BLEBoardFanout::electResponder() {
+    // Keep the current responder while it stays up so the app is not switched
+    // between boards mid-exchange; otherwise take the first connected board
+    if (responder < 0 || !links[responder].used || !links[responder].wasConnected) {
+        responder = -1;
+        for (int i = 0; i < BLE_FANOUT_MAX_BOARDS; i++) {
+            if (links[i].used && links[i].wasConnected) {
+                responder = i;
+                break;
+            }
+        }
+    }
+
+    for (int i = 0; i < BLE_FANOUT_MAX_BOARDS; i++) {
+        if (links[i].used) {
+            links[i].client.setDataCallback(i == responder ? dataCallback : nullptr);
+        }
+    }
+}
+
+bool BLEBoardFanout::wantsConnect(const BoardLink& link, unsigned long now) const {
+    if (!link.used || link.client.isConnected() || link.client.getState() == BLEClientState::CONNECTING) {
+        return false;
+    }
+    return (long)(now - link.nextAttemptMs) >= 0;
+}
+
+void BLEBoardFanout::startConnect(int index, unsigned long now) {
+    BoardLink& link = links[index];
+    Logger.logln("BLEFanout: Connecting board %d (%s)", index, link.address.toString().c_str());
+
+    if (!link.client.connectAsync(link.address)) {
+        connectFailed(index, now);
+        return;
+    }
+    link.connecting = true;
+
+    // Native builds finish the attempt synchronously
+    pollConnect(index, now);
+    updateConnection(index, now);
+}
+
+void BLEBoardFanout::pollConnect(int index, unsigned long now) {
+    BoardLink& link = links[index];
+    if (!link.connecting) {
+        return;
+    }
+
+    BLEClientState clientState = link.client.getState();
+    if (clientState == BLEClientState::CONNECTING) {
+        return;
+    }
+    link.connecting = false;
+
+    // The attempt also fails late when the NUS service is missing; only a
+    // live link counts as success. updateConnection() reports it.
+    if (clientState != BLEClientState::CONNECTED) {
+        connectFailed(index, now);
+    }
+}
+
+void BLEBoardFanout::connectFailed(int index, unsigned long now) {
+    BoardLink& link = links[index];
+    link.stats.connectFailures++;
+    if (link.failures < 8) {
+        link.failures++;
+    }
+    unsigned long backoff = backoffFor(link.failures);
+    link.nextAttemptMs = now + backoff;
+    Logger.logln("BLEFanout: Board %d connect failed, retry in %lums", index, backoff);
+}
+
+void BLEBoardFanout::drainQueue(BoardLink& link, unsigned long now) {
+    if (link.queue.isEmpty() || now - link.lastWriteMs < writeGapMs) {
+        return;
+    }
+
+    size_t len;
+    const uint8_t* data = link.queue.front(len);
+    link.lastWriteMs = now;
+
+    if (link.client.send(data, len)) {
+        link.queue.pop();
+        link.writeRetries = 0;
+        link.stats.chunksWritten++;
+        link.stats.bytesWritten += len;
+        return;
+    }
+
+    // Keep the chunk for the next slot; give up on the update if the board
+    // keeps refusing writes
+    link.stats.writeFailures++;
+    if (++link.writeRetries >= BLE_FANOUT_MAX_WRITE_RETRIES) {
+        link.queue.clear();
+        link.writeRetries = 0;
+        link.stats.updatesDropped++;
+    }
+}
+
+bool BLEBoardFanout::enqueue(BoardLink& link, const uint8_t* data, size_t len) {
+    for (size_t offset = 0; offset < len; offset += BLE_FANOUT_CHUNK_SIZE) {
+        size_t chunkSize = min((size_t)BLE_FANOUT_CHUNK_SIZE, len - offset);
+        if (!link.queue.push(data + offset, chunkSize)) {
+            return false;
+        }
+    }
+    if (link.queue.size() > link.stats.maxQueueDepth) {
+        link.stats.maxQueueDepth = link.queue.size();
+    }
+    return true;
+}
+
+unsigned long BLEBoardFanout::backoffFor(uint8_t failures) {
+    unsigned long backoff = BLE_FANOUT_RECONNECT_MIN_MS;
+    for (uint8_t i = 1; i < failures && backoff < BLE_FANOUT_RECONNECT_MAX_MS; i++) {
+        backoff *= 2;
+    }
+    return min(backoff, (unsigned long)BLE_FANOUT_RECONNECT_MAX_MS);
+}
@@ -0,0 +1,224 @@
+#ifndef BLE_BOARD_FANOUT_H
+#define BLE_BOARD_FANOUT_H
+
+#include "ble_client.h"
+
+#include <Arduino.h>
+#include <NimBLEDevice.h>
+#include <vector>
+
+// Maximum boards driven at once. The phone link and every board each use a
+// NimBLE connection, so CONFIG_BT_NIMBLE_MAX_CONNECTIONS must be at least
+// this plus one.
+#define BLE_FANOUT_MAX_BOARDS 4
+
+// Per-board write queue depth in chunks. A full Kilter climb encodes to
+// roughly 80 chunks, so this holds one update with headroom.
+#define BLE_FANOUT_QUEUE_CHUNKS 128
+
+// Largest single BLE write (matches the app's MAX_BLUETOOTH_MESSAGE_SIZE)
+#define BLE_FANOUT_CHUNK_SIZE 20
+
+// Minimum spacing between writes to one board
+#define BLE_FANOUT_WRITE_GAP_MS 10
+
+// Drop a board's backlog after this many consecutive failed writes
+#define BLE_FANOUT_MAX_WRITE_RETRIES 5
+
+// Reconnect backoff per board: min doubles per failure up to max
+#define BLE_FANOUT_RECONNECT_MIN_MS 1000
+#define BLE_FANOUT_RECONNECT_MAX_MS 30000
+
+/**
+ * Fixed-size FIFO of BLE write chunks for one board.
+ */
+class BoardWriteQueue {
+  public:
+    BoardWriteQueue();
+
+    /**
+     * Append one chunk (at most BLE_FANOUT_CHUNK_SIZE bytes).
+     * @return false if the queue is full or the chunk is too large
+     */
+    bool push(const uint8_t* data, size_t len);
+
+    /**
+     * Peek at the oldest chunk.
+     * @return Pointer to chunk data, or nullptr when empty
+     */
+    const uint8_t* front(size_t& len) const;
+
+    /**
+     * Remove the oldest chunk.
+     */
+    void pop();
+
+    void clear();
+    int size() const;
+    int available() const;
+    bool isEmpty() const;
+
+  private:
+    struct Chunk {
+        uint8_t data[BLE_FANOUT_CHUNK_SIZE];
+        uint8_t len;
+    };
+
+    Chunk chunks[BLE_FANOUT_QUEUE_CHUNKS];
+    int head;
+    int count;
+};
+
+/**
+ * Delivery statistics for one board.
+ */
+struct FanoutBoardStats {
+    uint32_t connects;
+    uint32_t disconnects;
+    uint32_t connectFailures;
+    uint32_t chunksWritten;
+    uint32_t bytesWritten;
+    uint32_t writeFailures;
+    uint32_t updatesSuperseded;  // Backlogs replaced by a newer update
+    uint32_t updatesDropped;     // Updates that did not fit or kept failing
+    int maxQueueDepth;
+};
+
+typedef void (*FanoutConnectCallback)(int boardIndex, bool connected);
+
+/**
+ * BLEBoardFanout relays the same Aurora packets to several boards, for gyms
+ * with mirrored walls.
+ *
+ * Each board has its own BLEClientConnection, write queue and reconnect
+ * timer. Sending only enqueues; loop() writes at most one chunk per board
+ * per BLE_FANOUT_WRITE_GAP_MS, so all boards progress in parallel and a slow
+ * or absent board never holds up the others.
+ *
+ * A new packet set replaces any backlog a board still has, because every
+ * LED update carries the full climb. Reconnects back off per board. Connects
+ * run asynchronously on the client's connector task; loop() polls each
+ * board's CONNECTING state and keeps at most one attempt in flight, since
+ * NimBLE handles one connection setup at a time.
+ *
+ * Board responses are relayed from one connected board only (the responder),
+ * so the app sees a single board. The responder is re-elected whenever a board
+ * connects or drops, so losing one board does not silence the app.
+ */
+class BLEBoardFanout {
+  public:
+    BLEBoardFanout();
+
+    /**
+     * Add a board. It is connected from loop().
+     * @return Board index, or -1 if full or already added
+     */
+    int addBoard(const NimBLEAddress& address);
+
+    /**
+     * Find a board index by address.
+     * @return Board index, or -1 if not added
+     */
+    int findBoard(const NimBLEAddress& address) const;
+
+    /**
+     * Disconnect and remove all boards.
+     */
+    void clear();
+
+    /**
+     * Process reconnects and drain write queues (call from loop).
+     * @param allowConnect false while a scan is running; NimBLE cannot
+     *        initiate connections during a scan
+     */
+    void loop(bool allowConnect = true);
+
+    /**
+     * Check whether loop() wants to start a connection now or one is still
+     * in flight. Scanning must stay stopped while this is true.
+     */
+    bool hasPendingConnect() const;
+
+    /**
+     * Check whether a board connect is in flight.
+     */
+    bool isConnecting() const;
+
+    /**
+     * Queue a complete packet set for every connected board, split into
+     * BLE_FANOUT_CHUNK_SIZE writes. Replaces each board's pending backlog.
+     * @return Number of boards the update was queued for
+     */
+    int sendPackets(const std::vector<std::vector<uint8_t>>& packets);
+
+    /**
+     * Queue raw bytes (e.g. app traffic) for every connected board, after
+     * whatever is already queued.
+     * @return Number of boards the data was queued for
+     */
+    int forward(const uint8_t* data, size_t len);
+
+    int getBoardCount() const;
+    int getConnectedCount() const;
+    bool isBoardConnected(int index) const;
+    int getResponder() const { return responder; }
+    NimBLEAddress getBoardAddress(int index) const;
+    int getQueueDepth(int index) const;
+    const FanoutBoardStats& getStats(int index) const;
+
+    /**
+     * Access a board's client connection (e.g. for link profiles).
+     */
+    BLEClientConnection& getClient(int index);
+
+    /**
+     * Set minimum spacing between writes to one board.
+     */
+    void setWriteGap(unsigned long gapMs);
+
+    /**
+     * Set callback for per-board connection changes.
+     */
+    void setConnectCallback(FanoutConnectCallback callback);
+
+    /**
+     * Set callback for data received from the responding board.
+     */
+    void setDataCallback(ClientDataCallback callback);
+
+  private:
+    struct BoardLink {
+        BLEClientConnection client;
+        NimBLEAddress address;
+        bool used;
+        bool wasConnected;
+        bool connecting;
+        uint8_t failures;
+        uint8_t writeRetries;
+        unsigned long nextAttemptMs;
+        unsigned long lastWriteMs;
+        BoardWriteQueue queue;
+        FanoutBoardStats stats;
+    };
+
+    BoardLink links[BLE_FANOUT_MAX_BOARDS];
+    int connectCursor;
+    unsigned long writeGapMs;
+    FanoutConnectCallback connectCallback;
+    ClientDataCallback dataCallback;
+    int responder;  // Board whose responses reach the app, -1 when none
+
+    void updateConnection(int index, unsigned long now);
+    void electResponder();
+    bool wantsConnect(const BoardLink& link, unsigned long now) const;
+    void startConnect(int index, unsigned long now);
+    void pollConnect(int index, unsigned long now);
+    void connectFailed(int index, unsigned long now);
+    void drainQueue(BoardLink& link, unsigned long now);
+    bool enqueue(BoardLink& link, const uint8_t* data, size_t len);
+    static unsigned long backoffFor(uint8_t failures);
+};
+
+extern BLEBoardFanout Fanout;
+
+#endif
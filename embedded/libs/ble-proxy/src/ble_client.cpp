@@ -1,24 +1,60 @@
 /**
  * BLE Client Connection Implementation
  *
- * This module uses a singleton pattern with a global instance pointer for
- * ESP32/NimBLE callback compatibility. The NimBLE library requires C-style
- * callback functions for notifications, which cannot directly call member
- * functions. The static instance pointer allows the static callback wrapper
- * to forward data to the singleton instance.
+ * NimBLE requires C-style callback functions for notifications, which cannot
+ * directly call member functions. Every connection registers itself in a
+ * static table, and the static callback wrapper forwards data to the
+ * connection that owns the notifying characteristic. This keeps the
+ * BoardClient singleton working alongside the fan-out connections.
  */
 
 #include "ble_client.h"
 
 #include <log_buffer.h>
 
+#if defined(ESP_PLATFORM) && !defined(UNIT_TEST)
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/task.h>
+#endif
+
 BLEClientConnection BoardClient;
-BLEClientConnection* BLEClientConnection::instance = nullptr;
+BLEClientConnection* BLEClientConnection::instances[BLE_CLIENT_MAX_INSTANCES] = {};
+ClientWakeCallback BLEClientConnection::wakeCallback = nullptr;
+
+#if defined(ESP_PLATFORM) && !defined(UNIT_TEST)
+// Connections waiting for the connector task
+static QueueHandle_t connectQueue = nullptr;
+#endif
+
+// Link profile parameters, indexed by BLELinkProfile.
+// Supervision timeout must exceed (1 + latency) * interval * 2.
+static const BLELinkParams LINK_PROFILE_PARAMS[BLE_LINK_PROFILE_COUNT] = {
+    {6, 6, 0, 100},   // LOW_LATENCY: 7.5 ms, no peripheral latency, 1 s timeout
+    {48, 48, 4, 300}  // IDLE: 60 ms, board may skip 4 events (300 ms effective), 3 s timeout
+};
 
 BLEClientConnection::BLEClientConnection()
     : pClient(nullptr), pRxChar(nullptr), pTxChar(nullptr), state(BLEClientState::IDLE), targetAddress(),
-      reconnectTime(0), connectCallback(nullptr), dataCallback(nullptr) {
-    instance = this;
+      reconnectTime(0), connectTimeoutMs(CLIENT_CONNECT_TIMEOUT_MS), reconnectDelayMs(CLIENT_RECONNECT_DELAY_MS),
+      linkProfile(BLELinkProfile::LOW_LATENCY), profileSince(0), linkStats(), linkUpdateInFlight(false),
+      inFlightProfile(BLELinkProfile::LOW_LATENCY), requestedProfile(BLELinkProfile::LOW_LATENCY), linkUpdateResult(0),
+      connectCallback(nullptr), dataCallback(nullptr), asyncAttempt(false) {
+    linkStats.profile = linkProfile;
+    for (auto& slot : instances) {
+        if (!slot) {
+            slot = this;
+            break;
+        }
+    }
+}
+
+BLEClientConnection::~BLEClientConnection() {
+    for (auto& slot : instances) {
+        if (slot == this) {
+            slot = nullptr;
+        }
+    }
 }
 
 bool BLEClientConnection::connect(NimBLEAddress address) {
@@ -29,29 +65,98 @@ bool BLEClientConnection::connect(NimBLEAddress address) {
 
     targetAddress = address;
     state = BLEClientState::CONNECTING;
+    prepareClient();
+    return runConnect();
+}
 
+bool BLEClientConnection::connectAsync(NimBLEAddress address) {
+#if defined(ESP_PLATFORM) && !defined(UNIT_TEST)
+    if (state == BLEClientState::CONNECTED || state == BLEClientState::CONNECTING) {
+        return false;
+    }
+
+    if (!connectQueue) {
+        connectQueue = xQueueCreate(BLE_CONNECTOR_QUEUE_SIZE, sizeof(BLEClientConnection*));
+        if (!connectQueue || xTaskCreate(connectorTask, "ble_connect", BLE_CONNECTOR_STACK_SIZE, nullptr,
+                                         BLE_CONNECTOR_PRIORITY, nullptr) != pdPASS) {
+            Logger.logln("BLEClient: Cannot start connector task");
+            return false;
+        }
+    }
+
+    targetAddress = address;
+    prepareClient();
+    asyncAttempt = true;
+    state = BLEClientState::CONNECTING;
+
+    BLEClientConnection* self = this;
+    if (xQueueSend(connectQueue, &self, 0) != pdTRUE) {
+        asyncAttempt = false;
+        state = BLEClientState::DISCONNECTED;
+        return false;
+    }
+    return true;
+#else
+    // Native builds have no host task; the mock connect returns at once
+    asyncAttempt = true;
+    bool started = connect(address);
+    asyncAttempt = false;
+    return started;
+#endif
+}
+
+void BLEClientConnection::connectorTask(void* arg) {
+#if defined(ESP_PLATFORM) && !defined(UNIT_TEST)
+    BLEClientConnection* client;
+    for (;;) {
+        if (xQueueReceive(connectQueue, &client, portMAX_DELAY) != pdTRUE) {
+            continue;
+        }
+        // Cancelled while queued
+        if (client->state == BLEClientState::CONNECTING) {
+            client->runConnect();
+        }
+        client->asyncAttempt = false;
+        wake();
+    }
+#else
+    (void)arg;
+#endif
+}
+
+void BLEClientConnection::prepareClient() {
     // Log address details
-    uint8_t addrType = address.getType();
-    Logger.logln("BLEClient: Target addr: %s", address.toString().c_str());
+    uint8_t addrType = targetAddress.getType();
+    Logger.logln("BLEClient: Target addr: %s", targetAddress.toString().c_str());
     Logger.logln("BLEClient: Addr type: %d (0=pub, 1=rand)", addrType);
 
     // Create client if needed
     if (!pClient) {
         pClient = NimBLEDevice::createClient();
         pClient->setClientCallbacks(this);
-        pClient->setConnectionParams(12, 12, 0, 51);
-        pClient->setConnectTimeout(5);  // 5 seconds - connections should be fast
+        // Connection-update completion only arrives as a raw GAP event
+        NimBLEDevice::setCustomGapHandler(gapEventHandler);
     }
 
+    // Connect with the low-latency profile so service discovery is quick;
+    // the proxy drops to IDLE once the link goes quiet
+    const BLELinkParams& params = LINK_PROFILE_PARAMS[(int)BLELinkProfile::LOW_LATENCY];
+    pClient->setConnectionParams(params.minInterval, params.maxInterval, params.latency, params.supervisionTimeout);
+    pClient->setConnectTimeout((uint8_t)((connectTimeoutMs + 999) / 1000));
+}
+
+bool BLEClientConnection::runConnect() {
     Logger.logln("BLEClient: Calling connect()...");
 
-    // Attempt connection with explicit address type
-    if (!pClient->connect(address, true)) {
+    // Attempt connection with explicit address type; blocks until connected
+    // and set up (onConnect) or failed
+    if (!pClient->connect(targetAddress, true)) {
         Logger.logln("BLEClient: connect() returned false");
-        state = BLEClientState::DISCONNECTED;
-        reconnectTime = millis() + CLIENT_RECONNECT_DELAY_MS;
+        BLEClientState expected = BLEClientState::CONNECTING;
+        state.compare_exchange_strong(expected, BLEClientState::DISCONNECTED);
+        reconnectTime = millis() + reconnectDelayMs;
         // Notify callback of connection failure so proxy can update state
-        if (connectCallback) {
+        if (connectCallback && !asyncAttempt) {
             connectCallback(false);
         }
         return false;
@@ -71,6 +176,8 @@ void BLEClientConnection::disconnect() {
 }
 
 void BLEClientConnection::loop() {
+    pollLinkUpdate();
+
     // Handle reconnection
     if (state == BLEClientState::DISCONNECTED || state == BLEClientState::RECONNECTING) {
         if (reconnectTime > 0 && millis() > reconnectTime) {
@@ -94,14 +201,135 @@ bool BLEClientConnection::send(const uint8_t* data, size_t len) {
         return false;
     }
 
+    // A burst starts on the idle link: ask for the fast profile before the
+    // first write rather than after it
+    if (linkProfile == BLELinkProfile::IDLE || requestedProfile == BLELinkProfile::IDLE) {
+        setLinkProfile(BLELinkProfile::LOW_LATENCY);
+    }
+
     // Write to the RX characteristic (board receives this)
     bool success = pRxChar->writeValue(data, len, false);  // No response needed
     if (!success) {
         Logger.logln("BLEClient: Write failed");
+    } else {
+        linkStats.writesInProfile[(int)linkProfile]++;
+        linkStats.bytesInProfile[(int)linkProfile] += len;
     }
     return success;
 }
 
+bool BLEClientConnection::setLinkProfile(BLELinkProfile profile) {
+    if (!isConnected()) {
+        return profile == linkProfile;
+    }
+
+    requestedProfile = profile;
+    if (linkUpdateInFlight) {
+        // Sent by pollLinkUpdate() once the current update completes
+        return true;
+    }
+    if (profile == linkProfile) {
+        return true;
+    }
+    return requestLinkParams(profile);
+}
+
+bool BLEClientConnection::requestLinkParams(BLELinkProfile profile) {
+    const BLELinkParams& params = LINK_PROFILE_PARAMS[(int)profile];
+    if (!pClient->updateConnParams(params.minInterval, params.maxInterval, params.latency,
+                                   params.supervisionTimeout)) {
+        Logger.logln("BLEClient: Link param update failed");
+        linkStats.paramUpdateFailures++;
+        requestedProfile = linkProfile;
+        return false;
+    }
+
+    linkUpdateInFlight = true;
+    inFlightProfile = profile;
+    return true;
+}
+
+bool BLEClientConnection::isLinkUpdatePending() const {
+    return linkUpdateInFlight;
+}
+
+void BLEClientConnection::pollLinkUpdate() {
+    int result = linkUpdateResult.exchange(0);
+    if (result == 0 || !linkUpdateInFlight) {
+        return;
+    }
+    linkUpdateInFlight = false;
+
+    if (result > 0) {
+        Logger.logln("BLEClient: Link profile -> %s",
+                     inFlightProfile == BLELinkProfile::LOW_LATENCY ? "low-latency" : "idle");
+        enterProfile(inFlightProfile);
+        linkStats.profileSwitches++;
+    } else {
+        Logger.logln("BLEClient: Link param update rejected");
+        linkStats.paramUpdateFailures++;
+        if (requestedProfile == inFlightProfile) {
+            requestedProfile = linkProfile;
+        }
+    }
+
+    if (requestedProfile != linkProfile && isConnected()) {
+        requestLinkParams(requestedProfile);
+    }
+}
+
+void BLEClientConnection::resetLinkUpdate() {
+    linkUpdateInFlight = false;
+    requestedProfile = linkProfile;
+    linkUpdateResult = 0;
+}
+
+BLELinkProfile BLEClientConnection::getLinkProfile() const {
+    return linkProfile;
+}
+
+const BLELinkParams& BLEClientConnection::getLinkParams(BLELinkProfile profile) {
+    return LINK_PROFILE_PARAMS[(int)profile];
+}
+
+BLELinkStats BLEClientConnection::getLinkStats() const {
+    BLELinkStats stats = linkStats;
+    if (isConnected()) {
+        stats.timeInProfileMs[(int)linkProfile] += millis() - profileSince;
+    }
+    return stats;
+}
+
+float BLEClientConnection::getConnectionEventUtilisation(BLELinkProfile profile) const {
+    BLELinkStats stats = getLinkStats();
+    unsigned long timeMs = stats.timeInProfileMs[(int)profile];
+    if (timeMs == 0) {
+        return 0.0f;
+    }
+    // Connection interval in ms (1.25 ms units)
+    float intervalMs = LINK_PROFILE_PARAMS[(int)profile].maxInterval * 1.25f;
+    float events = timeMs / intervalMs;
+    return stats.writesInProfile[(int)profile] / events;
+}
+
+void BLEClientConnection::setConnectTimeout(unsigned long timeoutMs) {
+    connectTimeoutMs = timeoutMs;
+}
+
+void BLEClientConnection::setReconnectDelay(unsigned long delayMs) {
+    reconnectDelayMs = delayMs;
+}
+
+void BLEClientConnection::enterProfile(BLELinkProfile profile) {
+    unsigned long now = millis();
+    if (isConnected()) {
+        linkStats.timeInProfileMs[(int)linkProfile] += now - profileSince;
+    }
+    linkProfile = profile;
+    linkStats.profile = profile;
+    profileSince = now;
+}
+
 String BLEClientConnection::getConnectedAddress() const {
     if (pClient && pClient->isConnected()) {
         return targetAddress.toString().c_str();
@@ -117,14 +345,34 @@ void BLEClientConnection::setDataCallback(ClientDataCallback callback) {
     dataCallback = callback;
 }
 
+void BLEClientConnection::setWakeCallback(ClientWakeCallback callback) {
+    wakeCallback = callback;
+}
+
+void BLEClientConnection::wake() {
+    if (wakeCallback) {
+        wakeCallback();
+    }
+}
+
 void BLEClientConnection::onConnect(NimBLEClient* client) {
     Logger.logln("BLEClient: Connected to board");
 
+    // disconnect() was called while the connector task was connecting
+    if (state == BLEClientState::IDLE) {
+        client->disconnect();
+        return;
+    }
+
     // Set up the service and characteristics
     if (setupService()) {
         state = BLEClientState::CONNECTED;
         reconnectTime = 0;
-        if (connectCallback) {
+        linkProfile = BLELinkProfile::LOW_LATENCY;
+        linkStats.profile = linkProfile;
+        profileSince = millis();
+        resetLinkUpdate();
+        if (connectCallback && !asyncAttempt) {
             connectCallback(true);
         }
     } else {
@@ -136,17 +384,24 @@ void BLEClientConnection::onConnect(NimBLEClient* client) {
 void BLEClientConnection::onDisconnect(NimBLEClient* client) {
     Logger.logln("BLEClient: Disconnected from board");
 
+    // Close out time accounting for the profile that was active
+    if (state == BLEClientState::CONNECTED) {
+        linkStats.timeInProfileMs[(int)linkProfile] += millis() - profileSince;
+    }
+
     pRxChar = nullptr;
     pTxChar = nullptr;
+    resetLinkUpdate();
 
     if (state != BLEClientState::IDLE) {
         state = BLEClientState::DISCONNECTED;
-        reconnectTime = millis() + CLIENT_RECONNECT_DELAY_MS;
+        reconnectTime = millis() + reconnectDelayMs;
     }
 
-    if (connectCallback) {
+    if (connectCallback && !asyncAttempt) {
         connectCallback(false);
     }
+    wake();
 }
 
 bool BLEClientConnection::setupService() {
@@ -187,9 +442,30 @@ bool BLEClientConnection::setupService() {
     return true;
 }
 
+int BLEClientConnection::gapEventHandler(ble_gap_event* event, void* arg) {
+    if (event->type != BLE_GAP_EVENT_CONN_UPDATE) {
+        return 0;
+    }
+    // Runs on the NimBLE host task; the loop applies it in pollLinkUpdate()
+    for (auto* client : instances) {
+        if (client && client->pClient && client->pClient->getConnId() == event->conn_update.conn_handle) {
+            client->linkUpdateResult = event->conn_update.status == 0 ? 1 : -1;
+            wake();
+            break;
+        }
+    }
+    return 0;
+}
+
 void BLEClientConnection::notifyCallback(NimBLERemoteCharacteristic* pChar, uint8_t* pData, size_t length,
                                          bool isNotify) {
-    if (instance && instance->dataCallback) {
-        instance->dataCallback(pData, length);
+    for (auto* client : instances) {
+        if (client && client->pTxChar == pChar) {
+            if (client->dataCallback) {
+                client->dataCallback(pData, length);
+            }
+            wake();
+            return;
+        }
     }
 }
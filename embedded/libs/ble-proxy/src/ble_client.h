@@ -4,19 +4,62 @@
 #include <Arduino.h>
 #include <NimBLEDevice.h>
 
+#include <atomic>
+
 // Nordic UART Service UUIDs
 #define NUS_SERVICE_UUID "6E400001-B5A3-F393-E0A9-E50E24DCCA9E"
 #define NUS_RX_CHARACTERISTIC "6E400002-B5A3-F393-E0A9-E50E24DCCA9E"
 #define NUS_TX_CHARACTERISTIC "6E400003-B5A3-F393-E0A9-E50E24DCCA9E"
 
-// Connection timing
+// Default connection timing (adjustable with setConnectTimeout/setReconnectDelay)
 #define CLIENT_CONNECT_TIMEOUT_MS 5000   // 5 second timeout (connections should be fast)
 #define CLIENT_RECONNECT_DELAY_MS 3000
 
+// Client connections that can route notifications at once (proxy + fan-out)
+#define BLE_CLIENT_MAX_INSTANCES 16
+
+// Connector task for connectAsync(): stack, priority and queued attempts
+#define BLE_CONNECTOR_STACK_SIZE 4096
+#define BLE_CONNECTOR_PRIORITY 1
+#define BLE_CONNECTOR_QUEUE_SIZE 4
+
 enum class BLEClientState { IDLE, CONNECTING, CONNECTED, RECONNECTING, DISCONNECTED };
 
+/**
+ * Link profiles trade latency against radio airtime.
+ * - LOW_LATENCY: 7.5 ms interval, used while a climb is being pushed
+ * - IDLE: long interval plus peripheral latency, leaves airtime for WiFi
+ */
+enum class BLELinkProfile { LOW_LATENCY = 0, IDLE = 1 };
+
+#define BLE_LINK_PROFILE_COUNT 2
+
+/**
+ * Connection parameters in BLE spec units:
+ * intervals in 1.25 ms, supervision timeout in 10 ms.
+ */
+struct BLELinkParams {
+    uint16_t minInterval;
+    uint16_t maxInterval;
+    uint16_t latency;
+    uint16_t supervisionTimeout;
+};
+
+/**
+ * Per-profile link usage, for judging how busy connection events are.
+ */
+struct BLELinkStats {
+    BLELinkProfile profile;
+    uint32_t profileSwitches;      // Confirmed by the controller
+    uint32_t paramUpdateFailures;  // Refused when requested or rejected on completion
+    unsigned long timeInProfileMs[BLE_LINK_PROFILE_COUNT];
+    uint32_t writesInProfile[BLE_LINK_PROFILE_COUNT];
+    uint32_t bytesInProfile[BLE_LINK_PROFILE_COUNT];
+};
+
 typedef void (*ClientConnectCallback)(bool connected);
 typedef void (*ClientDataCallback)(const uint8_t* data, size_t len);
+typedef void (*ClientWakeCallback)();
 
 /**
  * BLEClientConnection connects to an Aurora board and handles Nordic UART communication.
@@ -26,10 +69,12 @@ typedef void (*ClientDataCallback)(const uint8_t* data, size_t len);
  * - Writes to RX characteristic (sends data to board)
  * - Receives from TX characteristic via notify (receives data from board)
  * - Auto-reconnects on connection loss
+ * - Switchable link profiles (connection interval / latency) with usage stats
  */
 class BLEClientConnection : public NimBLEClientCallbacks {
   public:
     BLEClientConnection();
+    ~BLEClientConnection();
 
     /**
      * Connect to a target board by address.
@@ -39,7 +84,18 @@ class BLEClientConnection : public NimBLEClientCallbacks {
     bool connect(NimBLEAddress address);
 
     /**
-     * Disconnect from the current board.
+     * Start connecting without waiting for the result. The NimBLE connect
+     * and service discovery run on a shared connector task, one attempt at
+     * a time; the state stays CONNECTING until it finishes. Poll
+     * getState()/isConnected() for the outcome; the connect callback is
+     * not called for these attempts. Native builds connect synchronously.
+     * @return true if the attempt was started
+     */
+    bool connectAsync(NimBLEAddress address);
+
+    /**
+     * Disconnect from the current board. Cancels an attempt still running
+     * on the connector task: the link is dropped as soon as it comes up.
      */
     void disconnect();
 
@@ -71,6 +127,60 @@ class BLEClientConnection : public NimBLEClientCallbacks {
      */
     String getConnectedAddress() const;
 
+    /**
+     * Switch link profile. Requests a connection-parameter update; the
+     * profile (and its stats) change once the controller reports the update
+     * complete, see pollLinkUpdate(). A request made while another update
+     * is in flight is sent when that one finishes. A new connection always
+     * starts in LOW_LATENCY for fast service discovery.
+     * @return true if the profile is active or the update was requested
+     */
+    bool setLinkProfile(BLELinkProfile profile);
+
+    /**
+     * Get the active (confirmed) link profile.
+     */
+    BLELinkProfile getLinkProfile() const;
+
+    /**
+     * Check whether a connection-parameter update is waiting for completion.
+     */
+    bool isLinkUpdatePending() const;
+
+    /**
+     * Apply a completed connection-parameter update and send any request
+     * that was held back meanwhile. loop() calls this; callers that do not
+     * run loop() (fan-out links) call it directly.
+     */
+    void pollLinkUpdate();
+
+    /**
+     * Get the connection parameters used for a profile.
+     */
+    static const BLELinkParams& getLinkParams(BLELinkProfile profile);
+
+    /**
+     * Get link usage statistics, including time in the current profile.
+     */
+    BLELinkStats getLinkStats() const;
+
+    /**
+     * Estimate the fraction of connection events in a profile that carried a
+     * write (writes / elapsed connection events). Values above 1.0 mean
+     * several writes were packed into one event.
+     */
+    float getConnectionEventUtilisation(BLELinkProfile profile) const;
+
+    /**
+     * Set the connect timeout (rounded up to whole seconds for NimBLE).
+     */
+    void setConnectTimeout(unsigned long timeoutMs);
+
+    /**
+     * Set the delay before an automatic reconnect attempt.
+     */
+    void setReconnectDelay(unsigned long delayMs);
+
     /**
      * Set callback for connection state changes.
      */
@@ -81,6 +191,14 @@ class BLEClientConnection : public NimBLEClientCallbacks {
      */
     void setDataCallback(ClientDataCallback callback);
 
+    /**
+     * Set a callback shared by every connection, called from the NimBLE host
+     * and connector tasks when a notification, disconnect, finished connect
+     * attempt or link update leaves work for loop(). Must be safe to call
+     * from another task.
+     */
+    static void setWakeCallback(ClientWakeCallback callback);
+
     // NimBLE client callbacks
     void onConnect(NimBLEClient* pClient) override;
     void onDisconnect(NimBLEClient* pClient) override;
@@ -90,16 +208,40 @@ class BLEClientConnection : public NimBLEClientCallbacks {
     NimBLERemoteCharacteristic* pRxChar;  // We write to this
     NimBLERemoteCharacteristic* pTxChar;  // We receive from this
 
-    BLEClientState state;
+    // Written by the connector task during connectAsync() attempts
+    std::atomic<BLEClientState> state;
     NimBLEAddress targetAddress;
     unsigned long reconnectTime;
+    unsigned long connectTimeoutMs;
+    unsigned long reconnectDelayMs;
+
+    BLELinkProfile linkProfile;
+    unsigned long profileSince;
+    BLELinkStats linkStats;
+
+    // Connection-parameter update in flight, and the profile wanted next
+    bool linkUpdateInFlight;
+    BLELinkProfile inFlightProfile;
+    BLELinkProfile requestedProfile;
+    // Completion status from the GAP event (host task): 0 none, 1 done, -1 rejected
+    std::atomic<int> linkUpdateResult;
 
     ClientConnectCallback connectCallback;
     ClientDataCallback dataCallback;
+    std::atomic<bool> asyncAttempt;  // Suppresses connectCallback while the connector task runs the attempt
 
+    void prepareClient();
+    bool runConnect();
     bool setupService();
+    void enterProfile(BLELinkProfile profile);
+    bool requestLinkParams(BLELinkProfile profile);
+    void resetLinkUpdate();
+    static int gapEventHandler(ble_gap_event* event, void* arg);
+    static void connectorTask(void* arg);
     static void notifyCallback(NimBLERemoteCharacteristic* pChar, uint8_t* pData, size_t length, bool isNotify);
-    static BLEClientConnection* instance;
+    static BLEClientConnection* instances[BLE_CLIENT_MAX_INSTANCES];
+    static ClientWakeCallback wakeCallback;
+    static void wake();
 };
 
 extern BLEClientConnection BoardClient;
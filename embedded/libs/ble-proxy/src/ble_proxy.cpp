@@ -12,12 +12,23 @@
 #include <config_manager.h>
 #include <log_buffer.h>
 #include <nordic_uart_ble.h>
+#include <radio_coex.h>
 
 BLEProxy Proxy;
 
 // Delay before retrying scan when no boards found (10 seconds)
 static const unsigned long SCAN_RETRY_DELAY_MS = 10000;
 
+// How long RECONNECTING waits for the lost board to advertise again before
+// falling back to a full discovery scan
+static const unsigned long RECONNECT_FALLBACK_MS = 30000;
+
+// Drop the board link to the idle profile after this long without writes
+static const unsigned long LINK_IDLE_AFTER_MS = 2000;
+
+// Settling time after stopping a scan before NimBLE can initiate a connection
+static const unsigned long SCAN_RELEASE_MS = 100;
+
 // Static instance pointer for callbacks (required for C-style callback wrappers)
 static BLEProxy* proxyInstance = nullptr;
 
@@ -48,7 +59,8 @@ static void onBoardFoundStatic(const DiscoveredBoard& board) {
 
 BLEProxy::BLEProxy()
     : state(BLEProxyState::PROXY_DISABLED), enabled(false), scanStartTime(0), reconnectDelay(5000),
-      waitStartTime(0), waitDuration(0),
+      waitStartTime(0), waitDuration(0), reconnectPending(false), disconnectTime(0),
+      boardLostTime(0), lastReconnectDuration(0), lastBoardWriteTime(0), scanStoppedTime(0),
       stateCallback(nullptr), dataCallback(nullptr), sendToAppCallback(nullptr) {
     proxyInstance = this;
 }
@@ -56,6 +68,27 @@ BLEProxy::BLEProxy()
 void BLEProxy::begin(const String& mac) {
     targetMac = mac;
 
+    // A comma-separated list selects fan-out mode
+    fanoutMacs.clear();
+    if (mac.indexOf(',') >= 0) {
+        int start = 0;
+        while (start <= (int)mac.length()) {
+            int comma = mac.indexOf(',', start);
+            int end = comma < 0 ? mac.length() : comma;
+            String entry = mac.substring(start, end);
+            entry.trim();
+            if (entry.length() > 0) {
+                fanoutMacs.push_back(entry);
+            }
+            if (comma < 0) {
+                break;
+            }
+            start = comma + 1;
+        }
+        Logger.logln("BLEProxy: Fan-out to %d boards", (int)fanoutMacs.size());
+        Fanout.setDataCallback(onBoardDataStatic);
+    }
+
     // Load enabled state from config
     enabled = Config.getBool("proxy_en", false);
 
@@ -88,7 +121,9 @@ void BLEProxy::setEnabled(bool enable) {
     } else {
         Logger.logln("BLEProxy: Disabling proxy mode");
         BoardClient.disconnect();
+        Fanout.clear();
         Scanner.stopScan();
+        reconnectPending = false;
         // Reset connection flag when disabling
         connectionInitiated = false;
         setState(BLEProxyState::PROXY_DISABLED);
@@ -103,10 +138,20 @@ void BLEProxy::loop() {
     if (!enabled)
         return;
 
+    Scanner.loop();
+
+    if (isFanoutMode()) {
+        loopFanout();
+        return;
+    }
+
     switch (state) {
         case BLEProxyState::IDLE:
-            // Start scanning for boards
-            startScan();
+            // Connect to a recently seen board if we have one, otherwise scan
+            // once the radio is not busy with a WebSocket transfer
+            if (!connectFromCache() && Coex.requestScan()) {
+                startScan();
+            }
             break;
 
         case BLEProxyState::SCAN_COMPLETE_NONE:
@@ -167,10 +212,33 @@ void BLEProxy::loop() {
 
         case BLEProxyState::CONNECTED:
             BoardClient.loop();
+            // Transfer finished - give the airtime back to WiFi
+            if (BoardClient.getLinkProfile() == BLELinkProfile::LOW_LATENCY &&
+                millis() - lastBoardWriteTime >= LINK_IDLE_AFTER_MS) {
+                BoardClient.setLinkProfile(BLELinkProfile::IDLE);
+            }
+            // The live link gets the radio; RECONNECTING scans again
+            if (Scanner.isPassiveScanning()) {
+                Scanner.stopScan();
+            }
             break;
 
         case BLEProxyState::RECONNECTING:
-            BoardClient.loop();
+            // Reconnect as soon as the lost board advertises again (it only
+            // advertises once it has rebooted and is accepting connections)
+            if (Scanner.getBoardCache().seenSince(pendingConnectAddress, disconnectTime)) {
+                const CachedBoard* board = Scanner.getBoardCache().find(pendingConnectAddress);
+                Logger.logln("BLEProxy: %s is advertising again, reconnecting", board->name.c_str());
+                connectionInitiated = true;
+                scheduleConnect(board->address, board->name);
+            } else if (millis() - disconnectTime >= RECONNECT_FALLBACK_MS) {
+                Logger.logln("BLEProxy: Board not seen for %lus, rescanning", RECONNECT_FALLBACK_MS / 1000);
+                Scanner.stopScan();
+                connectionInitiated = false;
+                setState(BLEProxyState::IDLE);
+            } else {
+                runPassiveScan();
+            }
             break;
 
         default:
@@ -183,13 +251,36 @@ BLEProxyState BLEProxy::getState() const {
 }
 
 bool BLEProxy::isConnectedToBoard() const {
+    if (isFanoutMode()) {
+        return state == BLEProxyState::CONNECTED && Fanout.getConnectedCount() > 0;
+    }
     return state == BLEProxyState::CONNECTED && BoardClient.isConnected();
 }
 
 String BLEProxy::getConnectedBoardAddress() const {
+    if (isFanoutMode()) {
+        for (int i = 0; i < BLE_FANOUT_MAX_BOARDS; i++) {
+            if (Fanout.isBoardConnected(i)) {
+                return Fanout.getBoardAddress(i).toString().c_str();
+            }
+        }
+        return "";
+    }
     return BoardClient.getConnectedAddress();
 }
 
+unsigned long BLEProxy::getLastReconnectDuration() const {
+    return lastReconnectDuration;
+}
+
+BLELinkStats BLEProxy::getLinkStats() const {
+    return BoardClient.getLinkStats();
+}
+
+float BLEProxy::getConnectionEventUtilisation(BLELinkProfile profile) const {
+    return BoardClient.getConnectionEventUtilisation(profile);
+}
+
 void BLEProxy::setStateCallback(ProxyStateCallback callback) {
     stateCallback = callback;
 }
@@ -211,9 +302,48 @@ bool BLEProxy::forwardToBoard(const uint8_t* data, size_t len) {
         dataCallback(data, len, true);  // fromApp = true
     }
 
+    noteBoardWrite();
+
+    if (isFanoutMode()) {
+        return Fanout.forward(data, len) > 0;
+    }
     return BoardClient.send(data, len);
 }
 
+bool BLEProxy::isFanoutMode() const {
+    return !fanoutMacs.empty();
+}
+
+bool BLEProxy::sendPacketsToBoards(const std::vector<std::vector<uint8_t>>& packets) {
+    if (!isFanoutMode() || !isConnectedToBoard()) {
+        return false;
+    }
+
+    if (dataCallback) {
+        for (const auto& packet : packets) {
+            dataCallback(packet.data(), packet.size(), true);  // fromApp = true
+        }
+    }
+
+    noteBoardWrite();
+    return Fanout.sendPackets(packets) > 0;
+}
+
+void BLEProxy::noteBoardWrite() {
+    // Start of a transfer: shorten the connection interval for the burst
+    lastBoardWriteTime = millis();
+    if (isFanoutMode()) {
+        for (int i = 0; i < BLE_FANOUT_MAX_BOARDS; i++) {
+            if (Fanout.isBoardConnected(i)) {
+                Fanout.getClient(i).setLinkProfile(BLELinkProfile::LOW_LATENCY);
+            }
+        }
+    } else {
+        BoardClient.setLinkProfile(BLELinkProfile::LOW_LATENCY);
+    }
+    Coex.noteActivity(CoexActivity::BLE_TRANSFER);
+}
+
 void BLEProxy::forwardToApp(const uint8_t* data, size_t len) {
     if (dataCallback) {
         dataCallback(data, len, false);  // fromApp = false
@@ -235,7 +365,127 @@ void BLEProxy::setState(BLEProxyState newState) {
     }
 }
 
+bool BLEProxy::connectFromCache() {
+    const BoardCache& cache = Scanner.getBoardCache();
+    unsigned long now = millis();
+    const CachedBoard* board = nullptr;
+
+    if (targetMac.length() > 0) {
+        board = cache.findByMac(targetMac);
+        if (board && now - board->lastSeenMs > BOARD_CACHE_FRESH_MS) {
+            board = nullptr;
+        }
+    } else {
+        board = cache.getBest(now);
+    }
+
+    if (!board || connectionInitiated.exchange(true)) {
+        return false;
+    }
+
+    Logger.logln("BLEProxy: Using cached board %s (%s, %.0f dBm, seen %lums ago)", board->name.c_str(),
+                 board->address.toString().c_str(), board->smoothedRssi, now - board->lastSeenMs);
+    scheduleConnect(board->address, board->name);
+    return true;
+}
+
+void BLEProxy::scheduleConnect(const NimBLEAddress& address, const String& name) {
+    pendingConnectAddress = address;
+    pendingConnectName = name;
+
+    // NimBLE cannot initiate a connection while scanning. Stop first and give
+    // the controller a moment to release scan resources, as after discovery.
+    Scanner.stopScan();
+    waitStartTime = millis();
+    waitDuration = 100;
+    setState(BLEProxyState::WAIT_BEFORE_CONNECT);
+}
+
+void BLEProxy::runPassiveScan() {
+    // Background scanning is optional; yield the radio to active transfers
+    if (Coex.mayScan()) {
+        Scanner.startPassiveScan();
+    } else if (Scanner.isPassiveScanning()) {
+        Scanner.stopScan();
+    }
+}
+
+void BLEProxy::loopFanout() {
+    unsigned long now = millis();
+
+    // Boards are added once seen, so the address carries its advertised type
+    const BoardCache& cache = Scanner.getBoardCache();
+    for (const auto& mac : fanoutMacs) {
+        const CachedBoard* board = cache.findByMac(mac);
+        if (board && Fanout.findBoard(board->address) < 0) {
+            Fanout.addBoard(board->address);
+        }
+    }
+
+    // NimBLE cannot connect while scanning: stop and let the scan release
+    bool pendingConnect = Fanout.hasPendingConnect();
+    if (pendingConnect && Scanner.isScanning()) {
+        Scanner.stopScan();
+        scanStoppedTime = now;
+    }
+    bool scanReleased = !Scanner.isScanning() && now - scanStoppedTime >= SCAN_RELEASE_MS;
+    Fanout.loop(pendingConnect && scanReleased);
+
+    // Scan only while a listed board is still missing
+    if (!pendingConnect && Fanout.getConnectedCount() < (int)fanoutMacs.size()) {
+        runPassiveScan();
+    } else if (!pendingConnect && Scanner.isPassiveScanning()) {
+        Scanner.stopScan();
+    }
+
+    // Transfer finished on every board - give the airtime back to WiFi
+    if (now - lastBoardWriteTime >= LINK_IDLE_AFTER_MS) {
+        for (int i = 0; i < BLE_FANOUT_MAX_BOARDS; i++) {
+            if (Fanout.isBoardConnected(i) && Fanout.getQueueDepth(i) == 0 &&
+                Fanout.getClient(i).getLinkProfile() == BLELinkProfile::LOW_LATENCY) {
+                Fanout.getClient(i).setLinkProfile(BLELinkProfile::IDLE);
+            }
+        }
+    }
+
+    bool anyConnected = Fanout.getConnectedCount() > 0;
+    switch (state) {
+        case BLEProxyState::WAIT_BEFORE_ADVERTISE:
+            if (!anyConnected) {
+                setState(BLEProxyState::RECONNECTING);
+            } else if (now - waitStartTime >= waitDuration) {
+                Logger.logln("BLEProxy: Starting BLE advertising");
+                BLE.startAdvertising();
+                setState(BLEProxyState::CONNECTED);
+            }
+            break;
+
+        case BLEProxyState::CONNECTED:
+            if (!anyConnected) {
+                Logger.logln("BLEProxy: All fan-out boards disconnected");
+                setState(BLEProxyState::RECONNECTING);
+            }
+            break;
+
+        default:
+            if (anyConnected) {
+                // Same stabilisation delay as single-board mode before advertising
+                waitStartTime = now;
+                waitDuration = 200;
+                setState(BLEProxyState::WAIT_BEFORE_ADVERTISE);
+            } else if (Fanout.isConnecting()) {
+                setState(BLEProxyState::CONNECTING);
+            } else if (state == BLEProxyState::CONNECTING) {
+                setState(BLEProxyState::RECONNECTING);
+            }
+            break;
+    }
+}
+
 void BLEProxy::startScan() {
+    // A passive background scan may still be running from RECONNECTING
+    Scanner.stopScan();
+
     setState(BLEProxyState::SCANNING);
     scanStartTime = millis();
 
@@ -321,6 +571,13 @@ void BLEProxy::handleScanComplete(const std::vector<DiscoveredBoard>& boards) {
 void BLEProxy::handleBoardConnected(bool connected) {
     if (connected) {
         Logger.logln("BLEProxy: Connected to board!");
+        lastBoardWriteTime = millis();
+
+        if (reconnectPending) {
+            lastReconnectDuration = millis() - boardLostTime;
+            reconnectPending = false;
+            Logger.logln("BLEProxy: Reconnected in %lums", lastReconnectDuration);
+        }
 
         // Now that we're connected to the real board, start advertising
         // so phone apps can connect to us. Use non-blocking wait to allow
@@ -336,6 +593,15 @@ void BLEProxy::handleBoardConnected(bool connected) {
         // Reset connection flag so next scan can initiate a new connection
         connectionInitiated = false;
 
+        // Only advertisements after this point count as "board is back". A
+        // failed attempt restarts the clock so we wait for a fresh sighting.
+        disconnectTime = millis();
+        bool linkWasUp = state == BLEProxyState::CONNECTED || state == BLEProxyState::WAIT_BEFORE_ADVERTISE;
+        if (linkWasUp && !reconnectPending) {
+            reconnectPending = true;
+            boardLostTime = disconnectTime;
+        }
+
         setState(BLEProxyState::RECONNECTING);
     }
 }
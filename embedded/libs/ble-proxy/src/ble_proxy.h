@@ -1,6 +1,7 @@
 #ifndef BLE_PROXY_H
 #define BLE_PROXY_H
 
+#include "ble_board_fanout.h"
 #include "ble_client.h"
 #include "ble_scanner.h"
 
@@ -37,6 +38,22 @@ typedef void (*ProxySendToAppCallback)(const uint8_t* data, size_t len);
  *                                     ↑            ↓
  *                                     └── RECONNECTING ←┘
  *
+ * While reconnecting, a low duty-cycle passive scan keeps the scanner's
+ * board cache fresh; it stops once connected so the live link keeps the
+ * radio. IDLE connects straight to a recently seen
+ * board from the cache, and RECONNECTING reconnects as soon as the lost
+ * board advertises again, instead of waiting for a full discovery scan.
+ *
+ * The board link runs in the low-latency profile while data is being
+ * forwarded and drops to the idle profile after LINK_IDLE_AFTER_MS of
+ * silence, freeing airtime for WiFi.
+ *
+ * Fan-out mode: when the target MAC setting lists several comma-separated
+ * addresses, the proxy drives every listed board through BLEBoardFanout
+ * instead of BoardClient. Boards are resolved from the passive-scan cache
+ * and reconnect independently; the proxy counts as connected while at
+ * least one board is up.
+ *
  * Usage:
  * 1. Call begin() with a target MAC or empty string for auto-detect
  * 2. Call loop() regularly to process state
@@ -49,7 +66,8 @@ class BLEProxy {
 
     /**
      * Initialize the proxy.
-     * @param targetMac Optional MAC address of target board (empty for auto-detect)
+     * @param targetMac Optional MAC address of target board (empty for auto-detect),
+     *        or a comma-separated list of boards for fan-out mode
      */
     void begin(const String& targetMac = "");
 
@@ -83,6 +101,22 @@ class BLEProxy {
      */
     String getConnectedBoardAddress() const;
 
+    /**
+     * Get how long the most recent reconnect took (disconnect → connected).
+     * @return Duration in milliseconds, or 0 if no reconnect has happened
+     */
+    unsigned long getLastReconnectDuration() const;
+
+    /**
+     * Get board link usage statistics (per link profile).
+     */
+    BLELinkStats getLinkStats() const;
+
+    /**
+     * Get the estimated fraction of connection events used for writes.
+     */
+    float getConnectionEventUtilisation(BLELinkProfile profile) const;
+
     /**
      * Set callback for state changes.
      */
@@ -110,6 +144,18 @@ class BLEProxy {
      */
     bool forwardToBoard(const uint8_t* data, size_t len);
 
+    /**
+     * Check whether the proxy relays to several boards.
+     */
+    bool isFanoutMode() const;
+
+    /**
+     * Queue a complete Aurora packet set for every connected board
+     * (fan-out mode only; the packets are chunked per board).
+     * @return true if at least one board will receive it
+     */
+    bool sendPacketsToBoards(const std::vector<std::vector<uint8_t>>& packets);
+
     /**
      * Forward data from board to app.
      * This is called internally when board sends data.
@@ -137,6 +183,19 @@ class BLEProxy {
     NimBLEAddress pendingConnectAddress;
     String pendingConnectName;
 
+    // Reconnect bookkeeping (pendingConnectAddress is the board to recover)
+    bool reconnectPending;
+    unsigned long disconnectTime;  // Last disconnect or failed attempt
+    unsigned long boardLostTime;   // When the established link dropped
+    unsigned long lastReconnectDuration;
+
+    // Time of the last write to the board, for link profile switching
+    unsigned long lastBoardWriteTime;
+
+    // Fan-out mode: configured board MACs and when the last scan was stopped
+    std::vector<String> fanoutMacs;
+    unsigned long scanStoppedTime;
+
     ProxyStateCallback stateCallback;
     ProxyDataCallback dataCallback;
     ProxySendToAppCallback sendToAppCallback;
@@ -148,6 +207,11 @@ class BLEProxy {
 
     void setState(BLEProxyState newState);
     void startScan();
+    void runPassiveScan();
+    bool connectFromCache();
+    void scheduleConnect(const NimBLEAddress& address, const String& name);
+    void loopFanout();
+    void noteBoardWrite();
 };
 
 extern BLEProxy Proxy;
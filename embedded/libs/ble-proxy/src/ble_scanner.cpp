@@ -11,11 +11,23 @@
 #include "ble_scanner.h"
 
 #include <log_buffer.h>
+#include <radio_coex.h>
+
+#if defined(ESP_PLATFORM) && !defined(UNIT_TEST)
+static portMUX_TYPE scannerLock = portMUX_INITIALIZER_UNLOCKED;
+#define SCANNER_LOCK() portENTER_CRITICAL(&scannerLock)
+#define SCANNER_UNLOCK() portEXIT_CRITICAL(&scannerLock)
+#else
+#define SCANNER_LOCK()
+#define SCANNER_UNLOCK()
+#endif
 
 BLEScanner Scanner;
 BLEScanner* BLEScanner::instance = nullptr;
 
-BLEScanner::BLEScanner() : pScan(nullptr), resultCallback(nullptr), completeCallback(nullptr), scanning(false) {
+BLEScanner::BLEScanner()
+    : pScan(nullptr), resultCallback(nullptr), completeCallback(nullptr), wakeCallback(nullptr), scanning(false),
+      passive(false), advertHead(0), advertCount(0), scanEnded(false) {
     instance = this;
 }
 
@@ -39,28 +51,105 @@ void BLEScanner::startScan(ScanResultCallback onResult, ScanCompleteCallback onC
     pScan->setAdvertisedDeviceCallbacks(this);
     pScan->setActiveScan(true);
     pScan->setInterval(100);
-    pScan->setWindow(99);
+    // Leave WiFi part of each interval while the backend link is up
+    pScan->setWindow(Coex.getScanWindow(100));
     pScan->setMaxResults(0);  // Don't store in NimBLE, we store ourselves
+    pScan->setDuplicateFilter(true);
 
     Logger.logln("BLEScanner: Starting scan for Aurora boards (%d sec)", timeoutSec);
     scanning = true;
+    passive = false;
+    scanEnded = false;  // A completion not yet seen by loop() belongs to the old scan
+    Coex.beginActivity(CoexActivity::BLE_SCAN);
 
     // Start scan with callback
     pScan->start(timeoutSec, scanCompleteCB, false);
 }
 
+void BLEScanner::startPassiveScan(uint16_t intervalMs, uint16_t windowMs) {
+    if (scanning) {
+        return;
+    }
+
+    if (!NimBLEDevice::getInitialized()) {
+        return;
+    }
+
+    resultCallback = nullptr;
+    completeCallback = nullptr;
+
+    pScan = NimBLEDevice::getScan();
+    pScan->setAdvertisedDeviceCallbacks(this, true);
+    pScan->setActiveScan(false);        // No scan requests - adverts carry the service UUID
+    pScan->setInterval(intervalMs);
+    pScan->setWindow(windowMs);
+    pScan->setMaxResults(0);
+    pScan->setDuplicateFilter(false);   // Every advert refreshes RSSI and last-seen
+
+    Logger.logln("BLEScanner: Starting passive scan (%u/%u ms)", intervalMs, windowMs);
+    scanning = true;
+    passive = true;
+    scanEnded = false;
+    Coex.beginActivity(CoexActivity::BLE_SCAN);
+
+    // Duration 0 = scan until stopped; no completion callback
+    pScan->start(0, nullptr, false);
+}
+
 void BLEScanner::stopScan() {
     if (scanning && pScan) {
-        Logger.logln("BLEScanner: Stopping scan");
+        Logger.logln("BLEScanner: Stopping %s scan", passive ? "passive" : "discovery");
         pScan->stop();
         scanning = false;
+        passive = false;
+        scanEnded = false;
+        Coex.endActivity(CoexActivity::BLE_SCAN);
     }
 }
 
+void BLEScanner::loop() {
+    if (scanEnded.exchange(false)) {
+        Coex.endActivity(CoexActivity::BLE_SCAN);
+    }
+
+    PendingAdvert advert;
+    for (;;) {
+        SCANNER_LOCK();
+        bool available = advertCount > 0;
+        if (available) {
+            advert = adverts[advertHead];
+            advertHead = (advertHead + 1) % SCANNER_ADVERT_QUEUE_SIZE;
+            advertCount--;
+        }
+        SCANNER_UNLOCK();
+        if (!available) {
+            return;
+        }
+
+        const CachedBoard& cached = boardCache.update(advert.address, String(advert.name), advert.rssi, advert.seenMs);
+        if (cached.seenCount == 1) {
+            Logger.logln("BLEScanner: Cached Aurora board: %s (%s, %d dBm)", cached.name.c_str(),
+                         cached.address.toString().c_str(), cached.lastRssi);
+        }
+    }
+}
+
+void BLEScanner::setWakeCallback(ScanWakeCallback callback) {
+    wakeCallback = callback;
+}
+
 bool BLEScanner::isScanning() const {
     return scanning;
 }
 
+bool BLEScanner::isPassiveScanning() const {
+    return scanning && passive;
+}
+
+const BoardCache& BLEScanner::getBoardCache() const {
+    return boardCache;
+}
+
 const std::vector<DiscoveredBoard>& BLEScanner::getDiscoveredBoards() const {
     return discoveredBoards;
 }
@@ -94,23 +183,48 @@ void BLEScanner::onResult(NimBLEAdvertisedDevice* advertisedDevice) {
         return;
     }
 
+    // Every advert (discovery or passive) refreshes the cache, on the loop task
+    std::string advName = advertisedDevice->getName();
+    int rssi = advertisedDevice->getRSSI();
+    SCANNER_LOCK();
+    if (advertCount == SCANNER_ADVERT_QUEUE_SIZE) {
+        advertHead = (advertHead + 1) % SCANNER_ADVERT_QUEUE_SIZE;
+        advertCount--;
+    }
+    PendingAdvert& slot = adverts[(advertHead + advertCount) % SCANNER_ADVERT_QUEUE_SIZE];
+    slot.address = advertisedDevice->getAddress();
+    strncpy(slot.name, advName.c_str(), SCANNER_ADVERT_NAME_SIZE - 1);
+    slot.name[SCANNER_ADVERT_NAME_SIZE - 1] = '\0';
+    slot.rssi = rssi;
+    slot.seenMs = millis();
+    advertCount++;
+    SCANNER_UNLOCK();
+
+    if (wakeCallback) {
+        wakeCallback();
+    }
+
+    if (passive) {
+        return;
+    }
+
     // Check if we already found this board
-    for (const auto& board : discoveredBoards) {
+    for (auto& board : discoveredBoards) {
         if (board.address == advertisedDevice->getAddress()) {
+            board.rssi = rssi;
             return;  // Already in list
         }
     }
 
-    String name = advertisedDevice->getName().c_str();
+    String name = advName.c_str();
     if (name.length() == 0) {
         name = "Unknown Board";
     }
-
-    DiscoveredBoard board(advertisedDevice->getAddress(), name, advertisedDevice->getRSSI());
+    DiscoveredBoard board(advertisedDevice->getAddress(), name, rssi);
 
     discoveredBoards.push_back(board);
     Logger.logln("BLEScanner: Found Aurora board: %s (%s, %d dBm)", name.c_str(),
-                 advertisedDevice->getAddress().toString().c_str(), advertisedDevice->getRSSI());
+                 advertisedDevice->getAddress().toString().c_str(), rssi);
 
     if (resultCallback) {
         resultCallback(board);
@@ -126,6 +240,9 @@ void BLEScanner::scanCompleteCB(NimBLEScanResults results) {
             instance->pScan->clearResults();
         }
         instance->scanning = false;
+        instance->passive = false;
+        // Coex state belongs to the loop task
+        instance->scanEnded = true;
 
         // Note: The BLE proxy handles settling time via its WAIT_BEFORE_CONNECT
         // state, using a non-blocking timer. This avoids blocking the callback
@@ -136,5 +253,8 @@ void BLEScanner::scanCompleteCB(NimBLEScanResults results) {
         if (instance->completeCallback) {
             instance->completeCallback(instance->discoveredBoards);
         }
+        if (instance->wakeCallback) {
+            instance->wakeCallback();
+        }
     }
 }
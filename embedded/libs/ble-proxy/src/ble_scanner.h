@@ -1,9 +1,12 @@
 #ifndef BLE_SCANNER_H
 #define BLE_SCANNER_H
 
+#include "ble_board_cache.h"
+
 #include <Arduino.h>
 #include <NimBLEDevice.h>
 
+#include <atomic>
 #include <vector>
 
 // Aurora boards advertise this service UUID for discovery
@@ -12,6 +15,16 @@
 // Scan timeout in seconds
 #define SCAN_TIMEOUT_SEC 30
 
+// Background passive scan timing (~15% duty cycle). Short enough to notice a
+// board coming back within a second, sparse enough to leave airtime for WiFi.
+#define PASSIVE_SCAN_INTERVAL_MS 320
+#define PASSIVE_SCAN_WINDOW_MS 48
+
+// Adverts received on the NimBLE host task, waiting for loop() to fold them
+// into the board cache; when full the oldest is dropped
+#define SCANNER_ADVERT_QUEUE_SIZE 16
+#define SCANNER_ADVERT_NAME_SIZE 24
+
 /**
  * Information about a discovered Aurora board
  */
@@ -27,6 +40,7 @@ struct DiscoveredBoard {
 
 typedef void (*ScanResultCallback)(const DiscoveredBoard& board);
 typedef void (*ScanCompleteCallback)(const std::vector<DiscoveredBoard>& boards);
+typedef void (*ScanWakeCallback)();
 
 /**
  * BLEScanner searches for nearby Aurora climbing boards.
@@ -36,6 +50,13 @@ typedef void (*ScanCompleteCallback)(const std::vector<DiscoveredBoard>& boards)
  * - Returns RSSI for signal strength indication
  * - 30 second scan timeout
  * - Callback when scan completes
+ * - Low duty-cycle passive background scan that keeps an RSSI-smoothed
+ *   cache of every board seen, so reconnects can skip a full scan
+ *
+ * Adverts arrive on the NimBLE host task. The board cache belongs to the
+ * loop task: onResult() only copies each advert into a small locked queue,
+ * and loop() moves them into the cache. Likewise a scan that times out
+ * only flags it, and loop() ends the scan's coex activity.
  */
 class BLEScanner : public NimBLEAdvertisedDeviceCallbacks {
   public:
@@ -51,7 +72,28 @@ class BLEScanner : public NimBLEAdvertisedDeviceCallbacks {
                    int timeoutSec = SCAN_TIMEOUT_SEC);
 
     /**
-     * Stop an ongoing scan.
+     * Start a continuous passive scan that only refreshes the board cache.
+     * No result/complete callbacks are invoked. Stop it with stopScan().
+     * @param intervalMs Scan interval in milliseconds
+     * @param windowMs Scan window in milliseconds (<= intervalMs)
+     */
+    void startPassiveScan(uint16_t intervalMs = PASSIVE_SCAN_INTERVAL_MS, uint16_t windowMs = PASSIVE_SCAN_WINDOW_MS);
+
+    /**
+     * Fold queued adverts into the board cache and report finished scans
+     * to the coex scheduler. Call from the loop task before reading
+     * getBoardCache().
+     */
+    void loop();
+
+    /**
+     * Set a callback run on the NimBLE host task when an advert is queued or
+     * a scan ends, so the owner can call loop() without waiting to poll.
+     */
+    void setWakeCallback(ScanWakeCallback callback);
+
+    /**
+     * Stop an ongoing scan (discovery or passive).
      */
     void stopScan();
 
@@ -60,6 +102,16 @@ class BLEScanner : public NimBLEAdvertisedDeviceCallbacks {
      */
     bool isScanning() const;
 
+    /**
+     * Check if the current scan is the passive background scan.
+     */
+    bool isPassiveScanning() const;
+
+    /**
+     * Get the cache of every board seen by any scan (loop task only).
+     */
+    const BoardCache& getBoardCache() const;
+
     /**
      * Get the list of discovered boards from last scan.
      */
@@ -82,11 +134,29 @@ class BLEScanner : public NimBLEAdvertisedDeviceCallbacks {
     void onResult(NimBLEAdvertisedDevice* advertisedDevice) override;
 
   private:
+    struct PendingAdvert {
+        NimBLEAddress address;
+        char name[SCANNER_ADVERT_NAME_SIZE];
+        int rssi;
+        unsigned long seenMs;
+    };
+
     NimBLEScan* pScan;
     std::vector<DiscoveredBoard> discoveredBoards;
+    BoardCache boardCache;
     ScanResultCallback resultCallback;
     ScanCompleteCallback completeCallback;
+    ScanWakeCallback wakeCallback;
     bool scanning;
+    bool passive;
+
+    // Guarded by the scanner lock (written on the host task)
+    PendingAdvert adverts[SCANNER_ADVERT_QUEUE_SIZE];
+    int advertHead;
+    int advertCount;
+
+    // Set by scanCompleteCB (host task); loop() ends the coex activity
+    std::atomic<bool> scanEnded;
 
     static void scanCompleteCB(NimBLEScanResults results);
     static BLEScanner* instance;
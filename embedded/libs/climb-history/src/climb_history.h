@@ -3,14 +3,21 @@
 
 #include <Arduino.h>
 
-// Maximum number of climbs to track in history
-#define MAX_CLIMB_HISTORY 5
+// Number of climbs kept in history (RAM and NVS). Each climb is one
+// fixed-size NVS record, so a deeper history costs flash space, not extra
+// writes per climb. Override with -DMAX_CLIMB_HISTORY=n.
+#ifndef MAX_CLIMB_HISTORY
+#define MAX_CLIMB_HISTORY 20
+#endif
 
 // Maximum lengths for climb data
 #define MAX_CLIMB_NAME_LEN 64
 #define MAX_CLIMB_GRADE_LEN 16
 #define MAX_CLIMB_UUID_LEN 40
 
+// Format of the persisted climb records
+#define CLIMB_RECORD_VERSION 1
+
 /**
  * Data structure for a single climb entry
  */
@@ -34,7 +41,13 @@ struct ClimbEntry {
  * - Stores the last MAX_CLIMB_HISTORY climbs
  * - Persists to NVS for power cycle recovery
  * - Provides access to current and previous climbs
- * - Automatically shifts entries when adding new climbs
+ *
+ * Each climb is saved as one fixed-size binary record with a sequence number
+ * and CRC32, in NVS blob slot "ch_<seq % MAX_CLIMB_HISTORY>". A new climb
+ * overwrites the slot of the oldest one, and an update of the current climb
+ * rewrites its own slot, so every change writes exactly one record whatever
+ * the history depth. load() reads every slot, drops records with a bad size
+ * or CRC, and replays the newest ones in sequence order.
  */
 class ClimbHistory {
   public:
@@ -89,7 +102,7 @@ class ClimbHistory {
     bool hasCurrentClimb() const;
 
     /**
-     * Save history to NVS.
+     * Save the current climb's record to NVS.
      * Called automatically by addClimb().
      */
     void save();
@@ -106,14 +119,37 @@ class ClimbHistory {
     void clear();
 
   private:
+    /**
+     * On-flash record. Layout is fixed; bump CLIMB_RECORD_VERSION if it
+     * changes so old records fail validation instead of being misread.
+     */
+    struct Record {
+        uint8_t version;
+        uint8_t reserved[3];
+        uint32_t seq;
+        char name[MAX_CLIMB_NAME_LEN];
+        char grade[MAX_CLIMB_GRADE_LEN];
+        char uuid[MAX_CLIMB_UUID_LEN];
+        uint32_t crc;  // CRC32 of every byte before it
+    };
+
+    // Ring of entries; history[head] is the newest
     ClimbEntry history[MAX_CLIMB_HISTORY];
+    int head;
+    int count;
     bool hasCurrentClimb_;
 
-    // NVS key for storing history
+    // Sequence number of the newest record (0 = none written yet)
+    uint32_t newestSeq;
+
+    // Legacy JSON key, removed on load
     static const char* NVS_KEY_HISTORY;
 
-    // Shift all entries down by 1, discarding the oldest
-    void shiftDown();
+    // Advance the ring, discarding the oldest entry if full
+    void push();
+
+    static void slotKey(uint32_t seq, char* key, size_t len);
+    static uint32_t crc32(const uint8_t* data, size_t len);
 };
 
 extern ClimbHistory ClimbHistoryMgr;
@@ -0,0 +1,561 @@
+#include "climb_journal.h"
+
+#include <config_manager.h>
+#include <log_buffer.h>
+#include <stdarg.h>
+
+#if defined(ESP_PLATFORM) && !defined(UNIT_TEST)
+#include <LittleFS.h>
+#include <time.h>
+
+static portMUX_TYPE journalLock = portMUX_INITIALIZER_UNLOCKED;
+#define JOURNAL_LOCK() portENTER_CRITICAL(&journalLock)
+#define JOURNAL_UNLOCK() portEXIT_CRITICAL(&journalLock)
+
+/**
+ * The block ring as a fixed-size LittleFS file, written in place.
+ */
+class LittleFSJournalStorage : public ClimbJournalStorage {
+  public:
+    bool begin(size_t size) override {
+        if (!LittleFS.begin(true)) {
+            return false;
+        }
+        if (LittleFS.exists(CLIMB_JOURNAL_PATH)) {
+            file = LittleFS.open(CLIMB_JOURNAL_PATH, "r+");
+            if (file && file.size() == size) {
+                return true;
+            }
+            file.close();
+        }
+
+        // New journal, or one from a build with a different ring size
+        file = LittleFS.open(CLIMB_JOURNAL_PATH, "w+");
+        if (!file) {
+            return false;
+        }
+        uint8_t zeros[64] = {0};
+        for (size_t written = 0; written < size; written += sizeof(zeros)) {
+            size_t chunk = size - written < sizeof(zeros) ? size - written : sizeof(zeros);
+            if (file.write(zeros, chunk) != chunk) {
+                file.close();
+                return false;
+            }
+        }
+        file.flush();
+        return true;
+    }
+
+    bool read(size_t offset, uint8_t* data, size_t len) override {
+        return file.seek(offset) && file.read(data, len) == len;
+    }
+
+    bool write(size_t offset, const uint8_t* data, size_t len) override {
+        if (!file.seek(offset) || file.write(data, len) != len) {
+            return false;
+        }
+        file.flush();
+        return true;
+    }
+
+  private:
+    File file;
+};
+
+static LittleFSJournalStorage fileStorage;
+
+static uint32_t systemClock() {
+    // time() counts from 1970 until SNTP sets the clock
+    time_t now = time(nullptr);
+    return now > 1600000000 ? (uint32_t)now : 0;
+}
+#else
+#define JOURNAL_LOCK()
+#define JOURNAL_UNLOCK()
+
+static uint32_t systemClock() {
+    return 0;
+}
+#endif
+
+ClimbJournal Journal;
+
+const char* ClimbJournal::KEY_ACKED_SEQ = "cj_ack";
+const char* ClimbJournal::KEY_BOOT_ID = "cj_boot";
+
+static const char* const EVENT_MESSAGES[] = {"climb_shown", "climb_cleared", "queue_navigated"};
+static const char* const EVENT_SOURCES[] = {"backend", "ble", "device"};
+
+// FNV-1a, to recognise the climb already on the board
+static uint32_t hashBytes(const void* data, size_t len, uint32_t hash = 2166136261u) {
+    const uint8_t* bytes = (const uint8_t*)data;
+    for (size_t i = 0; i < len; i++) {
+        hash = (hash ^ bytes[i]) * 16777619u;
+    }
+    return hash;
+}
+
+/**
+ * Copy a UUID, keeping only characters that need no escaping in JSON.
+ */
+static void copyUuid(char* dest, const char* src) {
+    size_t length = 0;
+    for (; *src && length < CLIMB_JOURNAL_UUID_LEN - 1; src++) {
+        char c = *src;
+        if ((c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '-' || c == '_') {
+            dest[length++] = c;
+        }
+    }
+    dest[length] = '\0';
+}
+
+static bool appendf(char* out, size_t capacity, size_t& pos, const char* format, ...) {
+    if (pos >= capacity) {
+        return false;
+    }
+    va_list args;
+    va_start(args, format);
+    int written = vsnprintf(out + pos, capacity - pos, format, args);
+    va_end(args);
+    if (written < 0 || (size_t)written >= capacity - pos) {
+        return false;
+    }
+    pos += written;
+    return true;
+}
+
+ClimbJournal::ClimbJournal()
+    : storage(nullptr), clock(systemClock), openIndex(0), openHeader(), lastEventUptimeMs(0), openDirty(false),
+      dirtySinceMs(0), stagingHead(0), stagingCount(0), climbActive(false), activeKey(0), activeSinceMs(0), nextSeq(1),
+      ackedSeq(0), bootId(0), uploadThroughSeq(0), uploadCount(0), retryWait(false), failedAtMs(0), stats() {
+    memset(blocks, 0, sizeof(blocks));
+    memset(openBlock, 0, sizeof(openBlock));
+}
+
+bool ClimbJournal::begin(ClimbJournalStorage* blockStorage) {
+    ClimbJournalStorage* candidate = blockStorage;
+#if defined(ESP_PLATFORM) && !defined(UNIT_TEST)
+    if (!candidate) {
+        candidate = &fileStorage;
+    }
+#endif
+    if (!candidate || !candidate->begin(CLIMB_JOURNAL_BLOCK_COUNT * CLIMB_JOURNAL_BLOCK_SIZE)) {
+        Logger.logln("Journal: Storage unavailable, climbs are not journaled");
+        storage = nullptr;
+        return false;
+    }
+    storage = candidate;
+
+    // Only headers are read; the newest block tells where numbering resumes
+    int newest = -1;
+    for (int i = 0; i < CLIMB_JOURNAL_BLOCK_COUNT; i++) {
+        uint8_t raw[CLIMB_JOURNAL_HEADER_SIZE];
+        ClimbJournalBlockHeader header;
+        BlockInfo& info = blocks[i];
+        info.valid = storage->read(i * CLIMB_JOURNAL_BLOCK_SIZE, raw, sizeof(raw)) &&
+                     ClimbJournalReader::readHeader(raw, CLIMB_JOURNAL_BLOCK_SIZE, header) && header.count > 0;
+        info.firstSeq = info.valid ? header.firstSeq : 0;
+        info.count = info.valid ? header.count : 0;
+        if (info.valid && (newest < 0 || info.firstSeq > blocks[newest].firstSeq)) {
+            newest = i;
+        }
+    }
+
+    ackedSeq = (uint32_t)Config.getInt(KEY_ACKED_SEQ, 0);
+    nextSeq = newest >= 0 ? blocks[newest].firstSeq + blocks[newest].count : 1;
+    if (nextSeq <= ackedSeq) {
+        // Journal file was lost; never reuse acknowledged numbers
+        nextSeq = ackedSeq + 1;
+    }
+    bootId = (uint16_t)(Config.getInt(KEY_BOOT_ID, 0) + 1);
+    Config.setInt(KEY_BOOT_ID, bootId);
+
+    // Each boot starts a fresh block
+    openIndex = newest >= 0 ? (newest + 1) % CLIMB_JOURNAL_BLOCK_COUNT : 0;
+    openNewBlock(millis());
+
+    Logger.logln("Journal: Boot %u, next seq %u, %u events pending upload", bootId, (unsigned)nextSeq,
+                 (unsigned)getPendingCount());
+    return true;
+}
+
+// =============================================================================
+// Recording
+// =============================================================================
+
+void ClimbJournal::climbShown(const char* climbUuid, ClimbEventSource source) {
+    if (!storage || !climbUuid || climbUuid[0] == '\0') {
+        return;
+    }
+    ClimbEvent event;
+    event.type = ClimbEventType::SHOWN;
+    event.source = source;
+    copyUuid(event.uuid, climbUuid);
+    record(event, hashBytes(event.uuid, strlen(event.uuid)), true);
+}
+
+void ClimbJournal::bleClimbShown(const ClimbJournalHold* holds, int count, int angle) {
+    if (!storage || !holds || count <= 0) {
+        return;
+    }
+    ClimbEvent event;
+    event.type = ClimbEventType::SHOWN;
+    event.source = ClimbEventSource::BLE;
+    event.angle = angle > 0 ? angle : 0;
+    event.holdCount = count < CLIMB_JOURNAL_MAX_HOLDS ? count : CLIMB_JOURNAL_MAX_HOLDS;
+
+    // Insertion sort; position deltas are encoded
+    for (int i = 0; i < event.holdCount; i++) {
+        ClimbJournalHold hold = holds[i];
+        int j = i;
+        while (j > 0 && event.holds[j - 1].position > hold.position) {
+            event.holds[j] = event.holds[j - 1];
+            j--;
+        }
+        event.holds[j] = hold;
+    }
+
+    uint32_t key = 0;
+    for (int i = 0; i < event.holdCount; i++) {
+        key = hashBytes(&event.holds[i].position, sizeof(uint16_t), i == 0 ? 2166136261u : key);
+        key = hashBytes(&event.holds[i].role, 1, key);
+    }
+    record(event, key, true);
+}
+
+void ClimbJournal::climbCleared(ClimbEventSource source) {
+    if (!storage) {
+        return;
+    }
+    ClimbEvent event;
+    event.type = ClimbEventType::CLEARED;
+    event.source = source;
+    record(event, 0, false);
+}
+
+void ClimbJournal::navigated(const char* queueItemUuid) {
+    if (!storage || !queueItemUuid) {
+        return;
+    }
+    ClimbEvent event;
+    event.type = ClimbEventType::NAVIGATED;
+    event.source = ClimbEventSource::DEVICE;
+    copyUuid(event.uuid, queueItemUuid);
+    record(event, 0, false);
+}
+
+void ClimbJournal::record(ClimbEvent& event, uint32_t key, bool activates) {
+    uint32_t now = millis();
+    event.uptimeMs = now;
+
+    JOURNAL_LOCK();
+    bool repeat = activates && climbActive && key == activeKey;
+    bool idle = event.type == ClimbEventType::CLEARED && !climbActive;
+    if (repeat || idle) {
+        JOURNAL_UNLOCK();
+        return;
+    }
+
+    if (event.type != ClimbEventType::NAVIGATED) {
+        event.dwellMs = climbActive ? now - activeSinceMs : 0;
+        climbActive = activates;
+        activeKey = key;
+        activeSinceMs = now;
+    }
+
+    if (stagingCount < CLIMB_JOURNAL_STAGING) {
+        staging[(stagingHead + stagingCount) % CLIMB_JOURNAL_STAGING] = event;
+        stagingCount++;
+        stats.eventsRecorded++;
+    } else {
+        stats.eventsDropped++;
+    }
+    JOURNAL_UNLOCK();
+}
+
+// =============================================================================
+// Flash
+// =============================================================================
+
+void ClimbJournal::loop() {
+    if (!storage) {
+        return;
+    }
+    drainStaging();
+    if (openDirty && millis() - dirtySinceMs >= CLIMB_JOURNAL_FLUSH_DELAY_MS) {
+        writeOpenBlock();
+    }
+}
+
+void ClimbJournal::flush() {
+    if (!storage) {
+        return;
+    }
+    drainStaging();
+    if (openDirty) {
+        writeOpenBlock();
+    }
+}
+
+void ClimbJournal::drainStaging() {
+    ClimbEvent event;
+    while (true) {
+        JOURNAL_LOCK();
+        if (stagingCount == 0) {
+            JOURNAL_UNLOCK();
+            return;
+        }
+        event = staging[stagingHead];
+        stagingHead = (stagingHead + 1) % CLIMB_JOURNAL_STAGING;
+        stagingCount--;
+        JOURNAL_UNLOCK();
+
+        append(event);
+    }
+}
+
+void ClimbJournal::append(const ClimbEvent& event) {
+    size_t capacity = CLIMB_JOURNAL_BLOCK_SIZE - CLIMB_JOURNAL_HEADER_SIZE - openHeader.used;
+    if (openHeader.count > 0 && ClimbJournalEncoder::maxEventSize(event) > capacity) {
+        writeOpenBlock();
+        openIndex = (openIndex + 1) % CLIMB_JOURNAL_BLOCK_COUNT;
+        openNewBlock(event.uptimeMs);
+        capacity = CLIMB_JOURNAL_BLOCK_SIZE - CLIMB_JOURNAL_HEADER_SIZE;
+    }
+
+    if (openHeader.count == 0) {
+        // Claim the block; whatever it held is overwritten at the next write
+        BlockInfo& info = blocks[openIndex];
+        if (info.valid) {
+            uint32_t last = info.firstSeq + info.count - 1;
+            uint32_t uploaded = ackedSeq > info.firstSeq - 1 ? ackedSeq : info.firstSeq - 1;
+            if (last > uploaded) {
+                stats.eventsDropped += last - uploaded;
+                Logger.logln("Journal: Ring full, %u events dropped before upload", (unsigned)(last - uploaded));
+            }
+        }
+        openHeader.firstSeq = nextSeq;
+        openHeader.startUptimeMs = event.uptimeMs;
+        lastEventUptimeMs = event.uptimeMs;
+        info.firstSeq = nextSeq;
+        info.count = 0;
+        info.valid = true;
+    }
+
+    size_t written = ClimbJournalEncoder::encodeEvent(openBlock + CLIMB_JOURNAL_HEADER_SIZE + openHeader.used,
+                                                      capacity, event, event.uptimeMs - lastEventUptimeMs);
+    if (written == 0) {
+        stats.eventsDropped++;
+        return;
+    }
+    openHeader.used += written;
+    openHeader.count++;
+    blocks[openIndex].count = openHeader.count;
+    lastEventUptimeMs = event.uptimeMs;
+    nextSeq++;
+
+    if (!openDirty) {
+        openDirty = true;
+        dirtySinceMs = millis();
+    }
+}
+
+void ClimbJournal::openNewBlock(uint32_t startUptimeMs) {
+    memset(openBlock, 0, sizeof(openBlock));
+    openHeader = ClimbJournalBlockHeader();
+    openHeader.firstSeq = nextSeq;
+    openHeader.startUptimeMs = startUptimeMs;
+    openHeader.bootId = bootId;
+    lastEventUptimeMs = startUptimeMs;
+    openDirty = false;
+}
+
+void ClimbJournal::writeOpenBlock() {
+    if (openHeader.count == 0) {
+        openDirty = false;
+        return;
+    }
+    openHeader.epochOffset = epochOffset();
+    ClimbJournalEncoder::writeHeader(openBlock, openHeader);
+    if (!storage->write(openIndex * CLIMB_JOURNAL_BLOCK_SIZE, openBlock, CLIMB_JOURNAL_BLOCK_SIZE)) {
+        // Keep it dirty and try again after another delay
+        Logger.logln("Journal: Block %d write failed", openIndex);
+        dirtySinceMs = millis();
+        return;
+    }
+    stats.blocksWritten++;
+    openDirty = false;
+}
+
+uint32_t ClimbJournal::epochOffset() const {
+    uint32_t now = clock();
+    return now ? now - millis() / 1000 : 0;
+}
+
+uint32_t ClimbJournal::oldestSeq() const {
+    uint32_t oldest = nextSeq;
+    for (int i = 0; i < CLIMB_JOURNAL_BLOCK_COUNT; i++) {
+        if (blocks[i].valid && blocks[i].count > 0 && blocks[i].firstSeq < oldest) {
+            oldest = blocks[i].firstSeq;
+        }
+    }
+    return oldest;
+}
+
+const uint8_t* ClimbJournal::loadBlock(int index) {
+    if (index == openIndex && openHeader.count > 0) {
+        ClimbJournalEncoder::writeHeader(openBlock, openHeader);
+        return openBlock;
+    }
+    if (!storage->read(index * CLIMB_JOURNAL_BLOCK_SIZE, readBlock, CLIMB_JOURNAL_BLOCK_SIZE)) {
+        return nullptr;
+    }
+    return readBlock;
+}
+
+// =============================================================================
+// Upload
+// =============================================================================
+
+uint32_t ClimbJournal::getPendingCount() const {
+    uint32_t oldest = oldestSeq();
+    uint32_t start = ackedSeq + 1 > oldest ? ackedSeq + 1 : oldest;
+    return nextSeq > start ? nextSeq - start : 0;
+}
+
+bool ClimbJournal::isUploadDue() const {
+    if (!storage || isUploadInFlight() || getPendingCount() == 0) {
+        return false;
+    }
+    return !retryWait || millis() - failedAtMs >= CLIMB_JOURNAL_RETRY_MS;
+}
+
+int ClimbJournal::beginUpload(char* out, size_t capacity) {
+    if (!storage || isUploadInFlight() || capacity == 0) {
+        return 0;
+    }
+    drainStaging();
+
+    static const char PREFIX[] = "{\"input\":{\"logs\":[";
+    static const char SUFFIX[] = "]}}";
+    if (capacity < sizeof(PREFIX) + sizeof(SUFFIX)) {
+        return 0;
+    }
+    size_t pos = 0;
+    appendf(out, capacity, pos, "%s", PREFIX);
+    size_t eventCapacity = capacity - (sizeof(SUFFIX) - 1);
+
+    uint32_t oldest = oldestSeq();
+    uint32_t start = ackedSeq + 1 > oldest ? ackedSeq + 1 : oldest;
+    int count = 0;
+    uint32_t last = 0;
+    bool full = false;
+    ClimbEvent event;
+
+    while (count < CLIMB_JOURNAL_UPLOAD_BATCH && !full) {
+        // The block holding the lowest pending sequence number
+        int index = -1;
+        for (int i = 0; i < CLIMB_JOURNAL_BLOCK_COUNT; i++) {
+            const BlockInfo& info = blocks[i];
+            if (info.valid && info.count > 0 && info.firstSeq + info.count > start &&
+                (index < 0 || info.firstSeq < blocks[index].firstSeq)) {
+                index = i;
+            }
+        }
+        if (index < 0) {
+            break;
+        }
+
+        const uint8_t* data = loadBlock(index);
+        if (data) {
+            ClimbJournalReader reader(data, CLIMB_JOURNAL_BLOCK_SIZE);
+            while (count < CLIMB_JOURNAL_UPLOAD_BATCH && reader.next(event)) {
+                if (event.seq < start) {
+                    continue;
+                }
+                size_t written = formatEvent(out + pos, eventCapacity - pos, event, reader.getHeader().epochOffset,
+                                             count == 0);
+                if (written == 0) {
+                    full = true;
+                    break;
+                }
+                pos += written;
+                count++;
+                last = event.seq;
+            }
+        }
+        // A block that cannot be read or decoded is skipped
+        start = blocks[index].firstSeq + blocks[index].count;
+    }
+
+    if (count == 0) {
+        return 0;
+    }
+    appendf(out, capacity, pos, "%s", SUFFIX);
+    uploadThroughSeq = last;
+    uploadCount = count;
+    return count;
+}
+
+size_t ClimbJournal::formatEvent(char* out, size_t capacity, const ClimbEvent& event, uint32_t offset, bool first) {
+    // Blocks written before the clock was set can still be dated from the
+    // current boot's offset
+    if (offset == 0 && event.bootId == bootId) {
+        offset = epochOffset();
+    }
+    bool estimated = offset == 0;
+    uint64_t ts = estimated ? (uint64_t)clock() * 1000 : (uint64_t)offset * 1000 + event.uptimeMs;
+
+    size_t pos = 0;
+    bool ok = appendf(out, capacity, pos,
+                      "%s{\"ts\":%llu,\"level\":\"info\",\"component\":\"climb-journal\",\"message\":\"%s\","
+                      "\"metadata\":\"{\\\"seq\\\":%u,\\\"boot\\\":%u,\\\"uptime_ms\\\":%u,\\\"source\\\":\\\"%s\\\"",
+                      first ? "" : ",", (unsigned long long)ts, EVENT_MESSAGES[(int)event.type % 3],
+                      (unsigned)event.seq, (unsigned)event.bootId, (unsigned)event.uptimeMs,
+                      EVENT_SOURCES[(int)event.source % 3]);
+    if (event.type != ClimbEventType::NAVIGATED) {
+        ok = ok && appendf(out, capacity, pos, ",\\\"dwell_ms\\\":%u", (unsigned)event.dwellMs);
+    }
+    if (event.uuid[0]) {
+        ok = ok && appendf(out, capacity, pos, ",\\\"%s\\\":\\\"%s\\\"",
+                           event.type == ClimbEventType::NAVIGATED ? "queue_item_uuid" : "climb_uuid", event.uuid);
+    }
+    if (event.holdCount > 0) {
+        ok = ok && appendf(out, capacity, pos, ",\\\"angle\\\":%u,\\\"holds\\\":[", (unsigned)event.angle);
+        for (int i = 0; i < event.holdCount && ok; i++) {
+            ok = appendf(out, capacity, pos, "%s[%u,%u]", i == 0 ? "" : ",", (unsigned)event.holds[i].position,
+                         (unsigned)event.holds[i].role);
+        }
+        ok = ok && appendf(out, capacity, pos, "]");
+    }
+    if (estimated) {
+        // ts is when the event was uploaded, not when it happened
+        ok = ok && appendf(out, capacity, pos, ",\\\"clock\\\":\\\"upload\\\"");
+    }
+    ok = ok && appendf(out, capacity, pos, "}\"}");
+    return ok ? pos : 0;
+}
+
+void ClimbJournal::endUpload(bool delivered) {
+    if (!isUploadInFlight()) {
+        return;
+    }
+    if (delivered) {
+        stats.eventsUploaded += uploadCount;
+        if (uploadThroughSeq > ackedSeq) {
+            ackedSeq = uploadThroughSeq;
+            Config.setInt(KEY_ACKED_SEQ, (int32_t)ackedSeq);
+        }
+        retryWait = false;
+    } else {
+        stats.uploadFailures++;
+        retryWait = true;
+        failedAtMs = millis();
+    }
+    uploadThroughSeq = 0;
+    uploadCount = 0;
+}
+
+void ClimbJournal::setClock(ClimbJournalClock journalClock) {
+    clock = journalClock ? journalClock : systemClock;
+}
@@ -0,0 +1,230 @@
+#ifndef CLIMB_JOURNAL_H
+#define CLIMB_JOURNAL_H
+
+#include "climb_journal_format.h"
+
+#include <Arduino.h>
+
+// Blocks in the ring (CLIMB_JOURNAL_BLOCK_SIZE each); about 20 backend
+// events or 8 BLE climbs fit in a block
+#define CLIMB_JOURNAL_BLOCK_COUNT 32
+
+#define CLIMB_JOURNAL_PATH "/climb_journal.bin"
+
+// Events recorded but not yet encoded (drained by loop())
+#define CLIMB_JOURNAL_STAGING 4
+
+// The open block is written this long after its first unwritten event
+#define CLIMB_JOURNAL_FLUSH_DELAY_MS 5000
+
+// Events per upload
+#define CLIMB_JOURNAL_UPLOAD_BATCH 16
+
+// Wait this long after a failed upload before trying again
+#define CLIMB_JOURNAL_RETRY_MS 30000
+
+/**
+ * Storage for the block ring. The firmware uses a LittleFS file; tests
+ * supply RAM.
+ */
+class ClimbJournalStorage {
+  public:
+    virtual ~ClimbJournalStorage() {}
+
+    /**
+     * Open storage of `size` bytes. Bytes never written read as zero.
+     */
+    virtual bool begin(size_t size) = 0;
+    virtual bool read(size_t offset, uint8_t* data, size_t len) = 0;
+    virtual bool write(size_t offset, const uint8_t* data, size_t len) = 0;
+};
+
+/**
+ * Wall clock in Unix seconds, 0 while unknown.
+ */
+typedef uint32_t (*ClimbJournalClock)();
+
+/**
+ * Journal statistics since boot.
+ */
+struct ClimbJournalStats {
+    uint32_t eventsRecorded;
+    uint32_t eventsDropped;  // Staging full, or overwritten before upload
+    uint32_t blocksWritten;
+    uint32_t eventsUploaded;
+    uint32_t uploadFailures;
+};
+
+/**
+ * ClimbJournal keeps a bounded on-flash log of the climbs shown on the
+ * board, so attempts made while the backend link is down still reach it.
+ *
+ * Each event (climb shown, LEDs cleared, queue navigation) records its
+ * source, how long the previous climb was shown, and either the climb UUID
+ * or, for a BLE climb the backend has not matched, its holds. Events get
+ * sequence numbers that keep increasing across reboots.
+ *
+ * The record methods are safe from any task (NimBLE callbacks included):
+ * they copy the event into a small staging queue under a spinlock. loop()
+ * encodes staged events into the open block and writes it to flash a few
+ * seconds later, so flash writes never reach the LED path. When the ring
+ * is full the oldest block is reused, whether or not it was uploaded.
+ *
+ * Upload is pull-based: beginUpload() formats the oldest unacknowledged
+ * events as sendDeviceLogs input, and endUpload() records the outcome. The
+ * last acknowledged sequence number is kept in NVS, so a batch that was
+ * delivered but not acknowledged is sent again with the same sequence
+ * numbers, and the backend can drop the duplicates.
+ */
+class ClimbJournal {
+  public:
+    ClimbJournal();
+
+    /**
+     * Open the journal and find where it left off.
+     * @param storage Block storage, nullptr for the LittleFS file
+     * @return false if storage is unavailable (recording is then a no-op)
+     */
+    bool begin(ClimbJournalStorage* storage = nullptr);
+
+    bool isReady() const { return storage != nullptr; }
+
+    // Recording (any task)
+
+    /**
+     * A climb was lit. Repeats of the climb already shown are ignored.
+     */
+    void climbShown(const char* climbUuid, ClimbEventSource source);
+
+    /**
+     * A climb from the official app was lit while the backend could not
+     * match it. Holds are copied and sorted.
+     */
+    void bleClimbShown(const ClimbJournalHold* holds, int count, int angle);
+
+    /**
+     * LEDs were cleared. Ignored if no climb is shown.
+     */
+    void climbCleared(ClimbEventSource source);
+
+    /**
+     * This device navigated the queue to an item.
+     */
+    void navigated(const char* queueItemUuid);
+
+    /**
+     * Encode staged events and write the open block when due. Call from
+     * the main loop.
+     */
+    void loop();
+
+    /**
+     * Encode staged events and write the open block now.
+     */
+    void flush();
+
+    // Upload
+
+    /**
+     * Events recorded (and encoded) but not acknowledged, including ones
+     * already in an upload.
+     */
+    uint32_t getPendingCount() const;
+
+    /**
+     * True if events are pending, no upload is in flight and any retry
+     * delay has passed.
+     */
+    bool isUploadDue() const;
+
+    /**
+     * Format up to CLIMB_JOURNAL_UPLOAD_BATCH of the oldest pending events
+     * as {"input":{"logs":[...]}} for the sendDeviceLogs mutation, and
+     * mark them in flight.
+     * @return Events written, 0 if none are pending or none fit
+     */
+    int beginUpload(char* out, size_t capacity);
+
+    /**
+     * Record the outcome of the upload in flight. Delivered events are
+     * acknowledged; otherwise the same events go out again after
+     * CLIMB_JOURNAL_RETRY_MS.
+     */
+    void endUpload(bool delivered);
+
+    bool isUploadInFlight() const { return uploadThroughSeq != 0; }
+
+    /**
+     * Sequence numbers: next to assign, and last acknowledged.
+     */
+    uint32_t getNextSeq() const { return nextSeq; }
+    uint32_t getAckedSeq() const { return ackedSeq; }
+    uint16_t getBootId() const { return bootId; }
+
+    const ClimbJournalStats& getStats() const { return stats; }
+
+    /**
+     * Replace the wall clock (tests; default reads time() once it is set).
+     */
+    void setClock(ClimbJournalClock clock);
+
+    // Config keys
+    static const char* KEY_ACKED_SEQ;
+    static const char* KEY_BOOT_ID;
+
+  private:
+    struct BlockInfo {
+        uint32_t firstSeq;
+        uint16_t count;
+        bool valid;
+    };
+
+    ClimbJournalStorage* storage;
+    ClimbJournalClock clock;
+    BlockInfo blocks[CLIMB_JOURNAL_BLOCK_COUNT];
+
+    // Open block, written in place until full
+    uint8_t openBlock[CLIMB_JOURNAL_BLOCK_SIZE];
+    int openIndex;
+    ClimbJournalBlockHeader openHeader;
+    uint32_t lastEventUptimeMs;
+    bool openDirty;
+    unsigned long dirtySinceMs;
+
+    uint8_t readBlock[CLIMB_JOURNAL_BLOCK_SIZE];
+
+    // Filled by record methods, drained by loop()
+    ClimbEvent staging[CLIMB_JOURNAL_STAGING];
+    int stagingHead;
+    int stagingCount;
+
+    // What is on the board now, for dwell times and repeat suppression
+    bool climbActive;
+    uint32_t activeKey;
+    uint32_t activeSinceMs;
+
+    uint32_t nextSeq;
+    uint32_t ackedSeq;
+    uint16_t bootId;
+
+    uint32_t uploadThroughSeq;  // Last sequence number in flight, 0 if none
+    int uploadCount;
+    bool retryWait;
+    unsigned long failedAtMs;
+
+    ClimbJournalStats stats;
+
+    void record(ClimbEvent& event, uint32_t key, bool activates);
+    void drainStaging();
+    void append(const ClimbEvent& event);
+    void openNewBlock(uint32_t startUptimeMs);
+    void writeOpenBlock();
+    uint32_t epochOffset() const;
+    uint32_t oldestSeq() const;
+    const uint8_t* loadBlock(int index);
+    size_t formatEvent(char* out, size_t capacity, const ClimbEvent& event, uint32_t offset, bool first);
+};
+
+extern ClimbJournal Journal;
+
+#endif
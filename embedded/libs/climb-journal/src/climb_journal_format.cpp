@@ -0,0 +1,314 @@
+#include "climb_journal_format.h"
+
+#define FLAG_TYPE_MASK 0x03
+#define FLAG_SOURCE_SHIFT 2
+#define FLAG_SOURCE_MASK 0x0C
+#define FLAG_HOLDS 0x10
+#define FLAG_UUID_SHIFT 5
+#define FLAG_UUID_MASK 0x60
+#define FLAG_UUID_UPPER 0x80
+
+// How the UUID is stored
+#define UUID_NONE 0
+#define UUID_HEX 1     // Even number of hex digits
+#define UUID_DASHED 2  // 8-4-4-4-12 hex digits
+#define UUID_RAW 3
+
+#define DASHED_UUID_LEN 36
+
+static inline void writeU16(uint8_t* out, uint16_t value) {
+    out[0] = value & 0xFF;
+    out[1] = value >> 8;
+}
+
+static inline void writeU32(uint8_t* out, uint32_t value) {
+    out[0] = value & 0xFF;
+    out[1] = (value >> 8) & 0xFF;
+    out[2] = (value >> 16) & 0xFF;
+    out[3] = value >> 24;
+}
+
+static inline uint16_t readU16(const uint8_t* in) {
+    return in[0] | (in[1] << 8);
+}
+
+static inline uint32_t readU32(const uint8_t* in) {
+    return in[0] | (in[1] << 8) | (in[2] << 16) | ((uint32_t)in[3] << 24);
+}
+
+static inline bool isDashPosition(size_t i) {
+    return i == 8 || i == 13 || i == 18 || i == 23;
+}
+
+static int hexValue(char c) {
+    if (c >= '0' && c <= '9') {
+        return c - '0';
+    }
+    if (c >= 'a' && c <= 'f') {
+        return c - 'a' + 10;
+    }
+    if (c >= 'A' && c <= 'F') {
+        return c - 'A' + 10;
+    }
+    return -1;
+}
+
+/**
+ * Pick the most compact form for a UUID.
+ * @param upper Set if the hex digits are upper case
+ */
+static int uuidForm(const char* uuid, size_t length, bool& upper) {
+    upper = false;
+    if (length == 0) {
+        return UUID_NONE;
+    }
+
+    bool dashed = length == DASHED_UUID_LEN;
+    bool hasLower = false;
+    bool hasUpper = false;
+    for (size_t i = 0; i < length; i++) {
+        char c = uuid[i];
+        if (dashed && isDashPosition(i)) {
+            if (c != '-') {
+                return UUID_RAW;
+            }
+            continue;
+        }
+        if (hexValue(c) < 0) {
+            return UUID_RAW;
+        }
+        hasLower |= c >= 'a' && c <= 'f';
+        hasUpper |= c >= 'A' && c <= 'F';
+    }
+    if (hasLower && hasUpper) {
+        return UUID_RAW;
+    }
+    upper = hasUpper;
+    if (dashed) {
+        return UUID_DASHED;
+    }
+    return length % 2 == 0 ? UUID_HEX : UUID_RAW;
+}
+
+// =============================================================================
+// ClimbJournalEncoder
+// =============================================================================
+
+void ClimbJournalEncoder::writeHeader(uint8_t* out, const ClimbJournalBlockHeader& header) {
+    memcpy(out, CLIMB_JOURNAL_MAGIC, 2);
+    out[2] = CLIMB_JOURNAL_VERSION;
+    out[3] = 0;
+    writeU16(out + 4, header.used);
+    writeU16(out + 6, header.count);
+    writeU32(out + 8, header.firstSeq);
+    writeU32(out + 12, header.startUptimeMs);
+    writeU32(out + 16, header.epochOffset);
+    writeU16(out + 20, header.bootId);
+    writeU16(out + 22, 0);
+}
+
+size_t ClimbJournalEncoder::maxEventSize(const ClimbEvent& event) {
+    // Flags, two 5-byte varints, UUID length and characters
+    size_t size = 1 + 5 + 5 + 1 + strlen(event.uuid);
+    if (event.holdCount > 0) {
+        // Angle, count, and per hold a 3-byte position delta and a role
+        size += 5 + 1 + event.holdCount * 4;
+    }
+    return size;
+}
+
+size_t ClimbJournalEncoder::encodeEvent(uint8_t* out, size_t capacity, const ClimbEvent& event, uint32_t deltaMs) {
+    if (capacity < maxEventSize(event)) {
+        return 0;
+    }
+
+    size_t uuidLength = strlen(event.uuid);
+    bool upper;
+    int form = uuidForm(event.uuid, uuidLength, upper);
+
+    uint8_t flags = ((uint8_t)event.type & FLAG_TYPE_MASK) |
+                    (((uint8_t)event.source << FLAG_SOURCE_SHIFT) & FLAG_SOURCE_MASK) | (form << FLAG_UUID_SHIFT);
+    if (event.holdCount > 0) {
+        flags |= FLAG_HOLDS;
+    }
+    if (upper) {
+        flags |= FLAG_UUID_UPPER;
+    }
+
+    size_t pos = 0;
+    out[pos++] = flags;
+    pos += writeVarint(out + pos, deltaMs);
+    pos += writeVarint(out + pos, event.dwellMs);
+
+    if (form == UUID_HEX || form == UUID_DASHED) {
+        uint8_t* countByte = out + pos++;
+        uint8_t bytes = 0;
+        int high = -1;
+        for (size_t i = 0; i < uuidLength; i++) {
+            if (form == UUID_DASHED && isDashPosition(i)) {
+                continue;
+            }
+            int nibble = hexValue(event.uuid[i]);
+            if (high < 0) {
+                high = nibble;
+            } else {
+                out[pos++] = (uint8_t)((high << 4) | nibble);
+                bytes++;
+                high = -1;
+            }
+        }
+        *countByte = bytes;
+    } else if (form == UUID_RAW) {
+        out[pos++] = (uint8_t)uuidLength;
+        memcpy(out + pos, event.uuid, uuidLength);
+        pos += uuidLength;
+    }
+
+    if (event.holdCount > 0) {
+        pos += writeVarint(out + pos, event.angle);
+        out[pos++] = event.holdCount;
+        uint16_t previous = 0;
+        for (int i = 0; i < event.holdCount; i++) {
+            pos += writeVarint(out + pos, (uint16_t)(event.holds[i].position - previous));
+            out[pos++] = event.holds[i].role;
+            previous = event.holds[i].position;
+        }
+    }
+    return pos;
+}
+
+size_t ClimbJournalEncoder::writeVarint(uint8_t* out, uint32_t value) {
+    size_t pos = 0;
+    while (value >= 0x80) {
+        out[pos++] = (uint8_t)(value | 0x80);
+        value >>= 7;
+    }
+    out[pos++] = (uint8_t)value;
+    return pos;
+}
+
+// =============================================================================
+// ClimbJournalReader
+// =============================================================================
+
+ClimbJournalReader::ClimbJournalReader(const uint8_t* block, size_t length)
+    : buffer(block), end(0), position(CLIMB_JOURNAL_HEADER_SIZE), header(), index(0), uptimeMs(0), valid(false) {
+    valid = readHeader(block, length, header);
+    if (valid) {
+        end = CLIMB_JOURNAL_HEADER_SIZE + header.used;
+        uptimeMs = header.startUptimeMs;
+    }
+}
+
+bool ClimbJournalReader::readHeader(const uint8_t* block, size_t length, ClimbJournalBlockHeader& header) {
+    if (length < CLIMB_JOURNAL_HEADER_SIZE || memcmp(block, CLIMB_JOURNAL_MAGIC, 2) != 0 ||
+        block[2] != CLIMB_JOURNAL_VERSION) {
+        return false;
+    }
+    header.used = readU16(block + 4);
+    header.count = readU16(block + 6);
+    header.firstSeq = readU32(block + 8);
+    header.startUptimeMs = readU32(block + 12);
+    header.epochOffset = readU32(block + 16);
+    header.bootId = readU16(block + 20);
+    return header.used <= length - CLIMB_JOURNAL_HEADER_SIZE;
+}
+
+bool ClimbJournalReader::next(ClimbEvent& event) {
+    if (!valid || index >= header.count || position >= end) {
+        return false;
+    }
+
+    uint8_t flags = buffer[position++];
+    uint32_t delta;
+    uint32_t dwell;
+    if (!readVarint(delta) || !readVarint(dwell)) {
+        valid = false;
+        return false;
+    }
+
+    int form = (flags & FLAG_UUID_MASK) >> FLAG_UUID_SHIFT;
+    size_t uuidLength = 0;
+    if (form != UUID_NONE) {
+        if (position >= end) {
+            valid = false;
+            return false;
+        }
+        uint8_t count = buffer[position++];
+        bool packed = form == UUID_HEX || form == UUID_DASHED;
+        size_t chars = packed ? count * 2 + (form == UUID_DASHED ? 4 : 0) : count;
+        if (end - position < count || chars >= CLIMB_JOURNAL_UUID_LEN) {
+            valid = false;
+            return false;
+        }
+        if (packed) {
+            const char* digits = (flags & FLAG_UUID_UPPER) ? "0123456789ABCDEF" : "0123456789abcdef";
+            for (uint8_t i = 0; i < count; i++) {
+                uint8_t byte = buffer[position++];
+                for (int half = 0; half < 2; half++) {
+                    if (form == UUID_DASHED && isDashPosition(uuidLength)) {
+                        event.uuid[uuidLength++] = '-';
+                    }
+                    event.uuid[uuidLength++] = digits[half == 0 ? byte >> 4 : byte & 0x0F];
+                }
+            }
+        } else {
+            memcpy(event.uuid, buffer + position, count);
+            position += count;
+            uuidLength = count;
+        }
+    }
+    event.uuid[uuidLength] = '\0';
+
+    event.angle = 0;
+    event.holdCount = 0;
+    if (flags & FLAG_HOLDS) {
+        uint32_t angle;
+        if (!readVarint(angle) || position >= end) {
+            valid = false;
+            return false;
+        }
+        uint8_t count = buffer[position++];
+        if (count > CLIMB_JOURNAL_MAX_HOLDS) {
+            valid = false;
+            return false;
+        }
+        uint16_t holdPosition = 0;
+        for (uint8_t i = 0; i < count; i++) {
+            uint32_t positionDelta;
+            if (!readVarint(positionDelta) || position >= end) {
+                valid = false;
+                return false;
+            }
+            holdPosition += positionDelta;
+            event.holds[i].position = holdPosition;
+            event.holds[i].role = buffer[position++];
+        }
+        event.angle = angle;
+        event.holdCount = count;
+    }
+
+    uptimeMs += delta;
+    event.seq = header.firstSeq + index++;
+    event.type = (ClimbEventType)(flags & FLAG_TYPE_MASK);
+    event.source = (ClimbEventSource)((flags & FLAG_SOURCE_MASK) >> FLAG_SOURCE_SHIFT);
+    event.bootId = header.bootId;
+    event.uptimeMs = uptimeMs;
+    event.dwellMs = dwell;
+    return true;
+}
+
+bool ClimbJournalReader::readVarint(uint32_t& value) {
+    value = 0;
+    for (int shift = 0; shift < 35; shift += 7) {
+        if (position >= end) {
+            return false;
+        }
+        uint8_t byte = buffer[position++];
+        value |= (uint32_t)(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) {
+            return true;
+        }
+    }
+    return false;
+}
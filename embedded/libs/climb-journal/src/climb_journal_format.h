@@ -0,0 +1,168 @@
+#ifndef CLIMB_JOURNAL_FORMAT_H
+#define CLIMB_JOURNAL_FORMAT_H
+
+#include <Arduino.h>
+
+/**
+ * Climb journal format (version 1), little-endian.
+ *
+ * The journal is a ring of fixed-size blocks. A block only holds events
+ * from one boot, and sequence numbers run on across blocks and boots.
+ *
+ * Block header (24 bytes):
+ *   "CJ"        magic
+ *   u8          version
+ *   u8          reserved (0)
+ *   u16         bytes of events after the header
+ *   u16         event count
+ *   u32         sequence number of the first event
+ *   u32         uptime (ms) the first event's delta is relative to
+ *   u32         Unix time (s) at uptime 0 of this boot, 0 if the clock was not set
+ *   u16         boot ID
+ *   u16         reserved (0)
+ *
+ * Events, back to back (sequence numbers follow from the header):
+ *   u8          type (bits 0-1) | source (bits 2-3) | holds (bit 4) |
+ *               UUID form (bits 5-6) | UUID upper case (bit 7)
+ *   varint      ms since the previous event (first: since the header uptime)
+ *   varint      ms the previous climb was shown (0 if none)
+ *   UUID        hex forms: u8 byte count + packed nibbles; raw: u8 length + chars
+ *   holds       varint angle, u8 count, then per hold varint position delta
+ *               (positions ascending) and u8 role
+ *
+ * Varints are unsigned LEB128. A 32-character hex climb UUID packs into 16
+ * bytes and a dashed queue item UUID into 16, so an event from the backend
+ * costs about 22 bytes; a BLE climb with 20 holds about 50.
+ */
+
+#define CLIMB_JOURNAL_MAGIC "CJ"
+#define CLIMB_JOURNAL_VERSION 1
+#define CLIMB_JOURNAL_HEADER_SIZE 24
+
+#define CLIMB_JOURNAL_BLOCK_SIZE 512
+
+// Longest UUID kept (including terminator)
+#define CLIMB_JOURNAL_UUID_LEN 40
+
+// Holds kept for a climb from BLE; more are dropped
+#define CLIMB_JOURNAL_MAX_HOLDS 64
+
+enum class ClimbEventType : uint8_t {
+    SHOWN = 0,      // A climb was lit
+    CLEARED = 1,    // LEDs were cleared
+    NAVIGATED = 2,  // Queue navigation from this device
+};
+
+enum class ClimbEventSource : uint8_t {
+    BACKEND = 0,  // LedUpdate from another client
+    BLE = 1,      // The official app over BLE (directly, or echoed by the backend)
+    DEVICE = 2,   // Buttons or touch on this controller
+};
+
+struct ClimbJournalHold {
+    uint16_t position;
+    uint8_t role;
+};
+
+/**
+ * One journal event. A climb shown from BLE while offline has no UUID and
+ * carries its holds instead, so the backend can still match it.
+ */
+struct ClimbEvent {
+    uint32_t seq;
+    ClimbEventType type;
+    ClimbEventSource source;
+    uint16_t bootId;
+    uint32_t uptimeMs;
+    uint32_t dwellMs;                   // How long the previous climb was shown
+    char uuid[CLIMB_JOURNAL_UUID_LEN];  // Climb UUID (SHOWN) or queue item UUID (NAVIGATED), "" if none
+    uint16_t angle;
+    uint8_t holdCount;
+    ClimbJournalHold holds[CLIMB_JOURNAL_MAX_HOLDS];
+
+    ClimbEvent()
+        : seq(0), type(ClimbEventType::SHOWN), source(ClimbEventSource::BACKEND), bootId(0), uptimeMs(0), dwellMs(0),
+          angle(0), holdCount(0) {
+        uuid[0] = '\0';
+    }
+};
+
+/**
+ * Decoded block header.
+ */
+struct ClimbJournalBlockHeader {
+    uint16_t used;  // Event bytes after the header
+    uint16_t count;
+    uint32_t firstSeq;
+    uint32_t startUptimeMs;
+    uint32_t epochOffset;  // Unix time at uptime 0, 0 if unknown
+    uint16_t bootId;
+};
+
+/**
+ * Encodes block headers and events into caller-provided buffers.
+ */
+class ClimbJournalEncoder {
+  public:
+    /**
+     * Write a block header.
+     * @param out Buffer of at least CLIMB_JOURNAL_HEADER_SIZE bytes
+     */
+    static void writeHeader(uint8_t* out, const ClimbJournalBlockHeader& header);
+
+    /**
+     * Encode one event. Holds must be sorted by position.
+     * @param deltaMs Time since the previous event in the block
+     * @return Bytes written, or 0 if the event does not fit
+     */
+    static size_t encodeEvent(uint8_t* out, size_t capacity, const ClimbEvent& event, uint32_t deltaMs);
+
+    /**
+     * Upper bound on the encoded size of an event.
+     */
+    static size_t maxEventSize(const ClimbEvent& event);
+
+  private:
+    static size_t writeVarint(uint8_t* out, uint32_t value);
+};
+
+/**
+ * Iterates over the events of one block.
+ */
+class ClimbJournalReader {
+  public:
+    ClimbJournalReader(const uint8_t* block, size_t length);
+
+    /**
+     * Check the magic, version and sizes.
+     */
+    bool isValid() const { return valid; }
+
+    const ClimbJournalBlockHeader& getHeader() const { return header; }
+
+    /**
+     * Read the next event, with its sequence number, boot ID and uptime
+     * filled in from the header.
+     * @return false after the last event or at a malformed one
+     */
+    bool next(ClimbEvent& event);
+
+    /**
+     * Read only the header of a block.
+     * @return false if the block is not a valid journal block
+     */
+    static bool readHeader(const uint8_t* block, size_t length, ClimbJournalBlockHeader& header);
+
+  private:
+    const uint8_t* buffer;
+    size_t end;
+    size_t position;
+    ClimbJournalBlockHeader header;
+    uint32_t index;
+    uint32_t uptimeMs;
+    bool valid;
+
+    bool readVarint(uint32_t& value);
+};
+
+#endif
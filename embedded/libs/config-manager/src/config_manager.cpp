@@ -1,8 +1,12 @@
 #include "config_manager.h"
 
+#include <log_buffer.h>
+
 ConfigManager Config;
 
-ConfigManager::ConfigManager() : opened(false) {}
+ConfigManager::ConfigManager() : opened(false), listenerCount(0) {
+    reset();
+}
 
 void ConfigManager::begin() {
     if (!opened) {
@@ -13,62 +17,365 @@ void ConfigManager::begin() {
 
 void ConfigManager::end() {
     if (opened) {
+        flush();
         prefs.end();
         opened = false;
     }
 }
 
-String ConfigManager::getString(const char* key, const String& defaultValue) {
+void ConfigManager::reset() {
+    for (int i = 0; i < CONFIG_MAX_ENTRIES; i++) {
+        entries[i].text = String();
+    }
+    uncachedText = String();
+    entryCount = 0;
+    dirtyCount = 0;
+    firstDirtyMs = 0;
+    lastChangeMs = 0;
+    cacheFullLogged = false;
+    wear = ConfigWearStats();
+}
+
+// =============================================================================
+// Cache
+// =============================================================================
+
+ConfigManager::Entry* ConfigManager::find(const char* key) {
+    if (!key) {
+        return nullptr;
+    }
+    for (int i = 0; i < entryCount; i++) {
+        if (strcmp(entries[i].key, key) == 0) {
+            return &entries[i];
+        }
+    }
+    return nullptr;
+}
+
+ConfigManager::Entry* ConfigManager::insert(const char* key) {
+    if (!key || strlen(key) >= CONFIG_KEY_MAX_LEN) {
+        return nullptr;
+    }
+    if (entryCount >= CONFIG_MAX_ENTRIES) {
+        if (!cacheFullLogged) {
+            Logger.logln("Config: cache full, '%s' and later keys go straight to NVS", key);
+            cacheFullLogged = true;
+        }
+        return nullptr;
+    }
+    Entry& entry = entries[entryCount++];
+    strcpy(entry.key, key);
+    entry.type = ValueType::ABSENT;
+    entry.dirty = false;
+    entry.number = 0;
+    entry.text = String();
+    return &entry;
+}
+
+ConfigManager::Entry* ConfigManager::load(const char* key, ValueType type) {
+    Entry* entry = find(key);
+    if (entry && (entry->type == type || entry->type == ValueType::ABSENT || entry->dirty)) {
+        return entry;
+    }
+
+    // First access, or read back as a different type than cached
+    if (!entry) {
+        entry = insert(key);
+        if (!entry) {
+            return nullptr;
+        }
+    }
     begin();
-    return prefs.getString(key, defaultValue);
+    wear.nvsReads++;
+    if (!prefs.isKey(key)) {
+        entry->type = ValueType::ABSENT;
+        return entry;
+    }
+    entry->type = type;
+    switch (type) {
+        case ValueType::STRING:
+            entry->text = prefs.getString(key, "");
+            break;
+        case ValueType::INT:
+            entry->number = prefs.getInt(key, 0);
+            break;
+        case ValueType::BOOL:
+            entry->number = prefs.getBool(key, false) ? 1 : 0;
+            break;
+        case ValueType::ABSENT:
+            break;
+    }
+    return entry;
 }
 
-bool ConfigManager::setString(const char* key, const String& value) {
+bool ConfigManager::store(const char* key, ValueType type, int32_t number, const String* text) {
+    Entry* entry = load(key, type);
+    if (!entry) {
+        return writeThrough(key, type, number, text);
+    }
+
+    bool unchanged = entry->type == type &&
+                     (type == ValueType::STRING ? entry->text == *text : entry->number == number);
+    if (unchanged) {
+        wear.writesSkipped++;
+        return true;
+    }
+
+    entry->type = type;
+    if (type == ValueType::STRING) {
+        entry->text = *text;
+    } else {
+        entry->number = number;
+    }
+
+    unsigned long now = millis();
+    if (entry->dirty) {
+        wear.writesCoalesced++;
+    } else {
+        entry->dirty = true;
+        if (dirtyCount++ == 0) {
+            firstDirtyMs = now;
+        }
+    }
+    lastChangeMs = now;
+    notify(key);
+    return true;
+}
+
+bool ConfigManager::writeThrough(const char* key, ValueType type, int32_t number, const String* text) {
     begin();
-    return prefs.putString(key, value) > 0 || value.length() == 0;
+    bool ok = false;
+    switch (type) {
+        case ValueType::STRING:
+            ok = prefs.putString(key, *text) > 0 || text->length() == 0;
+            wear.bytesWritten += text->length() + 1;
+            break;
+        case ValueType::INT:
+            ok = prefs.putInt(key, number) > 0;
+            wear.bytesWritten += sizeof(int32_t);
+            break;
+        case ValueType::BOOL:
+            ok = prefs.putBool(key, number != 0) > 0;
+            wear.bytesWritten += 1;
+            break;
+        case ValueType::ABSENT:
+            ok = prefs.remove(key);
+            break;
+    }
+    wear.keysWritten++;
+    if (!ok) {
+        wear.failures++;
+    }
+    notify(key);
+    return ok;
+}
+
+void ConfigManager::notify(const char* key) {
+    for (int i = 0; i < listenerCount; i++) {
+        listeners[i](key);
+    }
+}
+
+// =============================================================================
+// Typed Access
+// =============================================================================
+
+String ConfigManager::getString(const char* key, const String& defaultValue) {
+    Entry* entry = load(key, ValueType::STRING);
+    if (!entry) {
+        begin();
+        wear.nvsReads++;
+        return prefs.getString(key, defaultValue);
+    }
+    return entry->type == ValueType::STRING ? entry->text : defaultValue;
+}
+
+const char* ConfigManager::getCString(const char* key, const char* defaultValue) {
+    Entry* entry = load(key, ValueType::STRING);
+    if (!entry) {
+        begin();
+        wear.nvsReads++;
+        if (!prefs.isKey(key)) {
+            return defaultValue;
+        }
+        uncachedText = prefs.getString(key, "");
+        return uncachedText.c_str();
+    }
+    return entry->type == ValueType::STRING ? entry->text.c_str() : defaultValue;
+}
+
+bool ConfigManager::setString(const char* key, const String& value) {
+    return store(key, ValueType::STRING, 0, &value);
 }
 
 int32_t ConfigManager::getInt(const char* key, int32_t defaultValue) {
-    begin();
-    return prefs.getInt(key, defaultValue);
+    Entry* entry = load(key, ValueType::INT);
+    if (!entry) {
+        begin();
+        wear.nvsReads++;
+        return prefs.getInt(key, defaultValue);
+    }
+    return entry->type == ValueType::INT ? entry->number : defaultValue;
 }
 
 bool ConfigManager::setInt(const char* key, int32_t value) {
-    begin();
-    return prefs.putInt(key, value) > 0;
+    return store(key, ValueType::INT, value, nullptr);
 }
 
 bool ConfigManager::getBool(const char* key, bool defaultValue) {
-    begin();
-    return prefs.getBool(key, defaultValue);
+    Entry* entry = load(key, ValueType::BOOL);
+    if (!entry) {
+        begin();
+        wear.nvsReads++;
+        return prefs.getBool(key, defaultValue);
+    }
+    return entry->type == ValueType::BOOL ? entry->number != 0 : defaultValue;
 }
 
 bool ConfigManager::setBool(const char* key, bool value) {
-    begin();
-    return prefs.putBool(key, value) > 0;
+    return store(key, ValueType::BOOL, value ? 1 : 0, nullptr);
 }
 
 size_t ConfigManager::getBytes(const char* key, uint8_t* buffer, size_t maxLen) {
     begin();
+    wear.nvsReads++;
     return prefs.getBytes(key, buffer, maxLen);
 }
 
 bool ConfigManager::setBytes(const char* key, const uint8_t* buffer, size_t len) {
+    // A cached value of another type under this key is now stale
+    Entry* entry = find(key);
+    if (entry) {
+        if (entry->dirty) {
+            entry->dirty = false;
+            dirtyCount--;
+        }
+        *entry = entries[--entryCount];
+        entries[entryCount].text = String();
+    }
+
     begin();
-    return prefs.putBytes(key, buffer, len) > 0 || len == 0;
+    bool ok = prefs.putBytes(key, buffer, len) > 0 || len == 0;
+    wear.keysWritten++;
+    wear.bytesWritten += len;
+    if (!ok) {
+        wear.failures++;
+    }
+    notify(key);
+    return ok;
 }
 
 void ConfigManager::clear() {
+    for (int i = 0; i < entryCount; i++) {
+        entries[i].text = String();
+    }
+    entryCount = 0;
+    dirtyCount = 0;
+    firstDirtyMs = 0;
+    lastChangeMs = 0;
     begin();
     prefs.clear();
+    wear.keysWritten++;
+    notify(nullptr);
 }
 
 bool ConfigManager::hasKey(const char* key) {
+    Entry* entry = find(key);
+    if (entry) {
+        return entry->type != ValueType::ABSENT;
+    }
     begin();
+    wear.nvsReads++;
     return prefs.isKey(key);
 }
 
 void ConfigManager::remove(const char* key) {
+    Entry* entry = find(key);
+    if (entry) {
+        if (entry->dirty) {
+            entry->dirty = false;
+            dirtyCount--;
+        }
+        entry->type = ValueType::ABSENT;
+        entry->text = String();
+    }
+    writeThrough(key, ValueType::ABSENT, 0, nullptr);
+}
+
+bool ConfigManager::onChange(ConfigChangeCallback callback) {
+    if (!callback || listenerCount >= CONFIG_MAX_LISTENERS) {
+        return false;
+    }
+    listeners[listenerCount++] = callback;
+    return true;
+}
+
+// =============================================================================
+// Commit
+// =============================================================================
+
+bool ConfigManager::commit(Entry& entry) {
+    bool ok = false;
+    switch (entry.type) {
+        case ValueType::STRING:
+            ok = prefs.putString(entry.key, entry.text) > 0 || entry.text.length() == 0;
+            wear.bytesWritten += entry.text.length() + 1;
+            break;
+        case ValueType::INT:
+            ok = prefs.putInt(entry.key, entry.number) > 0;
+            wear.bytesWritten += sizeof(int32_t);
+            break;
+        case ValueType::BOOL:
+            ok = prefs.putBool(entry.key, entry.number != 0) > 0;
+            wear.bytesWritten += 1;
+            break;
+        case ValueType::ABSENT:
+            ok = true;
+            break;
+    }
+    wear.keysWritten++;
+    return ok;
+}
+
+bool ConfigManager::flush() {
+    if (dirtyCount == 0) {
+        return true;
+    }
     begin();
-    prefs.remove(key);
+
+    int written = 0;
+    int failed = 0;
+    for (int i = 0; i < entryCount; i++) {
+        Entry& entry = entries[i];
+        if (!entry.dirty) {
+            continue;
+        }
+        if (commit(entry)) {
+            entry.dirty = false;
+            dirtyCount--;
+            written++;
+        } else {
+            wear.failures++;
+            failed++;
+        }
+    }
+    wear.commits++;
+
+    if (failed > 0) {
+        // Retry after another settle period
+        Logger.logln("Config: %d of %d keys failed to commit", failed, written + failed);
+        firstDirtyMs = lastChangeMs = millis();
+        return false;
+    }
+    return true;
+}
+
+void ConfigManager::loop() {
+    if (dirtyCount == 0) {
+        return;
+    }
+    unsigned long now = millis();
+    if (now - lastChangeMs >= CONFIG_COMMIT_DELAY_MS || now - firstDirtyMs >= CONFIG_MAX_COMMIT_DELAY_MS) {
+        flush();
+    }
 }
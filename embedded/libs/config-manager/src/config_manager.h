@@ -6,17 +6,79 @@
 
 #define CONFIG_NAMESPACE "boardsesh"
 
+// Keys held in the RAM cache. Beyond this, reads and writes go straight to NVS.
+#define CONFIG_MAX_ENTRIES 32
+
+// NVS keys are at most 15 characters
+#define CONFIG_KEY_MAX_LEN 16
+
+// Changes are committed to NVS once no key has changed for this long...
+#define CONFIG_COMMIT_DELAY_MS 2000
+
+// ...or at the latest this long after the first uncommitted change
+#define CONFIG_MAX_COMMIT_DELAY_MS 10000
+
+// Change listeners
+#define CONFIG_MAX_LISTENERS 4
+
+/**
+ * Called after a value changes in RAM (before it reaches flash). key is
+ * nullptr when clear() dropped every key.
+ */
+typedef void (*ConfigChangeCallback)(const char* key);
+
+/**
+ * Flash wear accounting since boot.
+ */
+struct ConfigWearStats {
+    uint32_t commits;          // Batched commits to NVS
+    uint32_t keysWritten;      // Individual NVS writes and removals
+    uint32_t bytesWritten;     // Value bytes written
+    uint32_t writesCoalesced;  // Changes superseded in RAM before they were committed
+    uint32_t writesSkipped;    // Sets that did not change the value
+    uint32_t failures;         // NVS writes that failed (retried at the next commit)
+    uint32_t nvsReads;         // Reads that missed the cache
+};
+
+/**
+ * ConfigManager keeps device settings in a RAM cache in front of NVS.
+ *
+ * A key is read from NVS the first time it is asked for (absent keys are
+ * cached too); later reads are a lookup in a small table with no flash
+ * access or allocation beyond the returned String. getCString() avoids even
+ * that.
+ *
+ * Setters update the cache and notify listeners at once, but flash writes
+ * are deferred: loop() commits every changed key in one batch after the
+ * values settle. A key that changes several times before the commit costs
+ * one write, and a set that does not change the value costs none. Call
+ * flush() before restarting so nothing pending is lost. Byte arrays are
+ * not cached and write through.
+ *
+ * Not thread-safe: use from the loop task (setup(), scheduler tasks, web
+ * handlers), like every current caller.
+ */
 class ConfigManager {
   public:
     ConfigManager();
 
     void begin();
+
+    /** Commit pending changes and close NVS */
     void end();
 
     // String values
     String getString(const char* key, const String& defaultValue = "");
     bool setString(const char* key, const String& value);
 
+    /**
+     * Cached string without a copy. The pointer is only valid until the next
+     * write to the config (any set, remove, clear() or reset()) or the next
+     * getCString() call; copy it to keep it longer. Keys that do not fit the
+     * cache are read into one shared buffer.
+     */
+    const char* getCString(const char* key, const char* defaultValue = "");
+
     // Integer values
     int32_t getInt(const char* key, int32_t defaultValue = 0);
     bool setInt(const char* key, int32_t value);
@@ -25,7 +87,7 @@ class ConfigManager {
     bool getBool(const char* key, bool defaultValue = false);
     bool setBool(const char* key, bool value);
 
-    // Byte arrays
+    // Byte arrays (not cached, written immediately)
     size_t getBytes(const char* key, uint8_t* buffer, size_t maxLen);
     bool setBytes(const char* key, const uint8_t* buffer, size_t len);
 
@@ -38,9 +100,67 @@ class ConfigManager {
     // Remove single key
     void remove(const char* key);
 
+    /**
+     * Register a change listener.
+     * @return false if all listener slots are taken
+     */
+    bool onChange(ConfigChangeCallback callback);
+
+    /**
+     * Commit settled changes. Call periodically from the main loop.
+     */
+    void loop();
+
+    /**
+     * Commit all pending changes now.
+     * @return false if any NVS write failed
+     */
+    bool flush();
+
+    bool hasPendingWrites() const { return dirtyCount > 0; }
+    const ConfigWearStats& getWearStats() const { return wear; }
+
+    /**
+     * Drop the cache and pending writes without committing them (used by
+     * tests that reset the mock NVS).
+     */
+    void reset();
+
   private:
+    enum class ValueType : uint8_t { ABSENT = 0, STRING, INT, BOOL };
+
+    struct Entry {
+        char key[CONFIG_KEY_MAX_LEN];
+        ValueType type;
+        bool dirty;
+        int32_t number;  // INT and BOOL
+        String text;     // STRING
+    };
+
     Preferences prefs;
     bool opened;
+
+    Entry entries[CONFIG_MAX_ENTRIES];
+    int entryCount;
+    int dirtyCount;
+    unsigned long firstDirtyMs;
+    unsigned long lastChangeMs;
+    bool cacheFullLogged;
+
+    String uncachedText;  // getCString() result for a key the cache had no room for
+
+    ConfigChangeCallback listeners[CONFIG_MAX_LISTENERS];
+    int listenerCount;
+
+    ConfigWearStats wear;
+
+    Entry* find(const char* key);
+    Entry* insert(const char* key);
+    Entry* load(const char* key, ValueType type);
+    bool store(const char* key, ValueType type, int32_t number, const String* text);
+    bool writeThrough(const char* key, ValueType type, int32_t number, const String* text);
+    bool commit(Entry& entry);
+    void notify(const char* key);
 };
 
 extern ConfigManager Config;
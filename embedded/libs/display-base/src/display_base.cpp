@@ -1,36 +1,49 @@
 #include "display_base.h"
 
-#include <qrcode.h>
-
 // ============================================
 // DisplayBase Implementation
 // ============================================
 
 DisplayBase::DisplayBase()
     : _wifiConnected(false), _backendConnected(false), _bleEnabled(false), _bleConnected(false), _hasClimb(false),
-      _angle(0), _boardType("kilter"), _queueIndex(-1), _queueTotal(0), _hasNavigation(false), _hasQRCode(false),
-      _queueCount(0), _currentQueueIndex(-1), _pendingNavigation(false) {}
-
-DisplayBase::~DisplayBase() {}
+      _gradeId(GRADE_ID_UNKNOWN), _angle(0), _boardType("kilter"), _queueCount(0), _currentQueueIndex(-1),
+      _pendingNavigation(false), _queueIndex(-1), _queueTotal(0), _hasNavigation(false), _qrCode(), _qrGeneration(0),
+      _hasQRCode(false), _snapshotQueueGeneration(0), _stateQr(), _stateQrGeneration(0), _stateHasQRCode(false),
+      _renderTask(nullptr), _renderLock(nullptr), _drawLock(nullptr), _screenEpoch(0) {}
+
+DisplayBase::~DisplayBase() {
+    if (_renderTask) {
+        vTaskDelete(_renderTask);
+    }
+    if (_renderLock) {
+        vSemaphoreDelete(_renderLock);
+    }
+    if (_drawLock) {
+        vSemaphoreDelete(_drawLock);
+    }
+}
 
 // ============================================
 // Status Management
 // ============================================
 
 void DisplayBase::setWiFiStatus(bool connected) {
-    _wifiConnected = connected;
-    onStatusChanged();
+    DisplayLock lock(*this);
+    _state.wifiConnected = connected;
+    requestRender(RENDER_STATUS);
 }
 
 void DisplayBase::setBackendStatus(bool connected) {
-    _backendConnected = connected;
-    onStatusChanged();
+    DisplayLock lock(*this);
+    _state.backendConnected = connected;
+    requestRender(RENDER_STATUS);
 }
 
 void DisplayBase::setBleStatus(bool enabled, bool connected) {
-    _bleEnabled = enabled;
-    _bleConnected = connected;
-    onStatusChanged();
+    DisplayLock lock(*this);
+    _state.bleEnabled = enabled;
+    _state.bleConnected = connected;
+    requestRender(RENDER_STATUS);
 }
 
 // ============================================
@@ -38,59 +51,65 @@ void DisplayBase::setBleStatus(bool enabled, bool connected) {
 // ============================================
 
 void DisplayBase::setSessionId(const char* sessionId) {
-    _sessionId = sessionId ? sessionId : "";
-}
+    DisplayLock lock(*this);
+    _state.sessionId = sessionId ? sessionId : "";
 
-void DisplayBase::showClimb(const char* name, const char* grade, const char* gradeColor, int angle, const char* uuid,
-                            const char* boardType) {
-    _climbName = name ? name : "";
-    _grade = grade ? grade : "";
-    _gradeColor = gradeColor ? gradeColor : "";
-    _angle = angle;
-    _climbUuid = uuid ? uuid : "";
-    _boardType = boardType ? boardType : "kilter";
-    _hasClimb = true;
-
-    // Generate QR code for the session (boardsesh.com/join/{sessionId})
-    if (_sessionId.length() > 0) {
+    // Join QR code (boardsesh.com/join/{sessionId}), encoded here once per
+    // session rather than on every climb change
+    if (_state.sessionId.length() > 0) {
         String url = "https://www.boardsesh.com/join/";
-        url += _sessionId;
+        url += _state.sessionId;
         setQRCodeUrl(url.c_str());
+    } else {
+        _stateQrUrl = "";
+        _stateHasQRCode = false;
     }
+}
 
-    refresh();
+void DisplayBase::showClimb(const char* name, const char* grade, const char* gradeColor, int angle, const char* uuid,
+                            const char* boardType) {
+    DisplayLock lock(*this);
+    _state.climbName = name ? name : "";
+    _state.grade = grade ? grade : "";
+    _state.gradeId = gradeIdFromString(grade);
+    _state.gradeColor = gradeColor ? gradeColor : "";
+    _state.angle = angle;
+    _state.climbUuid = uuid ? uuid : "";
+    _state.boardType = boardType ? boardType : "kilter";
+    _state.hasClimb = true;
+    _stateHasQRCode = _stateQrUrl.length() > 0;
+
+    requestRender(RENDER_FULL);
 }
 
 void DisplayBase::showClimbInfoOnly(const char* name, const char* grade, const char* gradeColor, int angle,
                                      const char* uuid, const char* boardType) {
-    _climbName = name ? name : "";
-    _grade = grade ? grade : "";
-    _gradeColor = gradeColor ? gradeColor : "";
-    _angle = angle;
-    _climbUuid = uuid ? uuid : "";
-    _boardType = boardType ? boardType : "kilter";
-    _hasClimb = true;
-
-    // Generate QR code for the session (boardsesh.com/join/{sessionId})
-    if (_sessionId.length() > 0) {
-        String url = "https://www.boardsesh.com/join/";
-        url += _sessionId;
-        setQRCodeUrl(url.c_str());
-    }
-
-    refreshInfoOnly();
+    DisplayLock lock(*this);
+    _state.climbName = name ? name : "";
+    _state.grade = grade ? grade : "";
+    _state.gradeId = gradeIdFromString(grade);
+    _state.gradeColor = gradeColor ? gradeColor : "";
+    _state.angle = angle;
+    _state.climbUuid = uuid ? uuid : "";
+    _state.boardType = boardType ? boardType : "kilter";
+    _state.hasClimb = true;
+    _stateHasQRCode = _stateQrUrl.length() > 0;
+
+    requestRender(RENDER_INFO);
 }
 
 void DisplayBase::showNoClimb() {
-    _hasClimb = false;
-    _climbName = "";
-    _grade = "";
-    _gradeColor = "";
-    _angle = 0;
-    _climbUuid = "";
-    _hasQRCode = false;
-
-    refresh();
+    DisplayLock lock(*this);
+    _state.hasClimb = false;
+    _state.climbName = "";
+    _state.grade = "";
+    _state.gradeId = GRADE_ID_UNKNOWN;
+    _state.gradeColor = "";
+    _state.angle = 0;
+    _state.climbUuid = "";
+    _stateHasQRCode = false;
+
+    requestRender(RENDER_FULL);
 }
 
 // ============================================
@@ -98,6 +117,7 @@ void DisplayBase::showNoClimb() {
 // ============================================
 
 void DisplayBase::addToHistory(const char* name, const char* grade, const char* gradeColor) {
+    DisplayLock lock(*this);
     if (!name || strlen(name) == 0)
         return;
 
@@ -106,15 +126,16 @@ void DisplayBase::addToHistory(const char* name, const char* grade, const char*
     entry.grade = grade ? grade : "";
     entry.gradeColor = gradeColor ? gradeColor : "";
 
-    _history.push_back(entry);
+    _state.history.push_back(entry);
 
-    while (_history.size() > MAX_HISTORY_ITEMS) {
-        _history.erase(_history.begin());
+    while (_state.history.size() > MAX_HISTORY_ITEMS) {
+        _state.history.erase(_state.history.begin());
     }
 }
 
 void DisplayBase::clearHistory() {
-    _history.clear();
+    DisplayLock lock(*this);
+    _state.history.clear();
 }
 
 // ============================================
@@ -123,19 +144,21 @@ void DisplayBase::clearHistory() {
 
 void DisplayBase::setNavigationContext(const QueueNavigationItem& prevClimb, const QueueNavigationItem& nextClimb,
                                        int currentIndex, int totalCount) {
-    _prevClimb = prevClimb;
-    _nextClimb = nextClimb;
-    _queueIndex = currentIndex;
-    _queueTotal = totalCount;
-    _hasNavigation = true;
+    DisplayLock lock(*this);
+    _state.prevClimb = prevClimb;
+    _state.nextClimb = nextClimb;
+    _state.queueIndex = currentIndex;
+    _state.queueTotal = totalCount;
+    _state.hasNavigation = true;
 }
 
 void DisplayBase::clearNavigationContext() {
-    _prevClimb.clear();
-    _nextClimb.clear();
-    _queueIndex = -1;
-    _queueTotal = 0;
-    _hasNavigation = false;
+    DisplayLock lock(*this);
+    _state.prevClimb.clear();
+    _state.nextClimb.clear();
+    _state.queueIndex = -1;
+    _state.queueTotal = 0;
+    _state.hasNavigation = false;
 }
 
 // ============================================
@@ -143,62 +166,66 @@ void DisplayBase::clearNavigationContext() {
 // ============================================
 
 void DisplayBase::setQueueFromSync(LocalQueueItem* items, int count, int currentIndex) {
+    DisplayLock lock(*this);
     clearQueue();
 
-    _queueCount = min(count, MAX_QUEUE_SIZE);
-    for (int i = 0; i < _queueCount; i++) {
-        _queueItems[i] = items[i];
+    _state.queueCount = min(count, MAX_QUEUE_SIZE);
+    for (int i = 0; i < _state.queueCount; i++) {
+        _state.queueItems[i] = items[i];
     }
 
-    _currentQueueIndex = currentIndex;
-    _pendingNavigation = false;
+    _state.currentQueueIndex = currentIndex;
+    _state.pendingNavigation = false;
+    _state.queueGeneration++;
 
     // Update navigation context to match new queue state
-    if (_queueCount > 0 && _currentQueueIndex >= 0 && _currentQueueIndex < _queueCount) {
+    if (_state.queueCount > 0 && _state.currentQueueIndex >= 0 && _state.currentQueueIndex < _state.queueCount) {
         QueueNavigationItem prevItem, nextItem;
 
-        if (_currentQueueIndex > 0) {
-            const LocalQueueItem& prev = _queueItems[_currentQueueIndex - 1];
+        if (_state.currentQueueIndex > 0) {
+            const LocalQueueItem& prev = _state.queueItems[_state.currentQueueIndex - 1];
             prevItem = QueueNavigationItem(prev.name, prev.grade, "");
         }
 
-        if (_currentQueueIndex < _queueCount - 1) {
-            const LocalQueueItem& next = _queueItems[_currentQueueIndex + 1];
+        if (_state.currentQueueIndex < _state.queueCount - 1) {
+            const LocalQueueItem& next = _state.queueItems[_state.currentQueueIndex + 1];
             nextItem = QueueNavigationItem(next.name, next.grade, "");
         }
 
-        setNavigationContext(prevItem, nextItem, _currentQueueIndex, _queueCount);
+        setNavigationContext(prevItem, nextItem, _state.currentQueueIndex, _state.queueCount);
     } else {
         clearNavigationContext();
     }
 }
 
 void DisplayBase::clearQueue() {
+    DisplayLock lock(*this);
     for (int i = 0; i < MAX_QUEUE_SIZE; i++) {
-        _queueItems[i].clear();
+        _state.queueItems[i].clear();
     }
-    _queueCount = 0;
-    _currentQueueIndex = -1;
-    _pendingNavigation = false;
+    _state.queueCount = 0;
+    _state.currentQueueIndex = -1;
+    _state.pendingNavigation = false;
+    _state.queueGeneration++;
 }
 
 const LocalQueueItem* DisplayBase::getQueueItem(int index) const {
-    if (index < 0 || index >= _queueCount) {
+    if (index < 0 || index >= _state.queueCount) {
         return nullptr;
     }
-    return &_queueItems[index];
+    return &_state.queueItems[index];
 }
 
 const LocalQueueItem* DisplayBase::getCurrentQueueItem() const {
-    return getQueueItem(_currentQueueIndex);
+    return getQueueItem(_state.currentQueueIndex);
 }
 
 const LocalQueueItem* DisplayBase::getPreviousQueueItem() const {
-    return getQueueItem(_currentQueueIndex - 1);
+    return getQueueItem(_state.currentQueueIndex - 1);
 }
 
 const LocalQueueItem* DisplayBase::getNextQueueItem() const {
-    return getQueueItem(_currentQueueIndex + 1);
+    return getQueueItem(_state.currentQueueIndex + 1);
 }
 
 // ============================================
@@ -206,104 +233,108 @@ const LocalQueueItem* DisplayBase::getNextQueueItem() const {
 // ============================================
 
 bool DisplayBase::navigateToPrevious() {
+    DisplayLock lock(*this);
     if (!canNavigatePrevious()) {
         return false;
     }
 
-    _currentQueueIndex--;
-    _pendingNavigation = true;
+    _state.currentQueueIndex--;
+    _state.pendingNavigation = true;
 
     const LocalQueueItem* current = getCurrentQueueItem();
     if (current) {
         QueueNavigationItem prevItem, nextItem;
 
-        if (_currentQueueIndex > 0) {
+        if (_state.currentQueueIndex > 0) {
             const LocalQueueItem* prev = getPreviousQueueItem();
             if (prev) {
                 prevItem = QueueNavigationItem(prev->name, prev->grade, "");
             }
         }
 
-        if (_currentQueueIndex < _queueCount - 1) {
+        if (_state.currentQueueIndex < _state.queueCount - 1) {
             const LocalQueueItem* next = getNextQueueItem();
             if (next) {
                 nextItem = QueueNavigationItem(next->name, next->grade, "");
             }
         }
 
-        setNavigationContext(prevItem, nextItem, _currentQueueIndex, _queueCount);
+        setNavigationContext(prevItem, nextItem, _state.currentQueueIndex, _state.queueCount);
     }
 
     return true;
 }
 
 bool DisplayBase::navigateToNext() {
+    DisplayLock lock(*this);
     if (!canNavigateNext()) {
         return false;
     }
 
-    _currentQueueIndex++;
-    _pendingNavigation = true;
+    _state.currentQueueIndex++;
+    _state.pendingNavigation = true;
 
     const LocalQueueItem* current = getCurrentQueueItem();
     if (current) {
         QueueNavigationItem prevItem, nextItem;
 
-        if (_currentQueueIndex > 0) {
+        if (_state.currentQueueIndex > 0) {
             const LocalQueueItem* prev = getPreviousQueueItem();
             if (prev) {
                 prevItem = QueueNavigationItem(prev->name, prev->grade, "");
             }
         }
 
-        if (_currentQueueIndex < _queueCount - 1) {
+        if (_state.currentQueueIndex < _state.queueCount - 1) {
             const LocalQueueItem* next = getNextQueueItem();
             if (next) {
                 nextItem = QueueNavigationItem(next->name, next->grade, "");
             }
         }
 
-        setNavigationContext(prevItem, nextItem, _currentQueueIndex, _queueCount);
+        setNavigationContext(prevItem, nextItem, _state.currentQueueIndex, _state.queueCount);
     }
 
     return true;
 }
 
 bool DisplayBase::navigateToIndex(int index) {
+    DisplayLock lock(*this);
     if (!canNavigateToIndex(index)) {
         return false;
     }
 
-    _currentQueueIndex = index;
-    _pendingNavigation = true;
+    _state.currentQueueIndex = index;
+    _state.pendingNavigation = true;
 
     const LocalQueueItem* current = getCurrentQueueItem();
     if (current) {
         QueueNavigationItem prevItem, nextItem;
 
-        if (_currentQueueIndex > 0) {
+        if (_state.currentQueueIndex > 0) {
             const LocalQueueItem* prev = getPreviousQueueItem();
             if (prev) {
                 prevItem = QueueNavigationItem(prev->name, prev->grade, "");
             }
         }
 
-        if (_currentQueueIndex < _queueCount - 1) {
+        if (_state.currentQueueIndex < _state.queueCount - 1) {
             const LocalQueueItem* next = getNextQueueItem();
             if (next) {
                 nextItem = QueueNavigationItem(next->name, next->grade, "");
             }
         }
 
-        setNavigationContext(prevItem, nextItem, _currentQueueIndex, _queueCount);
+        setNavigationContext(prevItem, nextItem, _state.currentQueueIndex, _state.queueCount);
     }
 
     return true;
 }
 
 void DisplayBase::setCurrentQueueIndex(int index) {
-    if (index >= 0 && index < _queueCount) {
-        _currentQueueIndex = index;
+    DisplayLock lock(*this);
+    if (index >= 0 && index < _state.queueCount) {
+        _state.currentQueueIndex = index;
     }
 }
 
@@ -312,13 +343,196 @@ const char* DisplayBase::getPendingQueueItemUuid() const {
     return current ? current->uuid : nullptr;
 }
 
+// ============================================
+// Render Task
+// ============================================
+
+bool DisplayBase::startRenderTask() {
+    if (_renderTask) {
+        return true;
+    }
+
+    if (!_renderLock) {
+        _renderLock = xSemaphoreCreateRecursiveMutex();
+        if (!_renderLock) {
+            return false;
+        }
+    }
+    if (!_drawLock) {
+        _drawLock = xSemaphoreCreateRecursiveMutex();
+        if (!_drawLock) {
+            return false;
+        }
+    }
+
+    TaskHandle_t task = nullptr;
+    if (xTaskCreatePinnedToCore(renderTaskMain, "display", DISPLAY_RENDER_TASK_STACK, this,
+                                DISPLAY_RENDER_TASK_PRIORITY, &task, DISPLAY_RENDER_TASK_CORE) != pdPASS) {
+        return false;
+    }
+
+    DisplayLock lock(*this);
+    _renderTask = task;
+    return true;
+}
+
+void DisplayBase::lock() {
+    // No mutex before the task starts: everything runs on the caller's task
+    if (_renderLock) {
+        xSemaphoreTakeRecursive(_renderLock, portMAX_DELAY);
+    }
+}
+
+void DisplayBase::unlock() {
+    if (_renderLock) {
+        xSemaphoreGiveRecursive(_renderLock);
+    }
+}
+
+void DisplayBase::lockDraw() {
+    if (_drawLock) {
+        xSemaphoreTakeRecursive(_drawLock, portMAX_DELAY);
+    }
+}
+
+void DisplayBase::unlockDraw() {
+    if (_drawLock) {
+        xSemaphoreGiveRecursive(_drawLock);
+    }
+}
+
+void DisplayBase::resetRenderMetrics() {
+    DisplayLock lock(*this);
+    _renderQueue.resetMetrics();
+}
+
+void DisplayBase::requestRender(uint8_t flags) {
+    DisplayLock lock(*this);
+    bool wake = _renderQueue.publish(flags, micros());
+
+    if (!_renderTask) {
+        renderPending();
+    } else if (wake) {
+        xTaskNotifyGive(_renderTask);
+    }
+}
+
+void DisplayBase::discardPendingRender() {
+    DisplayLock lock(*this);
+    _renderQueue.discard();
+    _screenEpoch++;
+}
+
+void DisplayBase::renderTaskMain(void* param) {
+    DisplayBase* display = static_cast<DisplayBase*>(param);
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        display->renderPending();
+    }
+}
+
+void DisplayBase::renderPending() {
+    uint32_t publishedUs = 0;
+    uint8_t flags;
+    uint32_t epoch;
+    {
+        DisplayLock lock(*this);
+        flags = _renderQueue.take(publishedUs);
+        if (flags == 0) {
+            return;
+        }
+        snapshotState();
+        epoch = _screenEpoch;
+    }
+
+    uint32_t startUs = micros();
+    {
+        DrawLock draw(*this);
+        // A full-screen mode took over after the snapshot; its screen stays
+        if (epoch != _screenEpoch) {
+            return;
+        }
+
+        if (flags & RENDER_FULL) {
+            refresh();
+        } else if (flags & RENDER_INFO) {
+            refreshInfoOnly();
+        } else {
+            if (flags & RENDER_STATUS) {
+                onStatusChanged();
+            }
+            if (flags & RENDER_SCROLL) {
+                onScrollChanged();
+            }
+        }
+    }
+
+    DisplayLock lock(*this);
+    _renderQueue.recordRender(publishedUs, startUs, micros());
+}
+
+void DisplayBase::snapshotState() {
+    _wifiConnected = _state.wifiConnected;
+    _backendConnected = _state.backendConnected;
+    _bleEnabled = _state.bleEnabled;
+    _bleConnected = _state.bleConnected;
+
+    _hasClimb = _state.hasClimb;
+    _climbName = _state.climbName;
+    _grade = _state.grade;
+    _gradeId = _state.gradeId;
+    _gradeColor = _state.gradeColor;
+    _angle = _state.angle;
+    _climbUuid = _state.climbUuid;
+    _boardType = _state.boardType;
+
+    _sessionId = _state.sessionId;
+    _history = _state.history;
+
+    // The queue is ~18 KB; copy it only when its items changed
+    if (_snapshotQueueGeneration != _state.queueGeneration) {
+        for (int i = 0; i < _state.queueCount; i++) {
+            _queueItems[i] = _state.queueItems[i];
+        }
+        _snapshotQueueGeneration = _state.queueGeneration;
+    }
+    _queueCount = _state.queueCount;
+    _currentQueueIndex = _state.currentQueueIndex;
+    _pendingNavigation = _state.pendingNavigation;
+
+    _prevClimb = _state.prevClimb;
+    _nextClimb = _state.nextClimb;
+    _queueIndex = _state.queueIndex;
+    _queueTotal = _state.queueTotal;
+    _hasNavigation = _state.hasNavigation;
+
+    if (_qrGeneration != _stateQrGeneration) {
+        memcpy(_qrCodeData, _stateQrData, sizeof(_qrCodeData));
+        _qrCode = _stateQr;
+        _qrCode.modules = _qrCodeData;
+        _qrGeneration = _stateQrGeneration;
+    }
+    _qrUrl = _stateQrUrl;
+    _hasQRCode = _stateHasQRCode;
+}
+
 // ============================================
 // QR Code
 // ============================================
 
 void DisplayBase::setQRCodeUrl(const char* url) {
-    _qrUrl = url;
-    _hasQRCode = true;
+    if (_stateQrUrl == url) {
+        return;
+    }
+
+    if (qrcode_initText(&_stateQr, _stateQrData, QR_VERSION, ECC_LOW, url) != 0) {
+        // Too long for version 6; show no code rather than a stale one
+        _stateQrUrl = "";
+        _stateHasQRCode = false;
+        return;
+    }
+    _stateQrUrl = url;
+    _stateQrGeneration++;
 }
 
 // ============================================
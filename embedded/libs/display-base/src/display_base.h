@@ -2,15 +2,68 @@
 #define DISPLAY_BASE_H
 
 #include <Arduino.h>
+#include <qrcode.h>
 #include <vector>
 
 #include "display_types.h"
+#include "grade_colors.h"
+#include "render_queue.h"
+
+// Render task (core 0: redraws run beside the loop task's network and BLE handling)
+#define DISPLAY_RENDER_TASK_STACK 8192
+#define DISPLAY_RENDER_TASK_PRIORITY 1
+#define DISPLAY_RENDER_TASK_CORE 0
 
 // ============================================
 // Abstract Display Base Class
 // ============================================
 // Manages all shared state (climb, queue, navigation, status)
 // and delegates rendering to subclass-specific draw methods.
+//
+// Once startRenderTask() has run, state setters only publish a render
+// request and return; the render task draws the latest state. Code that
+// changes several pieces of state for one update holds a DisplayLock so the
+// task never sees it half done.
+//
+// The render task holds the DisplayLock only while it copies the desired
+// state into the render-side snapshot (the protected members below), then
+// draws from the snapshot under a separate DrawLock. Setters therefore never
+// wait for a frame. Code that draws directly (full-screen modes, touch
+// feedback) holds a DrawLock instead. The render task never holds both.
+
+/**
+ * Desired UI state, written by the setters under the DisplayLock.
+ */
+struct DisplayState {
+    bool wifiConnected = false;
+    bool backendConnected = false;
+    bool bleEnabled = false;
+    bool bleConnected = false;
+
+    bool hasClimb = false;
+    String climbName;
+    String grade;
+    uint8_t gradeId = GRADE_ID_UNKNOWN;
+    String gradeColor;
+    int angle = 0;
+    String climbUuid;
+    String boardType = "kilter";
+
+    String sessionId;
+    std::vector<ClimbHistoryEntry> history;
+
+    LocalQueueItem queueItems[MAX_QUEUE_SIZE];
+    int queueCount = 0;
+    int currentQueueIndex = -1;
+    bool pendingNavigation = false;
+    uint32_t queueGeneration = 0;  // Bumped when the items change, so the snapshot copies them only then
+
+    QueueNavigationItem prevClimb;
+    QueueNavigationItem nextClimb;
+    int queueIndex = -1;
+    int queueTotal = 0;
+    bool hasNavigation = false;
+};
 
 class DisplayBase {
   public:
@@ -51,15 +104,19 @@ class DisplayBase {
     // ====== Local queue management ======
     void setQueueFromSync(LocalQueueItem* items, int count, int currentIndex);
     void clearQueue();
-    int getQueueCount() const { return _queueCount; }
-    int getCurrentQueueIndex() const { return _currentQueueIndex; }
+    int getQueueCount() const { return _state.queueCount; }
+    int getCurrentQueueIndex() const { return _state.currentQueueIndex; }
     const LocalQueueItem* getQueueItem(int index) const;
     const LocalQueueItem* getCurrentQueueItem() const;
     const LocalQueueItem* getPreviousQueueItem() const;
     const LocalQueueItem* getNextQueueItem() const;
-    bool canNavigatePrevious() const { return _queueCount > 0 && _currentQueueIndex > 0; }
-    bool canNavigateNext() const { return _queueCount > 0 && _currentQueueIndex < _queueCount - 1; }
-    bool canNavigateToIndex(int index) const { return _queueCount > 0 && index >= 0 && index < _queueCount; }
+    bool canNavigatePrevious() const { return _state.queueCount > 0 && _state.currentQueueIndex > 0; }
+    bool canNavigateNext() const {
+        return _state.queueCount > 0 && _state.currentQueueIndex < _state.queueCount - 1;
+    }
+    bool canNavigateToIndex(int index) const {
+        return _state.queueCount > 0 && index >= 0 && index < _state.queueCount;
+    }
 
     // ====== Optimistic navigation (returns true if navigation was possible) ======
     bool navigateToPrevious();
@@ -68,10 +125,10 @@ class DisplayBase {
     void setCurrentQueueIndex(int index);
 
     // ====== Pending navigation state (for reconciliation with backend) ======
-    bool hasPendingNavigation() const { return _pendingNavigation; }
-    void clearPendingNavigation() { _pendingNavigation = false; }
+    bool hasPendingNavigation() const { return _state.pendingNavigation; }
+    void clearPendingNavigation() { _state.pendingNavigation = false; }
     const char* getPendingQueueItemUuid() const;
-    void setPendingNavigation(bool pending) { _pendingNavigation = pending; }
+    void setPendingNavigation(bool pending) { _state.pendingNavigation = pending; }
 
     // ====== Climb display (info-only, skips board image redraw) ======
     void showClimbInfoOnly(const char* name, const char* grade, const char* gradeColor, int angle, const char* uuid,
@@ -83,16 +140,59 @@ class DisplayBase {
     // ====== Refresh info sections only (status, climb info, nav) - skips board image ======
     virtual void refreshInfoOnly() { refresh(); }
 
+    // ====== Redraw everything from the latest state (through the render task once started) ======
+    void redraw() { requestRender(RENDER_FULL); }
+
+    // ====== Render task ======
+    /**
+     * Move drawing to a dedicated task. Until this is called every state
+     * change redraws synchronously in the caller.
+     */
+    bool startRenderTask();
+    bool isRenderTaskRunning() const { return _renderTask != nullptr; }
+
+    // Recursive; guards the desired state. Held by the render task only
+    // while it takes the snapshot
+    void lock();
+    void unlock();
+
+    // Recursive; held by the render task while it draws a frame
+    void lockDraw();
+    void unlockDraw();
+
+    // Frame count, render time and state-to-pixels latency
+    const RenderMetrics& getRenderMetrics() const { return _renderQueue.getMetrics(); }
+    void resetRenderMetrics();
+
     // ====== Utility ======
     static uint16_t hexToRgb565(const char* hex);
 
   protected:
+    // Queue a redraw of the latest state (RenderFlags)
+    void requestRender(uint8_t flags);
+
+    // Drop queued redraws; called by full-screen modes that replace the climb view
+    void discardPendingRender();
+
     // Called when WiFi/BLE/backend status changes (each display redraws its status bar)
     virtual void onStatusChanged() = 0;
 
-    // QR code URL management
+    // Called for RENDER_SCROLL frames (displays with a scrollable list redraw it)
+    virtual void onScrollChanged() {}
+
+    // Encode the QR code for url (skipped when it is already encoded)
     void setQRCodeUrl(const char* url);
 
+    /**
+     * Copy the desired state into the render-side members below. Called by
+     * renderPending() with the DisplayLock held; displays with state of their
+     * own override it and call the base.
+     */
+    virtual void snapshotState();
+
+    // Render-side snapshot of DisplayState, read by the draw code. Written
+    // only by snapshotState(); drawing never reads _state.
+
     // ====== Status state ======
     bool _wifiConnected;
     bool _backendConnected;
@@ -103,6 +203,7 @@ class DisplayBase {
     bool _hasClimb;
     String _climbName;
     String _grade;
+    uint8_t _gradeId;  // Resolved from _grade when the climb is set
     String _gradeColor;
     int _angle;
     String _climbUuid;
@@ -131,11 +232,70 @@ class DisplayBase {
     // ====== QR code data ======
     // QR Version 6: size = 6*4+17 = 41 modules per side
     // Buffer = ((41*41)+7)/8 = 211 bytes
+    // Encoded once per session URL; _qrGeneration changes with each new
+    // encoding so displays know when to re-rasterise their QR sprites
     static const int QR_VERSION = 6;
     static const int QR_BUFFER_SIZE = 211;
     uint8_t _qrCodeData[QR_BUFFER_SIZE];
+    QRCode _qrCode;
+    uint32_t _qrGeneration;
     String _qrUrl;
     bool _hasQRCode;
+
+  private:
+    DisplayState _state;
+    uint32_t _snapshotQueueGeneration;
+
+    // QR code for _state.sessionId, encoded by setQRCodeUrl()
+    uint8_t _stateQrData[QR_BUFFER_SIZE];
+    QRCode _stateQr;
+    uint32_t _stateQrGeneration;
+    String _stateQrUrl;
+    bool _stateHasQRCode;
+
+    RenderQueue _renderQueue;
+    TaskHandle_t _renderTask;
+    SemaphoreHandle_t _renderLock;
+    SemaphoreHandle_t _drawLock;
+
+    // Bumped by discardPendingRender(); a frame snapshotted before a
+    // full-screen mode took over is not drawn
+    uint32_t _screenEpoch;
+
+    static void renderTaskMain(void* param);
+    void renderPending();
+};
+
+/**
+ * Scoped DisplayBase::lock(). Hold one while making several related state
+ * changes or drawing through a display's LGFX device directly.
+ */
+class DisplayLock {
+  public:
+    explicit DisplayLock(DisplayBase& display) : _display(display) { _display.lock(); }
+    ~DisplayLock() { _display.unlock(); }
+
+    DisplayLock(const DisplayLock&) = delete;
+    DisplayLock& operator=(const DisplayLock&) = delete;
+
+  private:
+    DisplayBase& _display;
+};
+
+/**
+ * Scoped DisplayBase::lockDraw(). Hold one while drawing outside the render
+ * task. Take it before a DisplayLock, never while holding one.
+ */
+class DrawLock {
+  public:
+    explicit DrawLock(DisplayBase& display) : _display(display) { _display.lockDraw(); }
+    ~DrawLock() { _display.unlockDraw(); }
+
+    DrawLock(const DrawLock&) = delete;
+    DrawLock& operator=(const DrawLock&) = delete;
+
+  private:
+    DisplayBase& _display;
 };
 
 #endif  // DISPLAY_BASE_H
@@ -27,15 +27,15 @@
 // Maximum number of queue items to store locally
 #define MAX_QUEUE_SIZE 150
 
-// Optimized queue item structure (~88 bytes per item)
+// Optimized queue item structure (~120 bytes per item)
 struct LocalQueueItem {
-    char uuid[37];           // Queue item UUID (for navigation)
-    char climbUuid[37];      // Climb UUID (for display/matching)
-    char name[32];           // Climb name (truncated for display)
-    char grade[12];          // Grade string
-    uint16_t gradeColorRgb;  // RGB565 color (saves parsing)
+    char uuid[37];       // Queue item UUID (for navigation)
+    char climbUuid[37];  // Climb UUID (for display/matching)
+    char name[32];       // Climb name (truncated for display)
+    char grade[12];      // Grade string (passed on when the item becomes current)
+    uint8_t gradeId;     // Index into GRADE_INFO (grade_table.h), resolved once at sync
 
-    LocalQueueItem() : gradeColorRgb(0xFFFF) {
+    LocalQueueItem() : gradeId(0) {
         uuid[0] = '\0';
         climbUuid[0] = '\0';
         name[0] = '\0';
@@ -48,7 +48,7 @@ struct LocalQueueItem {
         climbUuid[0] = '\0';
         name[0] = '\0';
         grade[0] = '\0';
-        gradeColorRgb = 0xFFFF;
+        gradeId = 0;
     }
 };
 
@@ -0,0 +1,225 @@
+/**
+ * Grade Lookup Table
+ * Source: packages/web/app/lib/board-data.ts (BOULDER_GRADES)
+ *         packages/web/app/lib/grade-colors.ts (V_GRADE_COLORS)
+ *
+ * DO NOT EDIT MANUALLY - This file is generated by:
+ *   bun run controller:codegen:grade-table
+ *
+ * Every grade string the backend emits ("6a/V3", "6a", "V3", any case) maps
+ * to a grade ID through a perfect hash; the ID indexes GRADE_INFO for colors.
+ */
+
+#ifndef GRADE_TABLE_H
+#define GRADE_TABLE_H
+
+#include <stdint.h>
+
+// V-grade colors (RGB565)
+#define COLOR_V0 0xFF47   // #FFEB3B
+#define COLOR_V1 0xFE00   // #FFC107
+#define COLOR_V2 0xFCC0   // #FF9800
+#define COLOR_V3 0xFB88   // #FF7043
+#define COLOR_V4 0xFAA4   // #FF5722
+#define COLOR_V5 0xF206   // #F44336
+#define COLOR_V6 0xE1C6   // #E53935
+#define COLOR_V7 0xD165   // #D32F2F
+#define COLOR_V8 0xC145   // #C62828
+#define COLOR_V9 0xB0E3   // #B71C1C
+#define COLOR_V10 0xA0C9  // #A11B4A
+#define COLOR_V11 0x9936  // #9C27B0
+#define COLOR_V12 0x78F4  // #7B1FA2
+#define COLOR_V13 0x68D3  // #6A1B9A
+#define COLOR_V14 0x58D0  // #5C1A87
+#define COLOR_V15 0x48B1  // #4A148C
+#define COLOR_V16 0x380D  // #38006B
+#define COLOR_V17 0x280A  // #2A0054
+
+// Default color for unknown grades
+#define COLOR_GRADE_DEFAULT 0xCE59  // #C8C8C8
+
+#define GRADE_ID_UNKNOWN 0
+#define GRADE_COUNT 26
+#define GRADE_V_MAX 17
+#define GRADE_KEY_COUNT 66
+#define GRADE_HASH_SLOTS 512
+#define GRADE_HASH_SEED 27u
+
+struct GradeInfo {
+    const char* name;    // Canonical difficulty name ("6a/V3"), empty if unknown
+    const char* vGrade;  // V-grade label ("V3"), empty if unknown
+    uint16_t color;      // RGB565 background
+    uint16_t textColor;  // Black or white, whichever reads on color
+};
+
+struct GradeKey {
+    const char* key;  // Lowercase grade string
+    uint8_t id;
+};
+
+// Indexed by grade ID
+constexpr GradeInfo GRADE_INFO[GRADE_COUNT] = {
+    {"", "", COLOR_GRADE_DEFAULT, 0x0000},  // Unknown
+    {"4a/V0", "V0", COLOR_V0, 0x0000},      // 1
+    {"4b/V0", "V0", COLOR_V0, 0x0000},      // 2
+    {"4c/V0", "V0", COLOR_V0, 0x0000},      // 3
+    {"5a/V1", "V1", COLOR_V1, 0x0000},      // 4
+    {"5b/V1", "V1", COLOR_V1, 0x0000},      // 5
+    {"5c/V2", "V2", COLOR_V2, 0x0000},      // 6
+    {"6a/V3", "V3", COLOR_V3, 0x0000},      // 7
+    {"6a+/V3", "V3", COLOR_V3, 0x0000},     // 8
+    {"6b/V4", "V4", COLOR_V4, 0xFFFF},      // 9
+    {"6b+/V4", "V4", COLOR_V4, 0xFFFF},     // 10
+    {"6c/V5", "V5", COLOR_V5, 0xFFFF},      // 11
+    {"6c+/V5", "V5", COLOR_V5, 0xFFFF},     // 12
+    {"7a/V6", "V6", COLOR_V6, 0xFFFF},      // 13
+    {"7a+/V7", "V7", COLOR_V7, 0xFFFF},     // 14
+    {"7b/V8", "V8", COLOR_V8, 0xFFFF},      // 15
+    {"7b+/V8", "V8", COLOR_V8, 0xFFFF},     // 16
+    {"7c/V9", "V9", COLOR_V9, 0xFFFF},      // 17
+    {"7c+/V10", "V10", COLOR_V10, 0xFFFF},  // 18
+    {"8a/V11", "V11", COLOR_V11, 0xFFFF},   // 19
+    {"8a+/V12", "V12", COLOR_V12, 0xFFFF},  // 20
+    {"8b/V13", "V13", COLOR_V13, 0xFFFF},   // 21
+    {"8b+/V14", "V14", COLOR_V14, 0xFFFF},  // 22
+    {"8c/V15", "V15", COLOR_V15, 0xFFFF},   // 23
+    {"8c+/V16", "V16", COLOR_V16, 0xFFFF},  // 24
+    {"V17", "V17", COLOR_V17, 0xFFFF},      // 25
+};
+
+// Easiest grade ID carrying each V-grade
+constexpr uint8_t GRADE_ID_BY_V[GRADE_V_MAX + 1] = {1, 4, 6, 7, 9, 11, 13, 14, 15, 17, 18, 19, 20, 21, 22, 23, 24, 25};
+
+constexpr GradeKey GRADE_KEYS[GRADE_KEY_COUNT] = {
+    {"4a/v0", 1},
+    {"4a", 1},
+    {"v0", 1},
+    {"4b/v0", 2},
+    {"4b", 2},
+    {"4c/v0", 3},
+    {"4c", 3},
+    {"5a/v1", 4},
+    {"5a", 4},
+    {"v1", 4},
+    {"5b/v1", 5},
+    {"5b", 5},
+    {"5c/v2", 6},
+    {"5c", 6},
+    {"v2", 6},
+    {"6a/v3", 7},
+    {"6a", 7},
+    {"v3", 7},
+    {"6a+/v3", 8},
+    {"6a+", 8},
+    {"6b/v4", 9},
+    {"6b", 9},
+    {"v4", 9},
+    {"6b+/v4", 10},
+    {"6b+", 10},
+    {"6c/v5", 11},
+    {"6c", 11},
+    {"v5", 11},
+    {"6c+/v5", 12},
+    {"6c+", 12},
+    {"7a/v6", 13},
+    {"7a", 13},
+    {"v6", 13},
+    {"7a+/v7", 14},
+    {"7a+", 14},
+    {"v7", 14},
+    {"7b/v8", 15},
+    {"7b", 15},
+    {"v8", 15},
+    {"7b+/v8", 16},
+    {"7b+", 16},
+    {"7c/v9", 17},
+    {"7c", 17},
+    {"v9", 17},
+    {"7c+/v10", 18},
+    {"7c+", 18},
+    {"v10", 18},
+    {"8a/v11", 19},
+    {"8a", 19},
+    {"v11", 19},
+    {"8a+/v12", 20},
+    {"8a+", 20},
+    {"v12", 20},
+    {"8b/v13", 21},
+    {"8b", 21},
+    {"v13", 21},
+    {"8b+/v14", 22},
+    {"8b+", 22},
+    {"v14", 22},
+    {"8c/v15", 23},
+    {"8c", 23},
+    {"v15", 23},
+    {"8c+/v16", 24},
+    {"8c+", 24},
+    {"v16", 24},
+    {"v17", 25},
+};
+
+// Hash slot -> GRADE_KEYS index + 1 (0 = empty)
+constexpr uint8_t GRADE_HASH_TABLE[GRADE_HASH_SLOTS] = {
+    0, 0, 0, 0, 0, 0, 0, 11, 0, 49, 0, 0, 0, 59, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 0, 0, 0, 0,
+    0, 0, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 50, 0,
+    0, 0, 0, 26, 0, 0, 0, 28, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 0,
+    51, 0, 0, 0, 0, 0, 0, 16, 3, 0, 0, 0, 0, 0, 0, 25,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 34,
+    0, 57, 0, 0, 0, 0, 0, 0, 0, 0, 62, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 0, 0, 32, 0,
+    0, 58, 37, 0, 23, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 63, 0, 0, 0, 6, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 64, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 61, 0, 0, 0, 65, 0, 0, 0, 0, 0, 0, 0, 35,
+    60, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    42, 0, 0, 0, 0, 0, 0, 7, 56, 0, 0, 38, 0, 0, 0, 0,
+    0, 18, 24, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 27, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    55, 0, 0, 44, 66, 45, 0, 0, 0, 0, 0, 0, 0, 36, 0, 0,
+    41, 0, 0, 0, 0, 0, 0, 0, 0, 12, 0, 0, 0, 0, 0, 0,
+    8, 0, 0, 0, 5, 0, 0, 0, 43, 0, 0, 31, 0, 0, 15, 0,
+    0, 0, 0, 0, 0, 0, 52, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    20, 21, 0, 0, 0, 0, 0, 0, 0, 54, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 40, 0, 0, 22, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4,
+    39, 47, 0, 0, 0, 0, 0, 0, 0, 0, 33, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 30, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+constexpr char gradeLower(char c) {
+    return (c >= 'A' && c <= 'Z') ? (char)(c + ('a' - 'A')) : c;
+}
+
+/** Case-insensitive FNV-1a over a grade string */
+constexpr uint32_t gradeHash(const char* s, uint32_t h = 2166136261u ^ GRADE_HASH_SEED) {
+    return *s ? gradeHash(s + 1, (h ^ (uint8_t)gradeLower(*s)) * 16777619u) : h;
+}
+
+/**
+ * Exact lookup of a grade string
+ * @return Grade ID, GRADE_ID_UNKNOWN if the string is not on the scale
+ */
+inline uint8_t gradeIdLookup(const char* grade) {
+    if (!grade || !grade[0]) return GRADE_ID_UNKNOWN;
+    uint8_t entry = GRADE_HASH_TABLE[gradeHash(grade) & (GRADE_HASH_SLOTS - 1)];
+    if (entry == 0) return GRADE_ID_UNKNOWN;
+
+    const char* key = GRADE_KEYS[entry - 1].key;
+    const char* p = grade;
+    while (*p && gradeLower(*p) == *key) {
+        p++;
+        key++;
+    }
+    return (*p == '\0' && *key == '\0') ? GRADE_KEYS[entry - 1].id : GRADE_ID_UNKNOWN;
+}
+
+#endif  // GRADE_TABLE_H
@@ -0,0 +1,67 @@
+#include "hold_overlay.h"
+
+#include <algorithm>
+
+HoldOverlay::HoldOverlay() : _currentCount(0), _restoreCount(0), _drawCount(0), _restoredPixels(0) {}
+
+void HoldOverlay::reset() {
+    _currentCount = 0;
+    _restoreCount = 0;
+    _drawCount = 0;
+    _restoredPixels = 0;
+}
+
+void HoldOverlay::addRestore(const WidgetRect& rect) {
+    _restore[_restoreCount++] = rect;
+    _restoredPixels += rect.area();
+}
+
+void HoldOverlay::update(HoldCircle* next, int count) {
+    count = min(count, HOLD_OVERLAY_MAX_CIRCLES);
+    std::sort(next, next + count,
+              [](const HoldCircle& a, const HoldCircle& b) { return a.position < b.position; });
+
+    _restoreCount = 0;
+    _drawCount = 0;
+    _restoredPixels = 0;
+
+    bool changed[HOLD_OVERLAY_MAX_CIRCLES];
+
+    // Merge walk over both sorted sets
+    int i = 0, j = 0;
+    while (i < _currentCount || j < count) {
+        if (j >= count || (i < _currentCount && _current[i].position < next[j].position)) {
+            addRestore(_current[i++].bounds());
+        } else if (i >= _currentCount || next[j].position < _current[i].position) {
+            changed[j++] = true;
+        } else {
+            if (!_current[i].sameShape(next[j])) {
+                addRestore(_current[i].bounds());
+                changed[j] = true;
+            } else {
+                changed[j] = _current[i].color != next[j].color;
+            }
+            i++;
+            j++;
+        }
+    }
+
+    // Kept circles under restored background, or under a circle drawn
+    // before them, must be drawn again to keep the original stacking
+    for (j = 0; j < count; j++) {
+        WidgetRect bounds = next[j].bounds();
+        bool draw = changed[j];
+        for (int r = 0; !draw && r < _restoreCount; r++) {
+            draw = bounds.intersects(_restore[r]);
+        }
+        for (int d = 0; !draw && d < _drawCount; d++) {
+            draw = bounds.intersects(next[_draw[d]].bounds());
+        }
+        if (draw) {
+            _draw[_drawCount++] = j;
+        }
+    }
+
+    memcpy(_current, next, count * sizeof(HoldCircle));
+    _currentCount = count;
+}
@@ -0,0 +1,74 @@
+#ifndef HOLD_OVERLAY_H
+#define HOLD_OVERLAY_H
+
+#include <Arduino.h>
+
+#include "widget_renderer.h"
+
+// ============================================
+// Incremental Hold Overlay
+// ============================================
+// Tracks the hold circles currently drawn over the cached board image so a
+// climb change only restores background under removed holds and draws the
+// added or changed ones, instead of re-blitting the whole image.
+
+#define HOLD_OVERLAY_MAX_CIRCLES 512
+
+/**
+ * One hold ring in screen coordinates.
+ */
+struct HoldCircle {
+    uint16_t position;  // Hold identity across climbs (hold index or LED position)
+    int16_t x;
+    int16_t y;
+    int16_t radius;
+    int16_t innerRadius;
+    uint16_t color;  // RGB565
+
+    WidgetRect bounds() const { return WidgetRect(x - radius, y - radius, radius * 2 + 1, radius * 2 + 1); }
+    bool sameShape(const HoldCircle& other) const {
+        return x == other.x && y == other.y && radius == other.radius && innerRadius == other.innerRadius;
+    }
+};
+
+class HoldOverlay {
+  public:
+    HoldOverlay();
+
+    /**
+     * Forget the circles on screen (the image underneath was re-blitted).
+     * The next update() draws every circle.
+     */
+    void reset();
+
+    /**
+     * Plan the change from the circles on screen to next. next is sorted by
+     * position in place. Afterwards restore every restoreRect() from the
+     * background, then draw the drawIndex() circles of next, in that order.
+     * Circles left on screen that overlap a restored rect are redrawn too.
+     */
+    void update(HoldCircle* next, int count);
+
+    int restoreCount() const { return _restoreCount; }
+    const WidgetRect& restoreRect(int i) const { return _restore[i]; }
+    int drawCount() const { return _drawCount; }
+    uint16_t drawIndex(int i) const { return _draw[i]; }
+
+    int circleCount() const { return _currentCount; }
+
+    // Pixels restored and circles drawn by the last update
+    uint32_t lastRestoredPixels() const { return _restoredPixels; }
+
+  private:
+    HoldCircle _current[HOLD_OVERLAY_MAX_CIRCLES];
+    int _currentCount;
+    WidgetRect _restore[HOLD_OVERLAY_MAX_CIRCLES];
+    int _restoreCount;
+    uint16_t _draw[HOLD_OVERLAY_MAX_CIRCLES];
+    int _drawCount;
+    uint32_t _restoredPixels;
+
+    void addRestore(const WidgetRect& rect);
+};
+
+#endif  // HOLD_OVERLAY_H
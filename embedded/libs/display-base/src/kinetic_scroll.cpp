@@ -0,0 +1,109 @@
+#include "kinetic_scroll.h"
+
+#include <math.h>
+
+void KineticScroll::setExtent(int32_t contentPx, int32_t viewportPx) {
+    _maxOffset = contentPx > viewportPx ? contentPx - viewportPx : 0;
+    _offset = clamp(_offset);
+}
+
+void KineticScroll::scrollTo(int32_t offset) {
+    _flinging = false;
+    _offset = clamp(offset);
+    _anchorOffset = _offset;
+}
+
+void KineticScroll::press(int16_t y, uint32_t nowMs) {
+    _caughtFling = _flinging;
+    _flinging = false;
+    _pressed = true;
+    _dragging = false;
+    _anchorY = y;
+    _anchorOffset = _offset;
+    _lastY = y;
+    _lastSampleMs = nowMs;
+    _lastMotionMs = nowMs;
+    _velocity = 0;
+}
+
+bool KineticScroll::move(int16_t y, uint32_t nowMs) {
+    if (!_pressed) {
+        return false;
+    }
+
+    if (!_dragging) {
+        if (abs(_anchorY - y) <= KINETIC_TAP_SLOP_PX) {
+            return false;
+        }
+        // Start tracking from here so the list does not jump by the slop
+        _dragging = true;
+        _anchorY = y;
+        _anchorOffset = _offset;
+        _lastY = y;
+        _lastSampleMs = nowMs;
+        _lastMotionMs = nowMs;
+        return false;
+    }
+
+    uint32_t dt = nowMs - _lastSampleMs;
+    if (dt > 0) {
+        float instant = (float)(_lastY - y) / dt;
+        _velocity = 0.8f * instant + 0.2f * _velocity;
+        _lastSampleMs = nowMs;
+    }
+    if (y != _lastY) {
+        _lastMotionMs = nowMs;
+    }
+    _lastY = y;
+
+    int32_t offset = clamp(_anchorOffset + (_anchorY - y));
+    bool changed = offset != _offset;
+    _offset = offset;
+    return changed;
+}
+
+bool KineticScroll::release(uint32_t nowMs) {
+    if (!_pressed) {
+        return false;
+    }
+    _pressed = false;
+
+    if (!_dragging) {
+        return !_caughtFling;
+    }
+    _dragging = false;
+
+    if (nowMs - _lastMotionMs < KINETIC_RELEASE_IDLE_MS && fabsf(_velocity) >= KINETIC_MIN_FLING_PX_PER_MS) {
+        _flinging = true;
+        _flingStart = _offset;
+        _flingAmplitude = _velocity * KINETIC_TIME_CONSTANT_MS;
+        _flingStartMs = nowMs;
+    }
+    return false;
+}
+
+bool KineticScroll::step(uint32_t nowMs) {
+    if (!_flinging) {
+        return false;
+    }
+
+    float decay = expf(-(float)(nowMs - _flingStartMs) / KINETIC_TIME_CONSTANT_MS);
+    float remaining = _flingAmplitude * decay;
+    float position = _flingStart + _flingAmplitude - remaining;
+
+    int32_t offset = clamp((int32_t)lroundf(position));
+    if (fabsf(remaining) < 0.5f || offset != (int32_t)lroundf(position)) {
+        // Settled, or ran into either end of the list
+        _flinging = false;
+    }
+
+    bool changed = offset != _offset;
+    _offset = offset;
+    return changed;
+}
+
+int32_t KineticScroll::clamp(int32_t offset) const {
+    if (offset < 0) return 0;
+    if (offset > _maxOffset) return _maxOffset;
+    return offset;
+}
@@ -0,0 +1,91 @@
+#ifndef KINETIC_SCROLL_H
+#define KINETIC_SCROLL_H
+
+#include <Arduino.h>
+
+// ============================================
+// Kinetic Pixel Scrolling
+// ============================================
+// Tracks a touch drag over a scrollable list and keeps it moving after the
+// finger lifts, decaying exponentially (offset(t) = end - A * e^(-t/tau)).
+// The caller feeds it touch samples and the current time and redraws when
+// an update reports that the offset moved; it never reads a clock itself.
+
+// Movement before a press becomes a drag rather than a tap
+#define KINETIC_TAP_SLOP_PX 10
+
+// Fling decay time constant; the list travels velocity * tau in total
+#define KINETIC_TIME_CONSTANT_MS 325.0f
+
+// Release velocity below which the list stops where the finger left it
+#define KINETIC_MIN_FLING_PX_PER_MS 0.25f
+
+// A finger resting this long before lifting cancels the fling
+#define KINETIC_RELEASE_IDLE_MS 80
+
+class KineticScroll {
+  public:
+    /**
+     * Set the scrollable range. The offset is clamped to
+     * [0, contentPx - viewportPx].
+     */
+    void setExtent(int32_t contentPx, int32_t viewportPx);
+
+    /** Jump to an offset (clamped), stopping any fling */
+    void scrollTo(int32_t offset);
+
+    /** Finger down at y. Catches a running fling. */
+    void press(int16_t y, uint32_t nowMs);
+
+    /**
+     * Finger at y while pressed (call for every sample, moved or not).
+     * @return True if the offset changed
+     */
+    bool move(int16_t y, uint32_t nowMs);
+
+    /**
+     * Finger lifted; starts a fling if the drag was fast enough.
+     * @return True if the press was a tap (never dragged, did not stop a fling)
+     */
+    bool release(uint32_t nowMs);
+
+    /**
+     * Advance a fling to nowMs.
+     * @return True if the offset changed
+     */
+    bool step(uint32_t nowMs);
+
+    int32_t offset() const { return _offset; }
+    int32_t maxOffset() const { return _maxOffset; }
+    bool isPressed() const { return _pressed; }
+    bool isDragging() const { return _dragging; }
+    bool isFlinging() const { return _flinging; }
+
+    // Smoothed drag velocity in px/ms (positive scrolls towards the end)
+    float velocity() const { return _velocity; }
+
+  private:
+    int32_t clamp(int32_t offset) const;
+
+    int32_t _offset = 0;
+    int32_t _maxOffset = 0;
+
+    // Drag tracking
+    bool _pressed = false;
+    bool _dragging = false;
+    bool _caughtFling = false;
+    int16_t _anchorY = 0;
+    int32_t _anchorOffset = 0;
+    int16_t _lastY = 0;
+    uint32_t _lastSampleMs = 0;
+    uint32_t _lastMotionMs = 0;
+    float _velocity = 0;
+
+    // Fling
+    bool _flinging = false;
+    float _flingStart = 0;
+    float _flingAmplitude = 0;
+    uint32_t _flingStartMs = 0;
+};
+
+#endif  // KINETIC_SCROLL_H
@@ -0,0 +1,39 @@
+#include "qr_raster.h"
+
+int qrModuleScale(uint8_t modules, int targetPx) {
+    if (modules == 0) {
+        return 1;
+    }
+    int scale = targetPx / modules;
+    return scale < 1 ? 1 : scale;
+}
+
+int qrRasterSide(uint8_t modules, int scale, int border) {
+    return modules * scale + border * 2;
+}
+
+void qrRasterize1bpp(const uint8_t* modules, uint8_t size, int scale, int border, uint8_t* dst) {
+    int side = qrRasterSide(size, scale, border);
+    int stride = qrRasterStride(side);
+    memset(dst, 0, (size_t)stride * side);
+
+    for (int y = 0; y < size; y++) {
+        uint8_t* row = dst + (size_t)(border + y * scale) * stride;
+
+        for (int x = 0; x < size; x++) {
+            int bit = y * size + x;
+            if (!(modules[bit >> 3] & (0x80 >> (bit & 7)))) {
+                continue;
+            }
+            int px = border + x * scale;
+            for (int i = 0; i < scale; i++, px++) {
+                row[px >> 3] |= 0x80 >> (px & 7);
+            }
+        }
+
+        // Every pixel row of a module row is identical
+        for (int i = 1; i < scale; i++) {
+            memcpy(row + (size_t)i * stride, row, stride);
+        }
+    }
+}
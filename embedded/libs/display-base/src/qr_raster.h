@@ -0,0 +1,31 @@
+#ifndef QR_RASTER_H
+#define QR_RASTER_H
+
+#include <Arduino.h>
+
+// ============================================
+// QR Code Rasteriser
+// ============================================
+// Expands a QR module grid into a 1-bpp bitmap at a whole-pixel module scale
+// with a light border, laid out like a LovyanGFX 1-bit sprite (rows padded
+// to whole bytes, MSB = leftmost pixel). Set bits are dark modules, so the
+// bitmap is built once per session and every later draw is one blit.
+
+/** Whole pixels per module that fit `modules` modules into targetPx (at least 1) */
+int qrModuleScale(uint8_t modules, int targetPx);
+
+/** Bitmap side in pixels for the given scale and border */
+int qrRasterSide(uint8_t modules, int scale, int border);
+
+/** Bytes per bitmap row */
+inline int qrRasterStride(int side) { return (side + 7) / 8; }
+
+/**
+ * Rasterise a module grid.
+ * @param modules Packed grid as filled by qrcode_initText (row-major, MSB first)
+ * @param size Modules per side (QRCode::size)
+ * @param dst qrRasterStride(side) * side bytes, side = qrRasterSide(size, scale, border)
+ */
+void qrRasterize1bpp(const uint8_t* modules, uint8_t size, int scale, int border, uint8_t* dst);
+
+#endif  // QR_RASTER_H
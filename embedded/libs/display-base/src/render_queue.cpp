@@ -0,0 +1,51 @@
+#include "render_queue.h"
+
+bool RenderQueue::publish(uint8_t flags, uint32_t nowUs) {
+    bool wasIdle = _flags == 0;
+    if (wasIdle) {
+        _firstPublishedUs = nowUs;
+    }
+    _flags |= flags;
+    _pendingStates++;
+    _metrics.published++;
+    return wasIdle;
+}
+
+uint8_t RenderQueue::take(uint32_t& publishedUs) {
+    uint8_t flags = _flags;
+    if (flags == 0) {
+        return 0;
+    }
+
+    // Only the latest state is drawn; everything before it never reaches the screen
+    _metrics.dropped += _pendingStates - 1;
+    publishedUs = _firstPublishedUs;
+    _flags = 0;
+    _pendingStates = 0;
+    return flags;
+}
+
+void RenderQueue::discard() {
+    _metrics.dropped += _pendingStates;
+    _flags = 0;
+    _pendingStates = 0;
+}
+
+void RenderQueue::recordRender(uint32_t publishedUs, uint32_t startUs, uint32_t endUs) {
+    // Unsigned subtraction keeps both spans correct across a micros() wrap
+    uint32_t renderUs = endUs - startUs;
+    uint32_t latencyUs = endUs - publishedUs;
+
+    _metrics.rendered++;
+    _metrics.lastRenderUs = renderUs;
+    _metrics.totalRenderUs += renderUs;
+    if (renderUs > _metrics.maxRenderUs) {
+        _metrics.maxRenderUs = renderUs;
+    }
+
+    _metrics.lastLatencyUs = latencyUs;
+    _metrics.totalLatencyUs += latencyUs;
+    if (latencyUs > _metrics.maxLatencyUs) {
+        _metrics.maxLatencyUs = latencyUs;
+    }
+}
@@ -0,0 +1,73 @@
+#ifndef RENDER_QUEUE_H
+#define RENDER_QUEUE_H
+
+#include <Arduino.h>
+
+// ============================================
+// Coalescing Render Requests
+// ============================================
+// State setters publish what needs redrawing; the render task takes whatever
+// accumulated since its last frame and draws it once. Requests published
+// while a frame is pending merge into it, so a burst of navigation or sync
+// events costs one redraw of the latest state.
+
+enum RenderFlags : uint8_t {
+    RENDER_STATUS = 1 << 0,  // Status bar only
+    RENDER_INFO = 1 << 1,    // Everything except the board image
+    RENDER_FULL = 1 << 2,    // Whole screen
+    RENDER_SCROLL = 1 << 3,  // Scrolled content only (drag or fling frame)
+};
+
+struct RenderMetrics {
+    uint32_t published = 0;  // State changes published
+    uint32_t rendered = 0;   // Frames drawn
+    uint32_t dropped = 0;    // States superseded before they reached the screen
+
+    // Time spent drawing one frame
+    uint32_t lastRenderUs = 0;
+    uint32_t maxRenderUs = 0;
+    uint64_t totalRenderUs = 0;
+
+    // Oldest unrendered state change to end of the frame that shows it
+    uint32_t lastLatencyUs = 0;
+    uint32_t maxLatencyUs = 0;
+    uint64_t totalLatencyUs = 0;
+
+    uint32_t avgRenderUs() const { return rendered ? (uint32_t)(totalRenderUs / rendered) : 0; }
+    uint32_t avgLatencyUs() const { return rendered ? (uint32_t)(totalLatencyUs / rendered) : 0; }
+};
+
+class RenderQueue {
+  public:
+    /**
+     * Record a state change.
+     * @return True if nothing was pending before (the consumer needs waking)
+     */
+    bool publish(uint8_t flags, uint32_t nowUs);
+
+    /**
+     * Take everything published since the last take.
+     * @param publishedUs Set to the time of the oldest state change taken
+     * @return Merged RenderFlags, 0 if nothing is pending
+     */
+    uint8_t take(uint32_t& publishedUs);
+
+    /** Drop pending requests (a full-screen mode replaced the climb view) */
+    void discard();
+
+    bool isPending() const { return _flags != 0; }
+
+    /** Record a frame drawn for a request returned by take() */
+    void recordRender(uint32_t publishedUs, uint32_t startUs, uint32_t endUs);
+
+    const RenderMetrics& getMetrics() const { return _metrics; }
+    void resetMetrics() { _metrics = RenderMetrics(); }
+
+  private:
+    uint8_t _flags = 0;
+    uint32_t _pendingStates = 0;
+    uint32_t _firstPublishedUs = 0;
+    RenderMetrics _metrics;
+};
+
+#endif  // RENDER_QUEUE_H
@@ -0,0 +1,49 @@
+#include "rgb565_tiles.h"
+
+size_t rle565Decode(const uint8_t* src, size_t srcLen, uint16_t* dst, size_t dstPixels) {
+    const uint8_t* end = src + srcLen;
+    size_t written = 0;
+
+    while (src < end && written < dstPixels) {
+        uint8_t control = *src++;
+        if (control & 0x80) {
+            if (end - src < 2) {
+                break;
+            }
+            size_t n = min((size_t)(control & 0x7F) + 2, dstPixels - written);
+            uint16_t pixel;
+            memcpy(&pixel, src, 2);
+            src += 2;
+            uint16_t* out = dst + written;
+            for (size_t i = 0; i < n; i++) {
+                out[i] = pixel;
+            }
+            written += n;
+        } else {
+            size_t n = (size_t)control + 1;
+            if ((size_t)(end - src) < n * 2) {
+                break;
+            }
+            n = min(n, dstPixels - written);
+            // Literal spans are the bulk of photographic tiles; one memcpy each
+            memcpy(dst + written, src, n * 2);
+            src += ((size_t)control + 1) * 2;
+            written += n;
+        }
+    }
+    return written;
+}
+
+bool decodeRgb565Tile(const uint8_t* data, const uint32_t* tileOffsets, uint16_t tile, bool rle, uint16_t* dst,
+                      size_t dstPixels) {
+    const uint8_t* src = data + tileOffsets[tile];
+    size_t len = tileOffsets[tile + 1] - tileOffsets[tile];
+
+    if (rle) {
+        return rle565Decode(src, len, dst, dstPixels) == dstPixels;
+    }
+
+    size_t bytes = min(len, dstPixels * 2);
+    memcpy(dst, src, bytes);
+    return bytes == dstPixels * 2;
+}
@@ -0,0 +1,35 @@
+#ifndef RGB565_TILES_H
+#define RGB565_TILES_H
+
+#include <Arduino.h>
+
+// ============================================
+// Pre-decoded RGB565 Image Tiles
+// ============================================
+// Decoder for the tiled board images written by generate-board-data.mjs
+// (--image-format=rgb565 / rgb565-rle). Pixels are stored in panel byte
+// order and copied verbatim, so a tile lands in sprite memory with plain
+// memcpy instead of a JPEG decode.
+//
+// RLE stream, per tile:
+//   c < 0x80   c + 1 literal pixels follow (2 bytes each)
+//   c >= 0x80  the next pixel repeats (c & 0x7F) + 2 times
+
+/**
+ * Decode an RLE tile into dst.
+ * @return Pixels written; stops early at dstPixels or on a truncated stream
+ */
+size_t rle565Decode(const uint8_t* src, size_t srcLen, uint16_t* dst, size_t dstPixels);
+
+/**
+ * Decode tile `tile` of a tiled image into dst.
+ * @param data Image bytes (BoardConfig::imageData)
+ * @param tileOffsets tileCount + 1 byte offsets into data
+ * @param rle True for RLE tiles, false for raw RGB565
+ * @param dstPixels Pixels in the tile (width * rows)
+ * @return True if the tile filled all dstPixels
+ */
+bool decodeRgb565Tile(const uint8_t* data, const uint32_t* tileOffsets, uint16_t tile, bool rle, uint16_t* dst,
+                      size_t dstPixels);
+
+#endif  // RGB565_TILES_H
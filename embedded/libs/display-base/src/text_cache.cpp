@@ -0,0 +1,124 @@
+#include "text_cache.h"
+
+TextCacheKey textCacheKey(const char* text, const void* font, uint16_t color, uint16_t bg, int16_t w, int16_t h,
+                          uint8_t datum) {
+    if (!text) text = "";
+
+    TextCacheKey key;
+    key.hash = ContentHash()
+                   .add(text)
+                   .add(font)
+                   .add((uint32_t)color << 16 | bg)
+                   .add((uint32_t)(uint16_t)w << 16 | (uint16_t)h)
+                   .add((uint32_t)datum)
+                   .value();
+
+    // djb2, unrelated to FNV-1a, so a text collision has to hit both
+    uint32_t check = 5381;
+    size_t length = 0;
+    for (const char* c = text; *c; c++, length++) {
+        check = check * 33 + (uint8_t)*c;
+    }
+    key.check = check;
+    key.length = length > 0xFFFF ? 0xFFFF : (uint16_t)length;
+    key.font = font;
+    key.color = color;
+    key.bg = bg;
+    key.w = w;
+    key.h = h;
+    key.datum = datum;
+    return key;
+}
+
+void textDatumAnchor(uint8_t datum, int16_t w, int16_t h, int16_t& x, int16_t& y) {
+    x = (datum & 3) * w / 2;
+
+    switch (datum & 12) {
+        case 4:  // middle
+            y = h / 2;
+            break;
+        case 8:  // bottom
+        case 12:  // baseline (descenders fall outside the strip)
+            y = h;
+            break;
+        default:  // top
+            y = 0;
+            break;
+    }
+}
+
+TextCache::TextCache(uint8_t capacity)
+    : _capacity(capacity > TEXT_CACHE_MAX_ENTRIES ? TEXT_CACHE_MAX_ENTRIES : (capacity ? capacity : 1)), _clock(0) {
+    clear();
+    resetStats();
+}
+
+int TextCache::acquire(const TextCacheKey& key, bool& hit) {
+    _clock++;
+
+    int victim = 0;
+    for (int i = 0; i < _capacity; i++) {
+        Entry& e = _entries[i];
+        if (e.used && e.key == key) {
+            e.lastUse = _clock;
+            _stats.hits++;
+            hit = true;
+            return i;
+        }
+        // Prefer an empty slot, else the oldest
+        Entry& v = _entries[victim];
+        if (v.used && (!e.used || e.lastUse < v.lastUse)) {
+            victim = i;
+        }
+    }
+
+    Entry& e = _entries[victim];
+    if (e.used) {
+        _stats.evictions++;
+    }
+    e.key = key;
+    e.lastUse = _clock;
+    e.used = true;
+    _stats.misses++;
+    hit = false;
+    return victim;
+}
+
+void TextCache::release(int slot) {
+    if (slot >= 0 && slot < _capacity) {
+        _entries[slot].used = false;
+    }
+}
+
+int TextCache::evictOldest(int keep) {
+    int victim = -1;
+    for (int i = 0; i < _capacity; i++) {
+        const Entry& e = _entries[i];
+        if (i != keep && e.used && (victim < 0 || e.lastUse < _entries[victim].lastUse)) {
+            victim = i;
+        }
+    }
+    if (victim >= 0) {
+        _entries[victim].used = false;
+        _stats.evictions++;
+    }
+    return victim;
+}
+
+void TextCache::clear() {
+    memset(_entries, 0, sizeof(_entries));
+}
+
+int TextCache::size() const {
+    int count = 0;
+    for (int i = 0; i < _capacity; i++) {
+        if (_entries[i].used) {
+            count++;
+        }
+    }
+    return count;
+}
+
+void TextCache::resetStats() {
+    memset(&_stats, 0, sizeof(_stats));
+}
@@ -0,0 +1,103 @@
+#ifndef TEXT_CACHE_H
+#define TEXT_CACHE_H
+
+#include <Arduino.h>
+
+#include "widget_renderer.h"
+
+// ============================================
+// Rasterised Text Cache
+// ============================================
+// Climb names and grades repeat across refreshes and queue scrolls. The
+// display rasterises each text strip once into an off-screen surface (one
+// per slot) and blits it afterwards; this class maps strip keys to slots
+// and picks the least recently used slot to recycle on a miss.
+
+#define TEXT_CACHE_MAX_ENTRIES 64
+
+struct TextCacheStats {
+    uint32_t hits;
+    uint32_t misses;
+    uint32_t evictions;  // Occupied slots recycled by a miss or emptied by evictOldest()
+};
+
+/**
+ * Key for one text strip: the text plus everything that changes its pixels.
+ * The text itself is not stored, so it is matched on its length and two
+ * independent hashes; the other fields are compared exactly.
+ */
+struct TextCacheKey {
+    uint32_t hash;   // FNV-1a of every field, checked first
+    uint32_t check;  // Second hash of the text, compared on hit
+    uint16_t length;
+    const void* font;
+    uint16_t color;
+    uint16_t bg;
+    int16_t w;
+    int16_t h;
+    uint8_t datum;
+
+    bool operator==(const TextCacheKey& other) const {
+        return hash == other.hash && check == other.check && length == other.length && font == other.font &&
+               color == other.color && bg == other.bg && w == other.w && h == other.h && datum == other.datum;
+    }
+    bool operator!=(const TextCacheKey& other) const { return !(*this == other); }
+};
+
+/**
+ * Build the key for a strip. datum uses the LovyanGFX textdatum_t layout.
+ */
+TextCacheKey textCacheKey(const char* text, const void* font, uint16_t color, uint16_t bg, int16_t w, int16_t h,
+                          uint8_t datum);
+
+/**
+ * Point inside a w x h strip to draw text at so that it lands where
+ * drawString(text, x, y) with the same datum would (LovyanGFX textdatum_t:
+ * bits 0-1 left/centre/right, bits 2-3 top/middle/bottom/baseline).
+ */
+void textDatumAnchor(uint8_t datum, int16_t w, int16_t h, int16_t& x, int16_t& y);
+
+class TextCache {
+  public:
+    explicit TextCache(uint8_t capacity);
+
+    /**
+     * Find the slot holding key. On a miss the least recently used slot is
+     * reassigned to key and the caller rasterises into it.
+     * @param hit Set true when the slot already holds key's pixels
+     * @return Slot index in [0, capacity)
+     */
+    int acquire(const TextCacheKey& key, bool& hit);
+
+    /** Empty a slot whose rasterisation failed */
+    void release(int slot);
+
+    /**
+     * Empty the least recently used occupied slot other than keep, so the
+     * caller can free its pixels when a new strip does not fit the budget.
+     * @return The emptied slot, or -1 if no other slot is occupied
+     */
+    int evictOldest(int keep);
+
+    void clear();
+
+    uint8_t capacity() const { return _capacity; }
+    int size() const;
+
+    const TextCacheStats& getStats() const { return _stats; }
+    void resetStats();
+
+  private:
+    struct Entry {
+        TextCacheKey key;
+        uint32_t lastUse;
+        bool used;
+    };
+
+    Entry _entries[TEXT_CACHE_MAX_ENTRIES];
+    uint8_t _capacity;
+    uint32_t _clock;
+    TextCacheStats _stats;
+};
+
+#endif  // TEXT_CACHE_H
@@ -0,0 +1,234 @@
+#include "widget_renderer.h"
+
+// ============================================
+// WidgetRect / ContentHash
+// ============================================
+
+bool WidgetRect::intersects(const WidgetRect& other) const {
+    if (isEmpty() || other.isEmpty()) {
+        return false;
+    }
+    return x < other.x + other.w && other.x < x + w && y < other.y + other.h && other.y < y + h;
+}
+
+WidgetRect WidgetRect::intersection(const WidgetRect& other) const {
+    if (!intersects(other)) {
+        return WidgetRect();
+    }
+    int16_t left = max(x, other.x);
+    int16_t top = max(y, other.y);
+    int16_t right = min(x + w, other.x + other.w);
+    int16_t bottom = min(y + h, other.y + other.h);
+    return WidgetRect(left, top, right - left, bottom - top);
+}
+
+WidgetRect WidgetRect::united(const WidgetRect& other) const {
+    if (isEmpty()) {
+        return other;
+    }
+    if (other.isEmpty()) {
+        return *this;
+    }
+    int16_t left = min(x, other.x);
+    int16_t top = min(y, other.y);
+    int16_t right = max(x + w, other.x + other.w);
+    int16_t bottom = max(y + h, other.y + other.h);
+    return WidgetRect(left, top, right - left, bottom - top);
+}
+
+ContentHash& ContentHash::add(const void* data, size_t len) {
+    const uint8_t* bytes = (const uint8_t*)data;
+    for (size_t i = 0; i < len; i++) {
+        _hash ^= bytes[i];
+        _hash *= 16777619u;
+    }
+    return *this;
+}
+
+ContentHash& ContentHash::add(const char* str) {
+    if (str) {
+        while (*str) {
+            _hash ^= (uint8_t)*str++;
+            _hash *= 16777619u;
+        }
+    }
+    // Terminator keeps ("ab", "c") distinct from ("a", "bc")
+    _hash ^= 0xFF;
+    _hash *= 16777619u;
+    return *this;
+}
+
+// ============================================
+// WidgetRenderer
+// ============================================
+
+WidgetRenderer::WidgetRenderer(WidgetHost& host) : _host(host), _count(0), _damageCount(0) {
+    memset(&_last, 0, sizeof(_last));
+    memset(&_totals, 0, sizeof(_totals));
+    memset(_timing, 0, sizeof(_timing));
+}
+
+int WidgetRenderer::indexOf(uint8_t id) const {
+    for (int i = 0; i < _count; i++) {
+        if (_widgets[i].id == id) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+void WidgetRenderer::setRect(uint8_t id, const WidgetRect& rect) {
+    if (id >= WIDGET_MAX_WIDGETS) {
+        return;
+    }
+
+    int index = indexOf(id);
+    if (index < 0) {
+        if (_count >= WIDGET_MAX_WIDGETS) {
+            return;
+        }
+        Widget& widget = _widgets[_count++];
+        widget.id = id;
+        widget.rect = rect;
+        widget.hash = 0;
+        widget.invalid = true;
+        return;
+    }
+
+    Widget& widget = _widgets[index];
+    if (widget.rect == rect) {
+        return;
+    }
+
+    if (!widget.rect.isEmpty()) {
+        addDamage(widget.rect);
+    }
+    widget.rect = rect;
+    widget.invalid = true;
+}
+
+void WidgetRenderer::clear() {
+    _count = 0;
+    _damageCount = 0;
+}
+
+void WidgetRenderer::invalidate(uint8_t id) {
+    int index = indexOf(id);
+    if (index >= 0) {
+        _widgets[index].invalid = true;
+    }
+}
+
+void WidgetRenderer::invalidateAll() {
+    for (int i = 0; i < _count; i++) {
+        _widgets[i].invalid = true;
+    }
+}
+
+void WidgetRenderer::addDamage(const WidgetRect& rect) {
+    if (_damageCount < WIDGET_MAX_DAMAGE) {
+        _damage[_damageCount++] = rect;
+        return;
+    }
+
+    // List full: grow the closest entry so the old pixels are still repainted
+    int best = 0;
+    uint32_t bestGrowth = UINT32_MAX;
+    for (int i = 0; i < _damageCount; i++) {
+        uint32_t growth = _damage[i].united(rect).area() - _damage[i].area();
+        if (growth < bestGrowth) {
+            best = i;
+            bestGrowth = growth;
+        }
+    }
+    _damage[best] = _damage[best].united(rect);
+}
+
+bool WidgetRenderer::underDamage(const WidgetRect& rect) const {
+    for (int i = 0; i < _damageCount; i++) {
+        if (rect.intersects(_damage[i])) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void WidgetRenderer::render(uint32_t skipMask) {
+    unsigned long startUs = micros();
+    memset(&_last, 0, sizeof(_last));
+
+    // Rects painted so far in this pass; anything above them must repaint too
+    WidgetRect drawn[WIDGET_MAX_WIDGETS];
+    int drawnCount = 0;
+
+    for (int i = 0; i < _count; i++) {
+        Widget& widget = _widgets[i];
+
+        if (skipMask & (1u << widget.id)) {
+            if (underDamage(widget.rect)) {
+                widget.invalid = true;
+            }
+            continue;
+        }
+
+        _last.widgetsChecked++;
+        uint32_t hash = widget.rect.isEmpty() ? 0 : _host.widgetHash(widget.id);
+
+        // Repaint when the widget's pixels were lost; a content change alone
+        // leaves the old output on screen for an incremental update
+        bool repaint = widget.invalid || underDamage(widget.rect);
+        for (int d = 0; !repaint && d < drawnCount; d++) {
+            repaint = widget.rect.intersects(drawn[d]);
+        }
+        if (!repaint && hash == widget.hash) {
+            continue;
+        }
+
+        widget.hash = hash;
+        widget.invalid = false;
+        if (widget.rect.isEmpty()) {
+            continue;
+        }
+
+        _host.setWidgetClip(&widget.rect);
+        unsigned long widgetStartUs = micros();
+        _host.drawWidget(widget.id, widget.rect, !repaint);
+        uint32_t widgetUs = micros() - widgetStartUs;
+        drawn[drawnCount++] = widget.rect;
+
+        WidgetTiming& timing = _timing[widget.id];
+        timing.draws++;
+        timing.lastUs = widgetUs;
+        timing.totalUs += widgetUs;
+        if (widgetUs > timing.maxUs) {
+            timing.maxUs = widgetUs;
+        }
+
+        _last.widgetsDrawn++;
+        _last.drawnMask |= 1u << widget.id;
+        _last.pixelsDrawn += widget.rect.area();
+    }
+
+    if (drawnCount > 0) {
+        _host.setWidgetClip(nullptr);
+    }
+    _damageCount = 0;
+
+    _last.drawTimeUs = micros() - startUs;
+
+    _totals.frames++;
+    _totals.widgetsDrawn += _last.widgetsDrawn;
+    _totals.pixelsDrawn += _last.pixelsDrawn;
+    _totals.drawTimeUs += _last.drawTimeUs;
+    if (_last.pixelsDrawn > _totals.maxFramePixels) {
+        _totals.maxFramePixels = _last.pixelsDrawn;
+    }
+    if (_last.drawTimeUs > _totals.maxFrameUs) {
+        _totals.maxFrameUs = _last.drawTimeUs;
+    }
+}
+
+void WidgetRenderer::resetTotals() {
+    memset(&_totals, 0, sizeof(_totals));
+    memset(_timing, 0, sizeof(_timing));
+}
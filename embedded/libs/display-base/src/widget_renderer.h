@@ -0,0 +1,173 @@
+#ifndef WIDGET_RENDERER_H
+#define WIDGET_RENDERER_H
+
+#include <Arduino.h>
+
+// ============================================
+// Retained-Mode Widget Renderer
+// ============================================
+// Screen regions (status bar, climb info, queue rows, ...) are registered as
+// widgets with a clip rect. Each refresh asks the display for a content hash
+// per widget and only redraws widgets whose hash changed, so a queue step
+// touches a couple of rows instead of the whole panel.
+
+// Widget IDs index a 32-bit skip mask
+#define WIDGET_MAX_WIDGETS 32
+
+// Old rects of moved/resized widgets remembered until the next render
+#define WIDGET_MAX_DAMAGE 8
+
+struct WidgetRect {
+    int16_t x;
+    int16_t y;
+    int16_t w;
+    int16_t h;
+
+    WidgetRect() : x(0), y(0), w(0), h(0) {}
+    WidgetRect(int16_t x, int16_t y, int16_t w, int16_t h) : x(x), y(y), w(w), h(h) {}
+
+    bool isEmpty() const { return w <= 0 || h <= 0; }
+    uint32_t area() const { return isEmpty() ? 0 : (uint32_t)w * (uint32_t)h; }
+    bool intersects(const WidgetRect& other) const;
+    WidgetRect intersection(const WidgetRect& other) const;
+    WidgetRect united(const WidgetRect& other) const;
+    bool operator==(const WidgetRect& other) const {
+        return x == other.x && y == other.y && w == other.w && h == other.h;
+    }
+    bool operator!=(const WidgetRect& other) const { return !(*this == other); }
+};
+
+/**
+ * FNV-1a hash builder for widget content.
+ */
+class ContentHash {
+  public:
+    ContentHash() : _hash(2166136261u) {}
+
+    ContentHash& add(const void* data, size_t len);
+    ContentHash& add(const char* str);
+    ContentHash& add(const String& str) { return add(str.c_str()); }
+    ContentHash& add(int32_t value) { return add(&value, sizeof(value)); }
+    ContentHash& add(uint32_t value) { return add(&value, sizeof(value)); }
+    ContentHash& add(bool value) { return add((uint32_t)(value ? 1 : 0)); }
+    ContentHash& add(const void* ptr) { return add(&ptr, sizeof(ptr)); }
+
+    uint32_t value() const { return _hash; }
+
+  private:
+    uint32_t _hash;
+};
+
+/**
+ * Implemented by the display driver that owns the widgets.
+ */
+class WidgetHost {
+  public:
+    virtual ~WidgetHost() {}
+
+    // Hash of everything the widget's pixels depend on
+    virtual uint32_t widgetHash(uint8_t id) = 0;
+
+    // Draw the widget; it must paint every pixel of its rect. retained is true
+    // when the screen still holds the widget's previous output (only its
+    // content changed), so the host may update it incrementally.
+    virtual void drawWidget(uint8_t id, const WidgetRect& rect, bool retained) = 0;
+
+    // Restrict drawing to rect, or remove the clip when rect is null
+    virtual void setWidgetClip(const WidgetRect* rect) = 0;
+};
+
+/**
+ * Per-refresh and cumulative render statistics.
+ */
+struct WidgetRenderStats {
+    uint16_t widgetsChecked;
+    uint16_t widgetsDrawn;
+    uint32_t drawnMask;    // Bit per widget ID drawn
+    uint32_t pixelsDrawn;  // Sum of drawn widget areas (RGB565: 2 bytes each)
+    uint32_t drawTimeUs;
+};
+
+struct WidgetRenderTotals {
+    uint32_t frames;
+    uint32_t widgetsDrawn;
+    uint64_t pixelsDrawn;
+    uint64_t drawTimeUs;
+    uint32_t maxFramePixels;
+    uint32_t maxFrameUs;
+};
+
+/**
+ * Draw time of one widget across refreshes.
+ */
+struct WidgetTiming {
+    uint32_t draws;
+    uint32_t lastUs;
+    uint32_t maxUs;
+    uint64_t totalUs;
+
+    uint32_t avgUs() const { return draws ? (uint32_t)(totalUs / draws) : 0; }
+};
+
+class WidgetRenderer {
+  public:
+    explicit WidgetRenderer(WidgetHost& host);
+
+    /**
+     * Set a widget's rect, registering it on first use. Widgets are drawn in
+     * registration order, so later widgets sit on top of earlier ones. A
+     * changed rect damages the old area so widgets underneath repaint it.
+     * When the damage list is full, the old area is merged into the entry
+     * whose bounding box grows least.
+     */
+    void setRect(uint8_t id, const WidgetRect& rect);
+
+    /**
+     * Remove every widget (layout change). The caller clears the screen.
+     */
+    void clear();
+
+    // Force a redraw on the next render
+    void invalidate(uint8_t id);
+    void invalidateAll();
+
+    /**
+     * Redraw widgets whose content hash changed, that lie under damage, or
+     * that overlap a widget drawn earlier in this pass. Widgets in skipMask
+     * keep their previous pixels and are re-checked on the next render.
+     */
+    void render(uint32_t skipMask = 0);
+
+    bool hasWidget(uint8_t id) const { return indexOf(id) >= 0; }
+    int widgetCount() const { return _count; }
+
+    const WidgetRenderStats& getLastStats() const { return _last; }
+    const WidgetRenderTotals& getTotals() const { return _totals; }
+    void resetTotals();
+
+    // Per-widget draw time (reset with the totals)
+    const WidgetTiming& getTiming(uint8_t id) const { return _timing[id < WIDGET_MAX_WIDGETS ? id : 0]; }
+
+  private:
+    struct Widget {
+        uint8_t id;
+        WidgetRect rect;
+        uint32_t hash;
+        bool invalid;
+    };
+
+    WidgetHost& _host;
+    Widget _widgets[WIDGET_MAX_WIDGETS];
+    int _count;
+    WidgetRect _damage[WIDGET_MAX_DAMAGE];
+    int _damageCount;
+    WidgetRenderStats _last;
+    WidgetRenderTotals _totals;
+    WidgetTiming _timing[WIDGET_MAX_WIDGETS];
+
+    int indexOf(uint8_t id) const;
+    void addDamage(const WidgetRect& rect);
+    bool underDamage(const WidgetRect& rect) const;
+};
+
+#endif  // WIDGET_RENDERER_H
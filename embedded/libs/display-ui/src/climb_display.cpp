@@ -315,12 +315,12 @@ void ClimbDisplay::drawCurrentClimb() {
 
     // Draw grade with color
     textY += 25;
-    char vGrade[8];
-    extractVGrade(currentGrade, vGrade, sizeof(vGrade));
+    uint8_t gradeId = gradeIdFromString(currentGrade);
+    const char* vGrade = getGradeLabelById(gradeId);
 
     if (vGrade[0] != '\0') {
-        uint16_t gradeColor = getVGradeColor(vGrade);
-        uint16_t textColor = getTextColorForBackground(gradeColor);
+        uint16_t gradeColor = getGradeColorById(gradeId);
+        uint16_t textColor = getGradeTextColorById(gradeId);
 
         // Draw grade badge
         int badgeWidth = 45;
@@ -419,11 +419,10 @@ void ClimbDisplay::drawHistoryItem(int index, int y) {
     lcd.print(truncatedName);
 
     // Draw grade
-    char vGrade[8];
-    extractVGrade(entry->grade, vGrade, sizeof(vGrade));
+    uint8_t gradeId = gradeIdFromString(entry->grade);
+    const char* vGrade = getGradeLabelById(gradeId);
     if (vGrade[0] != '\0') {
-        uint16_t gradeColor = getVGradeColor(vGrade);
-        lcd.setTextColor(gradeColor);
+        lcd.setTextColor(getGradeColorById(gradeId));
         lcd.setCursor(DISPLAY_WIDTH - 35, y + 8);
         lcd.print(vGrade);
     }
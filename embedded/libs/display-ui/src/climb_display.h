@@ -1,8 +1,8 @@
 #ifndef CLIMB_DISPLAY_H
 #define CLIMB_DISPLAY_H
 
-#include "grade_colors.h"
 #include "qr_generator.h"
+#include "ui_colors.h"
 
 #include <Arduino.h>
 
@@ -28,7 +28,7 @@
  */
 
 #include "climb_display.h"
-#include "grade_colors.h"
 #include "qr_generator.h"
+#include "ui_colors.h"
 
 #endif
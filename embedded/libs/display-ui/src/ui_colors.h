@@ -0,0 +1,20 @@
+#ifndef UI_COLORS_H
+#define UI_COLORS_H
+
+#include <grade_colors.h>
+
+/**
+ * Display colors for the T-Display-S3 UI
+ * Grade colors come from display-base's generated grade table (grade_colors.h)
+ */
+
+// Common display colors
+#define COLOR_WHITE 0xFFFF
+#define COLOR_BLACK 0x0000
+#define COLOR_DARK_GRAY RGB565(0x40, 0x40, 0x40)
+#define COLOR_LIGHT_GRAY RGB565(0xA0, 0xA0, 0xA0)
+#define COLOR_GREEN RGB565(0x00, 0xD9, 0x64)
+#define COLOR_RED RGB565(0xE9, 0x45, 0x60)
+#define COLOR_CYAN RGB565(0x00, 0xD9, 0xFF)
+
+#endif
@@ -1,5 +1,9 @@
 #include "esp_web_server.h"
 
+#include <loop_profiler.h>
+
+#include "web_ui.h"
+
 // Firmware version macros - provided by build flags or version.h in the project
 #ifndef FIRMWARE_VERSION
 #define FIRMWARE_VERSION "dev"
@@ -11,9 +15,20 @@
 
 ESPWebServer WebConfig;
 
-ESPWebServer::ESPWebServer() : server(WEB_SERVER_PORT), running(false) {}
+static uint32_t freeHeap() {
+#if defined(ESP_PLATFORM) && !defined(UNIT_TEST)
+    return ESP.getFreeHeap();
+#else
+    return 0;
+#endif
+}
+
+ESPWebServer::ESPWebServer() : server(WEB_SERVER_PORT), running(false), uiStats() {}
 
 void ESPWebServer::begin() {
+    // WebServer drops request headers it was not asked to keep
+    static const char* HEADER_KEYS[] = {"If-None-Match"};
+    server.collectHeaders(HEADER_KEYS, 1);
     setupRoutes();
     server.begin();
     running = true;
@@ -65,6 +80,8 @@ void ESPWebServer::setupRoutes() {
     server.on("/api/wifi/connect", HTTP_POST, [this]() { handleWiFiConnect(); });
     server.on("/api/wifi/status", HTTP_GET, [this]() { handleWiFiStatus(); });
     server.on("/api/restart", HTTP_POST, [this]() { handleRestart(); });
+    server.on("/api/web/stats", HTTP_GET, [this]() { handleWebStats(); });
+    server.on("/api/web/timing", HTTP_POST, [this]() { handleWebTiming(); });
 
     // Firmware version endpoint
     server.on("/api/firmware/version", HTTP_GET, [this]() { handleFirmwareVersion(); });
@@ -92,383 +109,45 @@ void ESPWebServer::setCorsHeaders() {
 }
 
 void ESPWebServer::handleRoot() {
+    unsigned long startUs = micros();
+    uint32_t heapBefore = freeHeap();
     setCorsHeaders();
-    server.send(200, "text/html", R"rawliteral(
-<!DOCTYPE html>
-<html>
-<head>
-    <meta charset="UTF-8">
-    <meta name="viewport" content="width=device-width, initial-scale=1.0">
-    <title>Boardsesh Controller</title>
-    <style>
-        * { box-sizing: border-box; }
-        body { font-family: -apple-system, BlinkMacSystemFont, 'Segoe UI', Roboto, sans-serif; margin: 0; padding: 20px; background: #1a1a2e; color: #eee; }
-        h1 { color: #00d9ff; margin-bottom: 5px; }
-        .subtitle { color: #888; margin-bottom: 20px; }
-        .card { background: #16213e; border-radius: 12px; padding: 20px; margin-bottom: 20px; }
-        h2 { margin-top: 0; color: #00d9ff; font-size: 1.1em; border-bottom: 1px solid #0f3460; padding-bottom: 10px; }
-        label { display: block; margin-bottom: 5px; color: #aaa; font-size: 0.9em; }
-        input, select { width: 100%; padding: 12px; border: 1px solid #0f3460; border-radius: 8px; background: #0f3460; color: #fff; margin-bottom: 15px; font-size: 16px; }
-        input:focus, select:focus { outline: none; border-color: #00d9ff; }
-        button { background: #00d9ff; color: #1a1a2e; border: none; padding: 12px 24px; border-radius: 8px; cursor: pointer; font-weight: bold; font-size: 1em; width: 100%; }
-        button:hover { background: #00b8d4; }
-        button:disabled { background: #555; cursor: not-allowed; }
-        .btn-secondary { background: #0f3460; color: #fff; }
-        .btn-secondary:hover { background: #1a4a7a; }
-        .btn-danger { background: #e94560; }
-        .btn-danger:hover { background: #c73e54; }
-        .status { padding: 10px; border-radius: 8px; margin-bottom: 15px; }
-        .status.connected { background: rgba(0, 217, 100, 0.2); border: 1px solid #00d964; }
-        .status.disconnected { background: rgba(233, 69, 96, 0.2); border: 1px solid #e94560; }
-        .network-list { max-height: 200px; overflow-y: auto; }
-        .network { padding: 12px; background: #0f3460; border-radius: 8px; margin-bottom: 8px; cursor: pointer; display: flex; justify-content: space-between; }
-        .network:hover { background: #1a4a7a; }
-        .network.selected { border: 2px solid #00d9ff; }
-        .signal { color: #888; }
-        .row { display: flex; gap: 10px; }
-        .row > * { flex: 1; }
-        .slider-container { display: flex; align-items: center; gap: 15px; }
-        .slider-container input[type="range"] { flex: 1; }
-        .slider-value { min-width: 40px; text-align: center; }
-        input[type="range"] { -webkit-appearance: none; height: 8px; border-radius: 4px; }
-        input[type="range"]::-webkit-slider-thumb { -webkit-appearance: none; width: 20px; height: 20px; background: #00d9ff; border-radius: 50%; cursor: pointer; }
-        .loading { opacity: 0.5; pointer-events: none; }
-        .msg { padding: 10px; border-radius: 8px; margin-bottom: 15px; display: none; }
-        .msg.success { display: block; background: rgba(0, 217, 100, 0.2); border: 1px solid #00d964; }
-        .msg.error { display: block; background: rgba(233, 69, 96, 0.2); border: 1px solid #e94560; }
-        .progress-bar { width: 100%; height: 20px; background: #0f3460; border-radius: 10px; overflow: hidden; margin: 10px 0; display: none; }
-        .progress-bar-fill { height: 100%; background: #00d9ff; border-radius: 10px; transition: width 0.3s; width: 0%; }
-        .firmware-info { color: #888; font-size: 0.9em; margin-bottom: 15px; }
-    </style>
-</head>
-<body>
-    <h1>Boardsesh</h1>
-    <p class="subtitle">Board Controller Configuration</p>
-
-    <div class="card">
-        <h2>WiFi Status</h2>
-        <div id="wifiStatus" class="status disconnected">Checking...</div>
-        <button onclick="scanNetworks()" class="btn-secondary" id="scanBtn">Scan Networks</button>
-    </div>
-
-    <div class="card" id="networkCard" style="display:none;">
-        <h2>Available Networks</h2>
-        <div id="networkList" class="network-list"></div>
-        <div id="passwordSection" style="display:none; margin-top: 15px;">
-            <label>Password</label>
-            <input type="password" id="wifiPassword" placeholder="Enter WiFi password">
-            <button onclick="connectWifi()">Connect</button>
-        </div>
-    </div>
-
-    <div class="card">
-        <h2>Device Settings</h2>
-        <label>Device Name</label>
-        <input type="text" id="deviceName" placeholder="Boardsesh Controller">
-        <label>LED Brightness</label>
-        <div class="slider-container">
-            <input type="range" id="brightness" min="0" max="255" value="128">
-            <span class="slider-value" id="brightnessValue">128</span>
-        </div>
-        <label>Display Brightness</label>
-        <div class="slider-container">
-            <input type="range" id="displayBrightness" min="0" max="255" value="128">
-            <span class="slider-value" id="displayBrightnessValue">128</span>
-        </div>
-        <label>Display Mode</label>
-        <select id="displayMode">
-            <option value="0">Portrait (480x800)</option>
-            <option value="1">Landscape (800x480)</option>
-        </select>
-    </div>
-
-    <div class="card">
-        <h2>BLE Proxy Mode</h2>
-        <p style="color: #888; font-size: 0.9em; margin-bottom: 15px;">
-            Enable proxy mode to forward data from official Kilter/Tension app to a nearby board.
-            This lets you use the official app while also showing climb info on this device.
-        </p>
-        <label style="display: flex; align-items: center; gap: 10px; cursor: pointer;">
-            <input type="checkbox" id="proxyEnabled" style="width: auto; margin: 0;">
-            <span>Enable BLE Proxy</span>
-        </label>
-        <div id="proxyMacSection" style="display: none; margin-top: 15px;">
-            <label>Target Board MAC (optional)</label>
-            <input type="text" id="proxyMac" placeholder="Auto-detect nearest board">
-            <p style="color: #888; font-size: 0.8em; margin-top: -10px;">
-                Leave empty to connect to the nearest Aurora board
-            </p>
-        </div>
-    </div>
-
-    <div class="card">
-        <h2>Boardsesh Session</h2>
-        <label>Session ID</label>
-        <input type="text" id="sessionId" placeholder="Enter session ID from Boardsesh app">
-        <label>API Key</label>
-        <input type="password" id="apiKey" placeholder="Enter API key">
-    </div>
-
-    <div class="card">
-        <h2>Backend Connection</h2>
-        <label>Host</label>
-        <input type="text" id="backendHost" placeholder="boardsesh.com">
-        <div class="row">
-            <div>
-                <label>Port</label>
-                <input type="number" id="backendPort" placeholder="443">
-            </div>
-            <div>
-                <label>Path</label>
-                <input type="text" id="backendPath" placeholder="/graphql">
-            </div>
-        </div>
-    </div>
-
-    <div class="card">
-        <h2>Firmware Update</h2>
-        <div class="firmware-info">
-            <span>Version: </span><strong id="fwVersion">Loading...</strong><br>
-            <span>Build: </span><strong id="fwBuildEnv">Loading...</strong>
-        </div>
-        <label>Select firmware file (.bin)</label>
-        <input type="file" id="fwFile" accept=".bin">
-        <div class="progress-bar" id="fwProgress">
-            <div class="progress-bar-fill" id="fwProgressFill"></div>
-        </div>
-        <div id="fwStatus" style="margin-bottom: 15px;"></div>
-        <button onclick="uploadFirmware()" id="fwUploadBtn" disabled class="btn-danger">Upload Firmware</button>
-    </div>
-
-    <div id="message" class="msg"></div>
-
-    <button onclick="saveConfig()">Save Configuration</button>
-    <br><br>
-    <button onclick="restart()" class="btn-danger">Restart Device</button>
-
-    <script>
-        let selectedNetwork = null;
-
-        async function loadConfig() {
-            try {
-                const res = await fetch('/api/config');
-                const cfg = await res.json();
-                document.getElementById('deviceName').value = cfg.device_name || '';
-                document.getElementById('brightness').value = cfg.brightness || 128;
-                document.getElementById('brightnessValue').textContent = cfg.brightness || 128;
-                document.getElementById('displayBrightness').value = cfg.display_brightness || 128;
-                document.getElementById('displayBrightnessValue').textContent = cfg.display_brightness || 128;
-                document.getElementById('displayMode').value = cfg.display_mode || 0;
-                document.getElementById('sessionId').value = cfg.session_id || '';
-                document.getElementById('apiKey').value = cfg.api_key || '';
-                document.getElementById('backendHost').value = cfg.backend_host || '';
-                document.getElementById('backendPort').value = cfg.backend_port || 443;
-                document.getElementById('backendPath').value = cfg.backend_path || '/graphql';
-                document.getElementById('proxyEnabled').checked = cfg.proxy_enabled || false;
-                document.getElementById('proxyMac').value = cfg.proxy_mac || '';
-                document.getElementById('proxyMacSection').style.display = cfg.proxy_enabled ? 'block' : 'none';
-            } catch (e) { console.error('Failed to load config:', e); }
-        }
-
-        async function loadWifiStatus() {
-            try {
-                const res = await fetch('/api/wifi/status');
-                const status = await res.json();
-                const el = document.getElementById('wifiStatus');
-                if (status.connected) {
-                    el.className = 'status connected';
-                    el.innerHTML = 'Connected to <strong>' + status.ssid + '</strong><br>IP: ' + status.ip + ' | Signal: ' + status.rssi + ' dBm';
-                } else if (status.ap_mode) {
-                    el.className = 'status disconnected';
-                    el.innerHTML = 'Access Point Mode<br>IP: ' + status.ip + '<br><small>Connect to a WiFi network below</small>';
-                } else {
-                    el.className = 'status disconnected';
-                    el.textContent = 'Not connected';
-                }
-            } catch (e) { console.error('Failed to load wifi status:', e); }
-        }
-
-        async function scanNetworks() {
-            const btn = document.getElementById('scanBtn');
-            btn.disabled = true;
-            btn.textContent = 'Scanning...';
-            try {
-                const res = await fetch('/api/wifi/scan');
-                const data = await res.json();
-                const list = document.getElementById('networkList');
-                list.innerHTML = '';
-                data.networks.sort((a, b) => b.rssi - a.rssi).forEach(n => {
-                    const div = document.createElement('div');
-                    div.className = 'network';
-                    div.innerHTML = '<span>' + n.ssid + (n.secure ? ' 🔒' : '') + '</span><span class="signal">' + n.rssi + ' dBm</span>';
-                    div.onclick = () => selectNetwork(n.ssid, div);
-                    list.appendChild(div);
-                });
-                document.getElementById('networkCard').style.display = 'block';
-            } catch (e) { showMessage('Failed to scan networks', true); }
-            btn.disabled = false;
-            btn.textContent = 'Scan Networks';
-        }
-
-        function selectNetwork(ssid, el) {
-            document.querySelectorAll('.network').forEach(n => n.classList.remove('selected'));
-            el.classList.add('selected');
-            selectedNetwork = ssid;
-            document.getElementById('passwordSection').style.display = 'block';
-        }
-
-        async function connectWifi() {
-            if (!selectedNetwork) return;
-            const password = document.getElementById('wifiPassword').value;
-            try {
-                await fetch('/api/wifi/connect', {
-                    method: 'POST',
-                    headers: { 'Content-Type': 'application/json' },
-                    body: JSON.stringify({ ssid: selectedNetwork, password })
-                });
-                showMessage('Connecting to ' + selectedNetwork + '...');
-                setTimeout(loadWifiStatus, 5000);
-            } catch (e) { showMessage('Failed to connect', true); }
-        }
-
-        async function saveConfig() {
-            const config = {
-                device_name: document.getElementById('deviceName').value,
-                brightness: parseInt(document.getElementById('brightness').value),
-                display_brightness: parseInt(document.getElementById('displayBrightness').value),
-                display_mode: parseInt(document.getElementById('displayMode').value),
-                session_id: document.getElementById('sessionId').value,
-                api_key: document.getElementById('apiKey').value,
-                backend_host: document.getElementById('backendHost').value,
-                backend_port: parseInt(document.getElementById('backendPort').value),
-                backend_path: document.getElementById('backendPath').value,
-                proxy_enabled: document.getElementById('proxyEnabled').checked,
-                proxy_mac: document.getElementById('proxyMac').value
-            };
-            try {
-                await fetch('/api/config', {
-                    method: 'POST',
-                    headers: { 'Content-Type': 'application/json' },
-                    body: JSON.stringify(config)
-                });
-                showMessage('Configuration saved!');
-            } catch (e) { showMessage('Failed to save configuration', true); }
-        }
-
-        async function restart() {
-            if (!confirm('Restart the device?')) return;
-            try {
-                await fetch('/api/restart', { method: 'POST' });
-                showMessage('Restarting...');
-            } catch (e) {}
-        }
-
-        function showMessage(msg, isError = false) {
-            const el = document.getElementById('message');
-            el.textContent = msg;
-            el.className = 'msg ' + (isError ? 'error' : 'success');
-            setTimeout(() => { el.className = 'msg'; }, 3000);
-        }
-
-        async function loadFirmwareInfo() {
-            try {
-                const res = await fetch('/api/firmware/version');
-                const data = await res.json();
-                document.getElementById('fwVersion').textContent = data.version || 'Unknown';
-                document.getElementById('fwBuildEnv').textContent = data.build_env || 'Unknown';
-            } catch (e) {
-                document.getElementById('fwVersion').textContent = 'Error';
-                document.getElementById('fwBuildEnv').textContent = 'Error';
-            }
-        }
-
-        document.getElementById('fwFile').onchange = function() {
-            var btn = document.getElementById('fwUploadBtn');
-            btn.disabled = !this.files.length;
-        };
-
-        function uploadFirmware() {
-            var fileInput = document.getElementById('fwFile');
-            if (!fileInput.files.length) return;
-
-            var file = fileInput.files[0];
-            if (!file.name.endsWith('.bin')) {
-                showMessage('Please select a .bin firmware file', true);
-                return;
-            }
-
-            if (!confirm('Upload firmware "' + file.name + '" (' + Math.round(file.size / 1024) + ' KB)? The device will reboot after upload.')) return;
-
-            var xhr = new XMLHttpRequest();
-            var formData = new FormData();
-            formData.append('firmware', file, file.name);
-
-            var progressBar = document.getElementById('fwProgress');
-            var progressFill = document.getElementById('fwProgressFill');
-            var statusEl = document.getElementById('fwStatus');
-            var uploadBtn = document.getElementById('fwUploadBtn');
-
-            progressBar.style.display = 'block';
-            uploadBtn.disabled = true;
-            statusEl.textContent = 'Uploading...';
-            statusEl.style.color = '#aaa';
-
-            xhr.upload.onprogress = function(e) {
-                if (e.lengthComputable) {
-                    var pct = Math.round((e.loaded / e.total) * 100);
-                    progressFill.style.width = pct + '%';
-                    statusEl.textContent = 'Uploading: ' + pct + '%';
-                }
-            };
-
-            xhr.onload = function() {
-                if (xhr.status === 200) {
-                    progressFill.style.width = '100%';
-                    statusEl.textContent = 'Upload complete! Rebooting device...';
-                    statusEl.style.color = '#00d964';
-                    setTimeout(function() {
-                        statusEl.textContent = 'Reloading page...';
-                        window.location.reload();
-                    }, 10000);
-                } else {
-                    var msg = 'Upload failed';
-                    try { msg = JSON.parse(xhr.responseText).error || msg; } catch(e) {}
-                    statusEl.textContent = msg;
-                    statusEl.style.color = '#e94560';
-                    uploadBtn.disabled = false;
-                }
-            };
 
-            xhr.onerror = function() {
-                statusEl.textContent = 'Upload failed - connection error';
-                statusEl.style.color = '#e94560';
-                uploadBtn.disabled = false;
-            };
+    // Browsers revalidate on every load; an unchanged page costs a 304
+    server.sendHeader("Cache-Control", "no-cache");
+    server.sendHeader("ETag", WEB_UI_ETAG);
+    if (server.hasHeader("If-None-Match") && server.header("If-None-Match").indexOf(WEB_UI_ETAG) >= 0) {
+        server.send(304, "text/html", "");
+        uiStats.notModified++;
+        return;
+    }
 
-            xhr.open('POST', '/api/firmware/upload');
-            xhr.send(formData);
+    // Stream the gzipped page straight from flash, one TCP segment at a time
+    server.sendHeader("Content-Encoding", "gzip");
+    server.setContentLength(WEB_UI_GZ_SIZE);
+    server.send(200, "text/html", "");
+    uint32_t heapLow = heapBefore;
+    for (size_t offset = 0; offset < WEB_UI_GZ_SIZE; offset += WEB_UI_CHUNK_SIZE) {
+        size_t len = WEB_UI_GZ_SIZE - offset < WEB_UI_CHUNK_SIZE ? WEB_UI_GZ_SIZE - offset : WEB_UI_CHUNK_SIZE;
+        server.sendContent((const char*)WEB_UI_GZ + offset, len);
+        uint32_t heap = freeHeap();
+        if (heap < heapLow) {
+            heapLow = heap;
         }
+    }
 
-        document.getElementById('brightness').oninput = function() {
-            document.getElementById('brightnessValue').textContent = this.value;
-        };
-
-        document.getElementById('displayBrightness').oninput = function() {
-            document.getElementById('displayBrightnessValue').textContent = this.value;
-        };
-
-        document.getElementById('proxyEnabled').onchange = function() {
-            document.getElementById('proxyMacSection').style.display = this.checked ? 'block' : 'none';
-        };
-
-        loadConfig();
-        loadWifiStatus();
-        loadFirmwareInfo();
-        setInterval(loadWifiStatus, 10000);
-    </script>
-</body>
-</html>
-)rawliteral");
+    uint32_t elapsedUs = micros() - startUs;
+    uiStats.pageServed++;
+    uiStats.lastServeUs = elapsedUs;
+    if (elapsedUs > uiStats.maxServeUs) {
+        uiStats.maxServeUs = elapsedUs;
+    }
+    if (heapBefore - heapLow > uiStats.maxHeapDrop) {
+        uiStats.maxHeapDrop = heapBefore - heapLow;
+    }
+    if (uiStats.minFreeHeap == 0 || heapLow < uiStats.minFreeHeap) {
+        uiStats.minFreeHeap = heapLow;
+    }
 }
 
 void ESPWebServer::handleCaptivePortal() {
@@ -564,6 +243,8 @@ void ESPWebServer::handleSetConfig() {
 void ESPWebServer::handleWiFiScan() {
     setCorsHeaders();
 
+    // Blocks the web task for the whole channel sweep (seconds)
+    Profiler.tag("wifi-scan");
     int n = WiFi.scanNetworks();
     JsonDocument doc;
     JsonArray networks = doc["networks"].to<JsonArray>();
@@ -629,10 +310,67 @@ void ESPWebServer::handleWiFiStatus() {
 void ESPWebServer::handleRestart() {
     setCorsHeaders();
     sendJson(200, "{\"success\":true,\"message\":\"Restarting...\"}");
+    Profiler.tag("restart");
+    Config.flush();
     delay(500);
     ESP.restart();
 }
 
+void ESPWebServer::handleWebStats() {
+    setCorsHeaders();
+    JsonDocument doc;
+
+    doc["pageBytes"] = WEB_UI_GZ_SIZE;
+    doc["htmlBytes"] = WEB_UI_HTML_SIZE;
+    doc["etag"] = WEB_UI_ETAG;
+    doc["served"] = uiStats.pageServed;
+    doc["notModified"] = uiStats.notModified;
+    doc["lastServeUs"] = uiStats.lastServeUs;
+    doc["maxServeUs"] = uiStats.maxServeUs;
+    doc["minFreeHeap"] = uiStats.minFreeHeap;
+    doc["maxHeapDrop"] = uiStats.maxHeapDrop;
+
+    // Reported by the page itself
+    doc["loadReports"] = uiStats.loadReports;
+    doc["lastLoadMs"] = uiStats.lastLoadMs;
+    doc["maxLoadMs"] = uiStats.maxLoadMs;
+    doc["lastResponseMs"] = uiStats.lastResponseMs;
+    doc["lastTransferBytes"] = uiStats.lastTransferBytes;
+
+    sendJson(200, doc);
+}
+
+void ESPWebServer::handleWebTiming() {
+    setCorsHeaders();
+
+    if (!server.hasArg("plain")) {
+        sendError(400, "No body provided");
+        return;
+    }
+
+    JsonDocument doc;
+    DeserializationError error = deserializeJson(doc, server.arg("plain"));
+    if (error || !doc["loadMs"].is<int>()) {
+        sendError(400, "Invalid JSON");
+        return;
+    }
+
+    int loadMs = doc["loadMs"];
+    if (loadMs <= 0 || loadMs > WEB_UI_MAX_LOAD_MS) {
+        sendError(400, "Invalid loadMs");
+        return;
+    }
+
+    uiStats.loadReports++;
+    uiStats.lastLoadMs = loadMs;
+    if ((uint32_t)loadMs > uiStats.maxLoadMs) {
+        uiStats.maxLoadMs = loadMs;
+    }
+    uiStats.lastResponseMs = doc["responseMs"].is<int>() ? (uint32_t)(int)doc["responseMs"] : 0;
+    uiStats.lastTransferBytes = doc["transferBytes"].is<int>() ? (uint32_t)(int)doc["transferBytes"] : 0;
+    sendJson(200, "{\"success\":true}");
+}
+
 void ESPWebServer::handleFirmwareVersion() {
     setCorsHeaders();
     JsonDocument doc;
@@ -734,6 +472,8 @@ void ESPWebServer::handleFirmwareUploadComplete() {
     doc["message"] = "Firmware updated successfully. Rebooting...";
     sendJson(200, doc);
 
+    Profiler.tag("restart");
+    Config.flush();
     delay(1000);
     ESP.restart();
 }
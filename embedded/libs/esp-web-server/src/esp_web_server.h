@@ -12,6 +12,33 @@
 
 #define WEB_SERVER_PORT 80
 
+// The configuration page is streamed from flash in pieces of this size
+// (one TCP segment)
+#define WEB_UI_CHUNK_SIZE 1436
+
+// Page load times reported above this are discarded
+#define WEB_UI_MAX_LOAD_MS 120000
+
+/**
+ * Configuration page serving, measured on the device (time to hand the page
+ * to the TCP stack, free heap while doing so) and by the page itself
+ * (Navigation Timing, posted back once loaded).
+ */
+struct WebUIStats {
+    uint32_t pageServed;   // 200 responses with the page
+    uint32_t notModified;  // 304 revalidations
+    uint32_t lastServeUs;
+    uint32_t maxServeUs;
+    uint32_t minFreeHeap;  // Lowest free heap seen while serving, 0 if unknown
+    uint32_t maxHeapDrop;  // Largest drop in free heap during one serve
+
+    uint32_t loadReports;
+    uint32_t lastLoadMs;  // Navigation start to load event end, on the client
+    uint32_t maxLoadMs;
+    uint32_t lastResponseMs;  // Request start to last response byte
+    uint32_t lastTransferBytes;
+};
+
 typedef void (*WebServerRouteHandler)(WebServer& server);
 
 class ESPWebServer {
@@ -35,9 +62,12 @@ class ESPWebServer {
     // Get underlying server for advanced use
     WebServer& getServer();
 
+    const WebUIStats& getUIStats() const { return uiStats; }
+
   private:
     WebServer server;
     bool running;
+    WebUIStats uiStats;
 
     // Built-in handlers
     void handleRoot();
@@ -49,6 +79,8 @@ class ESPWebServer {
     void handleWiFiConnect();
     void handleWiFiStatus();
     void handleRestart();
+    void handleWebStats();
+    void handleWebTiming();
 
     // OTA firmware update handlers
     void handleFirmwareVersion();
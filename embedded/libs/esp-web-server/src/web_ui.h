@@ -0,0 +1,315 @@
+/**
+ * Configuration Web UI (gzip)
+ * Source: embedded/libs/esp-web-server/web/index.html
+ *
+ * DO NOT EDIT MANUALLY - This file is generated by:
+ *   bun run controller:codegen:web-ui
+ *
+ * 19020 bytes of HTML, 4651 bytes gzipped.
+ */
+
+#ifndef WEB_UI_H
+#define WEB_UI_H
+
+#include <stdint.h>
+
+#define WEB_UI_HTML_SIZE 19020
+#define WEB_UI_GZ_SIZE 4651
+#define WEB_UI_ETAG "\"22bebd0c9fc04a41\""
+
+// Constant data stays in flash (memory-mapped); nothing is copied to RAM
+alignas(4) static const uint8_t WEB_UI_GZ[WEB_UI_GZ_SIZE] = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xcd, 0x3c, 0xed, 0x72, 0x1a, 0xb9,
+    0x96, 0xff, 0xf3, 0x14, 0x27, 0x4c, 0xdd, 0x6a, 0xb8, 0x03, 0x0d, 0x38, 0x76, 0xc6, 0xc1, 0x40,
+    0x2a, 0x76, 0x9c, 0x9d, 0xec, 0x24, 0x33, 0xae, 0xd8, 0xb9, 0xb3, 0x5b, 0x53, 0x53, 0x29, 0xd1,
+    0x2d, 0x40, 0xd7, 0x8d, 0xd4, 0x23, 0x09, 0x30, 0xd7, 0xf1, 0x4b, 0x6c, 0xed, 0xff, 0x7d, 0xc5,
+    0x7d, 0x84, 0xad, 0x23, 0x75, 0x37, 0xfd, 0xa1, 0xc6, 0xe0, 0xc9, 0x54, 0xad, 0xff, 0x04, 0x68,
+    0x9d, 0xa3, 0x73, 0x8e, 0xce, 0xf7, 0x51, 0x67, 0xf8, 0xfc, 0xed, 0x2f, 0x17, 0x37, 0xff, 0x79,
+    0x75, 0x09, 0x73, 0xbd, 0x88, 0xc6, 0xcf, 0x86, 0xe9, 0x3f, 0x94, 0x84, 0xe3, 0x67, 0x00, 0x00,
+    0xc3, 0x05, 0xd5, 0x04, 0x82, 0x39, 0x91, 0x8a, 0xea, 0x51, 0xe3, 0xf3, 0xcd, 0xbb, 0xce, 0x69,
+    0x23, 0xff, 0x88, 0x93, 0x05, 0x1d, 0x35, 0x56, 0x8c, 0xae, 0x63, 0x21, 0x75, 0x03, 0x02, 0xc1,
+    0x35, 0xe5, 0x7a, 0xd4, 0x58, 0xb3, 0x50, 0xcf, 0x47, 0x21, 0x5d, 0xb1, 0x80, 0x76, 0xcc, 0x97,
+    0x36, 0x30, 0xce, 0x34, 0x23, 0x51, 0x47, 0x05, 0x24, 0xa2, 0xa3, 0xbe, 0xdf, 0x4b, 0x51, 0x69,
+    0xa6, 0x23, 0x3a, 0x3e, 0x17, 0x44, 0x86, 0x8a, 0xaa, 0x39, 0x5c, 0x08, 0xae, 0xa5, 0x88, 0x22,
+    0x2a, 0x87, 0x5d, 0xfb, 0xcc, 0xae, 0x53, 0x7a, 0x93, 0x7e, 0xc6, 0xbf, 0xbf, 0xc3, 0x3d, 0x4c,
+    0xc4, 0x5d, 0x47, 0xb1, 0x7f, 0x31, 0x3e, 0x1b, 0xc0, 0x44, 0xc8, 0x90, 0xca, 0xce, 0x44, 0xdc,
+    0x9d, 0xc1, 0x43, 0xb6, 0x6a, 0x22, 0xc2, 0x0d, 0xdc, 0xc3, 0x54, 0x70, 0xdd, 0x99, 0x92, 0x05,
+    0x8b, 0x36, 0x03, 0xe8, 0x90, 0x38, 0x8e, 0x68, 0x47, 0x6d, 0x94, 0xa6, 0x8b, 0x36, 0x9c, 0x47,
+    0x8c, 0xdf, 0x7e, 0x24, 0xc1, 0xb5, 0xf9, 0xfe, 0x4e, 0x70, 0xdd, 0x06, 0xef, 0x9a, 0xce, 0x04,
+    0x85, 0xcf, 0xef, 0xbd, 0x36, 0x7c, 0x12, 0x13, 0xa1, 0x45, 0x1b, 0x14, 0xe1, 0xaa, 0xa3, 0xa8,
+    0x64, 0xd3, 0x33, 0x58, 0x10, 0x39, 0x63, 0x7c, 0x00, 0xbd, 0x33, 0x88, 0x49, 0x18, 0x1a, 0x02,
+    0x8e, 0x7a, 0xf1, 0xdd, 0x19, 0x4c, 0x48, 0x70, 0x3b, 0x93, 0x62, 0xc9, 0xc3, 0x01, 0x7c, 0xd7,
+    0x27, 0x7d, 0x72, 0x44, 0xcf, 0x20, 0x10, 0x91, 0x90, 0x03, 0xf8, 0x8e, 0x52, 0x9a, 0x27, 0x6e,
+    0xde, 0x87, 0xfb, 0xec, 0x59, 0xaf, 0x17, 0xbe, 0x9a, 0x66, 0xa8, 0x3b, 0x13, 0xa1, 0xb5, 0x58,
+    0x0c, 0xe0, 0x24, 0x2e, 0xf0, 0xe3, 0xab, 0xe5, 0xc4, 0x08, 0x25, 0x07, 0x79, 0x7a, 0x7a, 0x5a,
+    0x01, 0xb3, 0xc4, 0xe4, 0xe0, 0x02, 0x22, 0x43, 0x94, 0x58, 0x81, 0xbc, 0x97, 0x47, 0xfd, 0x17,
+    0xf4, 0x2c, 0x15, 0x9d, 0x24, 0x21, 0x5b, 0xaa, 0x01, 0xf4, 0x8f, 0x10, 0xb6, 0xc4, 0xd7, 0x23,
+    0xf8, 0xe7, 0x47, 0x70, 0x9f, 0xae, 0xd1, 0x22, 0x36, 0x92, 0x29, 0x73, 0x66, 0x0e, 0x41, 0xb1,
+    0x7f, 0xd1, 0x01, 0xf4, 0xfd, 0x3e, 0x5d, 0x9c, 0x6d, 0xcf, 0xcc, 0x22, 0xed, 0xc7, 0x77, 0xa0,
+    0x44, 0xc4, 0x42, 0xf8, 0xae, 0x37, 0x7d, 0x71, 0xfc, 0x72, 0x2b, 0xdd, 0xed, 0x92, 0xd2, 0xbe,
+    0x11, 0x99, 0xd0, 0x08, 0xee, 0x21, 0x64, 0x2a, 0x8e, 0xc8, 0x66, 0x00, 0x93, 0x48, 0x04, 0xb7,
+    0x6e, 0x29, 0xa6, 0xf4, 0x10, 0x42, 0x0a, 0xc4, 0xf4, 0xfc, 0x57, 0x48, 0xcc, 0x16, 0x29, 0xe3,
+    0xf1, 0x52, 0xb7, 0x41, 0xd1, 0x88, 0x06, 0x1a, 0xee, 0xc1, 0x68, 0x30, 0xee, 0xdd, 0xfb, 0x5b,
+    0x4e, 0x2e, 0x56, 0x4c, 0x96, 0x05, 0x27, 0xed, 0x25, 0xb1, 0x9e, 0x56, 0xd4, 0x23, 0x5d, 0x98,
+    0x12, 0x36, 0x75, 0x9c, 0x7f, 0xdf, 0x90, 0x9e, 0x17, 0xdd, 0xcb, 0xa2, 0x04, 0x0c, 0xb1, 0x83,
+    0xa9, 0x08, 0x96, 0x2a, 0x25, 0xd9, 0x7e, 0x83, 0x7b, 0x10, 0x4b, 0x1d, 0x31, 0x4e, 0x07, 0xc0,
+    0x05, 0xdf, 0x9e, 0x73, 0xf9, 0x5c, 0x72, 0xd6, 0xb2, 0xd4, 0x5a, 0xf0, 0xb2, 0x9a, 0xa4, 0xeb,
+    0x52, 0xb8, 0x54, 0xab, 0x53, 0xd6, 0x2d, 0xf2, 0x82, 0x5c, 0xe0, 0xe8, 0x78, 0x2b, 0x9c, 0xa2,
+    0x04, 0x82, 0xa5, 0x54, 0x88, 0x26, 0x16, 0x8c, 0x6b, 0x2a, 0x13, 0xde, 0xd6, 0x94, 0xcd, 0xe6,
+    0x1a, 0xad, 0x38, 0x0a, 0x8b, 0xec, 0xe2, 0xd1, 0x14, 0x0e, 0xa0, 0x4c, 0xee, 0x60, 0x2e, 0x56,
+    0x54, 0x56, 0x89, 0x9e, 0x9c, 0x86, 0xc7, 0x8e, 0xd5, 0x21, 0x53, 0x64, 0x12, 0xd1, 0x8a, 0x31,
+    0x9c, 0x9c, 0x9c, 0x6c, 0x89, 0xe3, 0x42, 0x77, 0x48, 0x14, 0x89, 0x35, 0x0d, 0x0b, 0x56, 0x34,
+    0xd1, 0xbc, 0xa3, 0x68, 0x20, 0x78, 0x48, 0xe4, 0xa6, 0xb2, 0xa5, 0xeb, 0x38, 0xeb, 0x80, 0xdd,
+    0x54, 0xf7, 0xc9, 0x31, 0xf9, 0x81, 0x54, 0xa0, 0x42, 0xc2, 0x67, 0xd5, 0xc5, 0xf4, 0xd5, 0xf1,
+    0x09, 0xee, 0xe7, 0x5c, 0xec, 0xc6, 0x1f, 0xfc, 0xf0, 0x82, 0x9e, 0x1c, 0x17, 0x1d, 0x8a, 0x26,
+    0xda, 0x28, 0xcb, 0xf6, 0x00, 0x7b, 0x75, 0x67, 0xe7, 0xd4, 0xcd, 0x0a, 0x2e, 0x3f, 0x10, 0x9c,
+    0xd3, 0x40, 0x57, 0x64, 0x2c, 0x67, 0x13, 0xd2, 0xec, 0xb5, 0xe1, 0xa8, 0xff, 0x43, 0x1b, 0x0f,
+    0xb3, 0x0d, 0x3d, 0xff, 0xa8, 0xe5, 0xb6, 0xa1, 0x5e, 0xf8, 0xea, 0xa5, 0x8b, 0x50, 0x3f, 0x64,
+    0x6a, 0x27, 0xfe, 0xa3, 0x17, 0x2f, 0xda, 0xf0, 0xf2, 0x55, 0x1b, 0x5e, 0xbd, 0xdc, 0x81, 0xdf,
+    0x21, 0x3b, 0x4e, 0xf5, 0x5a, 0xc8, 0xdb, 0x4e, 0xc4, 0x94, 0x36, 0xce, 0xec, 0xae, 0x33, 0x4f,
+    0xb4, 0xf2, 0xa8, 0x67, 0x44, 0x82, 0x12, 0x9d, 0x46, 0x62, 0xdd, 0xd9, 0x0c, 0x80, 0x2c, 0xb5,
+    0x70, 0x81, 0x17, 0x04, 0x79, 0x54, 0x6b, 0xf2, 0x7b, 0x48, 0xd7, 0x6d, 0x2d, 0x99, 0xa3, 0x9b,
+    0x46, 0xf4, 0xee, 0x0c, 0xfe, 0xb9, 0x54, 0x9a, 0x4d, 0x37, 0x9d, 0x24, 0xf4, 0x0e, 0x40, 0xc5,
+    0x24, 0xa0, 0x9d, 0x09, 0xd5, 0x6b, 0x4a, 0xb9, 0x8b, 0xc0, 0xbd, 0x15, 0x2f, 0x59, 0xef, 0x5b,
+    0x9f, 0x62, 0x85, 0x9d, 0x08, 0xf2, 0xa8, 0x78, 0x50, 0x25, 0x3d, 0x57, 0x6c, 0xc6, 0x49, 0x54,
+    0x0e, 0x50, 0xb9, 0x05, 0x52, 0xac, 0xf3, 0x2e, 0xdb, 0x72, 0x32, 0x23, 0x71, 0xd5, 0xbd, 0x9b,
+    0xa5, 0x63, 0x13, 0xeb, 0x71, 0xd5, 0x00, 0xfa, 0xc5, 0x9d, 0x22, 0x66, 0x1d, 0x1a, 0xd7, 0x84,
+    0x71, 0xc3, 0x55, 0x09, 0x2b, 0x89, 0xd8, 0x8c, 0x77, 0x98, 0xa6, 0x0b, 0x35, 0x80, 0x80, 0x5a,
+    0x19, 0xda, 0xad, 0x2a, 0xca, 0x5b, 0x46, 0x66, 0x3c, 0xeb, 0x6f, 0x7a, 0x13, 0xd3, 0x51, 0x43,
+    0xa2, 0x51, 0x35, 0x7e, 0xdf, 0x4d, 0xc7, 0x8a, 0x44, 0x4b, 0x0c, 0xcc, 0x0b, 0xc6, 0x3b, 0x89,
+    0xcb, 0x3a, 0x36, 0x0c, 0x69, 0x7a, 0x87, 0xfe, 0x84, 0xcd, 0xf8, 0x96, 0x88, 0x92, 0x07, 0xaf,
+    0xec, 0xd3, 0x59, 0xd3, 0xc9, 0x2d, 0xd3, 0x98, 0xac, 0x50, 0x22, 0x09, 0x0f, 0x32, 0x37, 0x9e,
+    0x6a, 0xe5, 0xa9, 0xc3, 0x4c, 0x8f, 0x1d, 0xc1, 0xa1, 0x88, 0x7a, 0x30, 0x48, 0x31, 0x27, 0x54,
+    0xeb, 0xf9, 0x72, 0x31, 0xd9, 0xb9, 0x61, 0xc2, 0x8b, 0x8d, 0xf9, 0x5b, 0x9b, 0xa8, 0x2a, 0x77,
+    0xa2, 0x0b, 0x25, 0x9a, 0x4e, 0xd0, 0x6b, 0x57, 0x14, 0x39, 0x27, 0xbe, 0x48, 0x10, 0x34, 0x18,
+    0x0c, 0x58, 0x31, 0x09, 0x98, 0xde, 0x60, 0x4c, 0x3e, 0x39, 0x4b, 0xd7, 0x76, 0xe8, 0x8a, 0x72,
+    0xad, 0x52, 0x6a, 0x72, 0x80, 0x0b, 0x35, 0xfb, 0x13, 0x8e, 0x2b, 0x53, 0x15, 0x17, 0x5e, 0x5f,
+    0x2d, 0x83, 0x80, 0x2a, 0xe5, 0xc8, 0x2d, 0xbe, 0x9d, 0x4b, 0xc3, 0x7d, 0xa8, 0x94, 0x42, 0xee,
+    0xb3, 0xcb, 0x93, 0x1d, 0x5b, 0x2c, 0xc5, 0x4c, 0x52, 0xa5, 0x3a, 0x13, 0x22, 0xcb, 0xd9, 0xcc,
+    0xae, 0xd3, 0x74, 0xbb, 0xaa, 0x7e, 0xc1, 0x15, 0x0e, 0x60, 0xce, 0xc2, 0x10, 0x3d, 0x4d, 0x9a,
+    0x12, 0xe3, 0x73, 0xcc, 0xfe, 0xea, 0xa5, 0x9b, 0xa7, 0xa7, 0x33, 0x65, 0x11, 0xba, 0x8a, 0x94,
+    0x0e, 0x4b, 0xd5, 0x3e, 0x5a, 0x65, 0xe9, 0xd0, 0x92, 0x70, 0xc5, 0x34, 0x13, 0x7c, 0x60, 0x19,
+    0x83, 0x9e, 0xff, 0x42, 0x65, 0x2a, 0x5b, 0xcc, 0x17, 0xfc, 0x29, 0x93, 0x8b, 0x35, 0x91, 0xb4,
+    0xc3, 0xf8, 0x54, 0x94, 0x1d, 0x54, 0x35, 0x23, 0xdc, 0x11, 0xee, 0x86, 0xdd, 0xa4, 0x1c, 0x19,
+    0x76, 0x6d, 0xc1, 0x34, 0xc4, 0x4a, 0x23, 0xa9, 0x54, 0xe6, 0xfd, 0x6d, 0x39, 0x33, 0xec, 0xce,
+    0xfb, 0xc9, 0xcf, 0x31, 0x04, 0x11, 0x51, 0x6a, 0xd4, 0x48, 0x73, 0xf8, 0x86, 0x5d, 0x96, 0xab,
+    0x78, 0xf0, 0xe3, 0x94, 0xcd, 0x96, 0x92, 0x20, 0x4b, 0xc3, 0x6e, 0x3c, 0x7e, 0x66, 0x61, 0x43,
+    0xb6, 0x4a, 0xa1, 0x31, 0x93, 0x6f, 0x6c, 0xeb, 0xa0, 0xe1, 0xfc, 0x68, 0xfc, 0x2b, 0x7b, 0xc7,
+    0xe0, 0xda, 0xc4, 0xc7, 0x61, 0x77, 0x7e, 0x94, 0x7b, 0x88, 0x70, 0x2c, 0xc4, 0x8a, 0x6c, 0xca,
+    0xec, 0x82, 0x46, 0x46, 0x85, 0x0d, 0xfc, 0xf9, 0x78, 0xda, 0x18, 0x5f, 0xcc, 0x69, 0x70, 0xcb,
+    0xf8, 0xcc, 0xf7, 0xfd, 0x61, 0x37, 0x64, 0xab, 0x1c, 0xaa, 0x24, 0x39, 0x14, 0x3c, 0x88, 0x58,
+    0x70, 0x3b, 0x6a, 0xa8, 0x80, 0xf0, 0x9f, 0x6d, 0x8c, 0x50, 0xcd, 0x56, 0x86, 0xb6, 0x90, 0xe5,
+    0x34, 0xcc, 0xe6, 0xb8, 0xf2, 0x5c, 0xf3, 0xc6, 0xf8, 0x3a, 0x20, 0x1c, 0x52, 0x98, 0x61, 0xd7,
+    0x62, 0x4c, 0xa4, 0x63, 0x77, 0x73, 0x73, 0x6b, 0xb0, 0x24, 0xf1, 0xe8, 0xc2, 0xfc, 0x60, 0xa4,
+    0x3f, 0x6a, 0xa4, 0x4a, 0x66, 0x74, 0xac, 0x24, 0x94, 0x37, 0x2b, 0xc2, 0x22, 0x4c, 0xf5, 0x72,
+    0x3b, 0x3a, 0x65, 0x93, 0x20, 0xfe, 0xc0, 0x94, 0xce, 0xb8, 0xc8, 0x27, 0x03, 0x8d, 0x71, 0x59,
+    0x14, 0x29, 0x64, 0x4c, 0x94, 0x5a, 0x0b, 0x19, 0x5e, 0xd3, 0x00, 0xcf, 0xcb, 0x4d, 0x56, 0xa1,
+    0x2c, 0x32, 0x3a, 0x94, 0x23, 0xd4, 0xa0, 0x33, 0x45, 0xcc, 0xf8, 0x2a, 0x41, 0x36, 0xec, 0xda,
+    0xef, 0xc5, 0x35, 0xc6, 0x93, 0x83, 0xf5, 0xe4, 0xe9, 0xb6, 0x8d, 0xec, 0x68, 0xaf, 0xb2, 0x5f,
+    0xe2, 0x88, 0x04, 0x74, 0x2e, 0xa2, 0x90, 0xca, 0x51, 0xe3, 0x12, 0xdd, 0x27, 0x18, 0xed, 0xc8,
+    0x60, 0x4a, 0x78, 0xcb, 0xa7, 0x9a, 0xe8, 0xc2, 0xaf, 0x6c, 0xca, 0x9a, 0xad, 0xc6, 0xf8, 0xc2,
+    0x7e, 0x2d, 0x9e, 0x55, 0xee, 0xbc, 0x1e, 0x3d, 0xba, 0xe2, 0x99, 0xbc, 0x35, 0x2d, 0x01, 0xb8,
+    0xa6, 0x5a, 0x33, 0x3e, 0x2b, 0x1f, 0x88, 0xe5, 0x3b, 0x59, 0xf3, 0x33, 0x59, 0xd0, 0x8a, 0x28,
+    0x0a, 0x62, 0xc0, 0xa8, 0x6a, 0x45, 0x60, 0x3b, 0x0d, 0x08, 0x51, 0x12, 0x80, 0xab, 0xab, 0xd0,
+    0xa8, 0xec, 0xf8, 0xe1, 0xf2, 0x2d, 0x9c, 0x4b, 0x74, 0x40, 0x9c, 0x2a, 0x55, 0xdd, 0x34, 0xc7,
+    0x53, 0x39, 0x49, 0x68, 0xec, 0x38, 0x26, 0x1b, 0x70, 0x0d, 0x81, 0x93, 0x0c, 0x7b, 0x03, 0xb3,
+    0x83, 0x51, 0xa3, 0xd7, 0xc0, 0x04, 0x73, 0xd4, 0x38, 0x3a, 0x39, 0x69, 0x80, 0xc9, 0x1b, 0x46,
+    0x8d, 0xfe, 0xd1, 0x69, 0x19, 0x9d, 0x8a, 0x09, 0x2f, 0x6d, 0x6d, 0x16, 0x97, 0xb1, 0xfe, 0xc3,
+    0xfc, 0x38, 0xee, 0x1f, 0x9d, 0x0e, 0xbb, 0x08, 0xe3, 0x3c, 0xa7, 0xbc, 0x8c, 0xad, 0x82, 0xfe,
+    0xc5, 0x5c, 0x27, 0x66, 0x70, 0xfe, 0x97, 0x30, 0x5f, 0x41, 0xfe, 0x54, 0x19, 0x7c, 0x14, 0xa1,
+    0x43, 0xd1, 0x92, 0xe2, 0x3f, 0xb7, 0x13, 0xae, 0x2b, 0x93, 0x28, 0x62, 0xb4, 0xfb, 0x94, 0x87,
+    0x5e, 0x63, 0x7c, 0x25, 0xa4, 0x96, 0x84, 0x69, 0x68, 0x1e, 0x9f, 0xf6, 0xee, 0x4e, 0x7b, 0xbd,
+    0xd6, 0xb0, 0x6b, 0x17, 0xed, 0x84, 0xec, 0x37, 0xc6, 0x1f, 0x08, 0x0f, 0x55, 0x40, 0x62, 0x0a,
+    0xcd, 0xd3, 0x5e, 0xef, 0xee, 0xf8, 0xd4, 0x05, 0x3a, 0xec, 0x5a, 0xba, 0x0e, 0x36, 0xbc, 0xf3,
+    0x0f, 0x97, 0x70, 0x25, 0xc5, 0x5d, 0xca, 0x6e, 0xc1, 0xee, 0xe2, 0xd4, 0x6f, 0x3d, 0x21, 0x1e,
+    0x96, 0x24, 0x72, 0xc9, 0x8d, 0xc7, 0x8d, 0xcd, 0x56, 0x0b, 0x11, 0x52, 0xd0, 0x02, 0xa6, 0x42,
+    0xae, 0x31, 0xce, 0x85, 0x44, 0x13, 0x98, 0x4a, 0xb1, 0x00, 0x31, 0x9d, 0xb2, 0x80, 0x91, 0x08,
+    0x7e, 0x62, 0x91, 0xa6, 0xb2, 0x7b, 0x43, 0xb9, 0x42, 0x71, 0x90, 0x38, 0x46, 0x00, 0x02, 0x9c,
+    0x12, 0x39, 0xd9, 0xc0, 0x04, 0xed, 0xd7, 0x2f, 0xec, 0x70, 0x33, 0x67, 0x0a, 0x22, 0xaa, 0x15,
+    0x6c, 0xc4, 0x12, 0x96, 0x8a, 0x82, 0x9e, 0xd3, 0x2d, 0x42, 0xc4, 0xb0, 0x9e, 0xb3, 0x88, 0x02,
+    0x89, 0x94, 0x00, 0x35, 0x17, 0x6b, 0x4c, 0x2d, 0x83, 0x88, 0x2d, 0x26, 0x60, 0xc2, 0xbe, 0xe0,
+    0xa0, 0x11, 0x87, 0x75, 0x1a, 0x7e, 0x4e, 0xb6, 0x71, 0x59, 0x47, 0xca, 0xfe, 0xfc, 0xf1, 0xa2,
+    0xa2, 0xe7, 0x2a, 0xda, 0x76, 0x99, 0x4b, 0x80, 0x01, 0x77, 0x22, 0xee, 0xac, 0x52, 0x1b, 0xb9,
+    0x59, 0x19, 0x6e, 0x83, 0x5c, 0x92, 0xcb, 0xd8, 0x8a, 0x73, 0xdb, 0x79, 0x74, 0x99, 0xcb, 0x38,
+    0x91, 0x7f, 0x76, 0xdc, 0x55, 0x53, 0x70, 0x99, 0x79, 0xb6, 0x35, 0xb6, 0x41, 0x6b, 0x62, 0x19,
+    0x1c, 0x14, 0xcc, 0x6e, 0x88, 0x9c, 0x51, 0x0d, 0x36, 0xbf, 0xf9, 0xf8, 0xe6, 0x02, 0x9a, 0x56,
+    0x95, 0x49, 0xd4, 0x86, 0x40, 0x2c, 0x16, 0xa4, 0xa3, 0x68, 0x4c, 0x24, 0xd1, 0x14, 0x14, 0x5d,
+    0x51, 0x49, 0x22, 0x3c, 0xf7, 0x05, 0x33, 0xc9, 0xb0, 0x39, 0x75, 0xd5, 0x7a, 0x3c, 0x10, 0x6e,
+    0x23, 0x40, 0x4a, 0x7d, 0xc9, 0xff, 0xbf, 0x59, 0x6a, 0xd1, 0x09, 0xa9, 0x46, 0x53, 0x46, 0x95,
+    0xa2, 0x4a, 0x5b, 0xec, 0x65, 0xaa, 0xf7, 0x30, 0x81, 0xd3, 0x9c, 0x09, 0x18, 0xf6, 0x3b, 0xe6,
+    0xb4, 0x4b, 0x98, 0xf0, 0xef, 0x03, 0x25, 0x2b, 0x0a, 0x74, 0x11, 0xeb, 0x0d, 0x72, 0x95, 0x84,
+    0x54, 0xfc, 0x88, 0xaa, 0x9a, 0xd2, 0xf1, 0x66, 0x29, 0x85, 0x24, 0x96, 0x9c, 0x22, 0x31, 0x05,
+    0x45, 0x7c, 0x52, 0x9c, 0xdd, 0xc6, 0xbd, 0x6b, 0xaa, 0x94, 0x49, 0x25, 0x1d, 0x91, 0x36, 0x79,
+    0x06, 0xef, 0xdf, 0xee, 0x1b, 0x68, 0x95, 0x85, 0x78, 0xef, 0x4e, 0x34, 0x54, 0x86, 0xcf, 0x5a,
+    0xf9, 0x96, 0x0a, 0x12, 0xc7, 0xd5, 0xb0, 0xfb, 0xe6, 0xea, 0x3d, 0xfc, 0x44, 0x37, 0xbb, 0xf7,
+    0x2e, 0xe6, 0x3a, 0x24, 0x66, 0x3f, 0xd1, 0x8d, 0x73, 0x73, 0xc4, 0x76, 0x4b, 0x37, 0x8d, 0xc3,
+    0x65, 0x45, 0x82, 0x5b, 0xca, 0x4d, 0x16, 0xce, 0xad, 0xee, 0x3b, 0x85, 0xf5, 0xa3, 0x50, 0x7a,
+    0x5f, 0x31, 0x4d, 0x2c, 0x4a, 0x04, 0x29, 0xd1, 0x3a, 0x49, 0x45, 0xe2, 0x07, 0x62, 0xd1, 0x70,
+    0x47, 0x5b, 0x29, 0xd6, 0x65, 0xf5, 0x2c, 0xc4, 0xaf, 0x72, 0xde, 0x28, 0xa4, 0x76, 0x9a, 0x4a,
+    0x85, 0x40, 0xbe, 0x5c, 0x4c, 0xa8, 0x2c, 0x90, 0x78, 0x65, 0x06, 0x37, 0x05, 0x12, 0x8f, 0x8f,
+    0x5f, 0x94, 0xb7, 0xef, 0x56, 0xf6, 0xdf, 0x4d, 0x11, 0xd1, 0xf3, 0xfd, 0x28, 0xaa, 0x88, 0x0c,
+    0x41, 0x4b, 0xf4, 0x74, 0x67, 0x92, 0xc4, 0xf3, 0x3f, 0xa2, 0xdd, 0x44, 0x3d, 0xcd, 0x4e, 0xde,
+    0x25, 0x05, 0x21, 0x7c, 0x8e, 0x43, 0xa2, 0xa9, 0xa3, 0x40, 0x48, 0x60, 0x0b, 0x95, 0xa3, 0xd3,
+    0xf3, 0xfe, 0x83, 0x4a, 0x65, 0xca, 0xd0, 0xc4, 0xe5, 0x0e, 0x95, 0x96, 0x82, 0xcf, 0x0c, 0x73,
+    0xd3, 0x75, 0xf2, 0xb4, 0x31, 0xfe, 0x60, 0x7b, 0x1d, 0xa6, 0xbe, 0xb2, 0x2b, 0xc6, 0xc3, 0x89,
+    0x74, 0x21, 0x3c, 0x5f, 0xb2, 0x28, 0xac, 0x41, 0x67, 0x9e, 0x5d, 0xf2, 0x95, 0x13, 0xdf, 0x23,
+    0x79, 0xcf, 0xb5, 0xcd, 0x6c, 0x52, 0x8e, 0x60, 0x8a, 0xc1, 0xb2, 0xe9, 0x4f, 0x18, 0x6f, 0xed,
+    0xd6, 0x6f, 0x5c, 0xd8, 0x48, 0x08, 0x78, 0x67, 0x3e, 0x93, 0x20, 0xa0, 0xb1, 0x1e, 0x35, 0x10,
+    0xb8, 0x46, 0x99, 0xf3, 0xc5, 0x7e, 0x0a, 0x7c, 0x95, 0xfc, 0xe6, 0xd0, 0x72, 0x17, 0x98, 0xe9,
+    0x11, 0x94, 0x61, 0xdf, 0xe1, 0x6f, 0xe3, 0x7a, 0x25, 0x28, 0xc4, 0xb6, 0xe9, 0x3a, 0xad, 0x7d,
+    0x13, 0x2f, 0xef, 0xce, 0x64, 0x1e, 0xab, 0x78, 0x97, 0x31, 0x76, 0xaa, 0x52, 0x9d, 0xc1, 0x9a,
+    0xd7, 0x22, 0xff, 0x6c, 0x7e, 0xc7, 0x0a, 0x17, 0xb2, 0xe9, 0x42, 0xae, 0x1a, 0xb6, 0x0d, 0xf9,
+    0xc6, 0xd8, 0x2e, 0x83, 0x14, 0xfe, 0x91, 0xfa, 0x17, 0x51, 0x2f, 0xa8, 0x52, 0x04, 0xb3, 0xe9,
+    0x04, 0xdb, 0x42, 0xcd, 0x32, 0x2a, 0x9f, 0xb9, 0x8b, 0x72, 0xb2, 0xa2, 0xb6, 0x87, 0x80, 0xd5,
+    0xdb, 0x35, 0xc6, 0xa1, 0x52, 0x4b, 0xa1, 0xb0, 0xe9, 0x44, 0x6e, 0xb5, 0xaf, 0x82, 0x0b, 0xa3,
+    0x14, 0x91, 0xba, 0x54, 0xdb, 0xa7, 0xdc, 0x7c, 0xb2, 0x4f, 0xc1, 0x96, 0x6b, 0x5b, 0xbc, 0xc9,
+    0xb0, 0x36, 0x90, 0x2c, 0xd6, 0x5b, 0x59, 0x46, 0x54, 0x43, 0xda, 0x48, 0x4e, 0xca, 0x71, 0x18,
+    0x01, 0x5f, 0x46, 0xd1, 0xd9, 0xb3, 0x6c, 0x11, 0x51, 0x1b, 0x1e, 0xc0, 0x74, 0xc9, 0x8d, 0x17,
+    0x06, 0x94, 0x56, 0xca, 0x0b, 0xdc, 0x17, 0x54, 0x45, 0xe3, 0xf4, 0xa5, 0xe2, 0x5a, 0x02, 0xc1,
+    0x95, 0x06, 0x49, 0x15, 0x8c, 0x80, 0xac, 0x31, 0x0b, 0x9f, 0x52, 0x1d, 0xcc, 0x9b, 0x5e, 0x97,
+    0xc4, 0xac, 0x1b, 0x18, 0x54, 0x5e, 0xeb, 0xac, 0x06, 0x2e, 0x98, 0xce, 0x32, 0x38, 0x49, 0x95,
+    0xff, 0x4f, 0x25, 0x78, 0xd3, 0xb1, 0x3a, 0x14, 0xc1, 0x72, 0x41, 0xb9, 0xf6, 0x67, 0x54, 0x5f,
+    0x46, 0x14, 0x3f, 0x9e, 0x6f, 0xde, 0x87, 0x4d, 0x6f, 0x5b, 0x85, 0x7a, 0x2d, 0xdf, 0xf6, 0x82,
+    0x47, 0x88, 0xd5, 0xb7, 0x0f, 0xbe, 0xe0, 0xb8, 0x1c, 0xbe, 0x7e, 0x05, 0xcf, 0x3b, 0x00, 0xe9,
+    0xb6, 0xc6, 0x2b, 0x21, 0xdd, 0x3e, 0x40, 0x9c, 0xfd, 0xa3, 0xd3, 0x27, 0x21, 0x35, 0x45, 0x93,
+    0xd7, 0xf2, 0xd1, 0x11, 0x5f, 0xd8, 0x19, 0xc2, 0x37, 0xc0, 0x5f, 0xa9, 0xcd, 0xca, 0x02, 0xb1,
+    0xcf, 0xbf, 0x7c, 0xd3, 0x3d, 0xea, 0x59, 0xf9, 0x86, 0xdb, 0x61, 0xf5, 0x54, 0xc3, 0x8c, 0xa9,
+    0x76, 0xbe, 0x7e, 0x85, 0xde, 0x01, 0x58, 0xb3, 0x7c, 0xaa, 0x84, 0x33, 0xf9, 0xfd, 0x0b, 0x0b,
+    0x0f, 0x56, 0x18, 0x9b, 0x22, 0x95, 0xf0, 0x91, 0x98, 0x7d, 0xb9, 0xa5, 0x9b, 0xc3, 0xb5, 0x6f,
+    0x9b, 0xc8, 0x94, 0xd5, 0xcf, 0x3e, 0xf9, 0x32, 0x17, 0x4a, 0x3f, 0x15, 0x2d, 0x26, 0x1f, 0x35,
+    0x68, 0xf1, 0x42, 0x09, 0xa2, 0x3d, 0x3e, 0x7e, 0xf1, 0x04, 0xbc, 0x44, 0xcf, 0xeb, 0xf0, 0x12,
+    0x3d, 0x37, 0xe4, 0xa6, 0x59, 0xc5, 0x21, 0x64, 0xe7, 0xab, 0x33, 0xaf, 0xe5, 0x9b, 0xd2, 0x8d,
+    0x86, 0xc9, 0x0e, 0xe6, 0xe1, 0x17, 0x6a, 0x9f, 0xe2, 0x16, 0x53, 0x12, 0x29, 0x7a, 0x28, 0xf6,
+    0x8f, 0x24, 0x28, 0x51, 0x6e, 0xf1, 0x2e, 0x48, 0x70, 0xb0, 0x94, 0x4b, 0x15, 0x9d, 0xd7, 0xf2,
+    0x4d, 0xf4, 0x4b, 0x15, 0xd6, 0x49, 0xf7, 0x6b, 0xf0, 0xcc, 0xfc, 0xc1, 0x83, 0x01, 0x78, 0x58,
+    0xf1, 0x95, 0x36, 0x7c, 0x80, 0x80, 0xe8, 0x60, 0x0e, 0x4d, 0xda, 0x32, 0xfd, 0x73, 0xae, 0x44,
+    0x44, 0xed, 0x0c, 0xa3, 0xe9, 0xbd, 0x23, 0x0c, 0x71, 0x68, 0x61, 0x5c, 0x37, 0x58, 0x87, 0x3b,
+    0xf0, 0xda, 0x40, 0x5b, 0xf9, 0x36, 0xfc, 0xc3, 0x4e, 0x8f, 0xff, 0x6b, 0xd6, 0xa9, 0xfe, 0x26,
+    0x5e, 0x1f, 0xbb, 0xa3, 0x5d, 0xdb, 0xea, 0xae, 0x77, 0xfd, 0x49, 0x2b, 0x7c, 0x1f, 0xef, 0x6f,
+    0x01, 0x68, 0x04, 0xa3, 0x7a, 0xc1, 0x6f, 0x9b, 0xed, 0xae, 0x2d, 0xd9, 0x14, 0x9a, 0xe5, 0x41,
+    0x79, 0xcb, 0xc1, 0x17, 0xfe, 0xd1, 0xc8, 0x37, 0xa1, 0x17, 0x83, 0x0a, 0x8c, 0xc0, 0x4b, 0x08,
+    0xcd, 0xe0, 0x1c, 0xea, 0x90, 0x80, 0x31, 0xce, 0xa9, 0xfc, 0xf1, 0xe6, 0xe3, 0x07, 0x04, 0xbb,
+    0xc8, 0x06, 0xe6, 0x5a, 0x40, 0x92, 0x49, 0x8e, 0x3d, 0xf8, 0x3e, 0x61, 0xdc, 0x57, 0x8a, 0x85,
+    0xf0, 0x3d, 0x78, 0x85, 0x94, 0xf4, 0xfd, 0xd5, 0x00, 0x72, 0x6b, 0x58, 0x8c, 0x2b, 0xe0, 0x2b,
+    0x5c, 0x9b, 0xf1, 0x6e, 0xe1, 0x99, 0x54, 0x8a, 0x99, 0xa7, 0xe1, 0xf9, 0xc2, 0x41, 0xd2, 0x03,
+    0xd0, 0x48, 0xd1, 0x3c, 0xe3, 0x24, 0x36, 0xee, 0xf2, 0x40, 0xb6, 0xf3, 0xa3, 0x8a, 0x3d, 0x39,
+    0x7f, 0x63, 0x87, 0x78, 0x57, 0xd8, 0x89, 0xb1, 0xad, 0xaf, 0x3a, 0xce, 0x4c, 0x2e, 0xa4, 0x16,
+    0x24, 0x8a, 0xd2, 0xa6, 0xb7, 0xed, 0x44, 0x99, 0xee, 0x79, 0x3a, 0xdc, 0x9f, 0xd0, 0x48, 0xac,
+    0x87, 0x5d, 0xbb, 0xac, 0x9e, 0xd3, 0xbf, 0x80, 0xab, 0x62, 0x54, 0xf3, 0x7e, 0x16, 0x7a, 0xa7,
+    0x16, 0x3c, 0x3c, 0xd9, 0x6a, 0x51, 0x79, 0x13, 0xc9, 0x1c, 0x62, 0xba, 0xc5, 0x69, 0x50, 0x49,
+    0x02, 0xd6, 0x68, 0x26, 0x9a, 0xef, 0xb2, 0x9a, 0x64, 0x4a, 0x54, 0x36, 0x99, 0x89, 0xe6, 0x7e,
+    0x96, 0x55, 0x8f, 0x40, 0xcb, 0x25, 0xad, 0x2e, 0x28, 0x49, 0x07, 0xe7, 0x4c, 0xdc, 0x56, 0x45,
+    0x25, 0xd9, 0x3c, 0xdd, 0x85, 0x04, 0x84, 0xd7, 0x3b, 0x10, 0xd3, 0xd9, 0xdc, 0xdf, 0x7d, 0x98,
+    0x2b, 0x26, 0x3b, 0x44, 0x91, 0x9b, 0x48, 0xb9, 0xf6, 0x44, 0xf0, 0xa2, 0x9a, 0xbb, 0xc2, 0x02,
+    0xd1, 0x24, 0xbd, 0xc3, 0xa1, 0x7c, 0x25, 0xa4, 0x6e, 0x36, 0x49, 0x1b, 0x26, 0x2d, 0x18, 0x8d,
+    0x61, 0x62, 0x4d, 0xb6, 0x03, 0xc4, 0x7c, 0x68, 0xf9, 0x53, 0x21, 0x2f, 0x49, 0x30, 0x6f, 0x72,
+    0x7c, 0xea, 0x56, 0xdf, 0x84, 0x53, 0xb6, 0xca, 0x53, 0x1e, 0x48, 0x4a, 0x34, 0x4d, 0x88, 0xc7,
+    0x2c, 0x69, 0xe5, 0x22, 0xd8, 0xd0, 0xc3, 0x56, 0x45, 0xf5, 0x4f, 0x68, 0xf3, 0xea, 0x97, 0x17,
+    0x58, 0xb4, 0x45, 0x31, 0x9a, 0x2d, 0x4f, 0xfd, 0x55, 0x93, 0xfb, 0x8a, 0x06, 0x4b, 0x49, 0x31,
+    0x6c, 0xc1, 0xff, 0xfe, 0xcf, 0x7f, 0xff, 0x97, 0x09, 0x5b, 0x5e, 0x2b, 0xf1, 0x65, 0xb6, 0x6e,
+    0xce, 0x4f, 0x11, 0x8c, 0xeb, 0x6a, 0x24, 0x58, 0xf2, 0x5e, 0x2b, 0x59, 0xbd, 0x83, 0x98, 0xa4,
+    0x2c, 0x82, 0x11, 0x34, 0x8d, 0x08, 0x6d, 0x35, 0x93, 0xa8, 0x7c, 0xd3, 0xd2, 0xd4, 0xc6, 0x95,
+    0x35, 0xfc, 0x9b, 0x43, 0xc3, 0xbb, 0x15, 0x3c, 0xbc, 0x98, 0xb3, 0x28, 0x6c, 0xba, 0x97, 0x3e,
+    0x1c, 0x52, 0x71, 0xe4, 0x46, 0xa2, 0x8e, 0xe8, 0x9e, 0x44, 0xf2, 0x5d, 0x01, 0x1c, 0xdb, 0xe3,
+    0x1f, 0x6d, 0x91, 0x99, 0x77, 0x04, 0xa8, 0xec, 0xa9, 0xcf, 0x53, 0x5e, 0xdb, 0x18, 0x5d, 0xc1,
+    0x0f, 0x38, 0x0c, 0xd3, 0x91, 0xee, 0xd4, 0x58, 0x66, 0x36, 0x8f, 0xcd, 0x91, 0x96, 0x73, 0x2c,
+    0x5b, 0x97, 0x52, 0x90, 0xb0, 0x95, 0x2f, 0x8d, 0xca, 0xbe, 0x25, 0x13, 0xce, 0x1f, 0x4b, 0x2a,
+    0x37, 0xb6, 0xb9, 0x21, 0xe4, 0x9b, 0x28, 0x6a, 0x7a, 0xa9, 0xfa, 0x7b, 0x25, 0xfd, 0xe6, 0x56,
+    0x11, 0xd1, 0xbc, 0x7c, 0x49, 0x17, 0x62, 0x45, 0x31, 0x13, 0xb7, 0xc5, 0xa9, 0xd7, 0x2a, 0x1d,
+    0x40, 0xea, 0xb5, 0xcd, 0x6a, 0x12, 0x86, 0xf9, 0xa5, 0xc5, 0x95, 0xd5, 0xfa, 0x16, 0x69, 0x3e,
+    0x7b, 0xb6, 0x5f, 0xb2, 0x56, 0x1c, 0x25, 0xef, 0x73, 0x9c, 0xf5, 0xce, 0xb8, 0x30, 0xc4, 0x2d,
+    0xc9, 0x0b, 0xa3, 0xf0, 0xf3, 0x12, 0xa9, 0x2d, 0x90, 0x54, 0x2f, 0x25, 0x3f, 0x73, 0x78, 0xed,
+    0x94, 0xb0, 0xc7, 0x12, 0x9e, 0x74, 0x04, 0x9d, 0xa6, 0xaf, 0xfb, 0xf8, 0xdd, 0x1a, 0x5f, 0x9b,
+    0x90, 0xef, 0xb5, 0x6b, 0x3c, 0xd1, 0x82, 0xea, 0xb9, 0x08, 0x07, 0xe0, 0x5d, 0xfd, 0x72, 0x7d,
+    0xe3, 0xb5, 0x9d, 0x6b, 0xf0, 0x56, 0x06, 0x95, 0x6a, 0x00, 0xf7, 0x26, 0xfd, 0x41, 0xfd, 0xeb,
+    0xdc, 0x6c, 0x62, 0xea, 0x0d, 0xc0, 0xc3, 0xfb, 0xdf, 0x2c, 0x30, 0xfd, 0x90, 0x2e, 0x3a, 0x6a,
+    0x0f, 0x1e, 0xdc, 0x48, 0xf0, 0x4e, 0xc7, 0x00, 0xfe, 0xfd, 0xfa, 0x97, 0x9f, 0x7d, 0xa5, 0x25,
+    0xe3, 0x33, 0x36, 0xdd, 0x34, 0xef, 0xcd, 0xb1, 0x0e, 0xca, 0xc7, 0xdd, 0xde, 0x4a, 0xea, 0xa1,
+    0xb5, 0x97, 0x59, 0x17, 0x8c, 0x2f, 0xed, 0x3e, 0xf3, 0x19, 0x1a, 0xa0, 0xc9, 0x4e, 0x4a, 0xea,
+    0xf4, 0x3d, 0x78, 0x18, 0xcf, 0x5c, 0x88, 0xa8, 0xbe, 0x61, 0x0b, 0x2a, 0x96, 0xba, 0x59, 0xcc,
+    0xa0, 0xdb, 0x70, 0xd2, 0xeb, 0xf5, 0x5a, 0x4f, 0xf0, 0x00, 0xdb, 0x23, 0xa8, 0xd8, 0xfe, 0x8e,
+    0x1c, 0x20, 0xd7, 0x7c, 0x72, 0x66, 0x00, 0xb6, 0x22, 0x80, 0x91, 0xe3, 0x5c, 0x73, 0x3d, 0x92,
+    0xc1, 0x21, 0x2d, 0x96, 0xea, 0xc1, 0x6d, 0xab, 0xfc, 0x01, 0xc4, 0xf8, 0xee, 0xc2, 0x7b, 0xae,
+    0x9b, 0x07, 0xf4, 0x57, 0x5a, 0x55, 0x94, 0xd5, 0x06, 0xc2, 0x3e, 0xa8, 0x6b, 0xbb, 0x20, 0x3b,
+    0x76, 0xc0, 0xac, 0xf8, 0x00, 0xdc, 0xf9, 0x76, 0x84, 0x03, 0xeb, 0xb6, 0x8d, 0x30, 0x38, 0xa0,
+    0x07, 0x51, 0xc5, 0x93, 0xb4, 0x0f, 0x06, 0xfb, 0x76, 0x1d, 0x1c, 0x87, 0x92, 0x6b, 0x17, 0x0c,
+    0x0e, 0xea, 0x37, 0xd4, 0xe3, 0xc2, 0x1e, 0xc1, 0x5e, 0x47, 0x5c, 0xed, 0x36, 0xb4, 0x76, 0x60,
+    0x25, 0x38, 0x6c, 0x3d, 0xa4, 0xc5, 0x50, 0xc5, 0x55, 0xa8, 0xa9, 0x07, 0x87, 0x36, 0x14, 0xea,
+    0xf0, 0x2d, 0x48, 0x30, 0xd8, 0xbf, 0x7d, 0x50, 0xb4, 0xf9, 0xa7, 0x79, 0xe3, 0xa4, 0x65, 0xfa,
+    0xff, 0xd3, 0x0f, 0x5b, 0xe2, 0x9e, 0xe6, 0x6a, 0xb7, 0x0d, 0x71, 0xe3, 0xb4, 0xc2, 0xe7, 0xde,
+    0x53, 0x9c, 0x24, 0x82, 0x26, 0x3e, 0x2d, 0xc1, 0x76, 0x98, 0xbf, 0xcc, 0x1a, 0xec, 0xae, 0x10,
+    0x6d, 0xf0, 0xca, 0x45, 0xd3, 0x4b, 0x1b, 0xed, 0x38, 0x3b, 0xb6, 0xfe, 0xef, 0xb5, 0xd7, 0x72,
+    0x47, 0xec, 0x7d, 0xcf, 0x35, 0xd9, 0x18, 0x0f, 0xb6, 0x74, 0x88, 0x8f, 0x4b, 0x2f, 0x21, 0x27,
+    0xa9, 0xae, 0x76, 0x89, 0xed, 0x61, 0x77, 0x76, 0x97, 0x43, 0xba, 0x50, 0xb3, 0x36, 0x30, 0x75,
+    0x69, 0xa6, 0xff, 0x49, 0x2a, 0xe9, 0x8e, 0x20, 0xbb, 0x1b, 0x2f, 0xc9, 0xbc, 0xc4, 0xab, 0xa6,
+    0x70, 0xc5, 0x34, 0x74, 0xa1, 0x66, 0xee, 0x24, 0x2f, 0xad, 0x4d, 0xf0, 0x62, 0x31, 0xc6, 0xe0,
+    0x66, 0x4a, 0xd4, 0x6b, 0xf0, 0x4c, 0xb9, 0x6c, 0x0a, 0x8c, 0xe4, 0x6a, 0x70, 0x35, 0xff, 0xcb,
+    0xc2, 0xb0, 0x2d, 0x11, 0xee, 0x5d, 0x78, 0xbd, 0x33, 0x78, 0x68, 0xc3, 0x8b, 0x62, 0x5c, 0xde,
+    0xdd, 0x12, 0x4b, 0x27, 0x46, 0xef, 0xf9, 0x54, 0x7c, 0x93, 0xa6, 0x58, 0x3a, 0xfb, 0xeb, 0xae,
+    0xec, 0x58, 0xf2, 0x1b, 0x14, 0xb6, 0xb5, 0x67, 0x92, 0xcd, 0x3e, 0x2b, 0xad, 0x79, 0x53, 0xa1,
+    0x26, 0x14, 0x98, 0xe6, 0xe6, 0x67, 0x7e, 0xcb, 0xc5, 0x9a, 0x7b, 0x07, 0x61, 0x4f, 0x47, 0xa1,
+    0x6e, 0xf4, 0x13, 0x7c, 0xfa, 0x85, 0xf2, 0xd5, 0x8e, 0x0d, 0x0a, 0x4a, 0xfb, 0x2d, 0x18, 0xf3,
+    0x8c, 0xce, 0x7c, 0x23, 0x36, 0x9c, 0xc8, 0x9c, 0xa6, 0xb5, 0x03, 0x3b, 0x8e, 0x6b, 0xbd, 0x16,
+    0xd6, 0xb0, 0x73, 0x1c, 0xdf, 0xa1, 0x8d, 0x25, 0x0a, 0x56, 0xd1, 0xa7, 0x15, 0x91, 0x8f, 0x75,
+    0x6a, 0x72, 0x13, 0xcf, 0x47, 0xba, 0x35, 0xcf, 0xf1, 0xa6, 0x95, 0x8f, 0x83, 0x63, 0xe5, 0x47,
+    0x94, 0xcf, 0xf4, 0x3c, 0xa7, 0xf3, 0x67, 0x0e, 0xaf, 0x50, 0x1e, 0xb1, 0x3a, 0x88, 0x43, 0x6c,
+    0xef, 0xcd, 0x58, 0x7a, 0xf4, 0x38, 0xcb, 0x67, 0x55, 0xc7, 0x9a, 0xc1, 0x17, 0xe8, 0xda, 0x3a,
+    0x54, 0xe7, 0x86, 0x28, 0xb1, 0x22, 0xdc, 0x6f, 0xbd, 0xdf, 0x6b, 0x90, 0xfb, 0x98, 0xc4, 0xfa,
+    0x94, 0x87, 0xea, 0x57, 0xa6, 0xe7, 0x4d, 0x0f, 0xa7, 0xe3, 0xe8, 0xb1, 0xef, 0x77, 0x3b, 0xd6,
+    0xab, 0x88, 0x12, 0x45, 0xd3, 0xb7, 0x0e, 0x09, 0x20, 0x58, 0x71, 0x4a, 0x9f, 0x45, 0x97, 0x0a,
+    0x22, 0x57, 0x30, 0x78, 0x78, 0xb6, 0x23, 0xa8, 0x24, 0xb3, 0xe8, 0x0c, 0x7d, 0x03, 0xbd, 0x5d,
+    0x46, 0x3c, 0xd6, 0x1a, 0x0d, 0x68, 0xe2, 0x6f, 0x1f, 0x89, 0x9e, 0xfb, 0xe6, 0x2a, 0x7e, 0xd3,
+    0x3c, 0xc6, 0xdb, 0x50, 0xd0, 0x85, 0x7e, 0xef, 0xe8, 0xd8, 0xb4, 0x59, 0xe0, 0xa7, 0xf3, 0xd6,
+    0x6b, 0xb8, 0xc9, 0x62, 0x13, 0xac, 0xf1, 0x42, 0xbf, 0xa4, 0x13, 0x21, 0x34, 0x90, 0x29, 0xde,
+    0xcc, 0xb1, 0x67, 0xea, 0xe7, 0x83, 0x56, 0x45, 0xc6, 0x77, 0x73, 0x74, 0xfc, 0x9c, 0xae, 0xe1,
+    0x3f, 0x3e, 0x7e, 0xf8, 0x51, 0xeb, 0xf8, 0x13, 0xfd, 0x63, 0x49, 0x95, 0x2e, 0xbb, 0x1a, 0x73,
+    0x1e, 0x42, 0x2e, 0xde, 0x5a, 0xbf, 0x84, 0x00, 0xef, 0x92, 0xaf, 0xe5, 0xa5, 0xe9, 0xb2, 0xa4,
+    0xe9, 0xd2, 0xf4, 0x52, 0x66, 0xbd, 0xb6, 0xe1, 0xb4, 0xbd, 0xe5, 0xb7, 0xe5, 0xa0, 0x28, 0xbd,
+    0x81, 0x70, 0x4e, 0xe4, 0x6e, 0x45, 0x4b, 0x6f, 0x24, 0x78, 0x0e, 0x52, 0xe3, 0xdc, 0x6d, 0x85,
+    0xfd, 0xb0, 0xe0, 0x4a, 0x17, 0x26, 0xdb, 0x91, 0xbd, 0x7c, 0x04, 0x8b, 0x7b, 0xea, 0x80, 0xf0,
+    0xcb, 0xd4, 0x62, 0x0f, 0x30, 0xec, 0x67, 0xa5, 0x1c, 0x34, 0x95, 0xc7, 0x7e, 0x9d, 0xa6, 0x6c,
+    0xc7, 0xdd, 0xed, 0xdb, 0x94, 0xb1, 0xb2, 0xdb, 0xb3, 0x94, 0x38, 0x9b, 0xb8, 0x19, 0x88, 0xa5,
+    0xc3, 0x5c, 0xd9, 0x43, 0x10, 0x7c, 0xb3, 0xd7, 0x2b, 0x91, 0x7d, 0x37, 0x97, 0x7e, 0xa2, 0x80,
+    0x82, 0xa7, 0x3c, 0xe4, 0xfd, 0x9f, 0xd3, 0xe9, 0xa3, 0xb1, 0xd0, 0xc4, 0x33, 0x5c, 0x88, 0x45,
+    0xbc, 0xd4, 0xc8, 0x40, 0xdd, 0xb8, 0xc2, 0x9c, 0x74, 0x80, 0x54, 0xe7, 0xac, 0x05, 0xe1, 0x05,
+    0x09, 0x69, 0x08, 0x5d, 0xa0, 0xbe, 0x16, 0x9a, 0x44, 0x2d, 0xf8, 0x3b, 0xbe, 0xe0, 0x52, 0xd3,
+    0x20, 0xcc, 0xeb, 0x4a, 0xc2, 0x99, 0x7d, 0xa3, 0x65, 0x64, 0x90, 0x7f, 0x0f, 0xde, 0xdf, 0x6a,
+    0xda, 0x93, 0x8f, 0x8a, 0xd0, 0x8e, 0x3b, 0x76, 0x60, 0x79, 0x28, 0x57, 0x0b, 0x15, 0x19, 0x0a,
+    0x6e, 0x1c, 0xc6, 0x8e, 0xc0, 0x91, 0xca, 0x0d, 0x57, 0xa7, 0x03, 0xb5, 0xd1, 0x08, 0xdf, 0x9d,
+    0xac, 0x93, 0xdb, 0x0e, 0x8e, 0x3d, 0x7c, 0x11, 0xe8, 0x49, 0xec, 0xe2, 0xf5, 0xd2, 0x38, 0xa2,
+    0x9a, 0x3e, 0x87, 0x4f, 0xc6, 0x0b, 0x61, 0x4b, 0x25, 0xb9, 0xeb, 0x5b, 0xd1, 0xa4, 0x47, 0x35,
+    0xca, 0xbe, 0xb4, 0x55, 0x07, 0xb5, 0x4d, 0xf8, 0x76, 0x4a, 0xe5, 0x31, 0xc2, 0x3f, 0xd1, 0xf4,
+    0x0d, 0xb8, 0x98, 0xcc, 0x76, 0x50, 0x89, 0x7f, 0x6b, 0xc6, 0x43, 0xb1, 0xf6, 0x23, 0x61, 0xeb,
+    0x26, 0x5f, 0x1a, 0xd8, 0x66, 0x8d, 0x4e, 0x3d, 0x98, 0x97, 0xd2, 0x9c, 0x2a, 0xb7, 0x73, 0x54,
+    0x85, 0x1a, 0x8d, 0x39, 0xf0, 0x56, 0xaa, 0x53, 0x53, 0xf5, 0xd4, 0x10, 0x66, 0x72, 0xd0, 0x04,
+    0xc0, 0x54, 0x69, 0xa6, 0x28, 0x37, 0x9a, 0x20, 0xa9, 0x8a, 0x05, 0x57, 0xf4, 0x86, 0xde, 0xe9,
+    0x56, 0xf2, 0xb2, 0xdb, 0xd7, 0xaf, 0x26, 0x03, 0x4f, 0x13, 0xaf, 0x52, 0xb1, 0xb0, 0x87, 0xc4,
+    0x2a, 0xf9, 0xfb, 0xa3, 0xe7, 0x68, 0x5f, 0x8b, 0xab, 0x21, 0xdf, 0xe9, 0xa9, 0x6a, 0xc6, 0xf7,
+    0xfb, 0x58, 0x0a, 0x4d, 0xeb, 0x98, 0x5d, 0x4a, 0xf1, 0x88, 0x16, 0x5b, 0x79, 0x43, 0x27, 0xed,
+    0xc4, 0x61, 0x72, 0x44, 0x6b, 0xd2, 0xca, 0xc3, 0xb9, 0xde, 0x97, 0x63, 0x27, 0x7f, 0x31, 0xe5,
+    0xcd, 0xa4, 0xe4, 0x87, 0x52, 0x3d, 0x61, 0xf1, 0x96, 0xe3, 0x8f, 0xf1, 0x08, 0x18, 0x82, 0xd3,
+    0x90, 0xec, 0xae, 0x7c, 0xf6, 0xeb, 0xd1, 0x09, 0xce, 0x92, 0xe4, 0xaf, 0x56, 0xbc, 0x4f, 0xbe,
+    0xf7, 0x64, 0xb2, 0xd5, 0x52, 0xf7, 0x3a, 0x2f, 0x82, 0x83, 0x5a, 0x7d, 0x7f, 0x86, 0xd0, 0x3d,
+    0x2f, 0x37, 0x3d, 0x99, 0xde, 0x52, 0xe3, 0x69, 0x9f, 0xba, 0xe0, 0x4f, 0x5c, 0x33, 0x31, 0x64,
+    0xa6, 0xb7, 0x65, 0x76, 0xdd, 0x30, 0xc9, 0xd3, 0xde, 0xed, 0xc2, 0x27, 0x6a, 0xae, 0x01, 0xcd,
+    0xc5, 0x1a, 0x22, 0xbc, 0xfb, 0x6a, 0x5e, 0xdb, 0x40, 0x17, 0x09, 0x5a, 0x88, 0xdb, 0x6c, 0x62,
+    0xdd, 0xfc, 0xb7, 0xcb, 0x1b, 0xb0, 0xd3, 0x03, 0x3a, 0x31, 0x77, 0x3d, 0x54, 0xab, 0x5a, 0x59,
+    0x48, 0x83, 0x0c, 0xaf, 0xcb, 0xde, 0xb0, 0x05, 0xe3, 0x75, 0x2d, 0x6a, 0x4e, 0x70, 0xbe, 0x19,
+    0x53, 0x89, 0xba, 0x8a, 0x2f, 0x41, 0x1b, 0x7e, 0xb9, 0x96, 0x8c, 0xaa, 0xf3, 0x0d, 0x76, 0xae,
+    0xe0, 0xf5, 0xce, 0xc7, 0x4d, 0x8f, 0x93, 0x15, 0x9b, 0xd9, 0x76, 0x50, 0xeb, 0xb7, 0xde, 0xef,
+    0x30, 0x48, 0xee, 0x39, 0x56, 0xb2, 0x71, 0xdc, 0xeb, 0xeb, 0x57, 0xc0, 0x7f, 0x4d, 0xae, 0x70,
+    0x89, 0xef, 0x39, 0x5f, 0xf2, 0xd0, 0xdd, 0xdc, 0x29, 0x8c, 0x49, 0xe8, 0xa4, 0xab, 0x0d, 0x1b,
+    0xce, 0xe6, 0xdc, 0x63, 0x8d, 0xb9, 0x3f, 0xdd, 0x94, 0x73, 0x0f, 0x46, 0xdc, 0x73, 0x4f, 0x41,
+    0xc2, 0x8f, 0x6a, 0x90, 0x4f, 0x8d, 0xca, 0xfc, 0x42, 0x07, 0xc5, 0xee, 0x9b, 0xbe, 0x12, 0x06,
+    0xd4, 0x96, 0xbb, 0x0b, 0x98, 0x86, 0x12, 0x07, 0xb6, 0xf4, 0xd1, 0x16, 0x99, 0xb4, 0xf5, 0xc3,
+    0x35, 0xe2, 0xac, 0xc1, 0x67, 0xde, 0x1d, 0x9e, 0x52, 0x79, 0xbe, 0xd1, 0x14, 0xdf, 0x2e, 0x27,
+    0x2b, 0x3f, 0xfd, 0xe9, 0x1a, 0xab, 0x1c, 0xbc, 0xcb, 0xe7, 0xe8, 0x2e, 0x16, 0x1d, 0x64, 0xcb,
+    0xb7, 0x31, 0x2c, 0xe9, 0xf8, 0x3c, 0xb8, 0x5d, 0x5b, 0x12, 0xb5, 0x49, 0x68, 0x79, 0xc6, 0x59,
+    0x22, 0xe5, 0x54, 0x36, 0x3d, 0xe3, 0x2e, 0xdb, 0xd9, 0x48, 0x39, 0xcb, 0x27, 0xca, 0xda, 0xda,
+    0x86, 0x5e, 0x2b, 0x9f, 0x91, 0xe7, 0xef, 0xc6, 0x9e, 0x15, 0x7e, 0xcd, 0xdf, 0x9f, 0x2a, 0x3e,
+    0x29, 0xb6, 0x91, 0xb6, 0xcf, 0x14, 0xd5, 0xef, 0xf1, 0x15, 0x8a, 0x15, 0x89, 0x2a, 0xf3, 0xa3,
+    0x7c, 0xf6, 0x30, 0xec, 0xa6, 0xb7, 0x7a, 0x87, 0x5d, 0xfb, 0xb6, 0xf3, 0xb0, 0x6b, 0xff, 0xd3,
+    0xa8, 0xff, 0x03, 0xad, 0xd3, 0xcf, 0xa6, 0x4c, 0x4a, 0x00, 0x00,
+};
+
+#endif  // WEB_UI_H
@@ -3,6 +3,7 @@
 #include <WiFi.h>
 #include <aurora_protocol.h>
 #include <nordic_uart_ble.h>
+#include <radio_coex.h>
 
 GraphQLWSClient GraphQL;
 
@@ -11,9 +12,11 @@ const char* GraphQLWSClient::KEY_PORT = "gql_port";
 const char* GraphQLWSClient::KEY_PATH = "gql_path";
 
 GraphQLWSClient::GraphQLWSClient()
-    : state(GraphQLConnectionState::DISCONNECTED), messageCallback(nullptr), stateCallback(nullptr), queueSyncCallback(nullptr),
-      ledUpdateCallback(nullptr), serverPort(443), useSSL(true), lastPingTime(0), lastPongTime(0), reconnectTime(0), lastSentLedHash(0), currentDisplayHash(0),
-      mutationInFlight(false), mutationSentTime(0) {}
+    : state(GraphQLConnectionState::DISCONNECTED), messageCallback(nullptr), stateCallback(nullptr),
+      queueSyncCallback(nullptr), ledUpdateCallback(nullptr), activityCallback(nullptr), serverPort(443), useSSL(true),
+      lastPingTime(0), lastPongTime(0), reconnectTime(0), connectAttemptMs(0), handshakeMarked(false),
+      lastSentLedHash(0), currentDisplayHash(0), mutationInFlight(false), mutationSentTime(0),
+      operationCallback(nullptr), operationSentTime(0) {}
 
 void GraphQLWSClient::begin(const char* host, uint16_t port, const char* path, const char* apiKeyParam) {
     // Parse protocol prefix from host (ws:// or wss://)
@@ -60,10 +63,25 @@ void GraphQLWSClient::begin(const char* host, uint16_t port, const char* path, c
 
     ws.setReconnectInterval(WS_RECONNECT_INTERVAL);
 
+    // Keep BLE scans off the air until the TLS/upgrade handshake completes
+    markHandshake(true);
+
     setState(GraphQLConnectionState::CONNECTING);
 }
 
 void GraphQLWSClient::loop() {
+    // Until the socket comes up, ws.loop() retries the connect itself every
+    // WS_RECONNECT_INTERVAL without any event. Mirror that timer so each
+    // attempt counts as a handshake, and let a silent failure expire.
+    if (state == GraphQLConnectionState::CONNECTING) {
+        unsigned long sinceAttempt = millis() - connectAttemptMs;
+        if (handshakeMarked && sinceAttempt >= WS_HANDSHAKE_HOLD_MS) {
+            markHandshake(false);
+        } else if (!handshakeMarked && sinceAttempt >= WS_RECONNECT_INTERVAL) {
+            markHandshake(true);
+        }
+    }
+
     ws.loop();
 
     // Handle ping interval
@@ -75,6 +93,11 @@ void GraphQLWSClient::loop() {
         }
     }
 
+    if (isOperationPending() && millis() - operationSentTime > GQL_OPERATION_TIMEOUT_MS) {
+        Logger.logln("GraphQL: Operation %s timed out", pendingOperationId.c_str());
+        failOperation();
+    }
+
     // Handle reconnection
     if (state == GraphQLConnectionState::DISCONNECTED && reconnectTime > 0) {
         if (millis() > reconnectTime) {
@@ -87,7 +110,10 @@ void GraphQLWSClient::loop() {
 
 void GraphQLWSClient::disconnect() {
     ws.disconnect();
+    markHandshake(false);
+    Coex.setWifiLinkUp(false);
     setState(GraphQLConnectionState::DISCONNECTED);
+    failOperation();
 }
 
 bool GraphQLWSClient::isConnected() {
@@ -120,7 +146,7 @@ void GraphQLWSClient::subscribe(const char* subId, const char* query, const char
 
     String msg;
     serializeJson(doc, msg);
-    ws.sendTXT(msg);
+    sendText(msg);
 
     setState(GraphQLConnectionState::SUBSCRIBED);
     Logger.logln("GraphQL: Subscribed to %s", subId);
@@ -133,7 +159,7 @@ void GraphQLWSClient::unsubscribe(const char* subId) {
 
     String msg;
     serializeJson(doc, msg);
-    ws.sendTXT(msg);
+    sendText(msg);
 }
 
 void GraphQLWSClient::send(const char* query, const char* variables) {
@@ -154,7 +180,7 @@ void GraphQLWSClient::send(const char* query, const char* variables) {
 
     String msg;
     serializeJson(doc, msg);
-    ws.sendTXT(msg);
+    sendText(msg);
 }
 
 void GraphQLWSClient::sendMutation(const char* mutationId, const char* mutation, const char* variables) {
@@ -190,13 +216,58 @@ void GraphQLWSClient::sendMutation(const char* mutationId, const char* mutation,
 
     String msg;
     serializeJson(doc, msg);
-    ws.sendTXT(msg);
+    sendText(msg);
 
     mutationInFlight = true;
     mutationSentTime = millis();
     Logger.logln("GraphQL: Sent mutation %s", mutationId);
 }
 
+bool GraphQLWSClient::sendOperation(const char* operationId, const char* query, const char* variables,
+                                    GraphQLOperationCallback callback) {
+    if (!isConnected() || isOperationPending()) {
+        return false;
+    }
+
+    JsonDocument doc;
+    doc["id"] = operationId;
+    doc["type"] = "subscribe";
+
+    JsonObject payload = doc["payload"].to<JsonObject>();
+    payload["query"] = query;
+
+    if (variables) {
+        JsonDocument varsDoc;
+        deserializeJson(varsDoc, variables);
+        payload["variables"] = varsDoc;
+    }
+
+    String msg;
+    serializeJson(doc, msg);
+    sendText(msg);
+
+    pendingOperationId = operationId;
+    operationCallback = callback;
+    operationSentTime = millis();
+    return true;
+}
+
+void GraphQLWSClient::finishOperation(JsonObject data) {
+    GraphQLOperationCallback callback = operationCallback;
+    operationCallback = nullptr;
+    if (callback) {
+        callback(pendingOperationId.c_str(), data);
+    }
+}
+
+void GraphQLWSClient::failOperation() {
+    if (!isOperationPending()) {
+        return;
+    }
+    finishOperation(JsonObject());
+    pendingOperationId = "";
+}
+
 void GraphQLWSClient::setMessageCallback(GraphQLMessageCallback callback) {
     messageCallback = callback;
 }
@@ -213,15 +284,36 @@ void GraphQLWSClient::setLedUpdateCallback(GraphQLLedUpdateCallback callback) {
     ledUpdateCallback = callback;
 }
 
+void GraphQLWSClient::setActivityCallback(GraphQLActivityCallback callback) {
+    activityCallback = callback;
+}
+
+void GraphQLWSClient::markHandshake(bool active) {
+    if (active) {
+        connectAttemptMs = millis();
+        Coex.beginActivity(CoexActivity::WIFI_HANDSHAKE);
+    } else {
+        Coex.endActivity(CoexActivity::WIFI_HANDSHAKE);
+    }
+    handshakeMarked = active;
+}
+
 void GraphQLWSClient::onWebSocketEvent(WStype_t type, uint8_t* payload, size_t length) {
+    if (activityCallback) {
+        activityCallback();
+    }
+
     switch (type) {
         case WStype_DISCONNECTED:
             Logger.logln("GraphQL: Disconnected");
+            markHandshake(false);
+            Coex.setWifiLinkUp(false);
             setState(GraphQLConnectionState::DISCONNECTED);
             // Schedule reconnection
             reconnectTime = millis() + WS_RECONNECT_INTERVAL;
             // Clear mutation in-flight flag on disconnect
             mutationInFlight = false;
+            failOperation();
             // Clear LEDs on disconnect
             LEDs.clear();
             LEDs.show();
@@ -229,11 +321,14 @@ void GraphQLWSClient::onWebSocketEvent(WStype_t type, uint8_t* payload, size_t l
 
         case WStype_CONNECTED:
             Logger.logln("GraphQL: Connected to %s", serverHost.c_str());
+            markHandshake(false);
+            Coex.setWifiLinkUp(true);
             setState(GraphQLConnectionState::CONNECTED);
             sendConnectionInit();
             break;
 
         case WStype_TEXT:
+            Coex.noteActivity(CoexActivity::WIFI_TRANSFER);
             handleMessage(payload, length);
             break;
 
@@ -242,7 +337,7 @@ void GraphQLWSClient::onWebSocketEvent(WStype_t type, uint8_t* payload, size_t l
             break;
 
         case WStype_PING:
-            Logger.logln("GraphQL: Ping received");
+            Logger.debugln("GraphQL: Ping received");
             break;
 
         case WStype_PONG:
@@ -272,7 +367,7 @@ void GraphQLWSClient::sendConnectionInit() {
 
     String msg;
     serializeJson(doc, msg);
-    ws.sendTXT(msg);
+    sendText(msg);
 
     Logger.logln("GraphQL: Sent connection_init");
     setState(GraphQLConnectionState::CONNECTION_INIT);
@@ -293,6 +388,15 @@ void GraphQLWSClient::handleMessage(uint8_t* payload, size_t length) {
         Logger.logln("GraphQL: Connection acknowledged");
         setState(GraphQLConnectionState::CONNECTION_ACK);
     } else if (strcmp(type, "next") == 0) {
+        // Result of sendOperation(); "complete" follows
+        const char* msgId = doc["id"];
+        if (msgId && isOperationPending() && pendingOperationId == msgId) {
+            JsonObject payloadObj = doc["payload"];
+            JsonObject data = payloadObj["data"];
+            finishOperation(payloadObj["errors"].isNull() ? data : JsonObject());
+            return;
+        }
+
         // Subscription data
         JsonObject payloadObj = doc["payload"];
         if (payloadObj["data"].is<JsonObject>()) {
@@ -306,7 +410,7 @@ void GraphQLWSClient::handleMessage(uint8_t* payload, size_t length) {
                 } else if (typename_ && strcmp(typename_, "ControllerQueueSync") == 0) {
                     handleQueueSync(event);
                 } else if (typename_ && strcmp(typename_, "ControllerPing") == 0) {
-                    Logger.logln("GraphQL: Received ping from server");
+                    Logger.debugln("GraphQL: Received ping from server");
                 }
             }
         }
@@ -314,6 +418,13 @@ void GraphQLWSClient::handleMessage(uint8_t* payload, size_t length) {
             messageCallback(doc);
         }
     } else if (strcmp(type, "error") == 0) {
+        const char* msgId = doc["id"];
+        if (msgId && isOperationPending() && pendingOperationId == msgId) {
+            Logger.logln("GraphQL: Operation %s failed", msgId);
+            failOperation();
+            return;
+        }
+
         Logger.logln("GraphQL: Subscription/mutation error");
         JsonArray errors = doc["payload"];
         for (JsonObject err : errors) {
@@ -323,8 +434,11 @@ void GraphQLWSClient::handleMessage(uint8_t* payload, size_t length) {
         mutationInFlight = false;
     } else if (strcmp(type, "complete") == 0) {
         const char* msgId = doc["id"];
-        // Only reset state if main subscription completed, not mutations
-        if (msgId && subscriptionId == String(msgId)) {
+        if (msgId && isOperationPending() && pendingOperationId == msgId) {
+            // Fails the operation only if no result came first
+            failOperation();
+        } else if (msgId && subscriptionId == String(msgId)) {
+            // Only reset state if main subscription completed, not mutations
             Logger.logln("GraphQL: Main subscription completed");
             setState(GraphQLConnectionState::CONNECTION_ACK);
         } else {
@@ -339,6 +453,8 @@ void GraphQLWSClient::handleMessage(uint8_t* payload, size_t length) {
 }
 
 void GraphQLWSClient::handleLedUpdate(JsonObject& data) {
+    unsigned long receivedAt = millis();
+
     // Check if this update was initiated by this controller (self-initiated from BLE)
     // Compare incoming clientId with our device's MAC address
     const char* updateClientId = data["clientId"];
@@ -415,6 +531,9 @@ void GraphQLWSClient::handleLedUpdate(JsonObject& data) {
         ledUpdateCallback(ledCommands, count);
     }
 
+    // Frame received to LEDs shown and forwarded to the board
+    Coex.recordLedUpdateLatency(millis() - receivedAt);
+
     delete[] ledCommands;
 }
 
@@ -488,7 +607,7 @@ void GraphQLWSClient::handleQueueSync(JsonObject& data) {
 }
 
 void GraphQLWSClient::sendLedPositions(const LedCommand* commands, int count, int angle) {
-    Logger.logln("GraphQL: sendLedPositions called: %d LEDs, state=%d", count, (int)state);
+    Logger.debugln("GraphQL: sendLedPositions called: %d LEDs, state=%d", count, (int)state);
 
     if (state != GraphQLConnectionState::SUBSCRIBED) {
         Logger.logln("GraphQL: Cannot send LED positions - not subscribed");
@@ -497,23 +616,23 @@ void GraphQLWSClient::sendLedPositions(const LedCommand* commands, int count, in
 
     // Check if this is the same LED data we just sent (deduplication)
     uint32_t currentHash = computeLedHash(commands, count);
-    Logger.logln("GraphQL: Hash: %u, lastSent: %u, display: %u", currentHash, lastSentLedHash, currentDisplayHash);
+    Logger.debugln("GraphQL: Hash: %u, lastSent: %u, display: %u", currentHash, lastSentLedHash, currentDisplayHash);
 
     // Skip if same as last sent
     if (currentHash == lastSentLedHash && lastSentLedHash != 0) {
-        Logger.logln("GraphQL: Skipping duplicate LED data (same as last sent)");
+        Logger.debugln("GraphQL: Skipping duplicate LED data (same as last sent)");
         return;
     }
 
     // Skip if matches what's currently displayed on the board (from backend)
     if (currentHash == currentDisplayHash && currentDisplayHash != 0) {
-        Logger.logln("GraphQL: Skipping LED data (matches display hash: %u)", currentDisplayHash);
+        Logger.debugln("GraphQL: Skipping LED data (matches display hash: %u)", currentDisplayHash);
         return;
     }
 
     // Update last sent hash
     lastSentLedHash = currentHash;
-    Logger.logln("GraphQL: Proceeding to send (updated hash)");
+    Logger.debugln("GraphQL: Proceeding to send (updated hash)");
 
     JsonDocument doc;
     doc["id"] = generateSubscriptionId();
@@ -558,7 +677,7 @@ void GraphQLWSClient::sendLedPositions(const LedCommand* commands, int count, in
     Logger.logln("GraphQL: Sending %d LED positions (roles: %d start, %d hand, %d finish, %d foot)", count, starts,
                  hands, finishes, foots);
 
-    ws.sendTXT(message);
+    sendText(message);
 }
 
 void GraphQLWSClient::setState(GraphQLConnectionState newState) {
@@ -570,13 +689,18 @@ void GraphQLWSClient::setState(GraphQLConnectionState newState) {
     }
 }
 
+void GraphQLWSClient::sendText(String& message) {
+    Coex.noteActivity(CoexActivity::WIFI_TRANSFER);
+    ws.sendTXT(message);
+}
+
 void GraphQLWSClient::sendPing() {
     JsonDocument doc;
     doc["type"] = "ping";
 
     String message;
     serializeJson(doc, message);
-    ws.sendTXT(message);
+    sendText(message);
 }
 
 String GraphQLWSClient::generateSubscriptionId() {
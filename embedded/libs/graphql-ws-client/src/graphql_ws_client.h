@@ -19,6 +19,13 @@ class NordicUartBLE;
 #define WS_PONG_TIMEOUT 10000
 #define WS_RECONNECT_INTERVAL 5000
 
+// A connect attempt is treated as a coex handshake until the socket reports
+// connected/disconnected or this long has passed (failed attempts are silent)
+#define WS_HANDSHAKE_HOLD_MS 3000
+
+// An operation with no result after this long is failed
+#define GQL_OPERATION_TIMEOUT_MS 10000
+
 enum class GraphQLConnectionState { DISCONNECTED, CONNECTING, CONNECTED, CONNECTION_INIT, CONNECTION_ACK, SUBSCRIBED };
 
 // Forward declaration for queue sync data
@@ -40,6 +47,9 @@ typedef void (*GraphQLMessageCallback)(JsonDocument& doc);
 typedef void (*GraphQLStateCallback)(GraphQLConnectionState state);
 typedef void (*GraphQLQueueSyncCallback)(const ControllerQueueSyncData& data);
 typedef void (*GraphQLLedUpdateCallback)(const LedCommand* commands, int count);
+typedef void (*GraphQLActivityCallback)();
+// data is null if the operation failed, timed out or the connection dropped
+typedef void (*GraphQLOperationCallback)(const char* operationId, JsonObject data);
 
 class GraphQLWSClient {
   public:
@@ -64,6 +74,18 @@ class GraphQLWSClient {
     // Send a named GraphQL mutation (for tracking completion)
     void sendMutation(const char* mutationId, const char* mutation, const char* variables = nullptr);
 
+    /**
+     * Send a query or mutation and deliver its result to a callback. Runs
+     * alongside sendMutation() without touching its in-flight flag; one
+     * operation at a time.
+     * @return false if not connected or an operation is already pending
+     */
+    bool sendOperation(const char* operationId, const char* query, const char* variables,
+                       GraphQLOperationCallback callback);
+
+    // Check if an operation from sendOperation() is awaiting its result
+    bool isOperationPending() { return pendingOperationId.length() > 0; }
+
     // Send LED positions from Bluetooth to backend (to match climb)
     void sendLedPositions(const LedCommand* commands, int count, int angle);
 
@@ -73,6 +95,11 @@ class GraphQLWSClient {
     void setQueueSyncCallback(GraphQLQueueSyncCallback callback);
     void setLedUpdateCallback(GraphQLLedUpdateCallback callback);
 
+    // Called for every WebSocket event (frame, connect, disconnect). Events
+    // are raised inside loop(), one frame per call, so the owner can run
+    // loop() again at once to drain a burst instead of waiting for a poll.
+    void setActivityCallback(GraphQLActivityCallback callback);
+
     // Handle LED update from backend
     void handleLedUpdate(JsonObject& data);
 
@@ -103,6 +130,7 @@ class GraphQLWSClient {
     GraphQLStateCallback stateCallback;
     GraphQLQueueSyncCallback queueSyncCallback;
     GraphQLLedUpdateCallback ledUpdateCallback;
+    GraphQLActivityCallback activityCallback;
 
     String serverHost;
     uint16_t serverPort;
@@ -117,16 +145,25 @@ class GraphQLWSClient {
     unsigned long lastPingTime;
     unsigned long lastPongTime;
     unsigned long reconnectTime;
+    unsigned long connectAttemptMs;  // Last connect attempt, ours or WebSocketsClient's
+    bool handshakeMarked;
     uint32_t lastSentLedHash;     // Hash of last sent LED positions (to avoid duplicates)
     uint32_t currentDisplayHash;  // Hash of currently displayed LEDs (from backend LedUpdate)
     bool mutationInFlight;        // True if a mutation is pending completion
     unsigned long mutationSentTime;  // When the current mutation was sent (for timeout)
+    String pendingOperationId;                   // Operation awaiting "complete", empty if none
+    GraphQLOperationCallback operationCallback;  // Cleared once the result is delivered
+    unsigned long operationSentTime;
 
     void onWebSocketEvent(WStype_t type, uint8_t* payload, size_t length);
+    void markHandshake(bool active);
     void sendConnectionInit();
+    void finishOperation(JsonObject data);
+    void failOperation();
     void handleMessage(uint8_t* payload, size_t length);
     void setState(GraphQLConnectionState newState);
     void sendPing();
+    void sendText(String& message);
     String generateSubscriptionId();
     uint32_t computeLedHash(const LedCommand* commands, int count);
 };
@@ -1,6 +1,7 @@
 #include "lilygo_display.h"
 
 #include <grade_colors.h>
+#include <qr_raster.h>
 
 #include <qrcode.h>
 
@@ -77,7 +78,7 @@ LGFX_TDisplayS3::LGFX_TDisplayS3() {
 // LilyGoDisplay Implementation
 // ============================================
 
-LilyGoDisplay::LilyGoDisplay() {}
+LilyGoDisplay::LilyGoDisplay() : _renderer(*this) {}
 
 LilyGoDisplay::~LilyGoDisplay() {}
 
@@ -111,6 +112,9 @@ bool LilyGoDisplay::begin() {
 }
 
 void LilyGoDisplay::showConnecting() {
+    DrawLock draw(*this);
+    discardPendingRender();
+    invalidateLayout();
     _display.fillScreen(COLOR_BACKGROUND);
 
     _display.setFont(&fonts::FreeSansBold9pt7b);
@@ -126,6 +130,9 @@ void LilyGoDisplay::showConnecting() {
 }
 
 void LilyGoDisplay::showError(const char* message, const char* ipAddress) {
+    DrawLock draw(*this);
+    discardPendingRender();
+    invalidateLayout();
     _display.fillScreen(COLOR_BACKGROUND);
 
     _display.setFont(&fonts::FreeSansBold9pt7b);
@@ -148,6 +155,9 @@ void LilyGoDisplay::showError(const char* message, const char* ipAddress) {
 }
 
 void LilyGoDisplay::showConfigPortal(const char* apName, const char* ip) {
+    DrawLock draw(*this);
+    discardPendingRender();
+    invalidateLayout();
     _display.fillScreen(COLOR_BACKGROUND);
 
     _display.setFont(&fonts::FreeSansBold9pt7b);
@@ -180,6 +190,9 @@ void LilyGoDisplay::showConfigPortal(const char* apName, const char* ip) {
 }
 
 void LilyGoDisplay::showSetupScreen(const char* apName) {
+    DrawLock draw(*this);
+    discardPendingRender();
+    invalidateLayout();
     _display.fillScreen(COLOR_BACKGROUND);
 
     // Header
@@ -200,8 +213,10 @@ void LilyGoDisplay::showSetupScreen(const char* apName) {
     // QR Code section - generate WiFi join QR code
     char wifiQr[80];
     snprintf(wifiQr, sizeof(wifiQr), "WIFI:T:nopass;S:%s;;;", apName);
+    // Own buffer: _qrCodeData holds the session code
+    uint8_t wifiQrData[QR_BUFFER_SIZE];
     QRCode qrCode;
-    qrcode_initText(&qrCode, _qrCodeData, QR_VERSION, ECC_LOW, wifiQr);
+    qrcode_initText(&qrCode, wifiQrData, QR_VERSION, ECC_LOW, wifiQr);
 
     // Calculate QR code size and position
     int qrSize = qrCode.size;
@@ -243,81 +258,237 @@ void LilyGoDisplay::showSetupScreen(const char* apName) {
 }
 
 void LilyGoDisplay::onStatusChanged() {
-    drawStatusBar();
+    renderRegions(~(1u << REGION_STATUS_BAR));
 }
 
 void LilyGoDisplay::refresh() {
-    drawStatusBar();
-    drawCurrentClimb();
-    drawQRCode();
-    drawNextClimbIndicator();
-    drawHistory();
-    drawButtonHints();
+    renderRegions();
 }
 
-void LilyGoDisplay::drawStatusBar() {
+// ============================================
+// Region Rendering
+// ============================================
+
+const char* LilyGoDisplay::regionName(uint8_t region) {
+    switch (region) {
+        case REGION_STATUS_BAR:
+            return "statusBar";
+        case REGION_CURRENT_CLIMB:
+            return "currentClimb";
+        case REGION_QR_CODE:
+            return "qrCode";
+        case REGION_NEXT_CLIMB:
+            return "nextClimb";
+        case REGION_HISTORY:
+            return "history";
+        case REGION_BUTTON_HINTS:
+            return "buttonHints";
+        default:
+            return "unknown";
+    }
+}
+
+void LilyGoDisplay::renderRegions(uint32_t skipMask) {
+    // Full-screen modes leave pixels no region owns
+    if (!_layoutValid) {
+        _renderer.clear();
+        _display.fillScreen(COLOR_BACKGROUND);
+        _renderer.setRect(REGION_STATUS_BAR, WidgetRect(0, STATUS_BAR_Y, SCREEN_WIDTH, STATUS_BAR_HEIGHT));
+        _renderer.setRect(REGION_CURRENT_CLIMB, WidgetRect(0, CURRENT_CLIMB_Y, SCREEN_WIDTH, CURRENT_CLIMB_HEIGHT));
+        _renderer.setRect(REGION_QR_CODE, WidgetRect(0, QR_SECTION_Y, SCREEN_WIDTH, QR_SECTION_HEIGHT));
+        _renderer.setRect(REGION_NEXT_CLIMB, WidgetRect(0, NEXT_INDICATOR_Y, SCREEN_WIDTH, NEXT_INDICATOR_HEIGHT));
+        _renderer.setRect(REGION_HISTORY, WidgetRect(0, HISTORY_Y, SCREEN_WIDTH, HISTORY_HEIGHT));
+        _renderer.setRect(REGION_BUTTON_HINTS, WidgetRect(0, BUTTON_HINT_Y, SCREEN_WIDTH, BUTTON_HINT_HEIGHT));
+        _layoutValid = true;
+    }
+
+    // One bus transaction for the frame; ending it waits for the last DMA push
+    _display.startWrite();
+    _renderer.render(skipMask);
+    _display.endWrite();
+}
+
+uint32_t LilyGoDisplay::widgetHash(uint8_t id) {
+    ContentHash hash;
+
+    switch (id) {
+        case REGION_STATUS_BAR:
+            hash.add(_wifiConnected).add(_backendConnected).add(_bleEnabled).add(_bleConnected);
+            hash.add((int32_t)(_hasClimb ? _angle : 0));
+            break;
+
+        case REGION_CURRENT_CLIMB:
+            hash.add(_hasClimb).add(_climbName).add(_grade);
+            break;
+
+        case REGION_QR_CODE:
+            hash.add(_hasClimb).add(_hasQRCode).add(_qrUrl);
+            break;
+
+        case REGION_NEXT_CLIMB:
+            hash.add(_hasNavigation).add(_nextClimb.isValid);
+            hash.add(_nextClimb.name).add(_nextClimb.grade).add(_nextClimb.gradeColor);
+            break;
+
+        case REGION_HISTORY: {
+            int itemsToShow = min((int)_history.size(), HISTORY_MAX_ITEMS);
+            hash.add((int32_t)itemsToShow);
+            for (int i = 0; i < itemsToShow; i++) {
+                const ClimbHistoryEntry& entry = _history[_history.size() - 1 - i];
+                hash.add(entry.name).add(entry.grade);
+            }
+            break;
+        }
+
+        case REGION_BUTTON_HINTS:
+            hash.add(_hasNavigation).add((int32_t)_queueIndex).add((int32_t)_queueTotal);
+            hash.add(_prevClimb.isValid).add(_nextClimb.isValid);
+            break;
+    }
+
+    return hash.value();
+}
+
+void LilyGoDisplay::drawWidget(uint8_t id, const WidgetRect& rect, bool retained) {
+    if (!ensureBands()) {
+        drawRegion(id, _display, 0);
+        return;
+    }
+
+    // Draw band by band: while one band is on its way to the panel the CPU
+    // rasterises the next into the other sprite
+    for (int y = rect.y; y < rect.y + rect.h; y += LILYGO_BAND_LINES) {
+        int lines = min(LILYGO_BAND_LINES, rect.y + rect.h - y);
+        LGFX_Sprite& band = _bands[_nextBand];
+        _nextBand ^= 1;
+
+        drawRegion(id, band, y);
+
+        // The other band's push must finish before this one is queued (and
+        // before that band is drawn into again)
+        _display.waitDMA();
+        _display.pushImageDMA(rect.x, y, rect.w, lines, (const lgfx::swap565_t*)band.getBuffer());
+    }
+}
+
+void LilyGoDisplay::setWidgetClip(const WidgetRect* rect) {
+    if (rect) {
+        _display.setClipRect(rect->x, rect->y, rect->w, rect->h);
+    } else {
+        _display.clearClipRect();
+    }
+}
+
+bool LilyGoDisplay::ensureBands() {
+    if (_bands[0].getBuffer() && _bands[1].getBuffer()) {
+        return true;
+    }
+
+    // Internal SRAM: DMA-capable and fast to rasterise into
+    for (LGFX_Sprite& band : _bands) {
+        band.setPsram(false);
+        band.setColorDepth(16);
+        if (!band.getBuffer() && !band.createSprite(SCREEN_WIDTH, LILYGO_BAND_LINES)) {
+            _bands[0].deleteSprite();
+            _bands[1].deleteSprite();
+            return false;
+        }
+    }
+    return true;
+}
+
+void LilyGoDisplay::drawRegion(uint8_t id, lgfx::LovyanGFX& dst, int originY) {
+    switch (id) {
+        case REGION_STATUS_BAR:
+            drawStatusBar(dst, originY);
+            break;
+        case REGION_CURRENT_CLIMB:
+            drawCurrentClimb(dst, originY);
+            break;
+        case REGION_QR_CODE:
+            drawQRCode(dst, originY);
+            break;
+        case REGION_NEXT_CLIMB:
+            drawNextClimbIndicator(dst, originY);
+            break;
+        case REGION_HISTORY:
+            drawHistory(dst, originY);
+            break;
+        case REGION_BUTTON_HINTS:
+            drawButtonHints(dst, originY);
+            break;
+    }
+}
+
+// ============================================
+// Region Drawing
+// ============================================
+
+void LilyGoDisplay::drawStatusBar(lgfx::LovyanGFX& dst, int originY) {
+    int y = STATUS_BAR_Y - originY;
+
     // Clear status bar area
-    _display.fillRect(0, STATUS_BAR_Y, SCREEN_WIDTH, STATUS_BAR_HEIGHT, COLOR_BACKGROUND);
+    dst.fillRect(0, y, SCREEN_WIDTH, STATUS_BAR_HEIGHT, COLOR_BACKGROUND);
 
     // WiFi indicator
-    _display.setTextSize(1);
-    _display.setFont(&fonts::Font0);
-    _display.setCursor(4, STATUS_BAR_Y + 6);
-    _display.setTextColor(_wifiConnected ? COLOR_STATUS_OK : COLOR_STATUS_ERROR);
-    _display.print("WiFi");
+    dst.setTextSize(1);
+    dst.setFont(&fonts::Font0);
+    dst.setCursor(4, y + 6);
+    dst.setTextColor(_wifiConnected ? COLOR_STATUS_OK : COLOR_STATUS_ERROR);
+    dst.print("WiFi");
 
     // Draw status dot
-    _display.fillCircle(35, STATUS_BAR_Y + 10, 4, _wifiConnected ? COLOR_STATUS_OK : COLOR_STATUS_OFF);
+    dst.fillCircle(35, y + 10, 4, _wifiConnected ? COLOR_STATUS_OK : COLOR_STATUS_OFF);
 
     // Backend indicator
-    _display.setCursor(55, STATUS_BAR_Y + 6);
-    _display.setTextColor(_backendConnected ? COLOR_STATUS_OK : COLOR_STATUS_ERROR);
-    _display.print("WS");
-    _display.fillCircle(75, STATUS_BAR_Y + 10, 4, _backendConnected ? COLOR_STATUS_OK : COLOR_STATUS_OFF);
+    dst.setCursor(55, y + 6);
+    dst.setTextColor(_backendConnected ? COLOR_STATUS_OK : COLOR_STATUS_ERROR);
+    dst.print("WS");
+    dst.fillCircle(75, y + 10, 4, _backendConnected ? COLOR_STATUS_OK : COLOR_STATUS_OFF);
 
     // BLE indicator (if enabled)
     if (_bleEnabled) {
-        _display.setCursor(95, STATUS_BAR_Y + 6);
-        _display.setTextColor(_bleConnected ? COLOR_STATUS_OK : COLOR_TEXT_DIM);
-        _display.print("BLE");
-        _display.fillCircle(120, STATUS_BAR_Y + 10, 4, _bleConnected ? COLOR_STATUS_OK : COLOR_STATUS_OFF);
+        dst.setCursor(95, y + 6);
+        dst.setTextColor(_bleConnected ? COLOR_STATUS_OK : COLOR_TEXT_DIM);
+        dst.print("BLE");
+        dst.fillCircle(120, y + 10, 4, _bleConnected ? COLOR_STATUS_OK : COLOR_STATUS_OFF);
     }
 
     // Angle display (right side)
     if (_hasClimb && _angle > 0) {
-        _display.setTextColor(COLOR_TEXT);
-        _display.setCursor(SCREEN_WIDTH - 35, STATUS_BAR_Y + 6);
-        _display.printf("%d", _angle);
-        _display.drawCircle(SCREEN_WIDTH - 8, STATUS_BAR_Y + 7, 2, COLOR_TEXT);  // Degree symbol
+        dst.setTextColor(COLOR_TEXT);
+        dst.setCursor(SCREEN_WIDTH - 35, y + 6);
+        dst.printf("%d", _angle);
+        dst.drawCircle(SCREEN_WIDTH - 8, y + 7, 2, COLOR_TEXT);  // Degree symbol
     }
 }
 
-void LilyGoDisplay::drawCurrentClimb() {
-    int yStart = CURRENT_CLIMB_Y;
+void LilyGoDisplay::drawCurrentClimb(lgfx::LovyanGFX& dst, int originY) {
+    int yStart = CURRENT_CLIMB_Y - originY;
 
     // Clear current climb area
-    _display.fillRect(0, yStart, SCREEN_WIDTH, CURRENT_CLIMB_HEIGHT, COLOR_BACKGROUND);
+    dst.fillRect(0, yStart, SCREEN_WIDTH, CURRENT_CLIMB_HEIGHT, COLOR_BACKGROUND);
 
     if (!_hasClimb) {
         // Show "waiting for climb" message
-        _display.setFont(&fonts::Font2);
-        _display.setTextColor(COLOR_TEXT_DIM);
-        _display.setTextDatum(lgfx::middle_center);
-        _display.drawString("Waiting for climb...", SCREEN_WIDTH / 2, yStart + CURRENT_CLIMB_HEIGHT / 2);
-        _display.setTextDatum(lgfx::top_left);
+        dst.setFont(&fonts::Font2);
+        dst.setTextColor(COLOR_TEXT_DIM);
+        dst.setTextDatum(lgfx::middle_center);
+        dst.drawString("Waiting for climb...", SCREEN_WIDTH / 2, yStart + CURRENT_CLIMB_HEIGHT / 2);
+        dst.setTextDatum(lgfx::top_left);
         return;
     }
 
     // Draw climb name (may need to truncate)
-    _display.setFont(&fonts::FreeSansBold9pt7b);
-    _display.setTextColor(COLOR_TEXT);
-    _display.setTextDatum(lgfx::top_center);
+    dst.setFont(&fonts::FreeSansBold9pt7b);
+    dst.setTextColor(COLOR_TEXT);
+    dst.setTextDatum(lgfx::top_center);
 
     String displayName = _climbName;
     if (displayName.length() > 18) {
         displayName = displayName.substring(0, 15) + "...";
     }
-    _display.drawString(displayName.c_str(), SCREEN_WIDTH / 2, CLIMB_NAME_Y);
+    dst.drawString(displayName.c_str(), SCREEN_WIDTH / 2, CLIMB_NAME_Y - originY);
 
     // Draw grade badge or "Project" for ungraded climbs
     if (_grade.length() > 0) {
@@ -325,20 +496,20 @@ void LilyGoDisplay::drawCurrentClimb() {
         int badgeWidth = 80;
         int badgeHeight = 36;
         int badgeX = (SCREEN_WIDTH - badgeWidth) / 2;
-        int badgeY = GRADE_Y;
+        int badgeY = GRADE_Y - originY;
 
-        // Get grade color - calculate from grade string using same logic as frontend
-        uint16_t gradeColor565 = getGradeColor(_grade.c_str());
+        // Grade ID was resolved when the climb was set
+        uint16_t gradeColor565 = getGradeColorById(_gradeId);
 
         // Draw rounded rectangle badge
-        _display.fillRoundRect(badgeX, badgeY, badgeWidth, badgeHeight, 8, gradeColor565);
+        dst.fillRoundRect(badgeX, badgeY, badgeWidth, badgeHeight, 8, gradeColor565);
 
         // Draw grade text (determine text color based on background brightness)
-        uint16_t textColor = getGradeTextColor(gradeColor565);
+        uint16_t textColor = getGradeTextColorById(_gradeId);
 
-        _display.setFont(&fonts::FreeSansBold12pt7b);
-        _display.setTextColor(textColor);
-        _display.setTextDatum(lgfx::middle_center);
+        dst.setFont(&fonts::FreeSansBold12pt7b);
+        dst.setTextColor(textColor);
+        dst.setTextDatum(lgfx::middle_center);
 
         // Extract just the V-grade for display if combined format
         String displayGrade = _grade;
@@ -347,75 +518,77 @@ void LilyGoDisplay::drawCurrentClimb() {
             displayGrade = displayGrade.substring(slashPos + 1);
         }
 
-        _display.drawString(displayGrade.c_str(), badgeX + badgeWidth / 2, badgeY + badgeHeight / 2);
+        dst.drawString(displayGrade.c_str(), badgeX + badgeWidth / 2, badgeY + badgeHeight / 2);
     } else {
         // No grade - show "Project" in italic
-        _display.setFont(&fonts::FreeSansOblique12pt7b);
-        _display.setTextColor(COLOR_TEXT_DIM);
-        _display.setTextDatum(lgfx::middle_center);
-        _display.drawString("Project", SCREEN_WIDTH / 2, GRADE_Y + 18);
+        dst.setFont(&fonts::FreeSansOblique12pt7b);
+        dst.setTextColor(COLOR_TEXT_DIM);
+        dst.setTextDatum(lgfx::middle_center);
+        dst.drawString("Project", SCREEN_WIDTH / 2, GRADE_Y - originY + 18);
     }
 
-    _display.setTextDatum(lgfx::top_left);
+    dst.setTextDatum(lgfx::top_left);
 }
 
-void LilyGoDisplay::drawQRCode() {
-    int yStart = QR_SECTION_Y;
+void LilyGoDisplay::drawQRCode(lgfx::LovyanGFX& dst, int originY) {
+    int yStart = QR_SECTION_Y - originY;
 
     // Clear QR code area
-    _display.fillRect(0, yStart, SCREEN_WIDTH, QR_SECTION_HEIGHT, COLOR_BACKGROUND);
+    dst.fillRect(0, yStart, SCREEN_WIDTH, QR_SECTION_HEIGHT, COLOR_BACKGROUND);
 
     if (!_hasClimb || !_hasQRCode || _sessionId.length() == 0) {
         return;
     }
 
-    // Generate QR code from stored URL
-    QRCode qrCode;
-    qrcode_initText(&qrCode, _qrCodeData, QR_VERSION, ECC_LOW, _qrUrl.c_str());
-
-    // Calculate scale factor for QR code
-    int qrSize = qrCode.size;
-    int pixelSize = QR_CODE_SIZE / qrSize;
-    if (pixelSize < 1)
-        pixelSize = 1;
-
-    int actualQrSize = pixelSize * qrSize;
-    int qrX = (SCREEN_WIDTH - actualQrSize) / 2;
-    // Center QR code vertically in the section
-    int qrY = yStart + (QR_SECTION_HEIGHT - actualQrSize) / 2;
+    // Sprite includes the 4px white border; centre it in the section
+    if (!updateQrSprite(QR_CODE_SIZE, 4)) {
+        return;
+    }
+    int side = _qrSprite.width();
+    _qrSprite.pushSprite(&dst, (SCREEN_WIDTH - side) / 2, yStart + (QR_SECTION_HEIGHT - side) / 2);
+}
 
-    // Draw white background for QR code
-    _display.fillRect(qrX - 4, qrY - 4, actualQrSize + 8, actualQrSize + 8, COLOR_QR_BG);
+bool LilyGoDisplay::updateQrSprite(int targetPx, int border) {
+    int scale = qrModuleScale(_qrCode.size, targetPx);
+    int side = qrRasterSide(_qrCode.size, scale, border);
+    if (_qrSpriteGeneration == _qrGeneration && _qrSprite.width() == side) {
+        return true;
+    }
 
-    // Draw QR code modules
-    for (uint8_t y = 0; y < qrSize; y++) {
-        for (uint8_t x = 0; x < qrSize; x++) {
-            if (qrcode_getModule(&qrCode, x, y)) {
-                _display.fillRect(qrX + x * pixelSize, qrY + y * pixelSize, pixelSize, pixelSize, COLOR_QR_FG);
-            }
-        }
+    _qrSprite.deleteSprite();
+    _qrSprite.setColorDepth(1);
+    if (!_qrSprite.createSprite(side, side)) {
+        _qrSpriteGeneration = 0;
+        return false;
     }
+    _qrSprite.setPaletteColor(0, (uint16_t)COLOR_QR_BG);
+    _qrSprite.setPaletteColor(1, (uint16_t)COLOR_QR_FG);
+    qrRasterize1bpp(_qrCode.modules, _qrCode.size, scale, border, (uint8_t*)_qrSprite.getBuffer());
+    _qrSpriteGeneration = _qrGeneration;
+    return true;
 }
 
-void LilyGoDisplay::drawNextClimbIndicator() {
+void LilyGoDisplay::drawNextClimbIndicator(lgfx::LovyanGFX& dst, int originY) {
+    int y = NEXT_INDICATOR_Y - originY;
+
     // Clear next indicator area
-    _display.fillRect(0, NEXT_INDICATOR_Y, SCREEN_WIDTH, NEXT_INDICATOR_HEIGHT, COLOR_BACKGROUND);
+    dst.fillRect(0, y, SCREEN_WIDTH, NEXT_INDICATOR_HEIGHT, COLOR_BACKGROUND);
 
     // Only draw if we have navigation and a next climb
     if (!_hasNavigation || !_nextClimb.isValid) {
         return;
     }
 
-    _display.setFont(&fonts::Font0);
-    _display.setTextDatum(lgfx::middle_left);
+    dst.setFont(&fonts::Font0);
+    dst.setTextDatum(lgfx::middle_left);
 
     // Draw right arrow
-    _display.setTextColor(COLOR_ACCENT);
-    _display.drawString(">", 4, NEXT_INDICATOR_Y + NEXT_INDICATOR_HEIGHT / 2);
+    dst.setTextColor(COLOR_ACCENT);
+    dst.drawString(">", 4, y + NEXT_INDICATOR_HEIGHT / 2);
 
     // Draw "Next:" label
-    _display.setTextColor(COLOR_TEXT_DIM);
-    _display.drawString("Next:", 14, NEXT_INDICATOR_Y + NEXT_INDICATOR_HEIGHT / 2);
+    dst.setTextColor(COLOR_TEXT_DIM);
+    dst.drawString("Next:", 14, y + NEXT_INDICATOR_HEIGHT / 2);
 
     // Truncate name if needed
     String name = _nextClimb.name;
@@ -424,8 +597,8 @@ void LilyGoDisplay::drawNextClimbIndicator() {
     }
 
     // Draw climb name
-    _display.setTextColor(COLOR_TEXT);
-    _display.drawString(name.c_str(), 50, NEXT_INDICATOR_Y + NEXT_INDICATOR_HEIGHT / 2);
+    dst.setTextColor(COLOR_TEXT);
+    dst.drawString(name.c_str(), 50, y + NEXT_INDICATOR_HEIGHT / 2);
 
     // Draw grade with color
     uint16_t gradeColor = COLOR_TEXT;
@@ -442,28 +615,28 @@ void LilyGoDisplay::drawNextClimbIndicator() {
         grade = grade.substring(slashPos + 1);
     }
 
-    _display.setTextDatum(lgfx::middle_right);
-    _display.setTextColor(gradeColor);
-    _display.drawString(grade.c_str(), SCREEN_WIDTH - 4, NEXT_INDICATOR_Y + NEXT_INDICATOR_HEIGHT / 2);
+    dst.setTextDatum(lgfx::middle_right);
+    dst.setTextColor(gradeColor);
+    dst.drawString(grade.c_str(), SCREEN_WIDTH - 4, y + NEXT_INDICATOR_HEIGHT / 2);
 
-    _display.setTextDatum(lgfx::top_left);
+    dst.setTextDatum(lgfx::top_left);
 }
 
-void LilyGoDisplay::drawHistory() {
-    int yStart = HISTORY_Y;
+void LilyGoDisplay::drawHistory(lgfx::LovyanGFX& dst, int originY) {
+    int yStart = HISTORY_Y - originY;
 
     // Clear history area
-    _display.fillRect(0, yStart, SCREEN_WIDTH, HISTORY_HEIGHT, COLOR_BACKGROUND);
+    dst.fillRect(0, yStart, SCREEN_WIDTH, HISTORY_HEIGHT, COLOR_BACKGROUND);
 
     if (_history.empty()) {
         return;
     }
 
     // Draw "Previous:" label
-    _display.setFont(&fonts::Font0);
-    _display.setTextColor(COLOR_TEXT_DIM);
-    _display.setCursor(4, yStart);
-    _display.print("Previous:");
+    dst.setFont(&fonts::Font0);
+    dst.setTextColor(COLOR_TEXT_DIM);
+    dst.setCursor(4, yStart);
+    dst.print("Previous:");
 
     // Draw history items
     int y = yStart + 12;
@@ -477,7 +650,7 @@ void LilyGoDisplay::drawHistory() {
         if (entry.grade.length() > 0) {
             bulletColor = getGradeColor(entry.grade.c_str());
         }
-        _display.fillCircle(8, y + 6, 3, bulletColor);
+        dst.fillCircle(8, y + 6, 3, bulletColor);
 
         // Draw climb name (truncated)
         String name = entry.name;
@@ -485,59 +658,61 @@ void LilyGoDisplay::drawHistory() {
             name = name.substring(0, 10) + "..";
         }
 
-        _display.setTextColor(COLOR_TEXT);
-        _display.setCursor(16, y + 2);
-        _display.print(name.c_str());
+        dst.setTextColor(COLOR_TEXT);
+        dst.setCursor(16, y + 2);
+        dst.print(name.c_str());
 
         // Draw grade
-        _display.setTextColor(bulletColor);
-        _display.setCursor(SCREEN_WIDTH - 35, y + 2);
+        dst.setTextColor(bulletColor);
+        dst.setCursor(SCREEN_WIDTH - 35, y + 2);
 
         String grade = entry.grade;
         int slashPos = grade.indexOf('/');
         if (slashPos > 0) {
             grade = grade.substring(slashPos + 1);
         }
-        _display.print(grade.c_str());
+        dst.print(grade.c_str());
 
         y += HISTORY_ITEM_HEIGHT;
     }
 }
 
-void LilyGoDisplay::drawButtonHints() {
+void LilyGoDisplay::drawButtonHints(lgfx::LovyanGFX& dst, int originY) {
+    int y = BUTTON_HINT_Y - originY;
+
     // Clear button hint area
-    _display.fillRect(0, BUTTON_HINT_Y, SCREEN_WIDTH, BUTTON_HINT_HEIGHT, COLOR_BACKGROUND);
+    dst.fillRect(0, y, SCREEN_WIDTH, BUTTON_HINT_HEIGHT, COLOR_BACKGROUND);
 
     // Only show hints if we have navigation
     if (!_hasNavigation || _queueTotal <= 1) {
         return;
     }
 
-    _display.setFont(&fonts::Font0);
-    _display.setTextDatum(lgfx::middle_center);
+    dst.setFont(&fonts::Font0);
+    dst.setTextDatum(lgfx::middle_center);
 
     // Draw hint bar background
-    _display.fillRect(0, BUTTON_HINT_Y, SCREEN_WIDTH, BUTTON_HINT_HEIGHT, 0x2104);  // Very dark gray
+    dst.fillRect(0, y, SCREEN_WIDTH, BUTTON_HINT_HEIGHT, 0x2104);  // Very dark gray
 
     // Show position indicator in center
-    _display.setTextColor(COLOR_TEXT_DIM);
+    dst.setTextColor(COLOR_TEXT_DIM);
     char posStr[16];
     snprintf(posStr, sizeof(posStr), "%d/%d", _queueIndex + 1, _queueTotal);
-    _display.drawString(posStr, SCREEN_WIDTH / 2, BUTTON_HINT_Y + BUTTON_HINT_HEIGHT / 2);
+    dst.drawString(posStr, SCREEN_WIDTH / 2, y + BUTTON_HINT_HEIGHT / 2);
 
     // Draw left button hint (if there's a previous climb)
     if (_prevClimb.isValid) {
-        _display.setTextColor(COLOR_ACCENT);
-        _display.setTextDatum(lgfx::middle_left);
-        _display.drawString("<Prev", 4, BUTTON_HINT_Y + BUTTON_HINT_HEIGHT / 2);
+        dst.setTextColor(COLOR_ACCENT);
+        dst.setTextDatum(lgfx::middle_left);
+        dst.drawString("<Prev", 4, y + BUTTON_HINT_HEIGHT / 2);
     }
 
     // Draw right button hint (if there's a next climb)
     if (_nextClimb.isValid) {
-        _display.setTextColor(COLOR_ACCENT);
-        _display.setTextDatum(lgfx::middle_right);
-        _display.drawString("Next>", SCREEN_WIDTH - 4, BUTTON_HINT_Y + BUTTON_HINT_HEIGHT / 2);
+        dst.setTextColor(COLOR_ACCENT);
+        dst.setTextDatum(lgfx::middle_right);
+        dst.drawString("Next>", SCREEN_WIDTH - 4, y + BUTTON_HINT_HEIGHT / 2);
     }
 
-    _display.setTextDatum(lgfx::top_left);
+    dst.setTextDatum(lgfx::top_left);
 }
@@ -5,6 +5,7 @@
 
 #include <LovyanGFX.hpp>
 #include <display_base.h>
+#include <widget_renderer.h>
 
 // ============================================
 // LilyGo T-Display S3 Pin Configuration
@@ -82,6 +83,10 @@
 #define BUTTON_HINT_Y 309
 #define BUTTON_HINT_HEIGHT 11
 
+// Regions are rasterised into two internal-SRAM band sprites (170 x 40,
+// ~13 KB each) that alternate: one is pushed by DMA while the next is drawn
+#define LILYGO_BAND_LINES 40
+
 // ============================================
 // LilyGo T-Display S3 Display Class
 // ============================================
@@ -99,8 +104,19 @@ class LGFX_TDisplayS3 : public lgfx::LGFX_Device {
 // LilyGo Display Manager
 // ============================================
 
-class LilyGoDisplay : public DisplayBase {
+class LilyGoDisplay : public DisplayBase, public WidgetHost {
   public:
+    // Screen regions, each redrawn only when its content changes
+    enum Region : uint8_t {
+        REGION_STATUS_BAR = 0,
+        REGION_CURRENT_CLIMB,
+        REGION_QR_CODE,
+        REGION_NEXT_CLIMB,
+        REGION_HISTORY,
+        REGION_BUTTON_HINTS,
+        REGION_COUNT
+    };
+
     LilyGoDisplay();
     ~LilyGoDisplay();
 
@@ -119,19 +135,50 @@ class LilyGoDisplay : public DisplayBase {
     static const int SCREEN_WIDTH = LILYGO_SCREEN_WIDTH;
     static const int SCREEN_HEIGHT = LILYGO_SCREEN_HEIGHT;
 
+    // Per-region draw time (rasterise plus DMA push) and per-refresh totals
+    static const char* regionName(uint8_t region);
+    const WidgetTiming& getRegionTiming(uint8_t region) const { return _renderer.getTiming(region); }
+    const WidgetRenderStats& getLastRenderStats() const { return _renderer.getLastStats(); }
+    const WidgetRenderTotals& getRenderTotals() const { return _renderer.getTotals(); }
+    void resetRenderTotals() { _renderer.resetTotals(); }
+
+    // False when the band sprites could not be allocated (regions draw straight to the panel)
+    bool isBandRendering() const { return _bands[0].getBuffer() != nullptr; }
+
   protected:
     void onStatusChanged() override;
 
+    // WidgetHost overrides
+    uint32_t widgetHash(uint8_t id) override;
+    void drawWidget(uint8_t id, const WidgetRect& rect, bool retained) override;
+    void setWidgetClip(const WidgetRect* rect) override;
+
   private:
     LGFX_TDisplayS3 _display;
 
-    // Internal drawing methods
-    void drawStatusBar();
-    void drawCurrentClimb();
-    void drawQRCode();
-    void drawNextClimbIndicator();
-    void drawHistory();
-    void drawButtonHints();
+    WidgetRenderer _renderer;
+    bool _layoutValid = false;
+    void renderRegions(uint32_t skipMask = 0);
+    void invalidateLayout() { _layoutValid = false; }
+
+    // DMA band sprites, used alternately
+    LGFX_Sprite _bands[2];
+    int _nextBand = 0;
+    bool ensureBands();
+    void drawRegion(uint8_t id, lgfx::LovyanGFX& dst, int originY);
+
+    // Session QR code pre-rendered at 1 bpp; rebuilt when the session changes
+    LGFX_Sprite _qrSprite;
+    uint32_t _qrSpriteGeneration = 0;
+    bool updateQrSprite(int targetPx, int border);
+
+    // Region drawing: dst row 0 is screen row originY (0 for the panel itself)
+    void drawStatusBar(lgfx::LovyanGFX& dst, int originY);
+    void drawCurrentClimb(lgfx::LovyanGFX& dst, int originY);
+    void drawQRCode(lgfx::LovyanGFX& dst, int originY);
+    void drawNextClimbIndicator(lgfx::LovyanGFX& dst, int originY);
+    void drawHistory(lgfx::LovyanGFX& dst, int originY);
+    void drawButtonHints(lgfx::LovyanGFX& dst, int originY);
 };
 
 extern LilyGoDisplay Display;
@@ -1,74 +1,445 @@
 #include "log_buffer.h"
 
-#include <stdarg.h>
+#include <stdlib.h>
+
+#if defined(ESP_PLATFORM) && !defined(UNIT_TEST)
+#include <freertos/FreeRTOS.h>
+#endif
+
+#define RING_MASK (LOG_RING_SIZE - 1)
+
+static_assert((LOG_RING_SIZE & RING_MASK) == 0, "LOG_RING_SIZE must be a power of two");
+static_assert(LOG_MAX_RECORD <= LOG_RING_SIZE, "LOG_MAX_RECORD must fit in the ring");
+
+// Record flags
+#define RECORD_NEWLINE 0x01
+
+// Longest single conversion spec kept when formatting ("%-08.3lld")
+#define MAX_SPEC 16
 
 LogBuffer Logger;
 
-LogBuffer::LogBuffer() : writePos(0), serialEnabled(true) {
-    memset(buffer, 0, LOG_BUFFER_SIZE);
+// =============================================================================
+// Argument capture
+// =============================================================================
+
+void LogArgs::put(LogArgType type, const void* value, size_t size) {
+    if (length + 1 + size > CAPACITY) {
+        return;
+    }
+    data[length++] = (uint8_t)type;
+    memcpy(data + length, value, size);
+    length += size;
+    count++;
 }
 
-void LogBuffer::log(const char* format, ...) {
-    char temp[256];
-    va_list args;
-    va_start(args, format);
-    vsnprintf(temp, sizeof(temp), format, args);
-    va_end(args);
+void LogArgs::addString(const char* value) {
+    if (!value) {
+        value = "(null)";
+    }
+    if (length + 2 > CAPACITY) {
+        return;
+    }
+    size_t len = strlen(value);
+    size_t room = CAPACITY - length - 2;
+    if (len > room) {
+        len = room;
+    }
+    if (len > 255) {
+        len = 255;
+    }
+    data[length++] = (uint8_t)LogArgType::STRING;
+    data[length++] = (uint8_t)len;
+    memcpy(data + length, value, len);
+    length += len;
+    count++;
+}
 
-    appendToBuffer(temp);
+/**
+ * Reads captured arguments back in order.
+ */
+class LogArgReader {
+  public:
+    LogArgReader(const uint8_t* data, size_t length) : data(data), length(length), pos(0) {}
 
-    if (serialEnabled) {
-        Serial.print(temp);
+    bool next(LogArgType& type, uint64_t& bits, const char*& str, size_t& strLen) {
+        if (pos >= length) {
+            return false;
+        }
+        type = (LogArgType)data[pos++];
+        if (type == LogArgType::STRING) {
+            if (pos >= length || pos + 1 + data[pos] > length) {
+                return false;
+            }
+            strLen = data[pos++];
+            str = (const char*)data + pos;
+            pos += strLen;
+            return true;
+        }
+        size_t size = type == LogArgType::INT32 || type == LogArgType::UINT32 ? 4 : 8;
+        if (pos + size > length) {
+            return false;
+        }
+        bits = 0;
+        if (size == 4) {
+            uint32_t v;
+            memcpy(&v, data + pos, 4);
+            bits = type == LogArgType::INT32 ? (uint64_t)(int64_t)(int32_t)v : v;
+        } else {
+            memcpy(&bits, data + pos, 8);
+        }
+        pos += size;
+        return true;
+    }
+
+  private:
+    const uint8_t* data;
+    size_t length;
+    size_t pos;
+};
+
+/**
+ * printf over captured arguments. Each conversion is handed to snprintf
+ * with the length modifier replaced to match the captured width, so "%lu"
+ * of a 32-bit value and "%d" of a 64-bit one both print correctly. A
+ * conversion whose argument is missing or of the wrong kind prints "?".
+ */
+static size_t formatArgs(char* out, size_t capacity, const char* format, const uint8_t* args, size_t argsLength) {
+    LogArgReader reader(args, argsLength);
+    size_t pos = 0;
+    const char* p = format;
+
+    while (*p && pos + 1 < capacity) {
+        if (*p != '%') {
+            out[pos++] = *p++;
+            continue;
+        }
+        if (p[1] == '%') {
+            out[pos++] = '%';
+            p += 2;
+            continue;
+        }
+
+        // Flags, width and precision are kept; length modifiers are replaced
+        char spec[MAX_SPEC + 4];
+        size_t s = 0;
+        spec[s++] = *p++;
+        while (*p && strchr("-+ #0123456789.", *p) && s < MAX_SPEC) {
+            spec[s++] = *p++;
+        }
+        while (*p && strchr("hlLqjzt", *p)) {
+            p++;
+        }
+        char conversion = *p;
+        if (!conversion) {
+            break;
+        }
+        p++;
+
+        LogArgType type;
+        uint64_t bits = 0;
+        const char* str = nullptr;
+        size_t strLen = 0;
+        bool have = reader.next(type, bits, str, strLen);
+        bool isInteger = have && type != LogArgType::DOUBLE && type != LogArgType::STRING;
+        bool wide = have && (type == LogArgType::INT64 || type == LogArgType::UINT64 || type == LogArgType::POINTER);
+
+        int written = -1;
+        size_t room = capacity - pos;
+        switch (conversion) {
+            case 'd':
+            case 'i':
+            case 'u':
+            case 'o':
+            case 'x':
+            case 'X':
+                if (isInteger) {
+                    if (wide) {
+                        spec[s++] = 'l';
+                        spec[s++] = 'l';
+                    }
+                    spec[s++] = conversion;
+                    spec[s] = '\0';
+                    if (conversion == 'd' || conversion == 'i') {
+                        written = wide ? snprintf(out + pos, room, spec, (long long)bits)
+                                       : snprintf(out + pos, room, spec, (int)(int32_t)bits);
+                    } else {
+                        written = wide ? snprintf(out + pos, room, spec, (unsigned long long)bits)
+                                       : snprintf(out + pos, room, spec, (unsigned)bits);
+                    }
+                }
+                break;
+            case 'c':
+                if (isInteger) {
+                    spec[s++] = 'c';
+                    spec[s] = '\0';
+                    written = snprintf(out + pos, room, spec, (int)bits);
+                }
+                break;
+            case 'f':
+            case 'F':
+            case 'e':
+            case 'E':
+            case 'g':
+            case 'G':
+            case 'a':
+            case 'A':
+                if (have && (type == LogArgType::DOUBLE || isInteger)) {
+                    double value;
+                    if (type == LogArgType::DOUBLE) {
+                        memcpy(&value, &bits, sizeof(value));
+                    } else {
+                        value = type == LogArgType::INT32 || type == LogArgType::INT64 ? (double)(int64_t)bits
+                                                                                       : (double)bits;
+                    }
+                    spec[s++] = conversion;
+                    spec[s] = '\0';
+                    written = snprintf(out + pos, room, spec, value);
+                }
+                break;
+            case 's':
+                if (have && type == LogArgType::STRING) {
+                    char copy[256];
+                    memcpy(copy, str, strLen);
+                    copy[strLen] = '\0';
+                    spec[s++] = 's';
+                    spec[s] = '\0';
+                    written = snprintf(out + pos, room, spec, copy);
+                }
+                break;
+            case 'p':
+                if (isInteger) {
+                    written = snprintf(out + pos, room, "0x%llx", (unsigned long long)bits);
+                }
+                break;
+            default:
+                break;
+        }
+
+        if (written < 0) {
+            out[pos++] = '?';
+        } else {
+            pos += (size_t)written < room ? (size_t)written : room - 1;
+        }
+    }
+
+    out[pos] = '\0';
+    return pos;
+}
+
+// =============================================================================
+// LogBuffer
+// =============================================================================
+
+LogBuffer::LogBuffer()
+    : reserveHead(0), tail(0), dropped(0), totalDropped(0), textStart(0), textLength(0), serialEnabled(true),
+      synchronous(false), sink(nullptr) {
+    draining.clear();
+    memset(ring, 0, sizeof(ring));
+    memset(text, 0, sizeof(text));
+}
+
+void LogBuffer::commit(LogLevel level, bool newline, const char* format, const LogArgs& args) {
+    uint32_t length = (LogArgs::HEADER_SIZE + args.length + 3) & ~3u;
+
+    // Reserve space; never wait for the drain
+    uint32_t head = reserveHead.load(std::memory_order_relaxed);
+    do {
+        if (head + length - tail.load(std::memory_order_acquire) > LOG_RING_SIZE) {
+            dropped.fetch_add(1, std::memory_order_relaxed);
+            totalDropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+    } while (!reserveHead.compare_exchange_weak(head, head + length, std::memory_order_acq_rel,
+                                                std::memory_order_relaxed));
+
+    uint32_t timestamp = millis();
+    uint8_t meta[4] = {(uint8_t)level, (uint8_t)(newline ? RECORD_NEWLINE : 0), args.count, 0};
+    copyIn(head + 4, &timestamp, 4);
+    copyIn(head + 8, meta, 4);
+    copyIn(head + 12, &format, sizeof(format));
+    copyIn(head + LogArgs::HEADER_SIZE, args.data, args.length);
+
+    // Publish: the length word stays 0 until the record is complete
+    __atomic_store_n((uint32_t*)(ring + (head & RING_MASK)), length, __ATOMIC_RELEASE);
+
+    if (synchronous.load(std::memory_order_relaxed)) {
+#if defined(ESP_PLATFORM) && !defined(UNIT_TEST)
+        if (xPortInIsrContext()) {
+            return;
+        }
+#endif
+        drain(LOG_RING_SIZE);
     }
 }
 
-void LogBuffer::logln(const char* format, ...) {
-    char temp[256];
-    va_list args;
-    va_start(args, format);
-    vsnprintf(temp, sizeof(temp), format, args);
-    va_end(args);
+void LogBuffer::copyIn(uint32_t pos, const void* data, size_t len) {
+    size_t offset = pos & RING_MASK;
+    size_t first = len < LOG_RING_SIZE - offset ? len : LOG_RING_SIZE - offset;
+    memcpy(ring + offset, data, first);
+    memcpy(ring, (const uint8_t*)data + first, len - first);
+}
+
+void LogBuffer::copyOut(uint32_t pos, void* data, size_t len) const {
+    size_t offset = pos & RING_MASK;
+    size_t first = len < LOG_RING_SIZE - offset ? len : LOG_RING_SIZE - offset;
+    memcpy(data, ring + offset, first);
+    memcpy((uint8_t*)data + first, ring, len - first);
+}
+
+void LogBuffer::zero(uint32_t pos, size_t len) {
+    size_t offset = pos & RING_MASK;
+    size_t first = len < LOG_RING_SIZE - offset ? len : LOG_RING_SIZE - offset;
+    memset(ring + offset, 0, first);
+    memset(ring, 0, len - first);
+}
+
+int LogBuffer::drain(int maxRecords) {
+    if (draining.test_and_set(std::memory_order_acquire)) {
+        return 0;
+    }
+
+    int formatted = 0;
+    uint32_t position = tail.load(std::memory_order_relaxed);
+    while (formatted < maxRecords) {
+        uint32_t length = __atomic_load_n((uint32_t*)(ring + (position & RING_MASK)), __ATOMIC_ACQUIRE);
+        if (length == 0 || length > LOG_MAX_RECORD || (length & 3) != 0) {
+            // Nothing published yet (a producer may still be writing this one)
+            break;
+        }
+
+        uint8_t record[LOG_MAX_RECORD];
+        copyOut(position + 4, record, length - 4);
+
+        // Cleared bytes read as unpublished when the space is reused
+        zero(position, length);
+        position += length;
+        tail.store(position, std::memory_order_release);
 
-    appendToBuffer(temp);
-    appendToBuffer("\n");
+        emit(record, length - 4);
+        formatted++;
+    }
+
+    uint32_t lost = dropped.exchange(0, std::memory_order_relaxed);
+    if (lost > 0) {
+        char notice[48];
+        snprintf(notice, sizeof(notice), "[%u log messages dropped]", (unsigned)lost);
+        emitText(millis(), notice, LogLevel::WARN, true);
+    }
+
+    draining.clear(std::memory_order_release);
+    return formatted;
+}
+
+void LogBuffer::emit(const uint8_t* record, size_t len) {
+    const char* format;
+    memcpy(&format, record + 8, sizeof(format));
+    uint32_t timestampMs;
+    memcpy(&timestampMs, record, sizeof(timestampMs));
+    LogLevel level = (LogLevel)record[4];
+    bool newline = record[5] & RECORD_NEWLINE;
+
+    size_t argsOffset = LogArgs::HEADER_SIZE - 4;
+    char message[LOG_MAX_MESSAGE];
+    formatArgs(message, sizeof(message), format, record + argsOffset, len - argsOffset);
+    emitText(timestampMs, message, level, newline);
+}
+
+void LogBuffer::emitText(uint32_t timestampMs, const char* message, LogLevel level, bool newline) {
+    static const char* const PREFIXES[] = {"[D] ", "", "[W] ", "[E] "};
+    const char* prefix = PREFIXES[(int)level & 3];
+
+    appendText(prefix, strlen(prefix));
+    appendText(message, strlen(message));
+    if (newline) {
+        appendText("\n", 1);
+    }
 
     if (serialEnabled) {
-        Serial.println(temp);
+        if (prefix[0]) {
+            Serial.print(prefix);
+        }
+        if (newline) {
+            Serial.println(message);
+        } else {
+            Serial.print(message);
+        }
+    }
+
+    if (sink) {
+        sink(timestampMs, level, message);
+    }
+}
+
+void LogBuffer::appendText(const char* str, size_t len) {
+    // One byte short of full, as the text is also returned as a C string
+    const size_t capacity = LOG_BUFFER_SIZE - 1;
+    if (len > capacity) {
+        str += len - capacity;
+        len = capacity;
+    }
+
+    // Overwrite the oldest text
+    if (textLength + len > capacity) {
+        size_t overflow = textLength + len - capacity;
+        textStart = (textStart + overflow) % LOG_BUFFER_SIZE;
+        textLength -= overflow;
     }
+
+    size_t end = (textStart + textLength) % LOG_BUFFER_SIZE;
+    size_t first = len < LOG_BUFFER_SIZE - end ? len : LOG_BUFFER_SIZE - end;
+    memcpy(text + end, str, first);
+    memcpy(text, str + first, len - first);
+    textLength += len;
 }
 
 void LogBuffer::clear() {
-    memset(buffer, 0, LOG_BUFFER_SIZE);
-    writePos = 0;
+    // Pending records still reach Serial
+    while (drain() > 0) {
+    }
+    textStart = 0;
+    textLength = 0;
 }
 
 String LogBuffer::getBuffer() {
-    return String(buffer);
+    while (drain() > 0) {
+    }
+
+    char* copy = (char*)malloc(textLength + 1);
+    if (!copy) {
+        return String();
+    }
+    size_t first = textLength < LOG_BUFFER_SIZE - textStart ? textLength : LOG_BUFFER_SIZE - textStart;
+    memcpy(copy, text + textStart, first);
+    memcpy(copy + first, text, textLength - first);
+    copy[textLength] = '\0';
+
+    String result(copy);
+    free(copy);
+    return result;
 }
 
 size_t LogBuffer::getSize() {
-    return writePos;
+    while (drain() > 0) {
+    }
+    return textLength;
 }
 
 void LogBuffer::enableSerial(bool enable) {
     serialEnabled = enable;
 }
 
-void LogBuffer::appendToBuffer(const char* str) {
-    size_t len = strlen(str);
-
-    if (writePos + len >= LOG_BUFFER_SIZE - 1) {
-        // Ring buffer wrap - shift content
-        size_t shift = (writePos + len) - (LOG_BUFFER_SIZE - 1) + LOG_BUFFER_SIZE / 4;
-        if (shift < writePos) {
-            memmove(buffer, buffer + shift, writePos - shift);
-            writePos -= shift;
-        } else {
-            writePos = 0;
-        }
+void LogBuffer::setSynchronous(bool enable) {
+    synchronous.store(enable, std::memory_order_relaxed);
+    if (enable) {
+        drain(LOG_RING_SIZE);
     }
+}
+
+void LogBuffer::setSink(LogSink logSink) {
+    sink = logSink;
+}
 
-    memcpy(buffer + writePos, str, len);
-    writePos += len;
-    buffer[writePos] = '\0';
+size_t LogBuffer::getPendingBytes() const {
+    return reserveHead.load(std::memory_order_relaxed) - tail.load(std::memory_order_relaxed);
 }
@@ -3,27 +3,245 @@
 
 #include <Arduino.h>
 
+#include <atomic>
+#include <type_traits>
+
+// Formatted text kept for retrieval (getBuffer())
 #define LOG_BUFFER_SIZE 2048
 
+// Records waiting to be formatted; a power of two
+#ifndef LOG_RING_SIZE
+#define LOG_RING_SIZE 4096
+#endif
+
+// Largest record: header, format pointer and captured arguments. String
+// arguments are truncated to fit.
+#define LOG_MAX_RECORD 256
+
+// Formatted messages are truncated to this length (including terminator)
+#define LOG_MAX_MESSAGE 256
+
+// Compile-time level filter: calls below LOG_LEVEL compile to nothing
+#define LOG_LEVEL_DEBUG 0
+#define LOG_LEVEL_INFO 1
+#define LOG_LEVEL_WARN 2
+#define LOG_LEVEL_ERROR 3
+#define LOG_LEVEL_NONE 4
+
+#ifndef LOG_LEVEL
+#define LOG_LEVEL LOG_LEVEL_INFO
+#endif
+
+enum class LogLevel : uint8_t {
+    DEBUG = LOG_LEVEL_DEBUG,
+    INFO = LOG_LEVEL_INFO,
+    WARN = LOG_LEVEL_WARN,
+    ERROR = LOG_LEVEL_ERROR,
+};
+
+// Type tag stored before each captured argument
+enum class LogArgType : uint8_t { INT32, UINT32, INT64, UINT64, DOUBLE, POINTER, STRING };
+
+/**
+ * printf arguments captured by value, so formatting can wait for drain().
+ * Strings are copied, since the caller's buffer may be gone by then.
+ */
+class LogArgs {
+  public:
+    // Record header: length word, timestamp, level/flags/count, format pointer
+    static const size_t HEADER_SIZE = 12 + sizeof(const char*);
+    static const size_t CAPACITY = LOG_MAX_RECORD - HEADER_SIZE;
+
+    LogArgs() : length(0), count(0) {}
+
+    template <typename T>
+    typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value>::type add(T value) {
+        if (sizeof(T) > 4) {
+            int64_t v = value;
+            put(LogArgType::INT64, &v, sizeof(v));
+        } else {
+            int32_t v = value;
+            put(LogArgType::INT32, &v, sizeof(v));
+        }
+    }
+
+    template <typename T>
+    typename std::enable_if<std::is_integral<T>::value && !std::is_signed<T>::value>::type add(T value) {
+        if (sizeof(T) > 4) {
+            uint64_t v = value;
+            put(LogArgType::UINT64, &v, sizeof(v));
+        } else {
+            uint32_t v = value;
+            put(LogArgType::UINT32, &v, sizeof(v));
+        }
+    }
+
+    template <typename T>
+    typename std::enable_if<std::is_enum<T>::value>::type add(T value) {
+        add((int32_t)value);
+    }
+
+    template <typename T>
+    typename std::enable_if<std::is_floating_point<T>::value>::type add(T value) {
+        double v = value;
+        put(LogArgType::DOUBLE, &v, sizeof(v));
+    }
+
+    template <typename T>
+    void add(T* value) {
+        uint64_t v = (uintptr_t)value;
+        put(LogArgType::POINTER, &v, sizeof(v));
+    }
+
+    void add(const char* value) { addString(value); }
+    void add(char* value) { addString(value); }
+    void add(const String& value) { addString(value.c_str()); }
+
+    uint8_t data[CAPACITY];
+    size_t length;
+    uint8_t count;
+
+  private:
+    void put(LogArgType type, const void* value, size_t size);
+    void addString(const char* value);
+};
+
+/**
+ * Receives each message as drain() formats it: capture time (millis()),
+ * level and text without prefix or newline. Runs on the draining task.
+ */
+typedef void (*LogSink)(uint32_t timestampMs, LogLevel level, const char* message);
+
+/**
+ * LogBuffer is the firmware's logger.
+ *
+ * A log call only captures its format pointer and arguments into a record
+ * in a lock-free multi-producer ring: it reserves space with a
+ * compare-and-swap and publishes the record with a release store, so the
+ * loop task, NimBLE callbacks and ISRs can log at once without a lock and
+ * without waiting on the UART. If the ring is full the record is dropped
+ * and counted. drain(), called from a low-priority task, formats records
+ * in order into the text buffer returned by getBuffer() and prints them to
+ * Serial.
+ *
+ * The format string is kept by pointer and must be a string literal.
+ *
+ * Calls below LOG_LEVEL (build flag, default LOG_LEVEL_INFO) are removed
+ * at compile time. log()/logln() log at INFO.
+ */
 class LogBuffer {
   public:
     LogBuffer();
 
-    void log(const char* format, ...);
-    void logln(const char* format, ...);
+    template <typename... Args>
+    void log(const char* format, Args... args) {
+        if (LOG_LEVEL <= LOG_LEVEL_INFO) {
+            write(LogLevel::INFO, false, format, args...);
+        }
+    }
+
+    template <typename... Args>
+    void logln(const char* format, Args... args) {
+        if (LOG_LEVEL <= LOG_LEVEL_INFO) {
+            write(LogLevel::INFO, true, format, args...);
+        }
+    }
+
+    template <typename... Args>
+    void debugln(const char* format, Args... args) {
+        if (LOG_LEVEL <= LOG_LEVEL_DEBUG) {
+            write(LogLevel::DEBUG, true, format, args...);
+        }
+    }
+
+    template <typename... Args>
+    void warnln(const char* format, Args... args) {
+        if (LOG_LEVEL <= LOG_LEVEL_WARN) {
+            write(LogLevel::WARN, true, format, args...);
+        }
+    }
 
+    template <typename... Args>
+    void errorln(const char* format, Args... args) {
+        if (LOG_LEVEL <= LOG_LEVEL_ERROR) {
+            write(LogLevel::ERROR, true, format, args...);
+        }
+    }
+
+    /**
+     * Format up to maxRecords pending records. Only one caller drains at a
+     * time; a concurrent call returns 0 at once.
+     * @return Records formatted
+     */
+    int drain(int maxRecords = 32);
+
+    /**
+     * Discard pending records and the text buffer.
+     */
     void clear();
+
+    /**
+     * Text buffer after draining pending records.
+     */
     String getBuffer();
     size_t getSize();
 
     void enableSerial(bool enable);
 
+    /**
+     * Drain each record as soon as it is logged, on the logging task. For
+     * setup(), which runs before the scheduler's log task exists: boot
+     * messages reach Serial even if a later init step hangs. Records logged
+     * from an ISR still wait for the next drain.
+     */
+    void setSynchronous(bool enable);
+
+    /**
+     * Also pass formatted messages to `sink` (nullptr to stop).
+     */
+    void setSink(LogSink sink);
+
+    /**
+     * Records dropped because the ring was full, since boot.
+     */
+    uint32_t getDroppedCount() const { return totalDropped.load(std::memory_order_relaxed); }
+
+    /**
+     * Bytes of records waiting for drain().
+     */
+    size_t getPendingBytes() const;
+
   private:
-    char buffer[LOG_BUFFER_SIZE];
-    size_t writePos;
+    alignas(4) uint8_t ring[LOG_RING_SIZE];
+    std::atomic<uint32_t> reserveHead;  // End of the last reserved record
+    std::atomic<uint32_t> tail;         // Start of the oldest unformatted record
+    std::atomic<uint32_t> dropped;      // Since the last drain
+    std::atomic<uint32_t> totalDropped;
+    std::atomic_flag draining;
+
+    // Formatted text, circular
+    char text[LOG_BUFFER_SIZE];
+    size_t textStart;
+    size_t textLength;
     bool serialEnabled;
+    std::atomic<bool> synchronous;
+    LogSink sink;
+
+    template <typename... Args>
+    void write(LogLevel level, bool newline, const char* format, Args... args) {
+        LogArgs captured;
+        int unpack[] = {0, (captured.add(args), 0)...};
+        (void)unpack;
+        commit(level, newline, format, captured);
+    }
 
-    void appendToBuffer(const char* str);
+    void commit(LogLevel level, bool newline, const char* format, const LogArgs& args);
+    void copyIn(uint32_t pos, const void* data, size_t len);
+    void copyOut(uint32_t pos, void* data, size_t len) const;
+    void zero(uint32_t pos, size_t len);
+    void emit(const uint8_t* record, size_t len);
+    void emitText(uint32_t timestampMs, const char* message, LogLevel level, bool newline);
+    void appendText(const char* str, size_t len);
 };
 
 extern LogBuffer Logger;
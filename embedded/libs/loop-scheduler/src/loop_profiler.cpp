@@ -0,0 +1,245 @@
+#include "loop_profiler.h"
+
+#include <log_buffer.h>
+
+#if defined(ESP_PLATFORM) && !defined(UNIT_TEST)
+#include <xtensa/hal.h>
+#endif
+
+LoopProfiler Profiler;
+
+static const uint32_t DURATION_BUCKET_LIMITS_US[PROFILER_HISTOGRAM_BUCKETS] = {
+    50, 100, 200, 500, 1000, 2000, 5000, 10000, 20000, 50000, 100000, 250000, 1000000, UINT32_MAX};
+
+static const PhaseHistogram EMPTY_HISTOGRAM;
+static const PhaseStall EMPTY_STALL = {PROFILER_INVALID_PHASE, 0, 0, ""};
+
+static inline uint32_t readCycles() {
+#if defined(ESP_PLATFORM) && !defined(UNIT_TEST)
+    return xthal_get_ccount();
+#else
+    return micros();
+#endif
+}
+
+static inline uint32_t cyclesToUs(uint32_t cycles) {
+#if defined(ESP_PLATFORM) && !defined(UNIT_TEST)
+    return cycles / getCpuFrequencyMhz();
+#else
+    return cycles;
+#endif
+}
+
+// =============================================================================
+// PhaseHistogram
+// =============================================================================
+
+void PhaseHistogram::reset() {
+    memset(buckets, 0, sizeof(buckets));
+    count = 0;
+    maxUs = 0;
+    totalUs = 0;
+}
+
+void PhaseHistogram::record(uint32_t durationUs) {
+    int index = 0;
+    while (durationUs > DURATION_BUCKET_LIMITS_US[index]) {
+        index++;
+    }
+    buckets[index]++;
+    count++;
+    totalUs += durationUs;
+    if (durationUs > maxUs) {
+        maxUs = durationUs;
+    }
+}
+
+uint32_t PhaseHistogram::percentile(uint8_t percent) const {
+    if (count == 0) {
+        return 0;
+    }
+
+    // Rank of the sample that must be covered, rounded up
+    uint32_t rank = (uint32_t)(((uint64_t)count * percent + 99) / 100);
+    if (rank == 0) {
+        rank = 1;
+    }
+
+    uint32_t seen = 0;
+    for (int i = 0; i < PROFILER_HISTOGRAM_BUCKETS; i++) {
+        seen += buckets[i];
+        if (seen >= rank) {
+            // Never report more than was actually observed
+            return min(DURATION_BUCKET_LIMITS_US[i], maxUs);
+        }
+    }
+    return maxUs;
+}
+
+uint32_t PhaseHistogram::bucketLimit(int index) {
+    return DURATION_BUCKET_LIMITS_US[index];
+}
+
+// =============================================================================
+// LoopProfiler
+// =============================================================================
+
+LoopProfiler::LoopProfiler() {
+    reset();
+}
+
+void LoopProfiler::reset() {
+    phaseCount = 0;
+    defaultBudgetUs = PROFILER_DEFAULT_BUDGET_US;
+    resetStats();
+}
+
+void LoopProfiler::resetStats() {
+    for (int i = 0; i < phaseCount; i++) {
+        phases[i].stalls = 0;
+        phases[i].histogram.reset();
+    }
+    openPhase = PROFILER_INVALID_PHASE;
+    openStartCycles = 0;
+    openTag[0] = '\0';
+    stallHead = 0;
+    totalStalls = 0;
+    stallsNotLogged = 0;
+    lastStallLogMs = 0;
+    stallLogged = false;
+}
+
+ProfilerPhaseId LoopProfiler::addPhase(const char* name, uint32_t budgetUs) {
+    if (phaseCount >= PROFILER_MAX_PHASES) {
+        Logger.logln("Profiler: cannot register '%s'", name ? name : "");
+        return PROFILER_INVALID_PHASE;
+    }
+    Phase& phase = phases[phaseCount];
+    phase.name = name ? name : "";
+    phase.budgetUs = budgetUs;
+    phase.stalls = 0;
+    phase.histogram.reset();
+    return phaseCount++;
+}
+
+void LoopProfiler::setBudget(ProfilerPhaseId id, uint32_t budgetUs) {
+    if (isValid(id)) {
+        phases[id].budgetUs = budgetUs;
+    }
+}
+
+void LoopProfiler::setDefaultBudget(uint32_t budgetUs) {
+    defaultBudgetUs = budgetUs > 0 ? budgetUs : PROFILER_DEFAULT_BUDGET_US;
+}
+
+uint32_t LoopProfiler::getBudget(ProfilerPhaseId id) const {
+    if (!isValid(id)) {
+        return 0;
+    }
+    return phases[id].budgetUs > 0 ? phases[id].budgetUs : defaultBudgetUs;
+}
+
+// =============================================================================
+// Timing
+// =============================================================================
+
+void LoopProfiler::beginPhase(ProfilerPhaseId id) {
+    if (!isValid(id)) {
+        openPhase = PROFILER_INVALID_PHASE;
+        return;
+    }
+    openPhase = id;
+    openTag[0] = '\0';
+    openStartCycles = readCycles();
+}
+
+uint32_t LoopProfiler::endPhase() {
+    uint32_t elapsedCycles = readCycles() - openStartCycles;
+    if (!isValid(openPhase)) {
+        return 0;
+    }
+    ProfilerPhaseId id = openPhase;
+    openPhase = PROFILER_INVALID_PHASE;
+
+    uint32_t durationUs = cyclesToUs(elapsedCycles);
+    phases[id].histogram.record(durationUs);
+    if (durationUs > getBudget(id)) {
+        recordStall(id, durationUs);
+    }
+    return durationUs;
+}
+
+void LoopProfiler::tag(const char* label) {
+    if (openPhase == PROFILER_INVALID_PHASE || !label) {
+        return;
+    }
+    strncpy(openTag, label, PROFILER_TAG_LEN - 1);
+    openTag[PROFILER_TAG_LEN - 1] = '\0';
+}
+
+void LoopProfiler::recordStall(ProfilerPhaseId id, uint32_t durationUs) {
+    unsigned long now = millis();
+    PhaseStall& stall = stallHistory[stallHead];
+    stall.phase = id;
+    stall.durationUs = durationUs;
+    stall.atMs = now;
+    memcpy(stall.tag, openTag, PROFILER_TAG_LEN);
+    stallHead = (stallHead + 1) % PROFILER_STALL_HISTORY;
+    phases[id].stalls++;
+    totalStalls++;
+
+    // A phase that stalls every pass would otherwise flood the log
+    if (stallLogged && now - lastStallLogMs < PROFILER_STALL_LOG_INTERVAL_MS) {
+        stallsNotLogged++;
+        return;
+    }
+    Logger.logln("Profiler: STALL %s took %lums (budget %lums)%s%s%s", phases[id].name,
+                 (unsigned long)(durationUs / 1000), (unsigned long)(getBudget(id) / 1000), stall.tag[0] ? " in '" : "",
+                 stall.tag, stall.tag[0] ? "'" : "");
+    if (stallsNotLogged > 0) {
+        Logger.logln("Profiler: %u more stalls not logged", stallsNotLogged);
+        stallsNotLogged = 0;
+    }
+    lastStallLogMs = now;
+    stallLogged = true;
+}
+
+// =============================================================================
+// Reporting
+// =============================================================================
+
+const char* LoopProfiler::getPhaseName(ProfilerPhaseId id) const {
+    return isValid(id) ? phases[id].name : "";
+}
+
+const PhaseHistogram& LoopProfiler::getHistogram(ProfilerPhaseId id) const {
+    return isValid(id) ? phases[id].histogram : EMPTY_HISTOGRAM;
+}
+
+uint32_t LoopProfiler::getStallCount(ProfilerPhaseId id) const {
+    return isValid(id) ? phases[id].stalls : 0;
+}
+
+int LoopProfiler::getRecentStallCount() const {
+    return totalStalls < PROFILER_STALL_HISTORY ? (int)totalStalls : PROFILER_STALL_HISTORY;
+}
+
+const PhaseStall& LoopProfiler::getRecentStall(int index) const {
+    if (index < 0 || index >= getRecentStallCount()) {
+        return EMPTY_STALL;
+    }
+    int slot = (stallHead - 1 - index + PROFILER_STALL_HISTORY) % PROFILER_STALL_HISTORY;
+    return stallHistory[slot];
+}
+
+void LoopProfiler::logSummary() const {
+    for (int i = 0; i < phaseCount; i++) {
+        const PhaseHistogram& h = phases[i].histogram;
+        if (h.count == 0) {
+            continue;
+        }
+        Logger.logln("Profiler: %-10s n=%u avg=%luus p99=%luus max=%luus stalls=%u", phases[i].name, h.count,
+                     (unsigned long)h.avgUs(), (unsigned long)h.percentile(99), (unsigned long)h.maxUs,
+                     phases[i].stalls);
+    }
+}
@@ -0,0 +1,178 @@
+#ifndef LOOP_PROFILER_H
+#define LOOP_PROFILER_H
+
+#include <Arduino.h>
+
+// Phases that can be profiled (one per scheduler task plus ad-hoc sections)
+#define PROFILER_MAX_PHASES 24
+
+// Upper bounds (us) of the phase duration histogram buckets; the last
+// bucket catches everything slower
+#define PROFILER_HISTOGRAM_BUCKETS 14
+
+// A phase running longer than this is a stall unless it has its own budget
+#define PROFILER_DEFAULT_BUDGET_US 50000
+
+// Most recent stalls kept for /api/metrics
+#define PROFILER_STALL_HISTORY 8
+
+// Longest tag (including terminator) copied into a stall record
+#define PROFILER_TAG_LEN 24
+
+// Stalls beyond the first in this window are counted but not logged
+#define PROFILER_STALL_LOG_INTERVAL_MS 1000
+
+#define PROFILER_INVALID_PHASE -1
+
+typedef int8_t ProfilerPhaseId;
+
+/**
+ * Fixed-bucket duration histogram. Percentiles resolve to the upper bound of
+ * the bucket holding the requested rank, capped at the observed maximum.
+ */
+struct PhaseHistogram {
+    uint32_t buckets[PROFILER_HISTOGRAM_BUCKETS];
+    uint32_t count;
+    uint32_t maxUs;
+    uint64_t totalUs;
+
+    PhaseHistogram() { reset(); }
+
+    void reset();
+    void record(uint32_t durationUs);
+
+    /**
+     * Duration (us) at or below which `percent` of samples fall.
+     * @return 0 if no samples, maxUs for the overflow bucket
+     */
+    uint32_t percentile(uint8_t percent) const;
+
+    uint32_t avgUs() const { return count ? (uint32_t)(totalUs / count) : 0; }
+
+    static uint32_t bucketLimit(int index);
+};
+
+/**
+ * One phase that ran past its budget.
+ */
+struct PhaseStall {
+    ProfilerPhaseId phase;
+    uint32_t durationUs;
+    unsigned long atMs;          // millis() when the phase ended
+    char tag[PROFILER_TAG_LEN];  // Last tag() set while the phase ran, "" if none
+};
+
+/**
+ * LoopProfiler times main-loop phases with the CPU cycle counter.
+ *
+ * The scheduler wraps every task in beginPhase()/endPhase(). Code can also
+ * wrap its own sections the same way. Each phase keeps a duration histogram
+ * (count, average, p99, max). A phase that overruns its budget is recorded
+ * as a stall with the last tag() set while it ran. Callers set tags before
+ * known blocking work on the loop task (a WiFi scan, a chunked proxy forward,
+ * a TLS connect, the flush and delay before a restart), so a stall report
+ * names the culprit, not just "web" or "ble". Blocking work on other tasks,
+ * such as the LED blinks in the NimBLE connect callbacks, is not timed here.
+ * Stalls are logged at once (rate limited) and kept in a short history.
+ *
+ * The cycle counter wraps after 2^32 cycles (about 17 s at 240 MHz), so
+ * longer phases are misreported. Anything that long is a stall already.
+ * Native builds use micros() instead.
+ */
+class LoopProfiler {
+  public:
+    LoopProfiler();
+
+    /**
+     * Register a phase. budgetUs 0 uses the default budget.
+     * @return Phase ID, PROFILER_INVALID_PHASE if the table is full
+     */
+    ProfilerPhaseId addPhase(const char* name, uint32_t budgetUs = 0);
+
+    /**
+     * Budget for one phase (0 = follow the default budget).
+     */
+    void setBudget(ProfilerPhaseId id, uint32_t budgetUs);
+
+    /**
+     * Budget for phases without their own. Changing it applies immediately.
+     */
+    void setDefaultBudget(uint32_t budgetUs);
+    uint32_t getDefaultBudget() const { return defaultBudgetUs; }
+    uint32_t getBudget(ProfilerPhaseId id) const;
+
+    /**
+     * Start timing a phase. Phases do not nest; starting one while another
+     * is open discards the open one.
+     */
+    void beginPhase(ProfilerPhaseId id);
+
+    /**
+     * Stop timing the open phase, record it and check its budget.
+     * @return Phase duration in microseconds (0 if no phase was open)
+     */
+    uint32_t endPhase();
+
+    /**
+     * Label what the open phase is doing. The last tag is kept with a stall
+     * record. Ignored when no phase is open.
+     */
+    void tag(const char* label);
+
+    int getPhaseCount() const { return phaseCount; }
+    const char* getPhaseName(ProfilerPhaseId id) const;
+    const PhaseHistogram& getHistogram(ProfilerPhaseId id) const;
+    uint32_t getStallCount(ProfilerPhaseId id) const;
+
+    /** Stalls since reset, including ones that dropped out of the history */
+    uint32_t getTotalStalls() const { return totalStalls; }
+
+    /** Stalls in the history, newest first */
+    int getRecentStallCount() const;
+    const PhaseStall& getRecentStall(int index) const;
+
+    /**
+     * Log per-phase p99/max and stall counts.
+     */
+    void logSummary() const;
+
+    /**
+     * Clear histograms and stalls; phases and budgets are kept.
+     */
+    void resetStats();
+
+    /**
+     * Clear everything including phases (used by tests).
+     */
+    void reset();
+
+  private:
+    struct Phase {
+        const char* name;
+        uint32_t budgetUs;  // 0 = default
+        uint32_t stalls;
+        PhaseHistogram histogram;
+    };
+
+    Phase phases[PROFILER_MAX_PHASES];
+    int phaseCount;
+    uint32_t defaultBudgetUs;
+
+    ProfilerPhaseId openPhase;
+    uint32_t openStartCycles;
+    char openTag[PROFILER_TAG_LEN];
+
+    PhaseStall stallHistory[PROFILER_STALL_HISTORY];
+    int stallHead;  // Next slot to write
+    uint32_t totalStalls;
+    uint32_t stallsNotLogged;
+    unsigned long lastStallLogMs;
+    bool stallLogged;
+
+    bool isValid(ProfilerPhaseId id) const { return id >= 0 && id < phaseCount; }
+    void recordStall(ProfilerPhaseId id, uint32_t durationUs);
+};
+
+extern LoopProfiler Profiler;
+
+#endif
@@ -0,0 +1,322 @@
+#include "loop_scheduler.h"
+
+#include <log_buffer.h>
+
+#include "loop_profiler.h"
+
+#if defined(ESP_PLATFORM) && !defined(UNIT_TEST)
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#endif
+
+LoopScheduler Scheduler;
+
+static const char* PRIORITY_NAMES[(int)TaskPriority::COUNT] = {"urgent", "normal", "background"};
+
+static const SchedulerTaskStats EMPTY_TASK_STATS = {};
+
+LoopScheduler::LoopScheduler() : loopTask(nullptr), profiler(nullptr) {
+    reset();
+}
+
+void LoopScheduler::begin() {
+#if defined(ESP_PLATFORM) && !defined(UNIT_TEST)
+    loopTask = xTaskGetCurrentTaskHandle();
+#endif
+    resetStats();
+}
+
+void LoopScheduler::setProfiler(LoopProfiler* newProfiler) {
+    profiler = newProfiler;
+    for (int i = 0; i < taskCount; i++) {
+        tasks[i].phase = profiler ? profiler->addPhase(tasks[i].name) : PROFILER_INVALID_PHASE;
+    }
+}
+
+void LoopScheduler::reset() {
+    taskCount = 0;
+    resetStats();
+}
+
+void LoopScheduler::resetStats() {
+    for (int i = 0; i < taskCount; i++) {
+        tasks[i].stats = SchedulerTaskStats();
+    }
+    stats = SchedulerStats();
+    stats.sinceMs = millis();
+    lastStatsLogMs = stats.sinceMs;
+}
+
+// =============================================================================
+// Registration
+// =============================================================================
+
+SchedulerTaskId LoopScheduler::addTask(const char* name, uint32_t intervalMs, SchedulerTaskFn fn,
+                                       TaskPriority priority) {
+    if (taskCount >= SCHEDULER_MAX_TASKS || !fn) {
+        Logger.logln("Scheduler: cannot register '%s'", name ? name : "");
+        return SCHEDULER_INVALID_TASK;
+    }
+
+    Task& task = tasks[taskCount];
+    task.name = name ? name : "";
+    task.fn = fn;
+    task.priority = priority;
+    task.intervalMs = intervalMs;
+    task.deadlineMs = 0;
+    task.dueMs = millis() + intervalMs;
+    task.armed = intervalMs > 0;
+    task.signalled = false;
+    task.signalledMs = 0;
+    task.phase = profiler ? profiler->addPhase(task.name) : PROFILER_INVALID_PHASE;
+    task.stats = SchedulerTaskStats();
+    return taskCount++;
+}
+
+SchedulerTaskId LoopScheduler::addPeriodic(const char* name, uint32_t intervalMs, SchedulerTaskFn fn,
+                                           TaskPriority priority) {
+    return addTask(name, intervalMs > 0 ? intervalMs : 1, fn, priority);
+}
+
+SchedulerTaskId LoopScheduler::addEvent(const char* name, SchedulerTaskFn fn, TaskPriority priority) {
+    return addTask(name, 0, fn, priority);
+}
+
+// =============================================================================
+// Timers and Signals
+// =============================================================================
+
+void LoopScheduler::runAfter(SchedulerTaskId id, uint32_t delayMs) {
+    if (!isValid(id)) {
+        return;
+    }
+    tasks[id].dueMs = millis() + delayMs;
+    tasks[id].armed = true;
+}
+
+void LoopScheduler::signal(SchedulerTaskId id) {
+    if (!isValid(id)) {
+        return;
+    }
+    // Timestamp first so the loop never sees the flag without it
+    tasks[id].signalledMs = millis();
+    tasks[id].signalled = true;
+#if defined(ESP_PLATFORM) && !defined(UNIT_TEST)
+    if (loopTask) {
+        xTaskNotifyGive((TaskHandle_t)loopTask);
+    }
+#endif
+}
+
+void LoopScheduler::signalFromISR(SchedulerTaskId id) {
+    if (!isValid(id)) {
+        return;
+    }
+    tasks[id].signalledMs = millis();
+    tasks[id].signalled = true;
+#if defined(ESP_PLATFORM) && !defined(UNIT_TEST)
+    if (loopTask) {
+        BaseType_t woken = pdFALSE;
+        vTaskNotifyGiveFromISR((TaskHandle_t)loopTask, &woken);
+        portYIELD_FROM_ISR(woken);
+    }
+#endif
+}
+
+void LoopScheduler::cancel(SchedulerTaskId id) {
+    if (!isValid(id)) {
+        return;
+    }
+    tasks[id].armed = false;
+    tasks[id].signalled = false;
+}
+
+void LoopScheduler::setDeadline(SchedulerTaskId id, uint32_t maxLatenessMs) {
+    if (isValid(id)) {
+        tasks[id].deadlineMs = maxLatenessMs;
+    }
+}
+
+// =============================================================================
+// Running
+// =============================================================================
+
+bool LoopScheduler::readySince(const Task& task, unsigned long now, unsigned long& readyMs) const {
+    bool ready = false;
+    if (task.armed && (long)(now - task.dueMs) >= 0) {
+        readyMs = task.dueMs;
+        ready = true;
+    }
+    if (task.signalled) {
+        unsigned long signalledMs = task.signalledMs;
+        if (!ready || (long)(signalledMs - readyMs) < 0) {
+            readyMs = signalledMs;
+        }
+        ready = true;
+    }
+    return ready;
+}
+
+void LoopScheduler::run(Task& task, unsigned long now, unsigned long readyMs) {
+    bool timerDue = task.armed && (long)(now - task.dueMs) >= 0;
+    task.signalled = false;
+    if (timerDue) {
+        if (task.intervalMs > 0) {
+            // Keep the cadence, but skip runs missed while the loop was busy
+            task.dueMs += task.intervalMs;
+            if ((long)(now - task.dueMs) >= 0) {
+                task.dueMs = now + task.intervalMs;
+            }
+        } else {
+            task.armed = false;
+        }
+    }
+
+    uint32_t latenessMs = now - readyMs;
+    if (latenessMs > task.stats.maxLatenessMs) {
+        task.stats.maxLatenessMs = latenessMs;
+    }
+    if (task.deadlineMs > 0 && latenessMs > task.deadlineMs) {
+        task.stats.deadlineMisses++;
+    }
+
+    uint32_t startUs = micros();
+    if (profiler) {
+        profiler->beginPhase(task.phase);
+    }
+    task.fn();
+    if (profiler) {
+        profiler->endPhase();
+    }
+    uint32_t elapsedUs = micros() - startUs;
+
+    task.stats.runs++;
+    task.stats.totalUs += elapsedUs;
+    if (elapsedUs > task.stats.maxUs) {
+        task.stats.maxUs = elapsedUs;
+    }
+    stats.busyUs += elapsedUs;
+}
+
+uint32_t LoopScheduler::runOnce() {
+    bool ran[SCHEDULER_MAX_TASKS] = {};
+    bool ranAny = false;
+
+    while (true) {
+        // Pick the highest-priority ready task, oldest first, that has not run
+        // this pass. Re-evaluated after every run so an URGENT task signalled by a
+        // NORMAL one still goes before the remaining BACKGROUND work.
+        unsigned long now = millis();
+        int best = -1;
+        unsigned long bestReadyMs = 0;
+        for (int i = 0; i < taskCount; i++) {
+            unsigned long readyMs;
+            if (ran[i] || !readySince(tasks[i], now, readyMs)) {
+                continue;
+            }
+            if (best < 0 || tasks[i].priority < tasks[best].priority ||
+                (tasks[i].priority == tasks[best].priority && (long)(readyMs - bestReadyMs) < 0)) {
+                best = i;
+                bestReadyMs = readyMs;
+            }
+        }
+        if (best < 0) {
+            break;
+        }
+        ran[best] = true;
+        ranAny = true;
+        run(tasks[best], now, bestReadyMs);
+    }
+
+    if (ranAny) {
+        stats.passes++;
+    }
+
+    unsigned long now = millis();
+    if (now - lastStatsLogMs >= SCHEDULER_STATS_LOG_INTERVAL_MS) {
+        lastStatsLogMs = now;
+        logStats();
+        if (profiler) {
+            profiler->logSummary();
+        }
+    }
+    return msUntilNextDue(now);
+}
+
+uint32_t LoopScheduler::msUntilNextDue(unsigned long now) const {
+    uint32_t waitMs = SCHEDULER_MAX_IDLE_MS;
+    for (int i = 0; i < taskCount; i++) {
+        const Task& task = tasks[i];
+        if (task.signalled) {
+            return 0;
+        }
+        if (!task.armed) {
+            continue;
+        }
+        long untilDue = (long)(task.dueMs - now);
+        if (untilDue <= 0) {
+            return 0;
+        }
+        if ((uint32_t)untilDue < waitMs) {
+            waitMs = untilDue;
+        }
+    }
+    return waitMs;
+}
+
+void LoopScheduler::loop() {
+    uint32_t waitMs = runOnce();
+    if (waitMs > 0) {
+        idle(waitMs);
+    }
+}
+
+void LoopScheduler::idle(uint32_t ms) {
+#if defined(ESP_PLATFORM) && !defined(UNIT_TEST)
+    uint32_t startUs = micros();
+    if (loopTask) {
+        // Returns early when signal() notifies this task
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(ms));
+    } else {
+        vTaskDelay(pdMS_TO_TICKS(ms));
+    }
+    stats.idleUs += micros() - startUs;
+#else
+    (void)ms;
+#endif
+}
+
+// =============================================================================
+// Accounting
+// =============================================================================
+
+const char* LoopScheduler::getTaskName(SchedulerTaskId id) const {
+    return isValid(id) ? tasks[id].name : "";
+}
+
+TaskPriority LoopScheduler::getTaskPriority(SchedulerTaskId id) const {
+    return isValid(id) ? tasks[id].priority : TaskPriority::NORMAL;
+}
+
+const SchedulerTaskStats& LoopScheduler::getTaskStats(SchedulerTaskId id) const {
+    return isValid(id) ? tasks[id].stats : EMPTY_TASK_STATS;
+}
+
+void LoopScheduler::logStats() {
+    unsigned long windowMs = millis() - stats.sinceMs;
+    if (windowMs == 0) {
+        return;
+    }
+    Logger.logln("Scheduler: busy=%lums idle=%lums over %lums, %u passes", (unsigned long)(stats.busyUs / 1000),
+                 (unsigned long)(stats.idleUs / 1000), windowMs, stats.passes);
+    for (int i = 0; i < taskCount; i++) {
+        const SchedulerTaskStats& s = tasks[i].stats;
+        if (s.runs == 0) {
+            continue;
+        }
+        Logger.logln("Scheduler: %-10s [%s] runs=%u cpu=%lums avg=%luus max=%luus late=%lums misses=%u", tasks[i].name,
+                     PRIORITY_NAMES[(int)tasks[i].priority], s.runs, (unsigned long)(s.totalUs / 1000),
+                     (unsigned long)(s.totalUs / s.runs), (unsigned long)s.maxUs, (unsigned long)s.maxLatenessMs,
+                     s.deadlineMisses);
+    }
+}
@@ -0,0 +1,184 @@
+#ifndef LOOP_SCHEDULER_H
+#define LOOP_SCHEDULER_H
+
+#include <Arduino.h>
+
+// Tasks the main loop can register (periodic polls, timers and events)
+#define SCHEDULER_MAX_TASKS 16
+
+// Longest the loop sleeps even when nothing is due, so a missed signal costs
+// at most this much latency
+#define SCHEDULER_MAX_IDLE_MS 20
+
+// Log a per-task run-time summary at this interval
+#define SCHEDULER_STATS_LOG_INTERVAL_MS 60000
+
+#define SCHEDULER_INVALID_TASK -1
+
+class LoopProfiler;
+
+/**
+ * Priority classes. When several tasks are ready in the same pass, every
+ * URGENT task runs before any NORMAL one, and NORMAL before BACKGROUND.
+ */
+enum class TaskPriority : uint8_t { URGENT = 0, NORMAL, BACKGROUND, COUNT };
+
+typedef void (*SchedulerTaskFn)();
+typedef int8_t SchedulerTaskId;
+
+/**
+ * Run-time accounting for one task.
+ */
+struct SchedulerTaskStats {
+    uint32_t runs;
+    uint64_t totalUs;         // Time spent inside the task
+    uint32_t maxUs;           // Longest single run
+    uint32_t deadlineMisses;  // Runs that started later than the task's deadline allows
+    uint32_t maxLatenessMs;   // Worst delay between becoming ready and starting
+};
+
+/**
+ * Whole-loop accounting.
+ */
+struct SchedulerStats {
+    uint32_t passes;  // runOnce() calls that ran at least one task
+    uint64_t busyUs;  // Time inside tasks
+    uint64_t idleUs;  // Time the loop slept waiting for work
+    unsigned long sinceMs;
+};
+
+/**
+ * LoopScheduler replaces a spin-everything loop() with registered work.
+ *
+ * - Periodic tasks run every intervalMs (polls of libraries that have no
+ *   event source, e.g. WebServer::handleClient()).
+ * - Event tasks run when signal() is called (from a callback, another task
+ *   or an ISR) or when a timer armed with runAfter() expires, which covers
+ *   one-shot deadlines such as debounces.
+ * - Each pass runs every ready task once, ordered by priority class, then by
+ *   how long it has been ready.
+ * - Between passes the loop task blocks until the next task is due or a
+ *   signal arrives, so the CPU idles instead of spinning (the FreeRTOS idle
+ *   task runs, and light sleep applies if power management enables it).
+ *
+ * Per-task run counts, CPU time and lateness show which subsystem eats the
+ * loop. Timing comes from millis()/micros() and idling is compiled out in
+ * native tests, so the scheduling logic runs unchanged there.
+ */
+class LoopScheduler {
+  public:
+    LoopScheduler();
+
+    /**
+     * Bind to the calling task so signal() can wake it. Call from setup().
+     */
+    void begin();
+
+    /**
+     * Time every task run as a profiler phase named after the task, for
+     * duration histograms and stall detection. Tasks registered earlier are
+     * added too. nullptr stops profiling.
+     */
+    void setProfiler(LoopProfiler* profiler);
+
+    /**
+     * Register a task that runs every intervalMs, first after one interval.
+     * @return Task ID, SCHEDULER_INVALID_TASK if the table is full
+     */
+    SchedulerTaskId addPeriodic(const char* name, uint32_t intervalMs, SchedulerTaskFn fn,
+                                TaskPriority priority = TaskPriority::NORMAL);
+
+    /**
+     * Register a task that only runs when signalled or when its timer fires.
+     * @return Task ID, SCHEDULER_INVALID_TASK if the table is full
+     */
+    SchedulerTaskId addEvent(const char* name, SchedulerTaskFn fn, TaskPriority priority = TaskPriority::NORMAL);
+
+    /**
+     * (Re)arm a task's timer. For event tasks this is a one-shot; for
+     * periodic tasks it moves the next run, and the period resumes from there.
+     */
+    void runAfter(SchedulerTaskId id, uint32_t delayMs);
+
+    /**
+     * Mark a task ready now and wake the loop. Safe to call from other
+     * FreeRTOS tasks; use signalFromISR() in interrupt handlers.
+     */
+    void signal(SchedulerTaskId id);
+    void signalFromISR(SchedulerTaskId id);
+
+    /**
+     * Drop a pending signal and disarm the timer. Periodic tasks stop until
+     * runAfter() restarts them.
+     */
+    void cancel(SchedulerTaskId id);
+
+    /**
+     * Count runs that start more than maxLatenessMs after becoming ready.
+     * 0 (default) disables the check.
+     */
+    void setDeadline(SchedulerTaskId id, uint32_t maxLatenessMs);
+
+    /**
+     * Run every task that is ready, once each, in priority order.
+     * @return Milliseconds until the next task is due (0 if one is ready),
+     *         capped at SCHEDULER_MAX_IDLE_MS
+     */
+    uint32_t runOnce();
+
+    /**
+     * runOnce(), then sleep until the next task is due or a signal arrives.
+     * Call from loop().
+     */
+    void loop();
+
+    int getTaskCount() const { return taskCount; }
+    const char* getTaskName(SchedulerTaskId id) const;
+    TaskPriority getTaskPriority(SchedulerTaskId id) const;
+    const SchedulerTaskStats& getTaskStats(SchedulerTaskId id) const;
+    const SchedulerStats& getStats() const { return stats; }
+
+    /**
+     * Clear per-task and loop accounting; tasks and timers are kept.
+     */
+    void resetStats();
+
+    /**
+     * Clear everything including registered tasks (used by tests).
+     */
+    void reset();
+
+  private:
+    struct Task {
+        const char* name;
+        SchedulerTaskFn fn;
+        TaskPriority priority;
+        uint32_t intervalMs;  // 0 for event tasks
+        uint32_t deadlineMs;
+        unsigned long dueMs;
+        bool armed;
+        volatile bool signalled;
+        volatile unsigned long signalledMs;
+        int8_t phase;  // Profiler phase, -1 if not profiled
+        SchedulerTaskStats stats;
+    };
+
+    Task tasks[SCHEDULER_MAX_TASKS];
+    int taskCount;
+    SchedulerStats stats;
+    void* loopTask;  // TaskHandle_t of the task running loop()
+    LoopProfiler* profiler;
+    unsigned long lastStatsLogMs;
+
+    SchedulerTaskId addTask(const char* name, uint32_t intervalMs, SchedulerTaskFn fn, TaskPriority priority);
+    bool isValid(SchedulerTaskId id) const { return id >= 0 && id < taskCount; }
+    bool readySince(const Task& task, unsigned long now, unsigned long& readyMs) const;
+    void run(Task& task, unsigned long now, unsigned long readyMs);
+    uint32_t msUntilNextDue(unsigned long now) const;
+    void idle(uint32_t ms);
+    void logStats();
+};
+
+extern LoopScheduler Scheduler;
+
+#endif
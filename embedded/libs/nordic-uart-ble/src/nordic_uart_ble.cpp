@@ -6,8 +6,10 @@ NordicUartBLE BLE;
 
 NordicUartBLE::NordicUartBLE()
     : pServer(nullptr), pTxCharacteristic(nullptr), pRxCharacteristic(nullptr), deviceConnected(false),
-      advertising(false), advertisingEnabled(false), connectedDeviceHandle(BLE_HS_CONN_HANDLE_NONE),
-      connectCallback(nullptr), dataCallback(nullptr), ledDataCallback(nullptr), rawForwardCallback(nullptr) {}
+      advertising(false), advertisingEnabled(false), readvertisePending(false), readvertiseDueMs(0),
+      connectedDeviceHandle(BLE_HS_CONN_HANDLE_NONE),
+      connectCallback(nullptr), dataCallback(nullptr), ledDataCallback(nullptr), rawForwardCallback(nullptr),
+      wakeCallback(nullptr) {}
 
 void NordicUartBLE::begin(const char* deviceName, bool startAdv) {
     NimBLEDevice::init(deviceName);
@@ -57,10 +59,15 @@ void NordicUartBLE::begin(const char* deviceName, bool startAdv) {
 }
 
 void NordicUartBLE::loop() {
-    // Restart advertising if disconnected, not currently advertising, and allowed
+    // Restart advertising if disconnected, not currently advertising, and allowed.
+    // Wait a short pause first, timed so the rest of the loop keeps running.
     if (advertisingEnabled && !deviceConnected && !advertising) {
-        delay(500);  // Small delay before re-advertising
-        startAdvertising();
+        if (!readvertisePending) {
+            readvertisePending = true;
+            readvertiseDueMs = millis() + BLE_READVERTISE_DELAY_MS;
+        } else if ((long)(millis() - readvertiseDueMs) >= 0) {
+            startAdvertising();
+        }
     }
 }
 
@@ -95,6 +102,10 @@ void NordicUartBLE::setRawForwardCallback(BLERawForwardCallback callback) {
     rawForwardCallback = callback;
 }
 
+void NordicUartBLE::setWakeCallback(BLEWakeCallback callback) {
+    wakeCallback = callback;
+}
+
 void NordicUartBLE::onConnect(NimBLEServer* server, ble_gap_conn_desc* desc) {
     deviceConnected = true;
     advertising = false;
@@ -116,6 +127,10 @@ void NordicUartBLE::onConnect(NimBLEServer* server, ble_gap_conn_desc* desc) {
         NimBLEDevice::getAdvertising()->start();
         Logger.logln("BLE: Advertising restarted for more connections");
     }
+
+    if (wakeCallback) {
+        wakeCallback();
+    }
 }
 
 void NordicUartBLE::onDisconnect(NimBLEServer* server, ble_gap_conn_desc* desc) {
@@ -133,22 +148,26 @@ void NordicUartBLE::onDisconnect(NimBLEServer* server, ble_gap_conn_desc* desc)
 
     // Restart advertising
     startAdvertising();
+
+    if (wakeCallback) {
+        wakeCallback();
+    }
 }
 
 bool NordicUartBLE::shouldSendLedData(uint32_t hash) {
     if (connectedDeviceAddress.length() == 0) {
-        Logger.logln("BLE: shouldSendLedData: no device address, allowing");
+        Logger.debugln("BLE: shouldSendLedData: no device address, allowing");
         return true;
     }
 
     auto it = lastSentHashByMac.find(connectedDeviceAddress);
     if (it == lastSentHashByMac.end()) {
-        Logger.logln("BLE: shouldSendLedData: first time from %s, allowing", connectedDeviceAddress.c_str());
+        Logger.debugln("BLE: shouldSendLedData: first time from %s, allowing", connectedDeviceAddress.c_str());
         return true;  // Never sent from this device before
     }
 
     bool shouldSend = (it->second != hash);
-    Logger.logln("BLE: shouldSendLedData: %s, lastHash=%u, newHash=%u, send=%s", connectedDeviceAddress.c_str(),
+    Logger.debugln("BLE: shouldSendLedData: %s, lastHash=%u, newHash=%u, send=%s", connectedDeviceAddress.c_str(),
                  it->second, hash, shouldSend ? "yes" : "no");
     return shouldSend;
 }
@@ -181,7 +200,7 @@ void NordicUartBLE::onWrite(NimBLECharacteristic* characteristic) {
     if (value.length() == 0)
         return;
 
-    Logger.logln("BLE: Received %zu bytes", value.length());
+    Logger.debugln("BLE: Received %zu bytes", value.length());
 
     // Forward raw data to proxy if callback is set (before protocol processing)
     if (rawForwardCallback) {
@@ -213,6 +232,10 @@ void NordicUartBLE::onWrite(NimBLECharacteristic* characteristic) {
     if (dataCallback) {
         dataCallback((const uint8_t*)value.data(), value.length());
     }
+
+    if (wakeCallback) {
+        wakeCallback();
+    }
 }
 
 void NordicUartBLE::startAdvertising() {
@@ -222,6 +245,7 @@ void NordicUartBLE::startAdvertising() {
     pAdvertising->start();
     advertising = true;
     advertisingEnabled = true;  // Enable for future restarts in loop()
+    readvertisePending = false;
 
     Logger.logln("BLE: Advertising started");
 }
@@ -16,10 +16,14 @@
 #define NUS_RX_CHARACTERISTIC "6E400002-B5A3-F393-E0A9-E50E24DCCA9E"
 #define NUS_TX_CHARACTERISTIC "6E400003-B5A3-F393-E0A9-E50E24DCCA9E"
 
+// Pause before loop() restarts advertising that stopped while disconnected
+#define BLE_READVERTISE_DELAY_MS 500
+
 typedef void (*BLEConnectCallback)(bool connected);
 typedef void (*BLEDataCallback)(const uint8_t* data, size_t len);
 typedef void (*BLELedDataCallback)(const LedCommand* commands, int count, int angle);
 typedef void (*BLERawForwardCallback)(const uint8_t* data, size_t len);
+typedef void (*BLEWakeCallback)();
 
 class NordicUartBLE : public NimBLEServerCallbacks, public NimBLECharacteristicCallbacks {
   public:
@@ -47,6 +51,10 @@ class NordicUartBLE : public NimBLEServerCallbacks, public NimBLECharacteristicC
     // Used by BLE proxy to forward data to the actual board
     void setRawForwardCallback(BLERawForwardCallback callback);
 
+    // Called on the NimBLE host task after a connect, disconnect or write,
+    // so the owner can run loop() now instead of on its next poll
+    void setWakeCallback(BLEWakeCallback callback);
+
     // NimBLE callbacks
     void onConnect(NimBLEServer* server, ble_gap_conn_desc* desc) override;
     void onDisconnect(NimBLEServer* server, ble_gap_conn_desc* desc) override;
@@ -67,6 +75,9 @@ class NordicUartBLE : public NimBLEServerCallbacks, public NimBLECharacteristicC
     // Clear the last sent hash (after disconnect)
     void clearLastSentHash();
 
+    // Aurora decoder counters for data received from the app
+    const AuroraProtocolStats& getProtocolStats() const { return protocol.getStats(); }
+
   private:
     NimBLEServer* pServer;
     NimBLECharacteristic* pTxCharacteristic;
@@ -75,6 +86,8 @@ class NordicUartBLE : public NimBLEServerCallbacks, public NimBLECharacteristicC
     bool deviceConnected;
     bool advertising;
     bool advertisingEnabled;  // Whether advertising is allowed (false until proxy connects)
+    bool readvertisePending;
+    unsigned long readvertiseDueMs;
     String connectedDeviceAddress;                 // MAC address of currently connected device
     uint16_t connectedDeviceHandle;                // Connection handle for disconnect
     std::map<String, uint32_t> lastSentHashByMac;  // Track last sent hash per MAC address
@@ -85,6 +98,7 @@ class NordicUartBLE : public NimBLEServerCallbacks, public NimBLECharacteristicC
     BLEDataCallback dataCallback;
     BLELedDataCallback ledDataCallback;
     BLERawForwardCallback rawForwardCallback;
+    BLEWakeCallback wakeCallback;
 };
 
 extern NordicUartBLE BLE;
@@ -0,0 +1,268 @@
+#include "radio_coex.h"
+
+#include <log_buffer.h>
+
+#if defined(ESP_PLATFORM) && !defined(UNIT_TEST)
+#include <esp_coexist.h>
+#endif
+
+RadioCoex Coex;
+
+static const uint32_t LATENCY_BUCKET_LIMITS_MS[COEX_LATENCY_BUCKETS] = {1,   2,   5,    10,   20,   50,
+                                                                       100, 200, 500, 1000, 2000, UINT32_MAX};
+
+static const unsigned long TRANSFER_HOLD_MS[COEX_ACTIVITY_COUNT] = {0, COEX_WIFI_TRANSFER_HOLD_MS,
+                                                                    COEX_BLE_TRANSFER_HOLD_MS, 0};
+
+static const char* PREFERENCE_NAMES[COEX_PREFERENCE_COUNT] = {"balance", "wifi", "bt"};
+
+// =============================================================================
+// CoexLatencyHistogram
+// =============================================================================
+
+void CoexLatencyHistogram::reset() {
+    memset(buckets, 0, sizeof(buckets));
+    count = 0;
+    maxMs = 0;
+}
+
+void CoexLatencyHistogram::record(uint32_t latencyMs) {
+    int index = 0;
+    while (latencyMs > LATENCY_BUCKET_LIMITS_MS[index]) {
+        index++;
+    }
+    buckets[index]++;
+    count++;
+    if (latencyMs > maxMs) {
+        maxMs = latencyMs;
+    }
+}
+
+uint32_t CoexLatencyHistogram::percentile(uint8_t percent) const {
+    if (count == 0) {
+        return 0;
+    }
+
+    // Rank of the sample that must be covered, rounded up
+    uint32_t rank = (count * percent + 99) / 100;
+    if (rank == 0) {
+        rank = 1;
+    }
+
+    uint32_t seen = 0;
+    for (int i = 0; i < COEX_LATENCY_BUCKETS; i++) {
+        seen += buckets[i];
+        if (seen >= rank) {
+            // Never report more than was actually observed
+            return min(LATENCY_BUCKET_LIMITS_MS[i], maxMs);
+        }
+    }
+    return maxMs;
+}
+
+uint32_t CoexLatencyHistogram::bucketLimit(int index) {
+    return LATENCY_BUCKET_LIMITS_MS[index];
+}
+
+// =============================================================================
+// RadioCoex
+// =============================================================================
+
+RadioCoex::RadioCoex() {
+    reset();
+}
+
+void RadioCoex::reset() {
+    for (int i = 0; i < COEX_ACTIVITY_COUNT; i++) {
+        levelActive[i] = false;
+        lastNoteMs[i] = 0;
+        noted[i] = false;
+    }
+    wifiLinkUp = false;
+    scanDutyPct = COEX_DEFAULT_SCAN_DUTY_PCT;
+    scanWaiting = false;
+    preference = CoexPreference::BALANCE;
+    lastUpdateMs = millis();
+    lastStatsLogMs = lastUpdateMs;
+    memset(&stats, 0, sizeof(stats));
+    for (auto& histogram : ledLatency) {
+        histogram.reset();
+    }
+}
+
+void RadioCoex::loop() {
+    update();
+
+    if (millis() - lastStatsLogMs >= COEX_STATS_LOG_INTERVAL_MS) {
+        lastStatsLogMs = millis();
+        logStats();
+    }
+}
+
+void RadioCoex::beginActivity(CoexActivity activity) {
+    update();
+    levelActive[(int)activity] = true;
+    update();
+}
+
+void RadioCoex::endActivity(CoexActivity activity) {
+    update();
+    levelActive[(int)activity] = false;
+    update();
+}
+
+void RadioCoex::noteActivity(CoexActivity activity) {
+    update();
+    lastNoteMs[(int)activity] = millis();
+    noted[(int)activity] = true;
+    update();
+}
+
+bool RadioCoex::isActive(CoexActivity activity) const {
+    int index = (int)activity;
+    if (levelActive[index]) {
+        return true;
+    }
+    return noted[index] && millis() - lastNoteMs[index] < TRANSFER_HOLD_MS[index];
+}
+
+void RadioCoex::setWifiLinkUp(bool up) {
+    wifiLinkUp = up;
+}
+
+bool RadioCoex::mayScan() const {
+    // A scan window during a handshake can push TLS past its timeout, and
+    // one during a transfer shows up directly as LED latency
+    return !isActive(CoexActivity::WIFI_HANDSHAKE) && !isActive(CoexActivity::WIFI_TRANSFER) &&
+           !isActive(CoexActivity::BLE_TRANSFER);
+}
+
+bool RadioCoex::requestScan() {
+    if (mayScan()) {
+        scanWaiting = false;
+        return true;
+    }
+    if (!scanWaiting) {
+        scanWaiting = true;
+        stats.scansDeferred++;
+    }
+    return false;
+}
+
+uint16_t RadioCoex::getScanWindow(uint16_t intervalMs) const {
+    if (intervalMs < 2) {
+        return intervalMs;
+    }
+    uint32_t window = wifiLinkUp ? (uint32_t)intervalMs * scanDutyPct / 100 : (uint32_t)intervalMs - 1;
+    if (window < 1) {
+        window = 1;
+    }
+    if (window > (uint32_t)intervalMs - 1) {
+        window = intervalMs - 1;
+    }
+    return (uint16_t)window;
+}
+
+void RadioCoex::setScanDutyBudget(uint8_t percent) {
+    scanDutyPct = constrain(percent, 1, 99);
+}
+
+uint8_t RadioCoex::getScanDutyBudget() const {
+    return scanDutyPct;
+}
+
+void RadioCoex::recordLedUpdateLatency(uint32_t latencyMs) {
+    ledLatency[(int)preference].record(latencyMs);
+}
+
+uint32_t RadioCoex::getLedLatencyP99(CoexPreference pref) const {
+    return ledLatency[(int)pref].percentile(99);
+}
+
+const CoexLatencyHistogram& RadioCoex::getLedLatencyHistogram(CoexPreference pref) const {
+    return ledLatency[(int)pref];
+}
+
+CoexPreference RadioCoex::getPreference() const {
+    return preference;
+}
+
+CoexStats RadioCoex::getStats() const {
+    CoexStats snapshot = stats;
+    snapshot.preference = preference;
+
+    // Include the time since the last update without mutating state
+    unsigned long pending = millis() - lastUpdateMs;
+    for (int i = 0; i < COEX_ACTIVITY_COUNT; i++) {
+        if (isActive((CoexActivity)i)) {
+            snapshot.activityMs[i] += pending;
+        }
+    }
+    snapshot.preferenceMs[(int)preference] += pending;
+    return snapshot;
+}
+
+const char* RadioCoex::getPreferenceName(CoexPreference preference) {
+    return PREFERENCE_NAMES[(int)preference];
+}
+
+void RadioCoex::update() {
+    unsigned long now = millis();
+    unsigned long elapsed = now - lastUpdateMs;
+    lastUpdateMs = now;
+
+    for (int i = 0; i < COEX_ACTIVITY_COUNT; i++) {
+        if (isActive((CoexActivity)i)) {
+            stats.activityMs[i] += elapsed;
+        }
+    }
+    stats.preferenceMs[(int)preference] += elapsed;
+
+    CoexPreference next = choosePreference();
+    if (next != preference) {
+        preference = next;
+        stats.preferenceSwitches++;
+        applyPreference(next);
+    }
+}
+
+CoexPreference RadioCoex::choosePreference() const {
+    // Handshakes first: a stalled TLS setup costs a full reconnect cycle
+    if (isActive(CoexActivity::WIFI_HANDSHAKE)) {
+        return CoexPreference::PREFER_WIFI;
+    }
+    // LED writes to the board are the latency-critical path; the WebSocket
+    // frame that triggered them has already been received
+    if (isActive(CoexActivity::BLE_TRANSFER)) {
+        return CoexPreference::PREFER_BT;
+    }
+    if (isActive(CoexActivity::WIFI_TRANSFER)) {
+        return CoexPreference::PREFER_WIFI;
+    }
+    return CoexPreference::BALANCE;
+}
+
+void RadioCoex::applyPreference(CoexPreference pref) {
+#if defined(ESP_PLATFORM) && !defined(UNIT_TEST)
+    static const esp_coex_prefer_t ESP_PREFERENCES[COEX_PREFERENCE_COUNT] = {
+        ESP_COEX_PREFER_BALANCE, ESP_COEX_PREFER_WIFI, ESP_COEX_PREFER_BT};
+    esp_coex_preference_set(ESP_PREFERENCES[(int)pref]);
+#else
+    (void)pref;
+#endif
+}
+
+void RadioCoex::logStats() {
+    CoexStats snapshot = getStats();
+    Logger.logln("Coex: pref=%s switches=%u deferred=%u wifi=%lums/%lums ble=%lums scan=%lums",
+                 PREFERENCE_NAMES[(int)snapshot.preference], snapshot.preferenceSwitches, snapshot.scansDeferred,
+                 snapshot.activityMs[(int)CoexActivity::WIFI_HANDSHAKE],
+                 snapshot.activityMs[(int)CoexActivity::WIFI_TRANSFER],
+                 snapshot.activityMs[(int)CoexActivity::BLE_TRANSFER], snapshot.activityMs[(int)CoexActivity::BLE_SCAN]);
+    for (int i = 0; i < COEX_PREFERENCE_COUNT; i++) {
+        if (ledLatency[i].count > 0) {
+            Logger.logln("Coex: LED latency [%s] n=%u p99=%ums max=%ums", PREFERENCE_NAMES[i], ledLatency[i].count,
+                         ledLatency[i].percentile(99), ledLatency[i].maxMs);
+        }
+    }
+}
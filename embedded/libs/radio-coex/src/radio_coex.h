@@ -0,0 +1,189 @@
+#ifndef RADIO_COEX_H
+#define RADIO_COEX_H
+
+#include <Arduino.h>
+
+// How long a burst (single WebSocket frame / BLE write) keeps its activity
+// marked as busy. Chunked transfers renew this on every frame.
+#define COEX_WIFI_TRANSFER_HOLD_MS 250
+#define COEX_BLE_TRANSFER_HOLD_MS 300
+
+// Share of each scan interval the BLE scanner may occupy while the backend
+// WebSocket is up. Without a WiFi link the scanner gets the full window.
+#define COEX_DEFAULT_SCAN_DUTY_PCT 50
+
+// Log a stats summary at this interval from loop()
+#define COEX_STATS_LOG_INTERVAL_MS 60000
+
+// Upper bounds (ms) of the LED-update latency histogram buckets; the last
+// bucket catches everything slower
+#define COEX_LATENCY_BUCKETS 12
+
+/**
+ * Radio activities that compete for the shared 2.4 GHz front end.
+ */
+enum class CoexActivity : uint8_t {
+    WIFI_HANDSHAKE = 0,  // TLS / WebSocket upgrade in progress (level)
+    WIFI_TRANSFER,       // WebSocket frame sent or received (burst)
+    BLE_TRANSFER,        // Write forwarded to the board (burst)
+    BLE_SCAN,            // Discovery or passive scan running (level)
+    COUNT
+};
+
+/**
+ * Coexistence preference handed to the ESP-IDF coex arbiter.
+ */
+enum class CoexPreference : uint8_t { BALANCE = 0, PREFER_WIFI, PREFER_BT, COUNT };
+
+#define COEX_ACTIVITY_COUNT ((int)CoexActivity::COUNT)
+#define COEX_PREFERENCE_COUNT ((int)CoexPreference::COUNT)
+
+/**
+ * Fixed-bucket latency histogram. Percentiles resolve to the upper bound of
+ * the bucket holding the requested rank, which is coarse but allocation free.
+ */
+struct CoexLatencyHistogram {
+    uint32_t buckets[COEX_LATENCY_BUCKETS];
+    uint32_t count;
+    uint32_t maxMs;
+
+    CoexLatencyHistogram() { reset(); }
+
+    void reset();
+    void record(uint32_t latencyMs);
+
+    /**
+     * Latency (ms) at or below which `percent` of samples fall.
+     * @return 0 if no samples, maxMs for the overflow bucket
+     */
+    uint32_t percentile(uint8_t percent) const;
+
+    static uint32_t bucketLimit(int index);
+};
+
+/**
+ * Airtime and scheduling statistics.
+ */
+struct CoexStats {
+    CoexPreference preference;
+    uint32_t preferenceSwitches;
+    uint32_t scansDeferred;  // Scan attempts that had to wait (once per attempt)
+    unsigned long activityMs[COEX_ACTIVITY_COUNT];    // Time each activity was busy
+    unsigned long preferenceMs[COEX_PREFERENCE_COUNT];  // Time spent in each preference
+};
+
+/**
+ * RadioCoex arbitrates the single 2.4 GHz radio between the backend
+ * WebSocket and the BLE proxy.
+ *
+ * Clients report what they are doing (begin/end for long-running work,
+ * note for bursts) and consult it before starting optional work:
+ *  - BLE scans are deferred while a WiFi handshake or any transfer is busy,
+ *    and discovery scans are held to a duty budget while WiFi is linked.
+ *  - The ESP coex preference follows the busiest activity: WiFi during
+ *    handshakes and WebSocket traffic, BT while LED writes reach the board,
+ *    balanced otherwise.
+ *
+ * LED-update latency (WebSocket receive to board write) is recorded per
+ * preference so the effect of the airtime split shows up as p99 numbers.
+ *
+ * All timing comes from millis() and nothing blocks, so the scheduler runs
+ * unchanged in native tests. Not thread-safe: call from the loop task only.
+ */
+class RadioCoex {
+  public:
+    RadioCoex();
+
+    /**
+     * Re-evaluate the preference and accumulate airtime. Call from loop().
+     */
+    void loop();
+
+    /**
+     * Mark a long-running activity as started/finished.
+     */
+    void beginActivity(CoexActivity activity);
+    void endActivity(CoexActivity activity);
+
+    /**
+     * Mark a burst; the activity stays busy for its hold window.
+     */
+    void noteActivity(CoexActivity activity);
+
+    /**
+     * Check whether an activity is currently busy.
+     */
+    bool isActive(CoexActivity activity) const;
+
+    /**
+     * Tell the scheduler whether the backend WebSocket link is up.
+     */
+    void setWifiLinkUp(bool up);
+
+    /**
+     * Check whether a BLE scan may start now, without side effects.
+     */
+    bool mayScan() const;
+
+    /**
+     * Like mayScan(), but counts a deferral when the answer is no. Use at
+     * the point where a scan would otherwise be started; asking again on
+     * later passes does not count again until a scan is allowed.
+     */
+    bool requestScan();
+
+    /**
+     * Scan window (ms) allowed for the given scan interval under the
+     * current duty budget. Always at least 1 ms and at most interval - 1.
+     */
+    uint16_t getScanWindow(uint16_t intervalMs) const;
+
+    /**
+     * Set the scan duty budget (percent of each interval, 1..99).
+     */
+    void setScanDutyBudget(uint8_t percent);
+    uint8_t getScanDutyBudget() const;
+
+    /**
+     * Record the latency of one LED update under the current preference.
+     */
+    void recordLedUpdateLatency(uint32_t latencyMs);
+
+    /**
+     * p99 LED-update latency (ms) observed while in the given preference.
+     */
+    uint32_t getLedLatencyP99(CoexPreference preference) const;
+    const CoexLatencyHistogram& getLedLatencyHistogram(CoexPreference preference) const;
+
+    CoexPreference getPreference() const;
+    CoexStats getStats() const;
+    static const char* getPreferenceName(CoexPreference preference);
+
+    /**
+     * Clear statistics and activity state.
+     */
+    void reset();
+
+  private:
+    bool levelActive[COEX_ACTIVITY_COUNT];
+    unsigned long lastNoteMs[COEX_ACTIVITY_COUNT];
+    bool noted[COEX_ACTIVITY_COUNT];
+    bool wifiLinkUp;
+    uint8_t scanDutyPct;
+    bool scanWaiting;  // The current scan attempt was already counted as deferred
+
+    CoexPreference preference;
+    unsigned long lastUpdateMs;
+    unsigned long lastStatsLogMs;
+    CoexStats stats;
+    CoexLatencyHistogram ledLatency[COEX_PREFERENCE_COUNT];
+
+    void update();
+    CoexPreference choosePreference() const;
+    void applyPreference(CoexPreference pref);
+    void logStats();
+};
+
+extern RadioCoex Coex;
+
+#endif
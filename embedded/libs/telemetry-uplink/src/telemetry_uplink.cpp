@@ -0,0 +1,381 @@
+#include "telemetry_uplink.h"
+
+#include <config_manager.h>
+#include <ctype.h>
+#include <stdarg.h>
+
+#if defined(ESP_PLATFORM) && !defined(UNIT_TEST)
+#include <time.h>
+
+static uint32_t systemClock() {
+    // time() counts from 1970 until SNTP sets the clock
+    time_t now = time(nullptr);
+    return now > 1600000000 ? (uint32_t)now : 0;
+}
+#else
+static uint32_t systemClock() {
+    return 0;
+}
+#endif
+
+TelemetryUplink Telemetry;
+
+const char* TelemetryUplink::KEY_ENABLED = "tlm_on";
+const char* TelemetryUplink::KEY_LEVEL = "tlm_level";
+
+static const char* const LEVEL_NAMES[] = {"debug", "info", "warn", "error"};
+
+static const char PREFIX[] = "{\"input\":{\"logs\":[";
+static const char SUFFIX[] = "]}}";
+
+// Component names taken from a message prefix are at most this long
+#define TELEMETRY_COMPONENT_SIZE 24
+
+// =============================================================================
+// Formatting helpers
+// =============================================================================
+
+static bool appendf(char* out, size_t capacity, size_t& pos, const char* format, ...) {
+    if (pos >= capacity) {
+        return false;
+    }
+    va_list args;
+    va_start(args, format);
+    int written = vsnprintf(out + pos, capacity - pos, format, args);
+    va_end(args);
+    if (written < 0 || (size_t)written >= capacity - pos) {
+        return false;
+    }
+    pos += written;
+    return true;
+}
+
+/**
+ * Append `str` as the body of a JSON string.
+ */
+static bool appendEscaped(char* out, size_t capacity, size_t& pos, const char* str) {
+    for (const char* c = str; *c; c++) {
+        char escaped[8];
+        const char* piece = escaped;
+        size_t len = 2;
+        switch (*c) {
+            case '"':
+                piece = "\\\"";
+                break;
+            case '\\':
+                piece = "\\\\";
+                break;
+            case '\n':
+                piece = "\\n";
+                break;
+            case '\r':
+                piece = "\\r";
+                break;
+            case '\t':
+                piece = "\\t";
+                break;
+            default:
+                if ((unsigned char)*c < 0x20) {
+                    len = snprintf(escaped, sizeof(escaped), "\\u%04x", (unsigned)(unsigned char)*c);
+                } else {
+                    escaped[0] = *c;
+                    len = 1;
+                }
+                break;
+        }
+        if (pos + len >= capacity) {
+            return false;
+        }
+        memcpy(out + pos, piece, len);
+        pos += len;
+    }
+    out[pos] = '\0';
+    return true;
+}
+
+/**
+ * Split "GraphQL: Connected" or "[Aurora] Frame" into a lower-case
+ * component and the rest of the message. Other messages belong to
+ * "firmware".
+ * @return Start of the message after the prefix
+ */
+static const char* splitComponent(const char* message, char* component) {
+    const char* start = message[0] == '[' ? message + 1 : message;
+    char close = message[0] == '[' ? ']' : ':';
+    size_t len = 0;
+    while (len < TELEMETRY_COMPONENT_SIZE - 1 &&
+           (isalnum((unsigned char)start[len]) || start[len] == '-' || start[len] == '_')) {
+        len++;
+    }
+    if (len > 0 && start[len] == close && start[len + 1] == ' ') {
+        for (size_t i = 0; i < len; i++) {
+            component[i] = tolower((unsigned char)start[i]);
+        }
+        component[len] = '\0';
+        return start + len + 2;
+    }
+    strcpy(component, "firmware");
+    return message;
+}
+
+// =============================================================================
+// TelemetryUplink
+// =============================================================================
+
+TelemetryUplink::TelemetryUplink()
+    : head(0), count(0), nextSeq(1), enabled(true), minLevel(LogLevel::INFO), clock(systemClock),
+      metricsProvider(nullptr), tokens(TELEMETRY_BURST_BYTES), tokensAtMs(0), lastSendMs(0), lastActivityMs(0),
+      lastSnapshotMs(0), sentSnapshot(false), inFlightThroughSeq(0), inFlightCount(0), inFlightLines(0),
+      inFlightSnapshot(false), retryWait(false), failedAtMs(0), stats() {
+    memset(lines, 0, sizeof(lines));
+}
+
+static void telemetryLogSink(uint32_t timestampMs, LogLevel level, const char* message) {
+    Telemetry.addLog(timestampMs, level, message);
+}
+
+void TelemetryUplink::begin() {
+    setEnabled(Config.getBool(KEY_ENABLED, true));
+    int32_t level = Config.getInt(KEY_LEVEL, LOG_LEVEL_INFO);
+    if (level >= LOG_LEVEL_DEBUG && level <= LOG_LEVEL_ERROR) {
+        setMinLevel((LogLevel)level);
+    }
+    tokensAtMs = millis();
+    Logger.setSink(telemetryLogSink);
+}
+
+void TelemetryUplink::setEnabled(bool enable) {
+    enabled = enable;
+    if (!enabled) {
+        // A batch in flight still completes, but its lines are not resent
+        head = 0;
+        count = 0;
+        inFlightLines = 0;
+    }
+}
+
+void TelemetryUplink::setClock(TelemetryClock uplinkClock) {
+    clock = uplinkClock ? uplinkClock : systemClock;
+}
+
+const TelemetryUplink::Line& TelemetryUplink::lineAt(int index) const {
+    int oldest = (head - count + TELEMETRY_QUEUE_SIZE) % TELEMETRY_QUEUE_SIZE;
+    return lines[(oldest + index) % TELEMETRY_QUEUE_SIZE];
+}
+
+void TelemetryUplink::addLog(uint32_t timestampMs, LogLevel level, const char* message) {
+    if (!enabled || (int)level < (int)minLevel || !message || !message[0]) {
+        return;
+    }
+
+    // Fold a repeat of the newest line, unless that line is already on its way
+    if (count > 0) {
+        Line& newest = lines[(head - 1 + TELEMETRY_QUEUE_SIZE) % TELEMETRY_QUEUE_SIZE];
+        if (newest.seq > inFlightThroughSeq && newest.level == level && newest.repeat < 0xFFFF &&
+            strncmp(newest.message, message, TELEMETRY_MESSAGE_SIZE - 1) == 0) {
+            newest.repeat++;
+            newest.lastTimestampMs = timestampMs;
+            stats.linesCollapsed++;
+            return;
+        }
+    }
+
+    if (count == TELEMETRY_QUEUE_SIZE) {
+        // Drop the oldest. A line in flight has been sent already; it is only
+        // lost if that batch fails.
+        if (lineAt(0).seq > inFlightThroughSeq) {
+            stats.linesDropped++;
+        }
+        count--;
+    }
+
+    Line& line = lines[head];
+    line.seq = nextSeq++;
+    line.timestampMs = timestampMs;
+    line.lastTimestampMs = timestampMs;
+    line.repeat = 1;
+    line.level = level;
+    strncpy(line.message, message, TELEMETRY_MESSAGE_SIZE - 1);
+    line.message[TELEMETRY_MESSAGE_SIZE - 1] = '\0';
+    head = (head + 1) % TELEMETRY_QUEUE_SIZE;
+    count++;
+    stats.linesQueued++;
+}
+
+void TelemetryUplink::linkActivity() {
+    lastActivityMs = millis();
+}
+
+int32_t TelemetryUplink::availableTokens(unsigned long now) const {
+    unsigned long elapsed = now - tokensAtMs;
+    unsigned long fillMs = (unsigned long)TELEMETRY_BURST_BYTES * 1000 / TELEMETRY_RATE_BYTES_PER_S;
+    if (elapsed > fillMs) {
+        elapsed = fillMs;
+    }
+    int32_t available = tokens + (int32_t)(elapsed * TELEMETRY_RATE_BYTES_PER_S / 1000);
+    return available > TELEMETRY_BURST_BYTES ? TELEMETRY_BURST_BYTES : available;
+}
+
+bool TelemetryUplink::isSnapshotDue(unsigned long now) const {
+    return metricsProvider && (!sentSnapshot || now - lastSnapshotMs >= TELEMETRY_METRICS_INTERVAL_MS);
+}
+
+bool TelemetryUplink::hasErrorQueued() const {
+    for (int i = 0; i < count; i++) {
+        if (lineAt(i).level == LogLevel::ERROR) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool TelemetryUplink::isUploadDue() const {
+    if (!enabled || isUploadInFlight() || clock() == 0) {
+        return false;
+    }
+    unsigned long now = millis();
+    if (retryWait && now - failedAtMs < TELEMETRY_RETRY_MS) {
+        return false;
+    }
+    if (now - lastSendMs < TELEMETRY_MIN_INTERVAL_MS || now - lastActivityMs < TELEMETRY_QUIET_MS) {
+        return false;
+    }
+    if (availableTokens(now) < TELEMETRY_MIN_BATCH_BYTES) {
+        return false;
+    }
+
+    bool snapshotDue = isSnapshotDue(now);
+    if (count == 0) {
+        return snapshotDue;
+    }
+    return snapshotDue || retryWait || count >= TELEMETRY_BATCH_SIZE ||
+           (uint32_t)now - lineAt(0).timestampMs >= TELEMETRY_FLUSH_MS || hasErrorQueued();
+}
+
+size_t TelemetryUplink::formatLine(char* out, size_t capacity, const Line& line, uint32_t offset, bool first) {
+    char component[TELEMETRY_COMPONENT_SIZE];
+    const char* message = splitComponent(line.message, component);
+    uint64_t ts = (uint64_t)offset * 1000 + line.timestampMs;
+
+    size_t pos = 0;
+    bool ok = appendf(out, capacity, pos, "%s{\"ts\":%llu,\"level\":\"%s\",\"component\":\"%s\",\"message\":\"",
+                      first ? "" : ",", (unsigned long long)ts, LEVEL_NAMES[(int)line.level & 3], component);
+    ok = ok && appendEscaped(out, capacity, pos, message);
+    ok = ok && appendf(out, capacity, pos, "\",\"metadata\":\"{\\\"uptime_ms\\\":%u", (unsigned)line.timestampMs);
+    if (line.repeat > 1) {
+        // Identical lines in a row go up as one
+        ok = ok && appendf(out, capacity, pos, ",\\\"repeat\\\":%u,\\\"last_uptime_ms\\\":%u", (unsigned)line.repeat,
+                           (unsigned)line.lastTimestampMs);
+    }
+    ok = ok && appendf(out, capacity, pos, "}\"}");
+    return ok ? pos : 0;
+}
+
+size_t TelemetryUplink::formatSnapshot(char* out, size_t capacity, uint32_t now, bool first) {
+    char snapshot[TELEMETRY_METRICS_SIZE];
+    size_t len = metricsProvider(snapshot, sizeof(snapshot));
+    if (len == 0 || len >= sizeof(snapshot)) {
+        return 0;
+    }
+    snapshot[len] = '\0';
+
+    size_t pos = 0;
+    bool ok = appendf(out, capacity, pos,
+                      "%s{\"ts\":%llu,\"level\":\"info\",\"component\":\"metrics\",\"message\":\"snapshot\","
+                      "\"metadata\":\"",
+                      first ? "" : ",", (unsigned long long)now * 1000);
+    ok = ok && appendEscaped(out, capacity, pos, snapshot);
+    ok = ok && appendf(out, capacity, pos, "\"}");
+    return ok ? pos : 0;
+}
+
+int TelemetryUplink::beginUpload(char* out, size_t capacity) {
+    uint32_t now = clock();
+    if (!enabled || isUploadInFlight() || now == 0) {
+        return 0;
+    }
+
+    // Stay within the byte budget
+    unsigned long nowMs = millis();
+    int32_t budget = availableTokens(nowMs);
+    if (budget > 0 && (size_t)budget < capacity) {
+        capacity = budget;
+    }
+    if (budget <= 0 || capacity < sizeof(PREFIX) + sizeof(SUFFIX)) {
+        return 0;
+    }
+
+    size_t pos = 0;
+    appendf(out, capacity, pos, "%s", PREFIX);
+    size_t entryCapacity = capacity - (sizeof(SUFFIX) - 1);
+    int entries = 0;
+
+    bool snapshot = false;
+    if (isSnapshotDue(nowMs)) {
+        size_t written = formatSnapshot(out + pos, entryCapacity - pos, now, true);
+        if (written > 0) {
+            pos += written;
+            entries++;
+            snapshot = true;
+        }
+        // A snapshot that did not fit is skipped until the next interval
+        sentSnapshot = true;
+        lastSnapshotMs = nowMs;
+    }
+
+    uint32_t offset = now - nowMs / 1000;
+    uint32_t through = 0;
+    int sent = 0;
+    for (int i = 0; i < count && entries < TELEMETRY_BATCH_SIZE; i++) {
+        const Line& line = lineAt(i);
+        size_t written = formatLine(out + pos, entryCapacity - pos, line, offset, entries == 0);
+        if (written == 0) {
+            break;
+        }
+        pos += written;
+        entries++;
+        sent++;
+        through = line.seq;
+    }
+
+    if (entries == 0) {
+        out[0] = '\0';
+        return 0;
+    }
+    appendf(out, capacity, pos, "%s", SUFFIX);
+
+    tokens = budget - (int32_t)pos;
+    tokensAtMs = nowMs;
+    lastSendMs = nowMs;
+    inFlightThroughSeq = through;
+    inFlightLines = sent;
+    inFlightCount = entries;
+    inFlightSnapshot = snapshot;
+    stats.bytesSent += pos;
+    return entries;
+}
+
+void TelemetryUplink::endUpload(bool delivered) {
+    if (!isUploadInFlight()) {
+        return;
+    }
+    if (delivered) {
+        // Lines pushed out while in flight are already gone
+        while (count > 0 && lineAt(0).seq <= inFlightThroughSeq) {
+            count--;
+        }
+        stats.linesSent += inFlightLines;
+        stats.snapshotsSent += inFlightSnapshot ? 1 : 0;
+        stats.batchesSent++;
+        retryWait = false;
+    } else {
+        // The snapshot is not resent; the next one replaces it
+        stats.batchFailures++;
+        retryWait = true;
+        failedAtMs = millis();
+    }
+    inFlightThroughSeq = 0;
+    inFlightCount = 0;
+    inFlightLines = 0;
+    inFlightSnapshot = false;
+}
@@ -0,0 +1,202 @@
+#ifndef TELEMETRY_UPLINK_H
+#define TELEMETRY_UPLINK_H
+
+#include <Arduino.h>
+#include <log_buffer.h>
+
+// Log lines waiting for upload; when full the oldest is dropped
+#define TELEMETRY_QUEUE_SIZE 32
+
+// Longer log lines are truncated (including terminator)
+#define TELEMETRY_MESSAGE_SIZE 96
+
+// Entries per batch, metrics snapshot included
+#define TELEMETRY_BATCH_SIZE 16
+
+// A partial batch is sent once its oldest line has waited this long
+#define TELEMETRY_FLUSH_MS 30000
+
+// Minimum gap between batches
+#define TELEMETRY_MIN_INTERVAL_MS 5000
+
+// No batch is started within this long of LED traffic on the link
+#define TELEMETRY_QUIET_MS 2000
+
+// Upload budget: sustained bytes per second, burst, and the smallest batch
+// worth starting
+#define TELEMETRY_RATE_BYTES_PER_S 200
+#define TELEMETRY_BURST_BYTES 4096
+#define TELEMETRY_MIN_BATCH_BYTES 512
+
+// Metrics snapshot period, and the largest snapshot
+#define TELEMETRY_METRICS_INTERVAL_MS 60000
+#define TELEMETRY_METRICS_SIZE 384
+
+// Wait this long after a failed batch before trying again
+#define TELEMETRY_RETRY_MS 30000
+
+/**
+ * Wall clock in Unix seconds, 0 while unknown.
+ */
+typedef uint32_t (*TelemetryClock)();
+
+/**
+ * Write a metrics snapshot as a JSON object into `out`.
+ * @return Length written, 0 to skip this snapshot
+ */
+typedef size_t (*TelemetryMetricsProvider)(char* out, size_t capacity);
+
+/**
+ * Uplink statistics since boot.
+ */
+struct TelemetryStats {
+    uint32_t linesQueued;
+    uint32_t linesCollapsed;  // Repeats folded into the previous line
+    uint32_t linesDropped;    // Pushed out of the queue before upload
+    uint32_t linesSent;
+    uint32_t snapshotsSent;
+    uint32_t batchesSent;
+    uint32_t batchFailures;
+    uint32_t bytesSent;
+};
+
+/**
+ * TelemetryUplink streams firmware logs and periodic metrics snapshots to
+ * the backend as sendDeviceLogs batches, for fleet visibility without a
+ * USB serial connection.
+ *
+ * begin() makes it the Logger sink, so it sees each message as the log
+ * task formats it. Lines at or above the configured level are queued with
+ * their capture time; a line that repeats the previous one is folded into
+ * it with a count. When the queue is full the oldest line is dropped and
+ * counted.
+ *
+ * Upload is pull-based and yields to everything else on the link:
+ * isUploadDue() only says yes when a batch is worth sending (full, old
+ * enough, an error is waiting, or a snapshot is due), the previous batch
+ * was at least TELEMETRY_MIN_INTERVAL_MS ago, there has been no LED
+ * traffic for TELEMETRY_QUIET_MS (see linkActivity()), and the byte budget
+ * allows. beginUpload() formats the batch within that budget and
+ * endUpload() records the outcome; undelivered lines are sent again after
+ * TELEMETRY_RETRY_MS unless newer lines push them out first.
+ *
+ * Not thread-safe: call from the loop task, which is also where the log
+ * task drains the Logger.
+ */
+class TelemetryUplink {
+  public:
+    TelemetryUplink();
+
+    /**
+     * Read settings from config and make the Logger feed the global
+     * Telemetry instance.
+     */
+    void begin();
+
+    /**
+     * Disabling drops queued lines and stops queueing new ones.
+     */
+    void setEnabled(bool enabled);
+    bool isEnabled() const { return enabled; }
+
+    /**
+     * Lines below this level are not uploaded (default INFO).
+     */
+    void setMinLevel(LogLevel level) { minLevel = level; }
+
+    void setMetricsProvider(TelemetryMetricsProvider provider) { metricsProvider = provider; }
+
+    /**
+     * Queue a log line (the Logger sink calls this).
+     */
+    void addLog(uint32_t timestampMs, LogLevel level, const char* message);
+
+    /**
+     * LED data just crossed the link; hold off uploads for a while.
+     */
+    void linkActivity();
+
+    /**
+     * True if a batch should be sent now. The caller also checks that the
+     * link is up and has no other operation pending.
+     */
+    bool isUploadDue() const;
+
+    /**
+     * Format a batch as {"input":{"logs":[...]}} for the sendDeviceLogs
+     * mutation, within `capacity` and the byte budget, and mark it in
+     * flight.
+     * @return Entries written, 0 if nothing is pending or nothing fits
+     */
+    int beginUpload(char* out, size_t capacity);
+
+    /**
+     * Record the outcome of the batch in flight.
+     */
+    void endUpload(bool delivered);
+
+    bool isUploadInFlight() const { return inFlightCount > 0; }
+
+    int getQueuedCount() const { return count; }
+
+    const TelemetryStats& getStats() const { return stats; }
+
+    /**
+     * Replace the wall clock (tests; default reads time() once it is set).
+     */
+    void setClock(TelemetryClock clock);
+
+    // Config keys
+    static const char* KEY_ENABLED;
+    static const char* KEY_LEVEL;
+
+  private:
+    struct Line {
+        uint32_t seq;
+        uint32_t timestampMs;
+        uint32_t lastTimestampMs;
+        uint16_t repeat;
+        LogLevel level;
+        char message[TELEMETRY_MESSAGE_SIZE];
+    };
+
+    Line lines[TELEMETRY_QUEUE_SIZE];
+    int head;  // Next slot to write
+    int count;
+    uint32_t nextSeq;
+
+    bool enabled;
+    LogLevel minLevel;
+    TelemetryClock clock;
+    TelemetryMetricsProvider metricsProvider;
+
+    // Byte budget (token bucket)
+    int32_t tokens;
+    unsigned long tokensAtMs;
+
+    unsigned long lastSendMs;
+    unsigned long lastActivityMs;
+    unsigned long lastSnapshotMs;
+    bool sentSnapshot;
+
+    // Batch in flight
+    uint32_t inFlightThroughSeq;
+    int inFlightCount;
+    int inFlightLines;
+    bool inFlightSnapshot;
+    bool retryWait;
+    unsigned long failedAtMs;
+
+    TelemetryStats stats;
+
+    const Line& lineAt(int index) const;
+    int32_t availableTokens(unsigned long now) const;
+    bool isSnapshotDue(unsigned long now) const;
+    bool hasErrorQueued() const;
+    size_t formatLine(char* out, size_t capacity, const Line& line, uint32_t offset, bool first);
+    size_t formatSnapshot(char* out, size_t capacity, uint32_t now, bool first);
+};
+
+extern TelemetryUplink Telemetry;
+
+#endif
@@ -8,6 +8,9 @@
      fires each time DMA finishes one bounce buffer. Refills it with the next
      chunk from the PSRAM framebuffer while DMA reads the other buffer.
 
+  With double buffering the VSYNC ISR is also the only place the scanout
+  framebuffer changes, so a frame is always read from a single buffer.
+
   Based on LovyanGFX Bus_RGB with identical LCD_CAM + GDMA register setup.
 /----------------------------------------------------------------------------*/
 #if defined(ESP_PLATFORM)
@@ -50,6 +53,11 @@
 
 #include <string.h>
 
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <xtensa/hal.h>
+
 static const char *TAG = "Bus_RGB_Bounce";
 
 namespace lgfx
@@ -123,23 +131,74 @@ namespace lgfx
       _cfg = cfg;
     }
 
+    // PSRAM -> SRAM copy for the refill ISR. Four word loads are issued before
+    // the four stores so each 16-byte step reads one run of the cache line
+    // being filled from PSRAM, and there is no per-call alignment prologue
+    // as in memcpy. Framebuffer rows and bounce buffers are word aligned;
+    // anything else falls back to memcpy.
+    static IRAM_ATTR void copyBounce(uint8_t *dst, const uint8_t *src, size_t len)
+    {
+      if ((((uintptr_t)dst | (uintptr_t)src | len) & 3) != 0)
+      {
+        memcpy(dst, src, len);
+        return;
+      }
+
+      uint32_t *d = (uint32_t *)dst;
+      const uint32_t *s = (const uint32_t *)src;
+      for (size_t n = len >> 4; n > 0; n--)
+      {
+        uint32_t a = s[0];
+        uint32_t b = s[1];
+        uint32_t c = s[2];
+        uint32_t e = s[3];
+        d[0] = a;
+        d[1] = b;
+        d[2] = c;
+        d[3] = e;
+        s += 4;
+        d += 4;
+      }
+      for (size_t n = (len & 15) >> 2; n > 0; n--)
+      {
+        *d++ = *s++;
+      }
+    }
+
     IRAM_ATTR void Bus_RGB_Bounce::fillBounceBuffer(int buf_idx)
     {
+      uint32_t start = xthal_get_ccount();
+
       size_t remaining = (_bounce_pos < _fb_size) ? (_fb_size - _bounce_pos) : 0;
       size_t copy_size = (remaining < _bounce_buf_size) ? remaining : _bounce_buf_size;
 
       if (copy_size > 0)
       {
-        memcpy(_bounce_buf[buf_idx], _frame_buffer + _bounce_pos, copy_size);
+        copyBounce(_bounce_buf[buf_idx], _scanout_buffer + _bounce_pos, copy_size);
       }
 
-      // Zero-pad if we're at the end of the framebuffer
+      // Zero-pad if we're at the end of the framebuffer (only when the line
+      // count does not divide the panel height)
       if (copy_size < _bounce_buf_size)
       {
         memset(_bounce_buf[buf_idx] + copy_size, 0, _bounce_buf_size - copy_size);
       }
 
       _bounce_pos += _bounce_buf_size;
+
+      uint32_t cycles = xthal_get_ccount() - start;
+      _stats.refills++;
+      _stats.total_cycles += cycles;
+      if (cycles > _stats.max_cycles)
+      {
+        _stats.max_cycles = cycles;
+      }
+    }
+
+    void Bus_RGB_Bounce::resetStats(void)
+    {
+      _stats = stats_t();
+      _stats.since_us = esp_timer_get_time();
     }
 
     // LCD_CAM VSYNC ISR: fires once per frame (60Hz).
@@ -155,6 +214,13 @@ namespace lgfx
 
       if (intr_status & LCD_LL_EVENT_VSYNC_END)
       {
+        // The previous frame's refills should all have run by now
+        me->_stats.frames++;
+        if (me->_bounce_pos < me->_fb_size)
+        {
+          me->_stats.late_frames++;
+        }
+
         // Clear any pending GDMA EOF events from the previous frame
         GDMA.channel[me->_dma_ch].out.int_clr.out_eof = 1;
 
@@ -163,7 +229,19 @@ namespace lgfx
         GDMA.channel[me->_dma_ch].out.conf0.val = me->_conf0_val | 4; // bit 2 = out_rst
         GDMA.channel[me->_dma_ch].out.conf0.val = me->_conf0_val;     // clear out_rst
 
-        // Reset to frame start
+        // Reset to frame start, switching to a presented back buffer if any
+        TaskHandle_t waiter = nullptr;
+        portENTER_CRITICAL_ISR(&me->_swap_lock);
+        uint8_t *pending = me->_pending_buffer;
+        if (pending)
+        {
+          me->_scanout_buffer = pending;
+          me->_pending_buffer = nullptr;
+          me->_swap_count = me->_swap_count + 1;
+          waiter = me->_present_task;
+          me->_present_task = nullptr;
+        }
+        portEXIT_CRITICAL_ISR(&me->_swap_lock);
         me->_bounce_pos = 0;
         me->_next_refill_buf = 0;
 
@@ -181,11 +259,22 @@ namespace lgfx
         link_val.addr = (uintptr_t)&me->_bounce_dma_desc[0][0];
         link_val.start = 1;
         GDMA.channel[me->_dma_ch].out.link.val = link_val.val;
+
+        // Wake present() once DMA is running from the new buffer
+        if (waiter)
+        {
+          BaseType_t woken = pdFALSE;
+          vTaskNotifyGiveFromISR(waiter, &woken);
+          if (woken)
+          {
+            portYIELD_FROM_ISR();
+          }
+        }
       }
     }
 
     // GDMA TX EOF callback: called by the GDMA driver's ISR each time DMA
-    // finishes consuming one bounce buffer (~48 times/frame, ~2880Hz at 60fps).
+    // finishes consuming one bounce buffer (height / bounce_lines times per frame: ~2880Hz at 10 lines and 60fps).
     // DMA has moved on to the other buffer, so we can safely refill this one.
     IRAM_ATTR bool Bus_RGB_Bounce::gdma_eof_callback(gdma_channel_handle_t dma_chan, gdma_event_data_t *event_data, void *user_data)
     {
@@ -200,6 +289,13 @@ namespace lgfx
       if (me->_bounce_pos < me->_fb_size)
       {
         me->fillBounceBuffer(buf_to_refill);
+
+        // The driver clears EOF before calling us, so a raised EOF here means
+        // DMA drained the other buffer while this one was still being filled
+        if (GDMA.channel[me->_dma_ch].out.int_raw.out_eof)
+        {
+          me->_stats.underruns++;
+        }
       }
 
       return false; // No higher-priority task woken
@@ -212,20 +308,44 @@ namespace lgfx
       uint16_t height = _cfg.panel->height();
 
       // Calculate sizes
-      _fb_size = (size_t)width * pixel_bytes * height;
-      _bounce_buf_size = (size_t)width * pixel_bytes * BOUNCE_LINES;
+      _pixel_bytes = pixel_bytes;
+      _line_bytes = (size_t)width * pixel_bytes;
+      _fb_size = _line_bytes * height;
+      _bounce_lines = std::max<uint16_t>(1, std::min<uint16_t>(_cfg.bounce_lines, height));
+      _bounce_buf_size = _line_bytes * _bounce_lines;
+      if (height % _bounce_lines)
+      {
+        ESP_LOGW(TAG, "%d bounce lines do not divide %d rows; last refill is padded", _bounce_lines, height);
+      }
 
       ESP_LOGI(TAG, "Init: %dx%d, %dbpp, fb=%u bytes, bounce=%u bytes (%d lines)",
-               width, height, pixel_bytes * 8, _fb_size, _bounce_buf_size, BOUNCE_LINES);
+               width, height, pixel_bytes * 8, _fb_size, _bounce_buf_size, _bounce_lines);
 
       // Allocate framebuffer in PSRAM (CPU draws here via LovyanGFX)
-      _frame_buffer = (uint8_t *)heap_alloc_psram(_fb_size);
-      if (!_frame_buffer)
+      _frame_buffer[0] = (uint8_t *)heap_alloc_psram(_fb_size);
+      if (!_frame_buffer[0])
       {
         ESP_LOGE(TAG, "Failed to allocate framebuffer in PSRAM (%u bytes)", _fb_size);
         return false;
       }
-      memset(_frame_buffer, 0, _fb_size);
+      memset(_frame_buffer[0], 0, _fb_size);
+
+      // Optional back buffer; without it drawing goes straight to the screen
+      if (_cfg.double_buffer)
+      {
+        _frame_buffer[1] = (uint8_t *)heap_alloc_psram(_fb_size);
+        if (_frame_buffer[1])
+        {
+          memset(_frame_buffer[1], 0, _fb_size);
+        }
+        else
+        {
+          ESP_LOGW(TAG, "No PSRAM for back buffer (%u bytes), single buffered", _fb_size);
+        }
+      }
+      _scanout_buffer = _frame_buffer[0];
+      _pending_buffer = nullptr;
+      _draw_buffer = _frame_buffer[1] ? _frame_buffer[1] : _frame_buffer[0];
 
       // Allocate two bounce buffers in internal DMA-capable SRAM
       for (int i = 0; i < 2; i++)
@@ -438,6 +558,7 @@ namespace lgfx
 
       // Pre-fill bounce buffers and start DMA
       // Done last, after all config, ISRs, and callbacks are registered.
+      resetStats();
       _bounce_pos = 0;
       _next_refill_buf = 0;
       fillBounceBuffer(0);
@@ -456,14 +577,94 @@ namespace lgfx
       dev->lcd_user.lcd_start = 1;
 
       ESP_LOGI(TAG, "Started with bounce buffers (%d lines x 2 = %u bytes SRAM, ISRs on LCD_CAM + GDMA ch%d)",
-               BOUNCE_LINES, _bounce_buf_size * 2, _dma_ch);
+               _bounce_lines, _bounce_buf_size * 2, _dma_ch);
 
       return true;
     }
 
     uint8_t *Bus_RGB_Bounce::getDMABuffer(uint32_t length)
     {
-      return _frame_buffer;
+      return _draw_buffer;
+    }
+
+    bool Bus_RGB_Bounce::present(const rect_t *rects, size_t count, uint32_t timeout_ms)
+    {
+      if (!isDoubleBuffered())
+      {
+        return true;
+      }
+
+      // Hand the finished frame to the VSYNC ISR and sleep until it swaps
+      uint8_t *presented = _draw_buffer;
+      TaskHandle_t self = xTaskGetCurrentTaskHandle();
+      portENTER_CRITICAL(&_swap_lock);
+      _pending_buffer = presented;
+      _present_task = self;
+      portEXIT_CRITICAL(&_swap_lock);
+
+      // The loop scheduler shares this task's notification; a wake that is
+      // not the swap is passed on once we are done
+      bool foreign_wake = false;
+      bool swapped = false;
+      TickType_t start = xTaskGetTickCount();
+      TickType_t timeout = pdMS_TO_TICKS(timeout_ms);
+      for (;;)
+      {
+        TickType_t elapsed = xTaskGetTickCount() - start;
+        uint32_t woken = elapsed < timeout ? ulTaskNotifyTake(pdTRUE, timeout - elapsed) : 0;
+
+        portENTER_CRITICAL(&_swap_lock);
+        swapped = _scanout_buffer == presented;
+        if (!swapped && woken == 0)
+        {
+          // Panel not running; withdraw the frame and keep drawing into it
+          _pending_buffer = nullptr;
+          _present_task = nullptr;
+        }
+        portEXIT_CRITICAL(&_swap_lock);
+
+        if (swapped || woken == 0)
+        {
+          break;
+        }
+        foreign_wake = true;
+      }
+      if (foreign_wake)
+      {
+        xTaskNotifyGive(self);
+      }
+      if (!swapped)
+      {
+        ESP_LOGW(TAG, "present: no VSYNC within %u ms", timeout_ms);
+        return false;
+      }
+
+      // The old front buffer is one frame behind; bring the regions drawn in
+      // the presented frame forward instead of copying all 768 KB
+      uint8_t *back = (presented == _frame_buffer[0]) ? _frame_buffer[1] : _frame_buffer[0];
+      size_t copied = 0;
+      if (!rects)
+      {
+        memcpy(back, presented, _fb_size);
+        copied = _fb_size;
+      }
+      else
+      {
+        for (size_t i = 0; i < count; i++)
+        {
+          size_t offset = rects[i].y * _line_bytes + rects[i].x * _pixel_bytes;
+          size_t len = rects[i].w * _pixel_bytes;
+          for (uint16_t row = 0; row < rects[i].h; row++)
+          {
+            memcpy(back + offset, presented + offset, len);
+            offset += _line_bytes;
+          }
+          copied += len * rects[i].h;
+        }
+      }
+      _copy_forward_bytes = copied;
+      _draw_buffer = back;
+      return true;
     }
 
     void Bus_RGB_Bounce::release(void)
@@ -504,11 +705,18 @@ namespace lgfx
           _bounce_buf[i] = nullptr;
         }
       }
-      if (_frame_buffer)
+      for (int i = 0; i < 2; i++)
       {
-        heap_caps_free(_frame_buffer);
-        _frame_buffer = nullptr;
+        if (_frame_buffer[i])
+        {
+          heap_caps_free(_frame_buffer[i]);
+          _frame_buffer[i] = nullptr;
+        }
       }
+      _draw_buffer = nullptr;
+      _scanout_buffer = nullptr;
+      _pending_buffer = nullptr;
+      _present_task = nullptr;
     }
 
   }
@@ -13,6 +13,12 @@
   1. LCD_CAM VSYNC ISR: resets position, fills initial buffers, restarts DMA
   2. GDMA TX EOF ISR: refills the just-consumed bounce buffer with next chunk
 
+  Optional double buffering (config_t::double_buffer): a second PSRAM
+  framebuffer is allocated, the CPU draws into the back buffer and present()
+  asks the VSYNC ISR to scan out from it starting with the next frame. The
+  dirty rects of the presented frame are then copied forward into the new back
+  buffer so it matches the screen without copying the whole frame.
+
   Works with ESP-IDF 4.4 (no esp_lcd bounce buffer API needed).
   Uses the same low-level LCD_CAM + GDMA registers as LovyanGFX's Bus_RGB.
 /----------------------------------------------------------------------------*/
@@ -29,6 +35,9 @@
 #include <lgfx/v1/panel/Panel_FrameBufferBase.hpp>
 #include <lgfx/v1/platforms/common.hpp>
 
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
 struct lcd_cam_dev_t;
 
 namespace lgfx
@@ -87,6 +96,34 @@ namespace lgfx
         bool pclk_active_neg = 1;
         bool de_idle_high = 0;
         bool pclk_idle_high = 0;
+
+        // Allocate a second PSRAM framebuffer and swap on VSYNC in present()
+        bool double_buffer = false;
+
+        // Scanlines per bounce buffer. More lines mean fewer refill ISRs and
+        // more slack per refill, at 2 x lines x width x 2 bytes of SRAM.
+        uint16_t bounce_lines = 10;
+      };
+
+      // Refill ISR instrumentation (CPU cycles, since init or resetStats)
+      struct stats_t
+      {
+        uint32_t refills = 0;
+        uint64_t total_cycles = 0;
+        uint32_t max_cycles = 0;
+        uint32_t underruns = 0;       // DMA finished the other buffer before a refill completed
+        uint32_t late_frames = 0;     // VSYNC arrived before the frame was fully copied
+        uint32_t frames = 0;
+        int64_t since_us = 0;         // esp_timer time of the last reset
+      };
+
+      // Region in panel-native pixel coordinates
+      struct rect_t
+      {
+        uint16_t x;
+        uint16_t y;
+        uint16_t w;
+        uint16_t h;
       };
 
       const config_t &config(void) const { return _cfg; }
@@ -114,6 +151,27 @@ namespace lgfx
       void execDMAQueue(void) override {}
       uint8_t *getDMABuffer(uint32_t length) override;
 
+      // Framebuffer the CPU draws into (the back buffer when double buffered)
+      uint8_t *getDrawBuffer(void) const { return _draw_buffer; }
+      bool isDoubleBuffered(void) const { return _frame_buffer[1] != nullptr; }
+
+      /**
+       * Show the finished back buffer from the next VSYNC and return the other
+       * buffer (now the back buffer) after copying the given dirty rects
+       * forward into it. rects == nullptr copies the whole frame. Blocks on a
+       * task notification from the VSYNC ISR, up to timeout_ms. No-op when
+       * single buffered.
+       * @return true if the swap happened
+       */
+      bool present(const rect_t *rects, size_t count, uint32_t timeout_ms = 50);
+
+      uint32_t getSwapCount(void) const { return _swap_count; }
+
+      const stats_t &getStats(void) const { return _stats; }
+      void resetStats(void);
+      uint16_t getBounceLines(void) const { return _bounce_lines; }
+      uint32_t getLastCopyForwardBytes(void) const { return _copy_forward_bytes; }
+
       void beginRead(void) override {}
       void endRead(void) override {}
       uint32_t readData(uint_fast8_t bit_length) override { return 0; }
@@ -123,13 +181,29 @@ namespace lgfx
     private:
       config_t _cfg;
 
-      // Framebuffer in PSRAM (CPU draws here)
-      uint8_t *_frame_buffer = nullptr;
+      // Framebuffers in PSRAM; [1] only when double buffered
+      uint8_t *_frame_buffer[2] = {nullptr, nullptr};
       size_t _fb_size = 0;
+      size_t _line_bytes = 0;
+      uint8_t _pixel_bytes = 0;
+
+      // CPU draws into _draw_buffer; the ISRs read _scanout_buffer. The VSYNC
+      // ISR moves _pending_buffer into _scanout_buffer at frame start.
+      uint8_t *_draw_buffer = nullptr;
+      uint8_t *volatile _scanout_buffer = nullptr;
+      uint8_t *volatile _pending_buffer = nullptr;
+      volatile uint32_t _swap_count = 0;
+
+      // Guards _pending_buffer/_scanout_buffer/_present_task between
+      // present() and the VSYNC ISR. _present_task is the task blocked in
+      // present(); the ISR notifies it after the swap.
+      portMUX_TYPE _swap_lock = portMUX_INITIALIZER_UNLOCKED;
+      TaskHandle_t volatile _present_task = nullptr;
+      uint32_t _copy_forward_bytes = 0;
 
       // Two bounce buffers in internal SRAM (DMA reads from here)
-      // Each holds BOUNCE_LINES scanlines worth of pixel data
-      static constexpr int BOUNCE_LINES = 10;
+      // Each holds config_t::bounce_lines scanlines worth of pixel data
+      uint16_t _bounce_lines = 0;
       uint8_t *_bounce_buf[2] = {nullptr, nullptr};
       size_t _bounce_buf_size = 0; // bytes per bounce buffer
 
@@ -156,6 +230,8 @@ namespace lgfx
 
       // Fill a bounce buffer with the next chunk from the PSRAM framebuffer
       void IRAM_ATTR fillBounceBuffer(int buf_idx);
+
+      stats_t _stats;
     };
 
   }
@@ -2,6 +2,7 @@
 
 #include <config_manager.h>
 #include <grade_colors.h>
+#include <qr_raster.h>
 
 #include <qrcode.h>
 
@@ -74,6 +75,9 @@ LGFX_Waveshare7::LGFX_Waveshare7() {
         cfg.de_idle_high      = 0;
         cfg.pclk_idle_high    = 0;
 
+        cfg.double_buffer = WS_DOUBLE_BUFFER;
+        cfg.bounce_lines = WS_BOUNCE_LINES;
+
         _bus_instance.config(cfg);
     }
 
@@ -104,19 +108,73 @@ LGFX_Waveshare7::LGFX_Waveshare7() {
     setPanel(&_panel_instance);
 }
 
+void Panel_RGB_Swap::setDrawBuffer(uint8_t* buffer) {
+    uint8_t* base = _lines_buffer[0];
+    if (!buffer || buffer == base) return;
+    for (uint32_t y = 0; y < _cfg.memory_height; y++) {
+        _lines_buffer[y] = buffer + (_lines_buffer[y] - base);
+    }
+}
+
+void Panel_RGB_Swap::toNativeRect(int32_t& x, int32_t& y, int32_t& w, int32_t& h) const {
+    // Same transform Panel_FrameBufferBase applies when drawing
+    uint_fast8_t r = _internal_rotation;
+    if (r) {
+        if ((1u << r) & 0b10010110) { y = _height - (y + h); }
+        if (r & 2)                  { x = _width  - (x + w); }
+        if (r & 1) { std::swap(x, y); std::swap(w, h); }
+    }
+}
+
+void LGFX_Waveshare7::setBounceLines(uint16_t lines) {
+    auto cfg = _bus_instance.config();
+    cfg.bounce_lines = constrain(lines, 1, WS_BOUNCE_LINES_MAX);
+    _bus_instance.config(cfg);
+}
+
+bool LGFX_Waveshare7::present(const WidgetRect* rects, int count) {
+    if (!_bus_instance.isDoubleBuffered()) return true;
+
+    lgfx::Bus_RGB_Bounce::rect_t native[WS_MAX_DIRTY_RECTS];
+    int nativeCount = 0;
+    for (int i = 0; rects && i < count && i < WS_MAX_DIRTY_RECTS; i++) {
+        int32_t x = rects[i].x, y = rects[i].y, w = rects[i].w, h = rects[i].h;
+        // Clip to the screen in the current rotation
+        if (x < 0) { w += x; x = 0; }
+        if (y < 0) { h += y; y = 0; }
+        w = min(w, (int32_t)width() - x);
+        h = min(h, (int32_t)height() - y);
+        if (w <= 0 || h <= 0) continue;
+
+        _panel_instance.toNativeRect(x, y, w, h);
+        native[nativeCount++] = {(uint16_t)x, (uint16_t)y, (uint16_t)w, (uint16_t)h};
+    }
+
+    bool swapped = _bus_instance.present(rects ? native : nullptr, nativeCount);
+    _panel_instance.setDrawBuffer(_bus_instance.getDrawBuffer());
+    return swapped;
+}
+
 // ============================================
 // WaveshareDisplay Implementation
 // ============================================
 
-WaveshareDisplay::WaveshareDisplay() : _lastTouchTime(0) {}
+WaveshareDisplay::WaveshareDisplay() : _renderer(*this) {}
 
 WaveshareDisplay::~WaveshareDisplay() {
+    for (LGFX_Sprite*& sprite : _textSprites) {
+        delete sprite;
+        sprite = nullptr;
+    }
+    _textCacheBytes = 0;
 #ifdef ENABLE_BOARD_IMAGE
     if (_boardImageSprite) {
         _boardImageSprite->deleteSprite();
         delete _boardImageSprite;
         _boardImageSprite = nullptr;
     }
+    free(_tileBuffer);
+    _tileBuffer = nullptr;
 #endif
 }
 
@@ -138,6 +196,7 @@ bool WaveshareDisplay::begin() {
     delay(100);
 
     // 6. Initialize LovyanGFX display
+    _display.setBounceLines(Config.getInt("bounce_lines", WS_BOUNCE_LINES));
     _display.init();
 
     // Read display mode from config
@@ -153,20 +212,27 @@ bool WaveshareDisplay::begin() {
 
     // 8. Test pattern to verify display works
     _display.fillScreen(0xF800);  // RED
+    _display.present(nullptr, 0);
     delay(300);
     _display.fillScreen(0x07E0);  // GREEN
+    _display.present(nullptr, 0);
     delay(300);
     _display.fillScreen(0x001F);  // BLUE
+    _display.present(nullptr, 0);
     delay(300);
 
     _display.fillScreen(COLOR_BACKGROUND);
     _display.setTextColor(COLOR_TEXT);
+    _display.present(nullptr, 0);
 
     return true;
 }
 
 void WaveshareDisplay::showConnecting() {
+    DrawLock draw(*this);
+    discardPendingRender();
     _display.fillScreen(COLOR_BACKGROUND);
+    invalidateLayout();
 
     int sw = screenWidth();
     int sh = screenHeight();
@@ -181,10 +247,15 @@ void WaveshareDisplay::showConnecting() {
     _display.drawString("Boardsesh Queue", sw / 2, sh / 2 + 50);
 
     _display.setTextDatum(lgfx::top_left);
+
+    present();
 }
 
 void WaveshareDisplay::showError(const char* message, const char* ipAddress) {
+    DrawLock draw(*this);
+    discardPendingRender();
     _display.fillScreen(COLOR_BACKGROUND);
+    invalidateLayout();
 
     int sw = screenWidth();
     int sh = screenHeight();
@@ -205,10 +276,15 @@ void WaveshareDisplay::showError(const char* message, const char* ipAddress) {
     }
 
     _display.setTextDatum(lgfx::top_left);
+
+    present();
 }
 
 void WaveshareDisplay::showConfigPortal(const char* apName, const char* ip) {
+    DrawLock draw(*this);
+    discardPendingRender();
     _display.fillScreen(COLOR_BACKGROUND);
+    invalidateLayout();
 
     int sw = screenWidth();
 
@@ -238,10 +314,15 @@ void WaveshareDisplay::showConfigPortal(const char* apName, const char* ip) {
     _display.drawString("Enter your WiFi credentials to continue", sw / 2, _displayMode == WsDisplayMode::LANDSCAPE ? 450 : 520);
 
     _display.setTextDatum(lgfx::top_left);
+
+    present();
 }
 
 void WaveshareDisplay::showSetupScreen(const char* apName) {
+    DrawLock draw(*this);
+    discardPendingRender();
     _display.fillScreen(COLOR_BACKGROUND);
+    invalidateLayout();
 
     int sw = screenWidth();
     bool isLandscape = (_displayMode == WsDisplayMode::LANDSCAPE);
@@ -264,8 +345,10 @@ void WaveshareDisplay::showSetupScreen(const char* apName) {
     // QR Code section - generate WiFi join QR code
     char wifiQr[80];
     snprintf(wifiQr, sizeof(wifiQr), "WIFI:T:nopass;S:%s;;;", apName);
+    // Own buffer: _qrCodeData holds the session code
+    uint8_t wifiQrData[QR_BUFFER_SIZE];
     QRCode qrCode;
-    qrcode_initText(&qrCode, _qrCodeData, QR_VERSION, ECC_LOW, wifiQr);
+    qrcode_initText(&qrCode, wifiQrData, QR_VERSION, ECC_LOW, wifiQr);
 
     int qrSize = qrCode.size;
     int targetQrPx = isLandscape ? 180 : 250;
@@ -322,82 +405,288 @@ void WaveshareDisplay::showSetupScreen(const char* apName) {
     }
 
     _display.setTextDatum(lgfx::top_left);
+
+    present();
 }
 
 void WaveshareDisplay::onStatusChanged() {
     if (_settingsScreenActive) return;
-    if (_displayMode == WsDisplayMode::LANDSCAPE) {
-        drawLandscapeStatusBar();
-    } else {
-        drawStatusBar();
-    }
+    renderWidgets(~(1u << WIDGET_STATUS_BAR));
+}
+
+void WaveshareDisplay::onScrollChanged() {
+    if (_settingsScreenActive || _displayMode != WsDisplayMode::LANDSCAPE) return;
+    renderWidgets(~(1u << WIDGET_QUEUE_LIST));
+}
+
+void WaveshareDisplay::snapshotState() {
+    DisplayBase::snapshotState();
+#ifdef ENABLE_BOARD_IMAGE
+    _currentBoardConfig = _pendingBoardConfig;
+    _hasBoardImage = _pendingBoardConfig != nullptr;
+    memcpy(_holdCommands, _pendingHolds, _pendingHoldCount * sizeof(HoldCmd));
+    _holdCommandCount = _pendingHoldCount;
+#endif
 }
 
 void WaveshareDisplay::refresh() {
     if (_settingsScreenActive) return;
+    renderWidgets();
+}
+
+void WaveshareDisplay::refreshInfoOnly() {
+    if (_settingsScreenActive) return;
+    // Board image is left as-is until the LED commands for the new climb arrive
+    renderWidgets(1u << WIDGET_BOARD_IMAGE);
+}
+
+// ============================================
+// Retained-Mode Widgets
+// ============================================
+
+void WaveshareDisplay::renderWidgets(uint32_t skipMask) {
+    layoutWidgets();
+    _renderer.render(skipMask);
+    present();
+}
+
+void WaveshareDisplay::markDirty(const WidgetRect& rect) {
+    if (_dirtyAll) return;
+    if (_dirtyCount >= WS_MAX_DIRTY_RECTS) {
+        _dirtyAll = true;
+        return;
+    }
+    _dirtyRects[_dirtyCount++] = rect;
+}
+
+void WaveshareDisplay::present() {
+    if (!_dirtyAll && _dirtyCount == 0) return;
+    _display.present(_dirtyAll ? nullptr : _dirtyRects, _dirtyCount);
+    _dirtyAll = false;
+    _dirtyCount = 0;
+}
+
+void WaveshareDisplay::layoutWidgets() {
+    ContentHash key;
+    key.add((int32_t)_displayMode);
+#ifdef ENABLE_BOARD_IMAGE
+    key.add(_hasBoardImage).add((const void*)_currentBoardConfig);
+#endif
+
+    // Full-screen modes and layout switches leave pixels no widget owns
+    if (!_layoutValid || key.value() != _layoutKey) {
+        _renderer.clear();
+        _display.clearClipRect();
+        _display.fillScreen(COLOR_BACKGROUND);
+        markDirtyAll();
+        _layoutKey = key.value();
+        _layoutValid = true;
+    }
 
     if (_displayMode == WsDisplayMode::LANDSCAPE) {
-        drawLandscapeStatusBar();
-        drawLandscapeBoardPanel();
-        drawLandscapeQueuePanel();
+        layoutLandscapeWidgets();
+    } else {
+        layoutPortraitWidgets();
+    }
+}
+
+void WaveshareDisplay::layoutPortraitWidgets() {
+#ifdef ENABLE_BOARD_IMAGE
+    if (_hasBoardImage && _currentBoardConfig) {
+        int imageH = _currentBoardConfig->imageHeight;
+        // Status bar stops where the board image starts so status changes never touch it
+        _renderer.setRect(WIDGET_STATUS_BAR, WidgetRect(0, WS_STATUS_BAR_Y, SCREEN_WIDTH, WS_BOARD_IMAGE_Y));
+        _renderer.setRect(WIDGET_BOARD_IMAGE, WidgetRect(0, WS_BOARD_IMAGE_Y, SCREEN_WIDTH, imageH));
+        _renderer.setRect(WIDGET_CLIMB_INFO,
+                          WidgetRect(0, WS_BOARD_IMAGE_Y + imageH + 10, SCREEN_WIDTH, WS_CLIMB_INFO_V2_HEIGHT));
+        _renderer.setRect(WIDGET_NAV_BUTTONS, WidgetRect(0, WS_NAV_BUTTON_Y, SCREEN_WIDTH, WS_NAV_BUTTON_HEIGHT));
         return;
     }
+#endif
 
-    // Portrait mode (unchanged)
-    drawStatusBar();
+    _renderer.setRect(WIDGET_STATUS_BAR, WidgetRect(0, WS_STATUS_BAR_Y, SCREEN_WIDTH, WS_STATUS_BAR_HEIGHT));
+    _renderer.setRect(WIDGET_CURRENT_CLIMB, WidgetRect(0, WS_CURRENT_CLIMB_Y, SCREEN_WIDTH, WS_CURRENT_CLIMB_HEIGHT));
+    _renderer.setRect(WIDGET_QR_CODE, WidgetRect(0, WS_QR_SECTION_Y, SCREEN_WIDTH, WS_QR_SECTION_HEIGHT));
+    _renderer.setRect(WIDGET_NEXT_CLIMB, WidgetRect(0, WS_NEXT_INDICATOR_Y, SCREEN_WIDTH, WS_NEXT_INDICATOR_HEIGHT));
+    _renderer.setRect(WIDGET_HISTORY, WidgetRect(0, WS_HISTORY_Y, SCREEN_WIDTH, WS_HISTORY_HEIGHT));
+    _renderer.setRect(WIDGET_NAV_BUTTONS, WidgetRect(0, WS_NAV_BUTTON_Y, SCREEN_WIDTH, WS_NAV_BUTTON_HEIGHT));
+}
+
+void WaveshareDisplay::layoutLandscapeWidgets() {
+    _renderer.setRect(WIDGET_STATUS_BAR,
+                      WidgetRect(0, WS_L_STATUS_BAR_Y, WS_L_SCREEN_WIDTH, WS_L_STATUS_BAR_HEIGHT));
 
+    // Left panel: board image (or placeholder), climb info below it, QR overlaid bottom-left
+    int climbInfoY = landscapeClimbInfoY();
+    int boardH = climbInfoY - WS_L_LEFT_PANEL_Y;
+    WidgetRect qrRect;
 #ifdef ENABLE_BOARD_IMAGE
     if (_hasBoardImage && _currentBoardConfig) {
-        // Clear margins around the board image instead of full fillScreen
-        int offsetX = (SCREEN_WIDTH - _currentBoardConfig->imageWidth) / 2;
-        if (offsetX > 0) {
-            _display.fillRect(0, WS_BOARD_IMAGE_Y, offsetX, _currentBoardConfig->imageHeight, COLOR_BACKGROUND);
-            _display.fillRect(offsetX + _currentBoardConfig->imageWidth, WS_BOARD_IMAGE_Y, offsetX, _currentBoardConfig->imageHeight, COLOR_BACKGROUND);
+        boardH = climbInfoY - 4 - WS_L_LEFT_PANEL_Y;
+        if (_hasQRCode && _sessionId.length() > 0) {
+            int qrModules = QR_VERSION * 4 + 17;
+            int pixelSize = max(1, WS_L_QR_SIZE / qrModules);
+            int actualQrSize = pixelSize * qrModules;
+            int qrX = WS_L_LEFT_PANEL_X + WS_L_QR_MARGIN;
+            int qrY = WS_L_LEFT_PANEL_Y + WS_L_LEFT_PANEL_H - actualQrSize - WS_L_QR_MARGIN;
+            qrRect = WidgetRect(qrX - 2, qrY - 2, actualQrSize + 4, actualQrSize + 4);
         }
-        drawBoardImageWithHolds();
-        drawClimbInfoCompact();
-    } else {
-        _display.fillScreen(COLOR_BACKGROUND);
-        drawStatusBar();
-        drawCurrentClimb();
-        drawQRCode();
-        drawNextClimbIndicator();
-        drawHistory();
     }
-#else
-    _display.fillScreen(COLOR_BACKGROUND);
-    drawStatusBar();
-    drawCurrentClimb();
-    drawQRCode();
-    drawNextClimbIndicator();
-    drawHistory();
 #endif
+    int climbInfoH = min(WS_L_CLIMB_INFO_HEIGHT, WS_L_SCREEN_HEIGHT - climbInfoY);
+    _renderer.setRect(WIDGET_BOARD_IMAGE, WidgetRect(WS_L_LEFT_PANEL_X, WS_L_LEFT_PANEL_Y, WS_L_LEFT_PANEL_W, boardH));
+    _renderer.setRect(WIDGET_CLIMB_INFO, WidgetRect(WS_L_LEFT_PANEL_X, climbInfoY, WS_L_LEFT_PANEL_W, climbInfoH));
+    _renderer.setRect(WIDGET_QR_CODE, qrRect);
 
-    drawNavButtons();
+    // Right panel: header plus the scrolling list, or a single placeholder when empty
+    updateQueueScrollOffset();
+    if (_queueCount == 0) {
+        _renderer.setRect(WIDGET_QUEUE_HEADER,
+                          WidgetRect(WS_L_RIGHT_PANEL_X, WS_L_RIGHT_PANEL_Y, WS_L_RIGHT_PANEL_W, WS_L_RIGHT_PANEL_H));
+        _renderer.setRect(WIDGET_QUEUE_LIST, WidgetRect());
+    } else {
+        _renderer.setRect(WIDGET_QUEUE_HEADER,
+                          WidgetRect(WS_L_RIGHT_PANEL_X, WS_L_RIGHT_PANEL_Y, WS_L_RIGHT_PANEL_W, 24));
+        _renderer.setRect(WIDGET_QUEUE_LIST,
+                          WidgetRect(WS_L_RIGHT_PANEL_X, WS_L_QUEUE_LIST_Y, WS_L_RIGHT_PANEL_W, WS_L_QUEUE_LIST_H));
+    }
 }
 
-void WaveshareDisplay::refreshInfoOnly() {
-    if (_settingsScreenActive) return;
+uint32_t WaveshareDisplay::widgetHash(uint8_t id) {
+    ContentHash hash;
 
-    if (_displayMode == WsDisplayMode::LANDSCAPE) {
-        drawLandscapeStatusBar();
-        drawLandscapeClimbInfo();
-        drawLandscapeQueuePanel();
-        return;
+    switch (id) {
+        case WIDGET_STATUS_BAR:
+            hash.add(_wifiConnected).add(_backendConnected).add(_bleEnabled).add(_bleConnected);
+            hash.add((int32_t)(_hasClimb ? _angle : 0));
+            break;
+
+        case WIDGET_BOARD_IMAGE:
+#ifdef ENABLE_BOARD_IMAGE
+            if (_hasBoardImage && _currentBoardConfig) {
+                hash.add((const void*)_currentBoardConfig);
+                hash.add(_holdCommands, _holdCommandCount * sizeof(HoldCmd));
+                break;
+            }
+#endif
+            hash.add(_hasClimb);
+            break;
+
+        case WIDGET_CLIMB_INFO:
+        case WIDGET_CURRENT_CLIMB:
+            hash.add(_hasClimb).add(_climbName).add(_grade);
+            break;
+
+        case WIDGET_QR_CODE:
+            hash.add(_hasClimb).add(_hasQRCode).add(_qrUrl);
+            break;
+
+        case WIDGET_NEXT_CLIMB:
+            hash.add(_hasNavigation).add(_nextClimb.isValid);
+            hash.add(_nextClimb.name).add(_nextClimb.grade).add(_nextClimb.gradeColor);
+            break;
+
+        case WIDGET_HISTORY: {
+            int itemsToShow = min((int)_history.size(), WS_HISTORY_MAX_ITEMS);
+            hash.add((int32_t)itemsToShow);
+            for (int i = 0; i < itemsToShow; i++) {
+                const ClimbHistoryEntry& entry = _history[_history.size() - 1 - i];
+                hash.add(entry.name).add(entry.grade);
+            }
+            break;
+        }
+
+        case WIDGET_NAV_BUTTONS:
+            hash.add(_hasNavigation).add((int32_t)_queueIndex).add((int32_t)_queueTotal);
+            hash.add(_prevClimb.isValid).add(_nextClimb.isValid);
+            break;
+
+        case WIDGET_QUEUE_HEADER:
+            hash.add((int32_t)_queueCount).add((int32_t)_currentQueueIndex);
+            break;
+
+        case WIDGET_QUEUE_LIST: {
+            // Scroll position plus every row it shows
+            int32_t offset = _queueScroll.offset();
+            int first = offset / WS_L_QUEUE_ITEM_HEIGHT;
+            int last = min(_queueCount - 1, (int)((offset + WS_L_QUEUE_LIST_H - 1) / WS_L_QUEUE_ITEM_HEIGHT));
+            hash.add(offset);
+            for (int i = first; i <= last; i++) {
+                hash.add(queueRowHash(i));
+            }
+            break;
+        }
     }
 
-    // Portrait mode (unchanged)
-    drawStatusBar();
+    return hash.value();
+}
+
+void WaveshareDisplay::drawWidget(uint8_t id, const WidgetRect& rect, bool retained) {
+    bool landscape = _displayMode == WsDisplayMode::LANDSCAPE;
+
+    switch (id) {
+        case WIDGET_STATUS_BAR:
+            landscape ? drawLandscapeStatusBar() : drawStatusBar();
+            break;
+
+        case WIDGET_BOARD_IMAGE:
+            if (landscape) {
+                drawLandscapeBoardPanel(rect, retained);
+            } else {
+#ifdef ENABLE_BOARD_IMAGE
+                drawBoardImageWithHolds(rect, retained);
+#endif
+            }
+            break;
+
+        case WIDGET_CLIMB_INFO:
+            if (landscape) {
+                drawLandscapeClimbInfo();
+            } else {
 #ifdef ENABLE_BOARD_IMAGE
-    if (_hasBoardImage && _currentBoardConfig) {
-        drawClimbInfoCompact();
+                drawClimbInfoCompact();
+#endif
+            }
+            break;
+
+        case WIDGET_CURRENT_CLIMB:
+            drawCurrentClimb();
+            break;
+
+        case WIDGET_QR_CODE:
+            landscape ? drawLandscapeQRCode() : drawQRCode();
+            break;
+
+        case WIDGET_NEXT_CLIMB:
+            drawNextClimbIndicator();
+            break;
+
+        case WIDGET_HISTORY:
+            drawHistory();
+            break;
+
+        case WIDGET_NAV_BUTTONS:
+            drawNavButtons();
+            break;
+
+        case WIDGET_QUEUE_HEADER:
+            drawLandscapeQueueHeader(rect);
+            break;
+
+        case WIDGET_QUEUE_LIST:
+            drawLandscapeQueueList(rect);
+            break;
+    }
+}
+
+void WaveshareDisplay::setWidgetClip(const WidgetRect* rect) {
+    if (rect) {
+        // Widgets only draw inside their clip, so the clip is the dirty region
+        markDirty(*rect);
+        _display.setClipRect(rect->x, rect->y, rect->w, rect->h);
     } else {
-        drawCurrentClimb();
+        _display.clearClipRect();
     }
-#else
-    drawCurrentClimb();
-#endif
-    drawNavButtons();
 }
 
 // ============================================
@@ -472,15 +761,12 @@ void WaveshareDisplay::drawCurrentClimb() {
     }
 
     // Draw climb name
-    _display.setFont(&fonts::FreeSansBold24pt7b);
-    _display.setTextColor(COLOR_TEXT);
-    _display.setTextDatum(lgfx::top_center);
-
     String displayName = _climbName;
     if (displayName.length() > 25) {
         displayName = displayName.substring(0, 22) + "...";
     }
-    _display.drawString(displayName.c_str(), SCREEN_WIDTH / 2, WS_CLIMB_NAME_Y);
+    drawCachedText(_display, displayName.c_str(), &fonts::FreeSansBold24pt7b, COLOR_TEXT, COLOR_BACKGROUND,
+                   WidgetRect(0, WS_CLIMB_NAME_Y, SCREEN_WIDTH, WS_CLIMB_NAME_HEIGHT), lgfx::top_center);
 
     // Draw grade badge or "Project" for ungraded climbs
     if (_grade.length() > 0) {
@@ -489,15 +775,11 @@ void WaveshareDisplay::drawCurrentClimb() {
         int badgeX = (SCREEN_WIDTH - badgeWidth) / 2;
         int badgeY = WS_GRADE_Y;
 
-        uint16_t gradeColor565 = getGradeColor(_grade.c_str());
+        uint16_t gradeColor565 = getGradeColorById(_gradeId);
 
         _display.fillRoundRect(badgeX, badgeY, badgeWidth, badgeHeight, 16, gradeColor565);
 
-        uint16_t textColor = getGradeTextColor(gradeColor565);
-
-        _display.setFont(&fonts::FreeSansBold24pt7b);
-        _display.setTextColor(textColor);
-        _display.setTextDatum(lgfx::middle_center);
+        uint16_t textColor = getGradeTextColorById(_gradeId);
 
         // Extract just the V-grade for display if combined format
         String displayGrade = _grade;
@@ -506,7 +788,9 @@ void WaveshareDisplay::drawCurrentClimb() {
             displayGrade = displayGrade.substring(slashPos + 1);
         }
 
-        _display.drawString(displayGrade.c_str(), badgeX + badgeWidth / 2, badgeY + badgeHeight / 2);
+        // Strip inside the rounded corners, centred on the badge
+        drawCachedText(_display, displayGrade.c_str(), &fonts::FreeSansBold24pt7b, textColor, gradeColor565,
+                       WidgetRect(badgeX + 16, badgeY + 16, badgeWidth - 32, badgeHeight - 32), lgfx::middle_center);
     } else {
         _display.setFont(&fonts::FreeSansOblique24pt7b);
         _display.setTextColor(COLOR_TEXT_DIM);
@@ -526,28 +810,32 @@ void WaveshareDisplay::drawQRCode() {
         return;
     }
 
-    QRCode qrCode;
-    qrcode_initText(&qrCode, _qrCodeData, QR_VERSION, ECC_LOW, _qrUrl.c_str());
-
-    int qrSize = qrCode.size;
-    int pixelSize = WS_QR_CODE_SIZE / qrSize;
-    if (pixelSize < 1) pixelSize = 1;
-
-    int actualQrSize = pixelSize * qrSize;
-    int qrX = (SCREEN_WIDTH - actualQrSize) / 2;
-    int qrY = yStart + (WS_QR_SECTION_HEIGHT - actualQrSize) / 2;
+    // Sprite includes the 8px white border; centre it in the section
+    if (!updateQrSprite(WS_QR_CODE_SIZE, 8)) {
+        return;
+    }
+    int side = _qrSprite.width();
+    _qrSprite.pushSprite(&_display, (SCREEN_WIDTH - side) / 2, yStart + (WS_QR_SECTION_HEIGHT - side) / 2);
+}
 
-    // Draw white background for QR code
-    _display.fillRect(qrX - 8, qrY - 8, actualQrSize + 16, actualQrSize + 16, COLOR_QR_BG);
+bool WaveshareDisplay::updateQrSprite(int targetPx, int border) {
+    int scale = qrModuleScale(_qrCode.size, targetPx);
+    int side = qrRasterSide(_qrCode.size, scale, border);
+    if (_qrSpriteGeneration == _qrGeneration && _qrSprite.width() == side) {
+        return true;
+    }
 
-    // Draw QR code modules
-    for (uint8_t y = 0; y < qrSize; y++) {
-        for (uint8_t x = 0; x < qrSize; x++) {
-            if (qrcode_getModule(&qrCode, x, y)) {
-                _display.fillRect(qrX + x * pixelSize, qrY + y * pixelSize, pixelSize, pixelSize, COLOR_QR_FG);
-            }
-        }
+    _qrSprite.deleteSprite();
+    _qrSprite.setColorDepth(1);
+    if (!_qrSprite.createSprite(side, side)) {
+        _qrSpriteGeneration = 0;
+        return false;
     }
+    _qrSprite.setPaletteColor(0, (uint16_t)COLOR_QR_BG);
+    _qrSprite.setPaletteColor(1, (uint16_t)COLOR_QR_FG);
+    qrRasterize1bpp(_qrCode.modules, _qrCode.size, scale, border, (uint8_t*)_qrSprite.getBuffer());
+    _qrSpriteGeneration = _qrGeneration;
+    return true;
 }
 
 void WaveshareDisplay::drawNextClimbIndicator() {
@@ -632,25 +920,84 @@ void WaveshareDisplay::drawHistory() {
             name = name.substring(0, 22) + "...";
         }
 
-        _display.setTextColor(COLOR_TEXT);
-        _display.setCursor(38, y + 6);
-        _display.print(name.c_str());
+        drawCachedText(_display, name.c_str(), &fonts::FreeSansBold9pt7b, COLOR_TEXT, COLOR_BACKGROUND,
+                       WidgetRect(38, y + 6, SCREEN_WIDTH - 80 - 38 - 4, 24), lgfx::top_left);
 
         // Draw grade
-        _display.setTextColor(bulletColor);
-        _display.setCursor(SCREEN_WIDTH - 80, y + 6);
-
         String grade = entry.grade;
         int slashPos = grade.indexOf('/');
         if (slashPos > 0) {
             grade = grade.substring(slashPos + 1);
         }
-        _display.print(grade.c_str());
+        drawCachedText(_display, grade.c_str(), &fonts::FreeSansBold9pt7b, bulletColor, COLOR_BACKGROUND,
+                       WidgetRect(SCREEN_WIDTH - 80, y + 6, 72, 24), lgfx::top_left);
 
         y += WS_HISTORY_ITEM_HEIGHT;
     }
 }
 
+void WaveshareDisplay::drawCachedText(lgfx::LovyanGFX& dst, const char* text, const lgfx::IFont* font, uint16_t color,
+                                      uint16_t bg, const WidgetRect& box, lgfx::textdatum_t datum) {
+    int16_t ax, ay;
+    textDatumAnchor(datum, box.w, box.h, ax, ay);
+
+    bool hit;
+    int slot = _textCache.acquire(textCacheKey(text, font, color, bg, box.w, box.h, datum), hit);
+    LGFX_Sprite*& sprite = _textSprites[slot];
+
+    if (!hit) {
+        if (!sprite) {
+            sprite = new LGFX_Sprite(&_display);
+            sprite->setPsram(true);
+        }
+        if (sprite->getBuffer() && (sprite->width() != box.w || sprite->height() != box.h)) {
+            freeTextSprite(slot);
+        }
+        uint32_t bytes = (uint32_t)box.w * box.h * 2;
+        if (!sprite->getBuffer()) {
+            // Free the least recently used strips until this one fits; empty
+            // slots are preferred on a miss, so nothing else would recycle them
+            while (_textCacheBytes + bytes > WS_TEXT_CACHE_BYTES) {
+                int victim = _textCache.evictOldest(slot);
+                if (victim < 0) break;
+                freeTextSprite(victim);
+            }
+        }
+        bool fits = sprite->getBuffer() || _textCacheBytes + bytes <= WS_TEXT_CACHE_BYTES;
+        if (fits && !sprite->getBuffer()) {
+            fits = sprite->createSprite(box.w, box.h) != nullptr;
+            if (fits) _textCacheBytes += bytes;
+        }
+        if (!fits) {
+            // Larger than the whole budget or out of PSRAM: render straight to
+            // the target
+            _textCache.release(slot);
+            dst.fillRect(box.x, box.y, box.w, box.h, bg);
+            dst.setFont(font);
+            dst.setTextColor(color);
+            dst.setTextDatum(datum);
+            dst.drawString(text, box.x + ax, box.y + ay);
+            dst.setTextDatum(lgfx::top_left);
+            return;
+        }
+        sprite->fillSprite(bg);
+        sprite->setFont(font);
+        sprite->setTextColor(color);
+        sprite->setTextDatum(datum);
+        sprite->drawString(text, ax, ay);
+    }
+
+    sprite->pushSprite(&dst, box.x, box.y);
+}
+
+void WaveshareDisplay::freeTextSprite(int slot) {
+    LGFX_Sprite* sprite = _textSprites[slot];
+    if (sprite && sprite->getBuffer()) {
+        _textCacheBytes -= (uint32_t)sprite->width() * sprite->height() * 2;
+        sprite->deleteSprite();
+    }
+}
+
 void WaveshareDisplay::drawNavButtons() {
     _display.fillRect(0, WS_NAV_BUTTON_Y, SCREEN_WIDTH, WS_NAV_BUTTON_HEIGHT, COLOR_BACKGROUND);
 
@@ -694,102 +1041,248 @@ void WaveshareDisplay::drawNavButtons() {
 
 #ifdef ENABLE_BOARD_IMAGE
 void WaveshareDisplay::setBoardConfig(const BoardConfig* config) {
-    if (_currentBoardConfig != config) {
-        // Invalidate cached sprite when board config changes
-        _cachedBoardConfig = nullptr;
+    DisplayLock lock(*this);
+    if (_pendingBoardConfig != config) {
+        _lastImageDecodeUs = 0;
+        // Hold indices belong to the old config
+        _pendingHoldCount = 0;
     }
-    _currentBoardConfig = config;
-    _hasBoardImage = (config != nullptr);
+    _pendingBoardConfig = config;
 }
 
 void WaveshareDisplay::setLedCommands(const LedCmd* commands, int count) {
-    _ledCommandCount = min(count, MAX_LED_COMMANDS);
-    if (commands && _ledCommandCount > 0) {
-        memcpy(_ledCommands, commands, _ledCommandCount * sizeof(LedCmd));
+    DisplayLock lock(*this);
+    clearLedCommands();
+    for (int i = 0; commands && i < count; i++) {
+        addLedCommand(commands[i].position, commands[i].r, commands[i].g, commands[i].b);
     }
 }
 
-void WaveshareDisplay::drawBoardImageWithHolds() {
+void WaveshareDisplay::addLedCommand(uint16_t position, uint8_t r, uint8_t g, uint8_t b) {
+    DisplayLock lock(*this);
+    if (!_pendingBoardConfig || _pendingHoldCount >= MAX_LED_COMMANDS) return;
+
+    // Resolve the hold once here so drawing is a straight array walk
+    uint16_t holdIndex = findHoldIndex(_pendingBoardConfig, position);
+    if (holdIndex == BOARD_NO_HOLD) return;
+
+    HoldCmd& cmd = _pendingHolds[_pendingHoldCount++];
+    cmd.holdIndex = holdIndex;
+    cmd.color = _display.color565(r, g, b);
+}
+
+void WaveshareDisplay::drawBoardImageWithHolds(const WidgetRect& rect, bool retained) {
     if (!_currentBoardConfig) return;
 
     const BoardConfig* cfg = _currentBoardConfig;
 
     // Center the image horizontally
-    int offsetX = (SCREEN_WIDTH - cfg->imageWidth) / 2;
-    int offsetY = WS_BOARD_IMAGE_Y;
-
-    // Cache the decoded JPEG in a PSRAM sprite so subsequent refreshes
-    // (when only hold circles change) don't re-decode the entire JPEG.
-    if (_cachedBoardConfig != cfg) {
-        // Board config changed - rebuild the cache
-        if (_boardImageSprite) {
-            _boardImageSprite->deleteSprite();
-            delete _boardImageSprite;
-            _boardImageSprite = nullptr;
-        }
+    _boardImageX = (SCREEN_WIDTH - cfg->imageWidth) / 2;
+    _boardImageY = WS_BOARD_IMAGE_Y;
+    _boardImageScale = 1.0f;
+
+    cacheBoardImage(cfg);
+
+    // Only the holds changed and the image is still on screen: patch the overlay
+    if (retained && _boardImageSprite) {
+        drawHoldOverlay(rect);
+        return;
+    }
+
+    // Clear margins around the board image instead of full fillScreen
+    if (_boardImageX > 0) {
+        _display.fillRect(0, _boardImageY, _boardImageX, cfg->imageHeight, COLOR_BACKGROUND);
+        _display.fillRect(_boardImageX + cfg->imageWidth, _boardImageY, _boardImageX, cfg->imageHeight,
+                          COLOR_BACKGROUND);
+    }
+
+    blitBoardImage();
+    _holdOverlay.reset();
+    drawHoldOverlay(rect);
+}
+
+bool WaveshareDisplay::preloadBoardImage() {
+    const BoardConfig* config;
+    {
+        DisplayLock lock(*this);
+        config = _pendingBoardConfig;
+    }
+    if (!config) return false;
+
+    // The sprite is render-side state; the render task picks it up when it
+    // snapshots the same config
+    DrawLock draw(*this);
+    cacheBoardImage(config);
+    return _boardImageSprite != nullptr;
+}
+
+void WaveshareDisplay::cacheBoardImage(const BoardConfig* cfg) {
+    // Cache the decoded image in a PSRAM sprite so subsequent refreshes
+    // (when only hold circles change) don't re-decode the entire image.
+    if (_cachedBoardConfig == cfg) return;
+
+    // Board config changed - rebuild the cache
+    if (_boardImageSprite) {
+        _boardImageSprite->deleteSprite();
+        delete _boardImageSprite;
+        _boardImageSprite = nullptr;
+    }
 
-        _boardImageSprite = new LGFX_Sprite(&_display);
-        _boardImageSprite->setPsram(true);
-        if (_boardImageSprite->createSprite(cfg->imageWidth, cfg->imageHeight)) {
-            // Decode JPEG into the sprite (one-time cost)
+    _boardImageSprite = new LGFX_Sprite(&_display);
+    _boardImageSprite->setPsram(true);
+    if (_boardImageSprite->createSprite(cfg->imageWidth, cfg->imageHeight)) {
+        // Decode into the sprite (one-time cost)
+        unsigned long startUs = micros();
+        if (cfg->imageFormat == BOARD_IMAGE_JPEG) {
             _boardImageSprite->drawJpg(cfg->imageData, cfg->imageSize,
                                         0, 0, cfg->imageWidth, cfg->imageHeight);
-            _cachedBoardConfig = cfg;
         } else {
-            // PSRAM allocation failed - fall back to direct decode each time
-            delete _boardImageSprite;
-            _boardImageSprite = nullptr;
-            _cachedBoardConfig = nullptr;
+            decodeBoardImageTiles(cfg, (uint16_t*)_boardImageSprite->getBuffer());
         }
+        _lastImageDecodeUs = micros() - startUs;
+        _cachedBoardConfig = cfg;
+    } else {
+        // PSRAM allocation failed - fall back to direct decode each time
+        delete _boardImageSprite;
+        _boardImageSprite = nullptr;
+        _cachedBoardConfig = nullptr;
     }
+}
 
-    // Blit the cached image to screen (fast memcpy vs slow JPEG decode)
-    if (_boardImageSprite) {
-        _boardImageSprite->pushSprite(&_display, offsetX, offsetY);
-    } else {
-        // Fallback: decode JPEG directly (slow path)
-        _display.drawJpg(cfg->imageData, cfg->imageSize,
-                         offsetX, offsetY,
-                         cfg->imageWidth, cfg->imageHeight);
-    }
-
-    // Overlay hold circles for each active LED command.
-    // holdMap is sorted by ledPosition (at code generation time),
-    // so we use binary search for O(n log m) instead of O(n*m).
-    for (int i = 0; i < _ledCommandCount; i++) {
-        uint16_t target = _ledCommands[i].position;
-        int lo = 0, hi = cfg->holdCount - 1;
-        while (lo <= hi) {
-            int mid = (lo + hi) / 2;
-            uint16_t midPos = cfg->holdMap[mid].ledPosition;
-            if (midPos == target) {
-                uint16_t color = _display.color565(
-                    _ledCommands[i].r, _ledCommands[i].g, _ledCommands[i].b);
-                int dx = offsetX + cfg->holdMap[mid].cx;
-                int dy = offsetY + cfg->holdMap[mid].cy;
-                int dr = cfg->holdMap[mid].radius;
-                // Anti-aliased ring using fillArc (full 360° sweep)
-                int strokeWidth = 3;
-                int innerR = max(1, dr - strokeWidth);
-                _display.fillArc(dx, dy, dr, innerR, 0.0f, 360.0f, color);
-                break;
-            } else if (midPos < target) {
-                lo = mid + 1;
-            } else {
-                hi = mid - 1;
-            }
+void WaveshareDisplay::decodeBoardImageTiles(const BoardConfig* cfg, uint16_t* dst) {
+    // Tiles are stored in sprite byte order, so each one is a straight copy
+    // (raw) or a run of memcpy/fill spans (RLE) into the sprite rows
+    bool rle = cfg->imageFormat == BOARD_IMAGE_RGB565_RLE;
+    for (uint16_t tile = 0; tile < cfg->tileCount; tile++) {
+        int y = tile * cfg->tileHeight;
+        int rows = min((int)cfg->tileHeight, (int)cfg->imageHeight - y);
+        decodeRgb565Tile(cfg->imageData, cfg->tileOffsets, tile, rle, dst + y * cfg->imageWidth,
+                         (size_t)rows * cfg->imageWidth);
+    }
+}
+
+void WaveshareDisplay::blitBoardImageTiles(const BoardConfig* cfg, const WidgetRect& clip) {
+    bool rle = cfg->imageFormat == BOARD_IMAGE_RGB565_RLE;
+    if (rle && _tileBufferConfig != cfg) {
+        // Sized for one tile of this image
+        free(_tileBuffer);
+        _tileBuffer = (uint16_t*)malloc((size_t)cfg->tileHeight * cfg->imageWidth * sizeof(uint16_t));
+        _tileBufferConfig = _tileBuffer ? cfg : nullptr;
+        if (!_tileBuffer) return;
+    }
+
+    for (uint16_t tile = 0; tile < cfg->tileCount; tile++) {
+        int y = tile * cfg->tileHeight;
+        int rows = min((int)cfg->tileHeight, (int)cfg->imageHeight - y);
+        int dstY = _boardImageY + (int)(y * _boardImageScale);
+        int dstRows = (int)((y + rows) * _boardImageScale) - (int)(y * _boardImageScale);
+        if (!clip.intersects(WidgetRect(_boardImageX, dstY, (int)(cfg->imageWidth * _boardImageScale), dstRows))) {
+            continue;
+        }
+
+        // Raw tiles are pushed straight from flash; RLE tiles go through one
+        // tile-sized buffer
+        const lgfx::swap565_t* pixels;
+        if (rle) {
+            decodeRgb565Tile(cfg->imageData, cfg->tileOffsets, tile, true, _tileBuffer,
+                             (size_t)rows * cfg->imageWidth);
+            pixels = (const lgfx::swap565_t*)_tileBuffer;
+        } else {
+            pixels = (const lgfx::swap565_t*)(cfg->imageData + cfg->tileOffsets[tile]);
+        }
+
+        if (_boardImageScale == 1.0f) {
+            _display.pushImage(_boardImageX, dstY, cfg->imageWidth, rows, pixels);
+        } else {
+            // Float destination keeps scaled tiles seamless
+            _display.pushImageRotateZoom((float)_boardImageX, _boardImageY + y * _boardImageScale, 0, 0, 0,
+                                         _boardImageScale, _boardImageScale, cfg->imageWidth, rows, pixels);
         }
     }
 }
 
+void WaveshareDisplay::blitBoardImage() {
+    const BoardConfig* cfg = _currentBoardConfig;
+    int drawW = (int)(cfg->imageWidth * _boardImageScale);
+    int drawH = (int)(cfg->imageHeight * _boardImageScale);
+
+    if (!_boardImageSprite) {
+        int32_t clipX, clipY, clipW, clipH;
+        _display.getClipRect(&clipX, &clipY, &clipW, &clipH);
+        WidgetRect clip(clipX, clipY, clipW, clipH);
+        WidgetRect image(_boardImageX, _boardImageY, drawW, drawH);
+
+        unsigned long startUs = micros();
+        if (cfg->imageFormat == BOARD_IMAGE_JPEG) {
+            // Fallback: decode JPEG directly (slow path)
+            _display.drawJpg(cfg->imageData, cfg->imageSize, _boardImageX, _boardImageY, drawW, drawH);
+        } else {
+            // Fallback: push pre-decoded tiles from flash, skipping clipped ones
+            blitBoardImageTiles(cfg, clip);
+        }
+        // Only a full draw counts as a first show; hold restores are clipped
+        if (clip.intersection(image) == image) {
+            _lastImageDecodeUs = micros() - startUs;
+        }
+    } else if (_boardImageScale == 1.0f) {
+        // Blit the cached image to screen (fast memcpy vs slow JPEG decode)
+        _boardImageSprite->pushSprite(&_display, _boardImageX, _boardImageY);
+    } else {
+        // Use pushRotateZoom to scale the sprite (angle=0, scaleX=scale, scaleY=scale)
+        _boardImageSprite->pushRotateZoom(&_display, _boardImageX + drawW / 2, _boardImageY + drawH / 2,
+                                          0, _boardImageScale, _boardImageScale);
+    }
+}
+
+int WaveshareDisplay::buildHoldCircles() {
+    const BoardConfig* cfg = _currentBoardConfig;
+    float scale = _boardImageScale;
+    int strokeWidth = max(1, (int)(3 * scale));
+
+    for (int i = 0; i < _holdCommandCount; i++) {
+        const HoldMapEntry& hold = cfg->holdMap[_holdCommands[i].holdIndex];
+        HoldCircle& circle = _holdCircles[i];
+        circle.position = _holdCommands[i].holdIndex;
+        circle.color = _holdCommands[i].color;
+        circle.x = _boardImageX + (int)(hold.cx * scale);
+        circle.y = _boardImageY + (int)(hold.cy * scale);
+        circle.radius = max(1, (int)(hold.radius * scale));
+        circle.innerRadius = max(1, circle.radius - strokeWidth);
+    }
+    return _holdCommandCount;
+}
+
+void WaveshareDisplay::drawHoldOverlay(const WidgetRect& rect) {
+    _holdOverlay.update(_holdCircles, buildHoldCircles());
+
+    // Put the board image back under removed holds, clipped to each hold
+    for (int i = 0; i < _holdOverlay.restoreCount(); i++) {
+        WidgetRect area = _holdOverlay.restoreRect(i).intersection(rect);
+        if (area.isEmpty()) continue;
+        _display.setClipRect(area.x, area.y, area.w, area.h);
+        blitBoardImage();
+    }
+    if (_holdOverlay.restoreCount() > 0) {
+        setWidgetClip(&rect);
+    }
+
+    // Anti-aliased ring using fillArc (full 360° sweep)
+    for (int i = 0; i < _holdOverlay.drawCount(); i++) {
+        const HoldCircle& circle = _holdCircles[_holdOverlay.drawIndex(i)];
+        _display.fillArc(circle.x, circle.y, circle.radius, circle.innerRadius, 0.0f, 360.0f, circle.color);
+    }
+}
+
 void WaveshareDisplay::drawClimbInfoCompact() {
-    if (!_hasClimb || !_currentBoardConfig) return;
+    if (!_currentBoardConfig) return;
 
     int yStart = WS_BOARD_IMAGE_Y + _currentBoardConfig->imageHeight + 10;
 
     // Clear the climb info area
     _display.fillRect(0, yStart, SCREEN_WIDTH, WS_CLIMB_INFO_V2_HEIGHT, COLOR_BACKGROUND);
 
+    if (!_hasClimb) return;
+
     // Draw climb name centered
     _display.setFont(&fonts::FreeSansBold18pt7b);
     _display.setTextColor(COLOR_TEXT);
@@ -808,10 +1301,10 @@ void WaveshareDisplay::drawClimbInfoCompact() {
         int badgeX = (SCREEN_WIDTH - badgeWidth) / 2;
         int badgeY = yStart + 38;
 
-        uint16_t gradeColor565 = getGradeColor(_grade.c_str());
+        uint16_t gradeColor565 = getGradeColorById(_gradeId);
         _display.fillRoundRect(badgeX, badgeY, badgeWidth, badgeHeight, 10, gradeColor565);
 
-        uint16_t textColor = getGradeTextColor(gradeColor565);
+        uint16_t textColor = getGradeTextColorById(_gradeId);
         _display.setFont(&fonts::FreeSansBold12pt7b);
         _display.setTextColor(textColor);
         _display.setTextDatum(lgfx::middle_center);
@@ -834,12 +1327,14 @@ void WaveshareDisplay::drawClimbInfoCompact() {
 // ============================================
 
 void WaveshareDisplay::setSettingsData(const char* ssid, const char* ip, bool proxyEnabled) {
+    DrawLock draw(*this);
     _settingsSSID = ssid ? ssid : "";
     _settingsIP = ip ? ip : "";
     _settingsProxyEnabled = proxyEnabled;
 }
 
 void WaveshareDisplay::showSettingsScreen() {
+    DrawLock draw(*this);
     _settingsScreenActive = true;
     if (_displayMode == WsDisplayMode::LANDSCAPE) {
         drawLandscapeSettingsScreen();
@@ -849,12 +1344,15 @@ void WaveshareDisplay::showSettingsScreen() {
 }
 
 void WaveshareDisplay::hideSettingsScreen() {
+    DrawLock draw(*this);
     _settingsScreenActive = false;
-    refresh();
+    invalidateLayout();
+    redraw();
 }
 
 void WaveshareDisplay::drawSettingsScreen() {
     _display.fillScreen(COLOR_BACKGROUND);
+    invalidateLayout();
 
     // Title
     _display.setFont(&fonts::FreeSansBold24pt7b);
@@ -928,6 +1426,8 @@ void WaveshareDisplay::drawSettingsScreen() {
                         WS_SETTINGS_BACK_BTN_Y + WS_SETTINGS_BTN_H / 2);
 
     _display.setTextDatum(lgfx::top_left);
+
+    present();
 }
 
 TouchAction WaveshareDisplay::handleSettingsTouch(int16_t x, int16_t y) {
@@ -966,13 +1466,31 @@ TouchEvent WaveshareDisplay::pollTouch() {
     TouchEvent event;
 
     unsigned long now = millis();
-    if (now - _lastTouchTime < TOUCH_DEBOUNCE_MS) {
-        return event;  // Still in debounce period
+    if (now - _lastTouchPollMs < WS_TOUCH_POLL_MS) {
+        // Between touch samples a fling still needs its frames
+        stepQueueScroll(now);
+        return event;
     }
+    _lastTouchPollMs = now;
 
     lgfx::touch_point_t tp;
-    if (_display.getTouch(&tp)) {
-        _lastTouchTime = now;
+    bool touched = _display.getTouch(&tp);
+    bool pressed = touched && !_touchDown;
+    _touchDown = touched;
+
+    if (_displayMode == WsDisplayMode::LANDSCAPE && !_settingsScreenActive) {
+        // A touch that starts on the queue list scrolls it until the finger lifts
+        if (pressed && getQueueCount() > 0 && tp.x >= WS_L_RIGHT_PANEL_X && tp.y >= WS_L_QUEUE_LIST_Y) {
+            _queueGesture = true;
+        }
+        if (_queueGesture) {
+            return handleQueueGesture(touched, tp, now);
+        }
+        stepQueueScroll(now);
+    }
+
+    // Everything else fires once per touch, as the finger goes down
+    if (pressed) {
         event.x = tp.x;
         event.y = tp.y;
 
@@ -1064,7 +1582,7 @@ void WaveshareDisplay::drawLandscapeStatusBar() {
     _display.drawFastVLine(gearCx, gearCy + gearR - 3, 6, COLOR_TEXT_DIM);
 }
 
-void WaveshareDisplay::drawLandscapeBoardPanel() {
+void WaveshareDisplay::drawLandscapeBoardPanel(const WidgetRect& rect, bool retained) {
 #ifdef ENABLE_BOARD_IMAGE
     if (!_hasBoardImage || !_currentBoardConfig) {
         // Clear left panel and show "waiting" message
@@ -1100,6 +1618,18 @@ void WaveshareDisplay::drawLandscapeBoardPanel() {
     int offsetX = WS_L_LEFT_PANEL_X + (availableW - drawW) / 2;
     int offsetY = WS_L_LEFT_PANEL_Y;
 
+    _boardImageX = offsetX;
+    _boardImageY = offsetY;
+    _boardImageScale = scale;
+
+    cacheBoardImage(cfg);
+
+    // Only the holds changed and the image is still on screen: patch the overlay
+    if (retained && _boardImageSprite) {
+        drawHoldOverlay(rect);
+        return;
+    }
+
     // Clear margins around the board image
     if (offsetX > WS_L_LEFT_PANEL_X) {
         _display.fillRect(WS_L_LEFT_PANEL_X, WS_L_LEFT_PANEL_Y,
@@ -1108,68 +1638,10 @@ void WaveshareDisplay::drawLandscapeBoardPanel() {
                           WS_L_LEFT_PANEL_W - (offsetX - WS_L_LEFT_PANEL_X) - drawW, availableH, COLOR_BACKGROUND);
     }
 
-    // Cache the decoded JPEG in a PSRAM sprite
-    if (_cachedBoardConfig != cfg) {
-        if (_boardImageSprite) {
-            _boardImageSprite->deleteSprite();
-            delete _boardImageSprite;
-            _boardImageSprite = nullptr;
-        }
-
-        _boardImageSprite = new LGFX_Sprite(&_display);
-        _boardImageSprite->setPsram(true);
-        if (_boardImageSprite->createSprite(cfg->imageWidth, cfg->imageHeight)) {
-            _boardImageSprite->drawJpg(cfg->imageData, cfg->imageSize,
-                                        0, 0, cfg->imageWidth, cfg->imageHeight);
-            _cachedBoardConfig = cfg;
-        } else {
-            delete _boardImageSprite;
-            _boardImageSprite = nullptr;
-            _cachedBoardConfig = nullptr;
-        }
-    }
-
-    // Blit the cached image scaled to fit
-    if (_boardImageSprite) {
-        // Use pushRotateZoom to scale the sprite (angle=0, scaleX=scale, scaleY=scale)
-        _boardImageSprite->pushRotateZoom(&_display,
-            offsetX + drawW / 2, offsetY + drawH / 2,
-            0, scale, scale);
-    } else {
-        _display.drawJpg(cfg->imageData, cfg->imageSize,
-                         offsetX, offsetY, drawW, drawH);
-    }
-
-    // Overlay hold circles (scaled)
-    for (int i = 0; i < _ledCommandCount; i++) {
-        uint16_t target = _ledCommands[i].position;
-        int lo = 0, hi = cfg->holdCount - 1;
-        while (lo <= hi) {
-            int mid = (lo + hi) / 2;
-            uint16_t midPos = cfg->holdMap[mid].ledPosition;
-            if (midPos == target) {
-                uint16_t color = _display.color565(
-                    _ledCommands[i].r, _ledCommands[i].g, _ledCommands[i].b);
-                int dx = offsetX + (int)(cfg->holdMap[mid].cx * scale);
-                int dy = offsetY + (int)(cfg->holdMap[mid].cy * scale);
-                int dr = max(1, (int)(cfg->holdMap[mid].radius * scale));
-                int strokeWidth = max(1, (int)(3 * scale));
-                int innerR = max(1, dr - strokeWidth);
-                _display.fillArc(dx, dy, dr, innerR, 0.0f, 360.0f, color);
-                break;
-            } else if (midPos < target) {
-                lo = mid + 1;
-            } else {
-                hi = mid - 1;
-            }
-        }
-    }
-
-    // Draw compact climb info below the board image
-    drawLandscapeClimbInfo();
-
-    // Draw small QR code in bottom-left corner (overlaid on board image)
-    drawLandscapeQRCode();
+    // Blit the cached image scaled to fit, then the hold circles
+    blitBoardImage();
+    _holdOverlay.reset();
+    drawHoldOverlay(rect);
 #else
     // No board image support - show placeholder
     _display.fillRect(WS_L_LEFT_PANEL_X, WS_L_LEFT_PANEL_Y,
@@ -1177,28 +1649,28 @@ void WaveshareDisplay::drawLandscapeBoardPanel() {
 #endif
 }
 
-void WaveshareDisplay::drawLandscapeClimbInfo() {
-    if (!_hasClimb) return;
-
+int WaveshareDisplay::landscapeClimbInfoY() const {
 #ifdef ENABLE_BOARD_IMAGE
-    int yStart;
     if (_hasBoardImage && _currentBoardConfig) {
         int availableH = WS_L_LEFT_PANEL_H - WS_L_CLIMB_INFO_HEIGHT;
         float scaleW = (float)WS_L_LEFT_PANEL_W / _currentBoardConfig->imageWidth;
         float scaleH = (float)availableH / _currentBoardConfig->imageHeight;
         float scale = min(scaleW, scaleH);
         int drawH = (int)(_currentBoardConfig->imageHeight * scale);
-        yStart = WS_L_LEFT_PANEL_Y + drawH + 4;
-    } else {
-        yStart = WS_L_LEFT_PANEL_Y + WS_L_LEFT_PANEL_H - WS_L_CLIMB_INFO_HEIGHT;
+        return WS_L_LEFT_PANEL_Y + drawH + 4;
     }
-#else
-    int yStart = WS_L_LEFT_PANEL_Y + WS_L_LEFT_PANEL_H - WS_L_CLIMB_INFO_HEIGHT;
 #endif
+    return WS_L_LEFT_PANEL_Y + WS_L_LEFT_PANEL_H - WS_L_CLIMB_INFO_HEIGHT;
+}
+
+void WaveshareDisplay::drawLandscapeClimbInfo() {
+    int yStart = landscapeClimbInfoY();
 
     // Clear climb info area
     _display.fillRect(WS_L_LEFT_PANEL_X, yStart, WS_L_LEFT_PANEL_W, WS_L_CLIMB_INFO_HEIGHT, COLOR_BACKGROUND);
 
+    if (!_hasClimb) return;
+
     int centerX = WS_L_LEFT_PANEL_X + WS_L_LEFT_PANEL_W / 2;
 
     // Draw climb name
@@ -1219,10 +1691,10 @@ void WaveshareDisplay::drawLandscapeClimbInfo() {
         int badgeX = centerX - badgeWidth / 2;
         int badgeY = yStart + 28;
 
-        uint16_t gradeColor565 = getGradeColor(_grade.c_str());
+        uint16_t gradeColor565 = getGradeColorById(_gradeId);
         _display.fillRoundRect(badgeX, badgeY, badgeWidth, badgeHeight, 8, gradeColor565);
 
-        uint16_t textColor = getGradeTextColor(gradeColor565);
+        uint16_t textColor = getGradeTextColorById(_gradeId);
         _display.setFont(&fonts::FreeSansBold9pt7b);
         _display.setTextColor(textColor);
         _display.setTextDatum(lgfx::middle_center);
@@ -1240,58 +1712,88 @@ void WaveshareDisplay::drawLandscapeClimbInfo() {
 
 void WaveshareDisplay::drawLandscapeQRCode() {
     if (!_hasQRCode || _sessionId.length() == 0) return;
+    if (!updateQrSprite(WS_L_QR_SIZE, 2)) return;
 
-    // Generate QR code
-    QRCode qrCode;
-    qrcode_initText(&qrCode, _qrCodeData, QR_VERSION, ECC_LOW, _qrUrl.c_str());
+    // Bottom-left corner of left panel; the 2px white border sits inside the margin
+    int side = _qrSprite.width();
+    int qrX = WS_L_LEFT_PANEL_X + WS_L_QR_MARGIN - 2;
+    int qrY = WS_L_LEFT_PANEL_Y + WS_L_LEFT_PANEL_H - WS_L_QR_MARGIN - side + 2;
+    _qrSprite.pushSprite(&_display, qrX, qrY);
+}
 
-    int qrSize = qrCode.size;
-    int pixelSize = WS_L_QR_SIZE / qrSize;
-    if (pixelSize < 1) pixelSize = 1;
+void WaveshareDisplay::updateQueueScrollOffset() {
+    _queueScroll.setExtent(_queueCount * WS_L_QUEUE_ITEM_HEIGHT, WS_L_QUEUE_LIST_H);
 
-    int actualQrSize = pixelSize * qrSize;
+    // Leave the list where the user scrolled it until the climb or queue changes
+    if (_currentQueueIndex == _scrollCenteredIndex && _queueCount == _scrollCenteredCount) {
+        return;
+    }
+    _scrollCenteredIndex = _currentQueueIndex;
+    _scrollCenteredCount = _queueCount;
+    if (_queueScroll.isPressed()) {
+        return;
+    }
 
-    // Position in bottom-left corner of left panel
-    int qrX = WS_L_LEFT_PANEL_X + WS_L_QR_MARGIN;
-    int qrY = WS_L_LEFT_PANEL_Y + WS_L_LEFT_PANEL_H - actualQrSize - WS_L_QR_MARGIN;
+    // Center the current item in the list (clamped at either end)
+    int32_t center = _currentQueueIndex * WS_L_QUEUE_ITEM_HEIGHT + WS_L_QUEUE_ITEM_HEIGHT / 2;
+    _queueScroll.scrollTo(center - WS_L_QUEUE_LIST_H / 2);
+}
 
-    // Draw white background
-    _display.fillRect(qrX - 2, qrY - 2, actualQrSize + 4, actualQrSize + 4, COLOR_QR_BG);
+TouchEvent WaveshareDisplay::handleQueueGesture(bool touched, const lgfx::touch_point_t& tp, unsigned long now) {
+    TouchEvent event;
 
-    // Draw QR code modules
-    for (uint8_t y = 0; y < qrSize; y++) {
-        for (uint8_t x = 0; x < qrSize; x++) {
-            if (qrcode_getModule(&qrCode, x, y)) {
-                _display.fillRect(qrX + x * pixelSize, qrY + y * pixelSize,
-                                  pixelSize, pixelSize, COLOR_QR_FG);
+    {
+        // Scroll state is read by the draw code
+        DrawLock draw(*this);
+        if (touched) {
+            _queueTouchX = tp.x;
+            _queueTouchY = tp.y;
+            if (!_queueScroll.isPressed()) {
+                _queueScroll.press(tp.y, now);
+            } else if (_queueScroll.move(tp.y, now)) {
+                _scrollFramePending = true;
+            }
+        } else {
+            _queueGesture = false;
+            if (_queueScroll.release(now)) {
+                // Tap: select the item under the finger
+                int tappedQueueIndex =
+                    (_queueScroll.offset() + _queueTouchY - WS_L_QUEUE_LIST_Y) / WS_L_QUEUE_ITEM_HEIGHT;
+                if (tappedQueueIndex < getQueueCount() && tappedQueueIndex != getCurrentQueueIndex()) {
+                    event.action = TouchAction::NAVIGATE_TO_INDEX;
+                    event.targetIndex = tappedQueueIndex;
+                    event.x = _queueTouchX;
+                    event.y = _queueTouchY;
+                }
             }
         }
     }
+
+    stepQueueScroll(now);
+    return event;
 }
 
-void WaveshareDisplay::updateQueueScrollOffset() {
-    if (_queueCount <= WS_L_QUEUE_VISIBLE_ITEMS) {
-        _queueScrollOffset = 0;
-        return;
+void WaveshareDisplay::stepQueueScroll(unsigned long now) {
+    if (_queueScroll.isFlinging()) {
+        DrawLock draw(*this);
+        if (_queueScroll.step(now)) {
+            _scrollFramePending = true;
+        }
     }
 
-    // Center current item at ~position 4 (midpoint of visible items)
-    int targetCenter = WS_L_QUEUE_VISIBLE_ITEMS / 2;
-    _queueScrollOffset = _currentQueueIndex - targetCenter;
-
-    // Clamp to valid range
-    int maxOffset = _queueCount - WS_L_QUEUE_VISIBLE_ITEMS;
-    if (_queueScrollOffset < 0) _queueScrollOffset = 0;
-    if (_queueScrollOffset > maxOffset) _queueScrollOffset = maxOffset;
+    // Samples arrive faster than frames; draw the latest offset at most once per frame
+    if (_scrollFramePending && now - _lastScrollFrameMs >= WS_SCROLL_FRAME_MS) {
+        _scrollFramePending = false;
+        _lastScrollFrameMs = now;
+        requestRender(RENDER_SCROLL);
+    }
 }
 
-void WaveshareDisplay::drawLandscapeQueuePanel() {
-    // Clear right panel
-    _display.fillRect(WS_L_RIGHT_PANEL_X, WS_L_RIGHT_PANEL_Y,
-                      WS_L_RIGHT_PANEL_W, WS_L_RIGHT_PANEL_H, COLOR_BACKGROUND);
+void WaveshareDisplay::drawLandscapeQueueHeader(const WidgetRect& rect) {
+    _display.fillRect(rect.x, rect.y, rect.w, rect.h, COLOR_BACKGROUND);
 
     // Draw panel separator line
-    _display.drawFastVLine(WS_L_RIGHT_PANEL_X, WS_L_RIGHT_PANEL_Y, WS_L_RIGHT_PANEL_H, 0x2104);
+    _display.drawFastVLine(WS_L_RIGHT_PANEL_X, rect.y, rect.h, 0x2104);
 
     if (_queueCount == 0) {
         _display.setFont(&fonts::FreeSansBold12pt7b);
@@ -1307,8 +1809,6 @@ void WaveshareDisplay::drawLandscapeQueuePanel() {
         return;
     }
 
-    updateQueueScrollOffset();
-
     // Draw queue header with position
     _display.setFont(&fonts::FreeSansBold9pt7b);
     _display.setTextColor(COLOR_TEXT_DIM);
@@ -1317,75 +1817,138 @@ void WaveshareDisplay::drawLandscapeQueuePanel() {
     snprintf(headerStr, sizeof(headerStr), "Queue %d/%d", _currentQueueIndex + 1, _queueCount);
     _display.drawString(headerStr, WS_L_RIGHT_PANEL_X + WS_L_RIGHT_PANEL_W / 2, WS_L_RIGHT_PANEL_Y + 4);
     _display.setTextDatum(lgfx::top_left);
+}
 
-    int listStartY = WS_L_RIGHT_PANEL_Y + 24;
-    int itemX = WS_L_RIGHT_PANEL_X + 8;
-    int itemW = WS_L_RIGHT_PANEL_W - 16;
+void WaveshareDisplay::drawLandscapeQueueList(const WidgetRect& rect) {
+    int32_t offset = _queueScroll.offset();
+    bool strip = ensureQueueStrip();
+
+    // Walk down the list one (partly) visible item at a time
+    int y = rect.y;
+    int bottom = rect.y + rect.h;
+    while (y < bottom) {
+        int32_t contentY = offset + (y - rect.y);
+        int queueIndex = contentY / WS_L_QUEUE_ITEM_HEIGHT;
+        int rowTop = contentY % WS_L_QUEUE_ITEM_HEIGHT;
+        int rows = min(WS_L_QUEUE_ITEM_HEIGHT - rowTop, bottom - y);
+
+        if (queueIndex >= _queueCount) {
+            // Empty space below the last item
+            _display.fillRect(rect.x, y, rect.w, bottom - y, COLOR_BACKGROUND);
+            _display.drawFastVLine(WS_L_RIGHT_PANEL_X, y, bottom - y, 0x2104);
+            break;
+        }
 
-    int visibleCount = min(_queueCount - _queueScrollOffset, WS_L_QUEUE_VISIBLE_ITEMS);
+        if (strip) {
+            // Render the row into its strip slot only if the slot holds something else
+            int slot = queueIndex % WS_L_QUEUE_STRIP_ROWS;
+            uint32_t rowHash = queueRowHash(queueIndex);
+            QueueStripRow& stripRow = _queueStripRows[slot];
+            if (stripRow.queueIndex != queueIndex || stripRow.hash != rowHash) {
+                drawLandscapeQueueRow(_queueStrip, queueIndex,
+                                      WidgetRect(0, slot * WS_L_QUEUE_ITEM_HEIGHT, rect.w, WS_L_QUEUE_ITEM_HEIGHT));
+                stripRow.queueIndex = queueIndex;
+                stripRow.hash = rowHash;
+            }
+            const lgfx::swap565_t* pixels = (const lgfx::swap565_t*)_queueStrip.getBuffer() +
+                                            (slot * WS_L_QUEUE_ITEM_HEIGHT + rowTop) * rect.w;
+            _display.pushImage(rect.x, y, rect.w, rows, pixels);
+        } else {
+            // No strip: draw the row in place; the widget clip trims the part above the list
+            drawLandscapeQueueRow(_display, queueIndex, WidgetRect(rect.x, y - rowTop, rect.w, WS_L_QUEUE_ITEM_HEIGHT));
+        }
 
-    for (int i = 0; i < visibleCount; i++) {
-        int queueIndex = _queueScrollOffset + i;
-        int itemY = listStartY + i * WS_L_QUEUE_ITEM_HEIGHT;
+        y += rows;
+    }
+}
 
-        const LocalQueueItem* item = getQueueItem(queueIndex);
-        if (!item || !item->isValid()) continue;
+bool WaveshareDisplay::ensureQueueStrip() {
+    if (_queueStrip.getBuffer()) {
+        return true;
+    }
 
-        // Determine colors based on position relative to current
-        uint16_t textColor;
-        if (queueIndex == _currentQueueIndex) {
-            // Current item - highlighted background
-            _display.fillRect(WS_L_RIGHT_PANEL_X + 2, itemY, WS_L_RIGHT_PANEL_W - 4, WS_L_QUEUE_ITEM_HEIGHT, 0x2104);
-            textColor = COLOR_TEXT;
-        } else if (queueIndex < _currentQueueIndex) {
-            // Previous/completed items - grey
-            textColor = COLOR_TEXT_DIM;
-        } else {
-            // Upcoming items - white
-            textColor = COLOR_TEXT;
-        }
+    _queueStrip.setPsram(true);
+    if (!_queueStrip.createSprite(WS_L_RIGHT_PANEL_W, WS_L_QUEUE_STRIP_ROWS * WS_L_QUEUE_ITEM_HEIGHT)) {
+        return false;
+    }
+    for (QueueStripRow& row : _queueStripRows) {
+        row.queueIndex = -1;
+    }
+    return true;
+}
 
-        // Draw climb name (left-aligned, truncated)
-        _display.setFont(&fonts::FreeSansBold9pt7b);
-        _display.setTextColor(textColor);
-        _display.setTextDatum(lgfx::middle_left);
+uint32_t WaveshareDisplay::queueRowHash(int queueIndex) {
+    // Item content plus its position relative to the current climb
+    ContentHash hash;
+    const LocalQueueItem* item = queueIndex < _queueCount ? &_queueItems[queueIndex] : nullptr;
+    if (item && item->isValid()) {
+        int state = queueIndex == _currentQueueIndex ? 0 : (queueIndex < _currentQueueIndex ? -1 : 1);
+        hash.add((int32_t)state).add(item->name).add(item->grade).add((uint32_t)item->gradeId);
+    }
+    return hash.value();
+}
 
-        String name = item->name;
-        if (name.length() > 18) {
-            name = name.substring(0, 15) + "...";
-        }
-        _display.drawString(name.c_str(), itemX, itemY + WS_L_QUEUE_ITEM_HEIGHT / 2);
-
-        // Draw grade text in grade color (right-aligned)
-        // Extract V-grade from grade string (e.g., "6c/V5" -> "V5")
-        if (item->grade[0] != '\0') {
-            char vGrade[8] = "";
-            const char* vPos = strchr(item->grade, 'V');
-            if (!vPos) vPos = strchr(item->grade, 'v');
-            if (vPos) {
-                int gi = 0;
-                vGrade[gi++] = 'V';
-                vPos++;
-                while (*vPos >= '0' && *vPos <= '9' && gi < 7) {
-                    vGrade[gi++] = *vPos++;
-                }
-                vGrade[gi] = '\0';
-            } else {
-                // No V-grade found, use the raw grade
-                strncpy(vGrade, item->grade, 7);
-                vGrade[7] = '\0';
-            }
-            _display.setTextDatum(lgfx::middle_right);
-            _display.setTextColor(item->gradeColorRgb);
-            _display.drawString(vGrade, itemX + itemW, itemY + WS_L_QUEUE_ITEM_HEIGHT / 2);
+void WaveshareDisplay::drawLandscapeQueueRow(lgfx::LovyanGFX& dst, int queueIndex, const WidgetRect& rect) {
+    dst.fillRect(rect.x, rect.y, rect.w, rect.h, COLOR_BACKGROUND);
+    dst.drawFastVLine(rect.x, rect.y, rect.h, 0x2104);
+
+    if (queueIndex >= _queueCount) return;
+
+    const LocalQueueItem* item = &_queueItems[queueIndex];
+    if (!item->isValid()) return;
+
+    int itemX = rect.x + 8;
+    int itemW = rect.w - 16;
+    int itemY = rect.y;
+
+    // Determine colors based on position relative to current
+    uint16_t textColor;
+    uint16_t rowBg = COLOR_BACKGROUND;
+    if (queueIndex == _currentQueueIndex) {
+        // Current item - highlighted background
+        rowBg = 0x2104;
+        dst.fillRect(rect.x + 2, itemY, rect.w - 4, WS_L_QUEUE_ITEM_HEIGHT, rowBg);
+        textColor = COLOR_TEXT;
+    } else if (queueIndex < _currentQueueIndex) {
+        // Previous/completed items - grey
+        textColor = COLOR_TEXT_DIM;
+    } else {
+        // Upcoming items - white
+        textColor = COLOR_TEXT;
+    }
+
+    // Name and grade are 24px strips centred in the row, cached so scrolling
+    // and refreshes blit them instead of re-rendering glyphs
+    const int gradeW = 44;
+    int textY = itemY + WS_L_QUEUE_ITEM_HEIGHT / 2 - 12;
+
+    // Draw climb name (left-aligned, truncated)
+    String name = item->name;
+    if (name.length() > 18) {
+        name = name.substring(0, 15) + "...";
+    }
+    drawCachedText(dst, name.c_str(), &fonts::FreeSansBold9pt7b, textColor, rowBg,
+                   WidgetRect(itemX, textY, itemW - gradeW, 24), lgfx::middle_left);
+
+    // Draw V-grade in grade color (right-aligned), both looked up by the
+    // grade ID resolved at queue sync
+    if (item->grade[0] != '\0') {
+        const char* label = getGradeLabelById(item->gradeId);
+        char rawGrade[8];
+        if (label[0] == '\0') {
+            // Grade not on the scale, use the raw grade
+            strncpy(rawGrade, item->grade, 7);
+            rawGrade[7] = '\0';
+            label = rawGrade;
         }
+        drawCachedText(dst, label, &fonts::FreeSansBold9pt7b, getGradeColorById(item->gradeId), rowBg,
+                       WidgetRect(itemX + itemW - gradeW, textY, gradeW, 24), lgfx::middle_right);
     }
-
-    _display.setTextDatum(lgfx::top_left);
 }
 
 void WaveshareDisplay::drawLandscapeSettingsScreen() {
     _display.fillScreen(COLOR_BACKGROUND);
+    invalidateLayout();
 
     int sw = WS_L_SCREEN_WIDTH;
 
@@ -1456,6 +2019,8 @@ void WaveshareDisplay::drawLandscapeSettingsScreen() {
     }
 
     _display.setTextDatum(lgfx::top_left);
+
+    present();
 }
 
 TouchEvent WaveshareDisplay::handleLandscapeTouch(int16_t x, int16_t y) {
@@ -1470,20 +2035,7 @@ TouchEvent WaveshareDisplay::handleLandscapeTouch(int16_t x, int16_t y) {
         return event;
     }
 
-    // Right panel - queue item tap
-    if (x >= WS_L_RIGHT_PANEL_X && y >= WS_L_RIGHT_PANEL_Y) {
-        int listStartY = WS_L_RIGHT_PANEL_Y + 24;  // After header
-        if (y >= listStartY) {
-            int itemIndex = (y - listStartY) / WS_L_QUEUE_ITEM_HEIGHT;
-            int tappedQueueIndex = _queueScrollOffset + itemIndex;
-            if (tappedQueueIndex >= 0 && tappedQueueIndex < _queueCount && tappedQueueIndex != _currentQueueIndex) {
-                event.action = TouchAction::NAVIGATE_TO_INDEX;
-                event.targetIndex = tappedQueueIndex;
-                return event;
-            }
-        }
-    }
-
+    // Queue list taps are handled by handleQueueGesture()
     return event;
 }
 
@@ -7,12 +7,17 @@
 #include <LovyanGFX.hpp>
 #include <lgfx/v1/platforms/esp32s3/Panel_RGB.hpp>
 #include <display_base.h>
+#include <kinetic_scroll.h>
+#include <text_cache.h>
+#include <widget_renderer.h>
 
 #include "bus_rgb_bounce.h"
 
 // Board image data is only available when explicitly enabled
 #ifdef ENABLE_BOARD_IMAGE
 #include <board_hold_data.h>
+#include <hold_overlay.h>
+#include <rgb565_tiles.h>
 #endif
 
 #include "ch422g.h"
@@ -70,6 +75,27 @@
 #define WS_SCREEN_WIDTH  480
 #define WS_SCREEN_HEIGHT 800
 
+// Second PSRAM framebuffer swapped on VSYNC (tear-free redraws, +768KB PSRAM)
+#ifndef WS_DOUBLE_BUFFER
+#define WS_DOUBLE_BUFFER 1
+#endif
+
+// Dirty rects tracked per presented frame before falling back to a full copy
+#define WS_MAX_DIRTY_RECTS 16
+
+// Default scanlines per SRAM bounce buffer; overridable with the
+// "bounce_lines" config key (applied at boot, 1-60; divisors of 480 avoid padding)
+#define WS_BOUNCE_LINES 10
+#define WS_BOUNCE_LINES_MAX 60
+
+// Touch sampling (GT911 reports at ~100 Hz) and scroll frame pacing (60 fps)
+#define WS_TOUCH_POLL_MS 10
+#define WS_SCROLL_FRAME_MS 16
+
+// Rasterised text strips kept in PSRAM (queue rows, history, current climb)
+#define WS_TEXT_CACHE_ENTRIES 40
+#define WS_TEXT_CACHE_BYTES (384 * 1024)
+
 // ============================================
 // Display Mode
 // ============================================
@@ -103,6 +129,14 @@ enum class WsDisplayMode : uint8_t { PORTRAIT = 0, LANDSCAPE = 1 };
 #define WS_L_QUEUE_ITEM_HEIGHT 48
 #define WS_L_QUEUE_VISIBLE_ITEMS 9
 
+// Scrollable queue list below the "Queue n/m" header
+#define WS_L_QUEUE_LIST_Y (WS_L_RIGHT_PANEL_Y + 24)
+#define WS_L_QUEUE_LIST_H (WS_L_SCREEN_HEIGHT - WS_L_QUEUE_LIST_Y)
+
+// Off-screen row strip: a ring of pre-rendered rows (PSRAM, ~280 KB). Any
+// scroll position shows at most VISIBLE + 1 rows, so each has its own slot.
+#define WS_L_QUEUE_STRIP_ROWS (WS_L_QUEUE_VISIBLE_ITEMS + 2)
+
 // Climb info compact below board image in left panel
 #define WS_L_CLIMB_INFO_HEIGHT 60
 
@@ -219,20 +253,49 @@ struct TouchEvent {
 // Waveshare 7" LGFX Display Class (RGB bus)
 // ============================================
 
+/**
+ * Panel_RGB whose line table can be moved to another framebuffer, so drawing
+ * follows the bus's back buffer after each swap.
+ */
+class Panel_RGB_Swap : public lgfx::Panel_RGB {
+  public:
+    void setDrawBuffer(uint8_t* buffer);
+
+    // Map a rect in the current rotation to panel-native coordinates
+    void toNativeRect(int32_t& x, int32_t& y, int32_t& w, int32_t& h) const;
+};
+
 class LGFX_Waveshare7 : public lgfx::LGFX_Device {
-    lgfx::Panel_RGB _panel_instance;
+    Panel_RGB_Swap _panel_instance;
     lgfx::Bus_RGB_Bounce _bus_instance;
     lgfx::Touch_GT911 _touch_instance;
 
   public:
     LGFX_Waveshare7();
+
+    /**
+     * Show the frame drawn so far (double buffered builds) and continue
+     * drawing into the other buffer. rects are the regions changed since the
+     * last present, in screen coordinates; nullptr means the whole screen.
+     */
+    bool present(const WidgetRect* rects, int count);
+
+    // Must be called before init()
+    void setBounceLines(uint16_t lines);
+    const lgfx::Bus_RGB_Bounce::stats_t& getBounceStats() const { return _bus_instance.getStats(); }
+    void resetBounceStats() { _bus_instance.resetStats(); }
+    uint16_t getBounceLines() const { return _bus_instance.getBounceLines(); }
+
+    bool isDoubleBuffered() const { return _bus_instance.isDoubleBuffered(); }
+    uint32_t getSwapCount() const { return _bus_instance.getSwapCount(); }
+    uint32_t getLastCopyForwardBytes() const { return _bus_instance.getLastCopyForwardBytes(); }
 };
 
 // ============================================
 // Waveshare Display Manager
 // ============================================
 
-class WaveshareDisplay : public DisplayBase {
+class WaveshareDisplay : public DisplayBase, public WidgetHost {
   public:
     WaveshareDisplay();
     ~WaveshareDisplay();
@@ -246,6 +309,13 @@ class WaveshareDisplay : public DisplayBase {
     void refresh() override;
     void refreshInfoOnly() override;
 
+    /**
+     * Make everything drawn since the last present() visible. Called at the
+     * end of each screen update; code drawing through getDisplay() directly
+     * must call it too. Cheap when nothing was drawn.
+     */
+    void present();
+
     // Touch handling
     TouchEvent pollTouch();
 
@@ -269,8 +339,22 @@ class WaveshareDisplay : public DisplayBase {
     // Display mode
     WsDisplayMode getDisplayMode() const { return _displayMode; }
 
+    // Dirty-rectangle render statistics (pixels and time per refresh)
+    const WidgetRenderStats& getLastRenderStats() const { return _renderer.getLastStats(); }
+    const WidgetRenderTotals& getRenderTotals() const { return _renderer.getTotals(); }
+
+    // Cached text strip hits/misses/evictions
+    const TextCacheStats& getTextCacheStats() const { return _textCache.getStats(); }
+
   protected:
     void onStatusChanged() override;
+    void onScrollChanged() override;
+    void snapshotState() override;
+
+    // WidgetHost overrides
+    uint32_t widgetHash(uint8_t id) override;
+    void drawWidget(uint8_t id, const WidgetRect& rect, bool retained) override;
+    void setWidgetClip(const WidgetRect* rect) override;
 
   private:
     LGFX_Waveshare7 _display;
@@ -279,9 +363,60 @@ class WaveshareDisplay : public DisplayBase {
     // Display mode
     WsDisplayMode _displayMode = WsDisplayMode::PORTRAIT;
 
-    // Touch debouncing
-    unsigned long _lastTouchTime;
-    static const unsigned long TOUCH_DEBOUNCE_MS = 150;
+    // Touch state: buttons fire once on touch-down; a touch that starts on
+    // the landscape queue list is a scroll gesture until it lifts
+    unsigned long _lastTouchPollMs = 0;
+    bool _touchDown = false;
+    bool _queueGesture = false;
+
+    // Screen regions tracked by the retained-mode renderer (z-order = layout order)
+    enum WidgetId : uint8_t {
+        WIDGET_STATUS_BAR = 0,
+        WIDGET_BOARD_IMAGE,
+        WIDGET_CLIMB_INFO,
+        WIDGET_CURRENT_CLIMB,
+        WIDGET_QR_CODE,
+        WIDGET_NEXT_CLIMB,
+        WIDGET_HISTORY,
+        WIDGET_NAV_BUTTONS,
+        WIDGET_QUEUE_HEADER,
+        WIDGET_QUEUE_LIST,
+    };
+
+    WidgetRenderer _renderer;
+    uint32_t _layoutKey = 0;
+    bool _layoutValid = false;
+
+    void layoutWidgets();
+    void layoutPortraitWidgets();
+    void layoutLandscapeWidgets();
+    void invalidateLayout() {
+        _layoutValid = false;
+        markDirtyAll();
+    }
+    void renderWidgets(uint32_t skipMask = 0);
+
+    // Regions drawn since the last present(); overflow means the whole screen
+    WidgetRect _dirtyRects[WS_MAX_DIRTY_RECTS];
+    int _dirtyCount = 0;
+    bool _dirtyAll = false;
+    void markDirty(const WidgetRect& rect);
+    void markDirtyAll() { _dirtyAll = true; }
+
+    // Text strips rasterised once and blitted on later refreshes and scrolls;
+    // one PSRAM sprite per cache slot, resized when a slot is recycled
+    TextCache _textCache{WS_TEXT_CACHE_ENTRIES};
+    LGFX_Sprite* _textSprites[WS_TEXT_CACHE_ENTRIES] = {};
+    uint32_t _textCacheBytes = 0;
+    void drawCachedText(lgfx::LovyanGFX& dst, const char* text, const lgfx::IFont* font, uint16_t color,
+                        uint16_t bg, const WidgetRect& box, lgfx::textdatum_t datum);
+    void freeTextSprite(int slot);
+
+    // Session QR code pre-rendered at 1 bpp for the active layout (portrait
+    // 300px, landscape 80px); rebuilt when the session or layout changes
+    LGFX_Sprite _qrSprite;
+    uint32_t _qrSpriteGeneration = 0;
+    bool updateQrSprite(int targetPx, int border);
 
     // Settings screen state
     bool _settingsScreenActive = false;
@@ -301,17 +436,39 @@ class WaveshareDisplay : public DisplayBase {
 
     // Landscape drawing methods
     void drawLandscapeStatusBar();
-    void drawLandscapeBoardPanel();
-    void drawLandscapeQueuePanel();
+    void drawLandscapeBoardPanel(const WidgetRect& rect, bool retained);
+    void drawLandscapeQueueHeader(const WidgetRect& rect);
+    void drawLandscapeQueueList(const WidgetRect& rect);
+    void drawLandscapeQueueRow(lgfx::LovyanGFX& dst, int queueIndex, const WidgetRect& rect);
+    uint32_t queueRowHash(int queueIndex);
     void drawLandscapeClimbInfo();
     void drawLandscapeQRCode();
+    int landscapeClimbInfoY() const;
     void drawLandscapeSettingsScreen();
     TouchEvent handleLandscapeTouch(int16_t x, int16_t y);
     TouchAction handleLandscapeSettingsTouch(int16_t x, int16_t y);
 
-    // Queue scrolling for landscape
-    int _queueScrollOffset = 0;
+    // Queue scrolling for landscape: pixel offset driven by touch drags and
+    // flings, re-centred on the current climb when it or the queue changes
+    KineticScroll _queueScroll;
+    int _scrollCenteredIndex = -1;
+    int _scrollCenteredCount = -1;
+    int16_t _queueTouchX = 0;
+    int16_t _queueTouchY = 0;
+    unsigned long _lastScrollFrameMs = 0;
+    bool _scrollFramePending = false;
     void updateQueueScrollOffset();
+    TouchEvent handleQueueGesture(bool touched, const lgfx::touch_point_t& tp, unsigned long now);
+    void stepQueueScroll(unsigned long now);
+
+    // Rows rendered once into the strip and copied to the panel per frame
+    struct QueueStripRow {
+        int queueIndex;
+        uint32_t hash;
+    };
+    LGFX_Sprite _queueStrip;
+    QueueStripRow _queueStripRows[WS_L_QUEUE_STRIP_ROWS];
+    bool ensureQueueStrip();
 
 #ifdef ENABLE_BOARD_IMAGE
   public:
@@ -322,22 +479,64 @@ class WaveshareDisplay : public DisplayBase {
     void setBoardConfig(const BoardConfig* config);
     void setLedCommands(const LedCmd* commands, int count);
 
+    // Build the hold overlay one LED at a time (no intermediate LedCmd array).
+    // LEDs without a hold on the current board are dropped.
+    void clearLedCommands() { _pendingHoldCount = 0; }
+    void addLedCommand(uint16_t position, uint8_t r, uint8_t g, uint8_t b);
+
+    /**
+     * Decode the current board image into its PSRAM sprite now rather than on
+     * the next refresh. Returns false when no sprite could be allocated and
+     * the image is drawn straight from flash on every refresh.
+     */
+    bool preloadBoardImage();
+
+    // Time taken to first show the current board image: the sprite decode,
+    // or the last full draw from flash when there is no sprite
+    uint32_t getLastImageDecodeUs() const { return _lastImageDecodeUs; }
+
   private:
     // Board image rendering (v2 layout)
-    void drawBoardImageWithHolds();
+    void drawBoardImageWithHolds(const WidgetRect& rect, bool retained);
     void drawClimbInfoCompact();
-
-    // Board image state
+    void cacheBoardImage(const BoardConfig* cfg);
+    void decodeBoardImageTiles(const BoardConfig* cfg, uint16_t* dst);
+    void blitBoardImage();
+    void blitBoardImageTiles(const BoardConfig* cfg, const WidgetRect& clip);
+    int buildHoldCircles();
+    void drawHoldOverlay(const WidgetRect& rect);
+
+    // Board image state (render-side snapshot of _pendingBoardConfig)
     bool _hasBoardImage = false;
     const BoardConfig* _currentBoardConfig = nullptr;
 
     // Cached decoded board image (PSRAM sprite avoids re-decoding JPEG each refresh)
     LGFX_Sprite* _boardImageSprite = nullptr;
     const BoardConfig* _cachedBoardConfig = nullptr;
-
-    // Current LED commands for hold overlay
-    LedCmd _ledCommands[MAX_LED_COMMANDS];
-    int _ledCommandCount = 0;
+    uint32_t _lastImageDecodeUs = 0;
+
+    // One decoded RLE tile, for drawing straight from flash without a sprite
+    uint16_t* _tileBuffer = nullptr;
+    const BoardConfig* _tileBufferConfig = nullptr;
+
+    // Current LED commands for hold overlay, resolved through cfg->ledToHold.
+    // Setters fill the pending set; snapshotState() copies it for drawing.
+    struct HoldCmd { uint16_t holdIndex; uint16_t color; };
+    HoldCmd _holdCommands[MAX_LED_COMMANDS];
+    int _holdCommandCount = 0;
+    const BoardConfig* _pendingBoardConfig = nullptr;
+    HoldCmd _pendingHolds[MAX_LED_COMMANDS];
+    int _pendingHoldCount = 0;
+
+    // Where the board image sits on screen (scale < 1 in landscape)
+    int _boardImageX = 0;
+    int _boardImageY = 0;
+    float _boardImageScale = 1.0f;
+
+    // Hold circles on screen; a climb change restores removed holds from the
+    // cached sprite and draws only added/changed ones
+    HoldOverlay _holdOverlay;
+    HoldCircle _holdCircles[MAX_LED_COMMANDS];
 #endif
 };
 
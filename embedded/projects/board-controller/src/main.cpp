@@ -5,11 +5,16 @@
 #include <wifi_utils.h>
 
 #include <aurora_protocol.h>
+#include <climb_journal.h>
 #include <config_manager.h>
 #include <graphql_ws_client.h>
 #include <led_controller.h>
 #include <log_buffer.h>
+#include <loop_profiler.h>
+#include <loop_scheduler.h>
 #include <nordic_uart_ble.h>
+#include <radio_coex.h>
+#include <telemetry_uplink.h>
 
 // Conditional libraries for display and proxy modes
 #ifdef ENABLE_BLE_PROXY
@@ -18,6 +23,12 @@
 #include <climb_history.h>
 #endif
 
+// Raw BLE traffic capture for offline replay (debug builds only)
+#ifdef ENABLE_BLE_CAPTURE
+#include <ble_capture.h>
+#include <LittleFS.h>
+#endif
+
 // Display support - include the right display driver
 #ifdef ENABLE_WAVESHARE_DISPLAY
 #include <waveshare_display.h>
@@ -42,12 +53,16 @@ bool wifiConnected = false;
 bool backendConnected = false;
 bool bleInitialized = false;
 
+// Radio tasks, signalled by their event callbacks; the poll period is a fallback
+SchedulerTaskId g_graphqlTask = SCHEDULER_INVALID_TASK;
+SchedulerTaskId g_bleTask = SCHEDULER_INVALID_TASK;
+
 #ifdef HAS_DISPLAY
 // Navigation mutation debounce - wait for rapid presses to stop before sending mutation
 const unsigned long G_MUTATION_DEBOUNCE_MS = 100;  // Wait 100ms after last press before sending mutation
-unsigned long g_pendingMutationTime = 0;           // When to send the debounced mutation (0 = none pending)
-bool g_mutationPending = false;                    // Flag indicating a mutation is waiting to be sent
-char g_pendingMutationUuid[64] = "";               // UUID of the queue item to navigate to
+SchedulerTaskId g_mutationTask = SCHEDULER_INVALID_TASK;  // Timer task that sends the debounced mutation
+bool g_mutationPending = false;                           // Flag indicating a mutation is waiting to be sent
+char g_pendingMutationUuid[64] = "";                      // UUID of the queue item to navigate to
 #endif
 
 #ifdef HAS_DISPLAY
@@ -61,7 +76,7 @@ String boardType = "kilter";
 bool hasCurrentClimb = false;
 
 // Static buffer for queue sync to avoid heap fragmentation
-// LocalQueueItem is ~88 bytes each, so 150 items = ~13KB
+// LocalQueueItem is ~120 bytes each, so 150 items = ~18KB
 static LocalQueueItem g_queueSyncBuffer[MAX_QUEUE_SIZE];
 
 #if defined(ENABLE_WAVESHARE_DISPLAY) && defined(ENABLE_BOARD_IMAGE)
@@ -132,32 +147,6 @@ String extractConfigKey(const char* boardPath) {
     return bp.substring(0, slash3 + 1) + sortedSetIds;
 }
 #endif
-
-/**
- * Convert hex color string to RGB565 without String allocations
- * @param hex Color string in format "#RRGGBB"
- * @return RGB565 color value, or 0xFFFF (white) if invalid
- */
-static uint16_t hexToRgb565Fast(const char* hex) {
-    if (!hex || hex[0] != '#' || strlen(hex) < 7) {
-        return 0xFFFF;  // White default
-    }
-
-    // Parse hex digits directly without String objects
-    char buf[3] = {0, 0, 0};
-
-    buf[0] = hex[1]; buf[1] = hex[2];
-    uint8_t r = strtol(buf, NULL, 16);
-
-    buf[0] = hex[3]; buf[1] = hex[4];
-    uint8_t g = strtol(buf, NULL, 16);
-
-    buf[0] = hex[5]; buf[1] = hex[6];
-    uint8_t b = strtol(buf, NULL, 16);
-
-    // Convert to RGB565: 5 bits red, 6 bits green, 5 bits blue
-    return ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3);
-}
 #endif
 
 // Forward declarations
@@ -165,9 +154,16 @@ void onWiFiStateChange(WiFiConnectionState state);
 void onBLEConnect(bool connected);
 void onBLEData(const uint8_t* data, size_t len);
 void onBLELedData(const LedCommand* commands, int count, int angle);
+#ifdef ENABLE_BLE_CAPTURE
+void registerCaptureRoutes();
+#endif
 void onGraphQLStateChange(GraphQLConnectionState state);
 void onGraphQLMessage(JsonDocument& doc);
+void journalLedUpdate(JsonObject& data);
+size_t writeTelemetryMetrics(char* out, size_t capacity);
 void initializeBLE();
+void wakeGraphQLTask();
+void wakeBleTask();
 #ifdef HAS_DISPLAY
 void handleLedUpdateExtended(JsonObject& data);
 void onQueueSync(const ControllerQueueSyncData& data);
@@ -177,9 +173,15 @@ void navigateToIndex(int index);
 void sendNavigationMutation(const char* queueItemUuid);
 #endif
 void startupAnimation();
+void registerLoopTasks();
+void registerSchedulerRoutes();
+void registerMetricsRoutes();
 #ifdef ENABLE_WAVESHARE_DISPLAY
 void updateSettingsDisplay(bool proxyEnabled);
 #endif
+#if defined(ENABLE_WAVESHARE_DISPLAY) || defined(ENABLE_DISPLAY)
+void registerDisplayRoutes();
+#endif
 
 #ifdef ENABLE_BLE_PROXY
 void onBLERawForward(const uint8_t* data, size_t len);
@@ -188,6 +190,9 @@ void onWebSocketLedUpdate(const LedCommand* commands, int count);
 
 // Function to send data to app via BLE (used by proxy)
 void sendToAppViaBLE(const uint8_t* data, size_t len) {
+#ifdef ENABLE_BLE_CAPTURE
+    Capture.record(BLECaptureDirection::BOARD_TO_APP, data, len);
+#endif
     BLE.send(data, len);
 }
 #endif
@@ -203,10 +208,15 @@ void initializeBLE() {
     }
 
     Logger.logln("Initializing BLE as '%s'...", BLE_DEVICE_NAME);
+#ifdef ENABLE_BLE_CAPTURE
+    // Record from the first connection on; /api/capture/start restarts it
+    Capture.start();
+#endif
     BLE.begin(BLE_DEVICE_NAME, true);
     BLE.setConnectCallback(onBLEConnect);
     BLE.setDataCallback(onBLEData);
     BLE.setLedDataCallback(onBLELedData);
+    BLE.setWakeCallback(wakeBleTask);
 
 #ifdef ENABLE_BLE_PROXY
     // Set up raw data forwarding for proxy mode
@@ -217,6 +227,8 @@ void initializeBLE() {
     Proxy.begin(targetMac);
     Proxy.setStateCallback(onProxyStateChange);
     Proxy.setSendToAppCallback(sendToAppViaBLE);
+    Scanner.setWakeCallback(wakeBleTask);
+    BLEClientConnection::setWakeCallback(wakeBleTask);
 #endif
 
 #ifdef HAS_DISPLAY
@@ -227,10 +239,23 @@ void initializeBLE() {
     Logger.logln("BLE initialization complete");
 }
 
+/**
+ * Print what is still queued before esp_restart() reboots. A panic skips
+ * shutdown handlers, so crash output is left to the panic handler itself.
+ */
+void drainLogOnShutdown() {
+    Logger.drain(LOG_RING_SIZE);
+}
+
 void setup() {
     Serial.begin(115200);
     delay(3000);  // Longer delay to ensure serial monitor catches boot messages
 
+    // The log task does not run until setup() returns; print each line as it
+    // is logged so a hang during init still shows how far boot got
+    Logger.setSynchronous(true);
+    esp_register_shutdown_handler(drainLogOnShutdown);
+
     Logger.logln("=================================");
     Logger.logln("%s v%s", DEVICE_NAME, FIRMWARE_VERSION);
     Logger.logln("LED_PIN = %d", LED_PIN);
@@ -245,6 +270,13 @@ void setup() {
     // Initialize config manager
     Config.begin();
 
+    // Climbs shown are journaled to flash and uploaded when the backend is reachable
+    Journal.begin();
+
+    // Logs and metrics are streamed to the backend in spare link time
+    Telemetry.begin();
+    Telemetry.setMetricsProvider(writeTelemetryMetrics);
+
 #ifdef HAS_DISPLAY
     // Initialize display first (before LEDs for visual feedback)
     Logger.logln("Initializing display...");
@@ -312,6 +344,17 @@ void setup() {
     // Initialize web config server
     Logger.logln("Starting web server...");
     WebConfig.begin();
+#ifdef ENABLE_BLE_CAPTURE
+    registerCaptureRoutes();
+#endif
+#if defined(ENABLE_WAVESHARE_DISPLAY) || defined(ENABLE_DISPLAY)
+    registerDisplayRoutes();
+#endif
+    registerSchedulerRoutes();
+    registerMetricsRoutes();
+
+    // Hand the main loop over to the scheduler
+    registerLoopTasks();
 
     Logger.logln("Setup complete!");
     if (WiFiMgr.isAPMode()) {
@@ -326,9 +369,17 @@ void setup() {
     // Don't refresh display if in AP mode - keep showing setup screen
 #ifdef HAS_DISPLAY
     if (!WiFiMgr.isAPMode()) {
-        Display.refresh();
+        Display.redraw();
+    }
+
+    // From here on display state changes are drawn by the render task
+    if (!Display.startRenderTask()) {
+        Logger.logln("WARNING: Display render task failed to start - drawing inline");
     }
 #endif
+
+    // From here on the log task drains the ring
+    Logger.setSynchronous(false);
 }
 
 #ifdef ENABLE_WAVESHARE_DISPLAY
@@ -345,48 +396,204 @@ void updateSettingsDisplay(bool proxyEnabled) {
 }
 #endif
 
-void loop() {
-    // Process WiFi
+// =============================================================================
+// Main Loop Tasks
+// =============================================================================
+// loop() only runs the scheduler. Each subsystem polls at the rate it needs
+// and the loop task sleeps in between instead of spinning, so the per-task
+// accounting (GET /api/scheduler) shows where loop time goes.
+
+void wifiTask() {
     WiFiMgr.loop();
+}
 
-    // Process BLE (only if initialized - deferred until WiFi configured)
-    if (bleInitialized) {
-        BLE.loop();
+void coexTask() {
+    // Re-evaluate BLE/WiFi airtime split
+    Coex.loop();
+}
 
-#ifdef ENABLE_BLE_PROXY
-        // Process BLE proxy
-        Proxy.loop();
+#ifdef ENABLE_BLE_CAPTURE
+void captureTask() {
+    // Write staged BLE capture records to flash
+    Capture.loop();
+}
 #endif
+
+void bleTask() {
+    // BLE is deferred until WiFi is configured
+    if (!bleInitialized) {
+        return;
     }
+    BLE.loop();
+
+#ifdef ENABLE_BLE_PROXY
+    Proxy.loop();
+#endif
+}
+
+/**
+ * Run the graphql task on the next pass. Called for every WebSocket event,
+ * so a burst of frames drains back to back instead of one per poll.
+ */
+void wakeGraphQLTask() {
+    Scheduler.signal(g_graphqlTask);
+}
+
+/**
+ * Run the ble task on the next pass. Called from the NimBLE host and
+ * connector tasks after writes, notifications, connects and scan results.
+ */
+void wakeBleTask() {
+    Scheduler.signal(g_bleTask);
+}
 
-    // Process WebSocket if WiFi connected
+void graphqlTask() {
     if (wifiConnected) {
         GraphQL.loop();
     }
+}
 
-    // Process web server
+void webTask() {
     WebConfig.loop();
+}
 
-#ifdef HAS_DISPLAY
-    // Process debounced navigation mutation (shared across all display types)
-    if (g_mutationPending && millis() >= g_pendingMutationTime) {
-        // If a mutation is already in flight, extend the debounce timer
-        if (GraphQL.isMutationInFlight()) {
-            g_pendingMutationTime = millis() + G_MUTATION_DEBOUNCE_MS;
-            // Don't clear g_mutationPending - wait for current mutation to complete
-        } else {
-            g_mutationPending = false;
-            if (g_pendingMutationUuid[0] != '\0' && backendConnected) {
-                Logger.logln("Navigation: Sending debounced mutation (uuid: %s)", g_pendingMutationUuid);
-                sendNavigationMutation(g_pendingMutationUuid);
-            }
-            g_pendingMutationUuid[0] = '\0';  // Clear after sending
+void configTask() {
+    // Commit settled config changes to NVS
+    Config.loop();
+}
+
+void logTask() {
+    // Format queued log records and print them to Serial
+    Logger.drain();
+}
+
+#define JOURNAL_UPLOAD_BUFFER_SIZE 4096
+
+void onJournalUploaded(const char* operationId, JsonObject data) {
+    bool delivered = !data.isNull() && (data["sendDeviceLogs"]["success"] | false);
+    Journal.endUpload(delivered);
+    if (!delivered) {
+        Logger.logln("Journal: Upload failed, %u events pending", (unsigned)Journal.getPendingCount());
+    }
+}
+
+/**
+ * Write journaled climbs to flash, and upload the oldest pending batch once
+ * the backend is reachable. Navigation mutations go first; the upload is
+ * its own operation so it never holds them up.
+ */
+void journalTask() {
+    Journal.loop();
+    if (!backendConnected || GraphQL.isMutationInFlight() || GraphQL.isOperationPending() || !Journal.isUploadDue()) {
+        return;
+    }
+
+    char* body = (char*)malloc(JOURNAL_UPLOAD_BUFFER_SIZE);
+    if (!body) {
+        return;
+    }
+    if (Journal.beginUpload(body, JOURNAL_UPLOAD_BUFFER_SIZE) > 0 &&
+        !GraphQL.sendOperation("climb-journal",
+                               "mutation SendDeviceLogs($input: SendDeviceLogsInput!) { "
+                               "sendDeviceLogs(input: $input) { success accepted } }",
+                               body, onJournalUploaded)) {
+        Journal.endUpload(false);
+    }
+    free(body);
+}
+
+#define TELEMETRY_UPLOAD_BUFFER_SIZE 4096
+
+void onTelemetryUploaded(const char* operationId, JsonObject data) {
+    Telemetry.endUpload(!data.isNull() && (data["sendDeviceLogs"]["success"] | false));
+}
+
+/**
+ * Stream a batch of logs and metrics when the link has nothing better to
+ * do: after navigation mutations and the climb journal, and not while LED
+ * data is moving (see Telemetry.linkActivity()).
+ */
+void telemetryTask() {
+    if (!backendConnected || GraphQL.isMutationInFlight() || GraphQL.isOperationPending() || Journal.isUploadDue() ||
+        !Telemetry.isUploadDue()) {
+        return;
+    }
+
+    char* body = (char*)malloc(TELEMETRY_UPLOAD_BUFFER_SIZE);
+    if (!body) {
+        return;
+    }
+    if (Telemetry.beginUpload(body, TELEMETRY_UPLOAD_BUFFER_SIZE) > 0 &&
+        !GraphQL.sendOperation("telemetry",
+                               "mutation SendDeviceLogs($input: SendDeviceLogsInput!) { "
+                               "sendDeviceLogs(input: $input) { success accepted } }",
+                               body, onTelemetryUploaded)) {
+        Telemetry.endUpload(false);
+    }
+    free(body);
+}
+
+/**
+ * Metrics snapshot for the telemetry uplink, as a JSON object.
+ */
+size_t writeTelemetryMetrics(char* out, size_t capacity) {
+    const TelemetryStats& telemetryStats = Telemetry.getStats();
+    int written = snprintf(out, capacity,
+                           "{\"uptime_ms\":%lu,\"heap_free\":%u,\"heap_min\":%u,\"rssi\":%d,\"stalls\":%u,"
+                           "\"log_dropped\":%u,\"telemetry_dropped\":%u,\"journal_pending\":%u,\"ble_connected\":%d}",
+                           millis(), (unsigned)ESP.getFreeHeap(), (unsigned)ESP.getMinFreeHeap(),
+                           wifiConnected ? (int)WiFiMgr.getRSSI() : 0, (unsigned)Profiler.getTotalStalls(),
+                           (unsigned)Logger.getDroppedCount(), (unsigned)telemetryStats.linesDropped,
+                           (unsigned)Journal.getPendingCount(), BLE.isConnected() ? 1 : 0);
+    return written > 0 && (size_t)written < capacity ? written : 0;
+}
+
+/**
+ * Apply settings that take effect without a restart.
+ */
+void onConfigChange(const char* key) {
+    if (!key || strcmp(key, "stall_ms") == 0) {
+        Profiler.setDefaultBudget(Config.getInt("stall_ms", PROFILER_DEFAULT_BUDGET_US / 1000) * 1000);
+    }
+    if (key && strcmp(key, TelemetryUplink::KEY_ENABLED) == 0) {
+        Telemetry.setEnabled(Config.getBool(TelemetryUplink::KEY_ENABLED, true));
+    }
+    if (key && strcmp(key, TelemetryUplink::KEY_LEVEL) == 0) {
+        int32_t level = Config.getInt(TelemetryUplink::KEY_LEVEL, LOG_LEVEL_INFO);
+        if (level >= LOG_LEVEL_DEBUG && level <= LOG_LEVEL_ERROR) {
+            Telemetry.setMinLevel((LogLevel)level);
         }
     }
+}
+
+#ifdef HAS_DISPLAY
+/**
+ * Send the debounced navigation mutation once presses stop (shared across
+ * all display types). Armed by the navigate functions via runAfter().
+ */
+void mutationTask() {
+    if (!g_mutationPending) {
+        return;
+    }
+    // If a mutation is already in flight, wait for it to complete
+    if (GraphQL.isMutationInFlight()) {
+        Scheduler.runAfter(g_mutationTask, G_MUTATION_DEBOUNCE_MS);
+        return;
+    }
+    g_mutationPending = false;
+    if (g_pendingMutationUuid[0] != '\0' && backendConnected) {
+        Logger.logln("Navigation: Sending debounced mutation (uuid: %s)", g_pendingMutationUuid);
+        sendNavigationMutation(g_pendingMutationUuid);
+    }
+    g_pendingMutationUuid[0] = '\0';  // Clear after sending
+}
 #endif
 
 #ifdef ENABLE_WAVESHARE_DISPLAY
-    // Handle touch input for Waveshare display
+/**
+ * Handle touch input for Waveshare display
+ */
+void touchTask() {
     TouchEvent touchEvent = Display.pollTouch();
     switch (touchEvent.action) {
         case TouchAction::NAVIGATE_PREVIOUS:
@@ -438,7 +645,9 @@ void loop() {
             int currentMode = Config.getInt("disp_mode", 0);
             int newMode = (currentMode == 0) ? 1 : 0;
             Config.setInt("disp_mode", newMode);
-            // Clear settings state and show restarting message
+            // Clear settings state and show restarting message; the render
+            // task cannot draw over it while the draw lock is held
+            DrawLock drawLock(Display);
             Display.hideSettingsScreen();
             Display.getDisplay().fillScreen(COLOR_BACKGROUND);
             Display.getDisplay().setFont(&fonts::FreeSansBold18pt7b);
@@ -447,6 +656,9 @@ void loop() {
             Display.getDisplay().drawString("Restarting...",
                 Display.screenWidth() / 2, Display.screenHeight() / 2);
             Display.getDisplay().setTextDatum(lgfx::top_left);
+            Display.getDisplay().present(nullptr, 0);
+            Profiler.tag("restart");
+            Config.flush();
             delay(1000);
             esp_restart();
             break;
@@ -459,8 +671,12 @@ void loop() {
         default:
             break;
     }
+}
 #elif defined(ENABLE_DISPLAY)
-    // Handle button presses with debouncing (LilyGo T-Display-S3)
+/**
+ * Handle button presses with debouncing (LilyGo T-Display-S3)
+ */
+void buttonTask() {
     static bool lastButton1 = HIGH;
     static bool lastButton2 = HIGH;
     static unsigned long button1PressTime = 0;
@@ -494,6 +710,8 @@ void loop() {
                 Logger.logln("WARNING: Failed to persist config reset");
             }
 
+            Profiler.tag("restart");
+            Config.flush();
             delay(1000);
             ESP.restart();
         }
@@ -526,9 +744,248 @@ void loop() {
         button2PressTime = 0;
     }
     lastButton2 = button2;
+}
+#endif
+
+void registerLoopTasks() {
+    Scheduler.begin();
+
+    // Time every task; any run over the stall budget is logged and kept for /api/metrics
+    onConfigChange("stall_ms");
+    Config.onChange(onConfigChange);
+    Scheduler.setProfiler(&Profiler);
+
+    // Radio and input work that the user or a connected app waits on
+    // Signalled by their event callbacks; the poll picks up the first WebSocket
+    // frame (the socket has no event source) and anything a signal missed
+    g_graphqlTask = Scheduler.addPeriodic("graphql", 10, graphqlTask, TaskPriority::URGENT);
+    g_bleTask = Scheduler.addPeriodic("ble", 50, bleTask, TaskPriority::URGENT);
+#ifdef ENABLE_WAVESHARE_DISPLAY
+    Scheduler.addPeriodic("touch", 5, touchTask, TaskPriority::URGENT);
+#elif defined(ENABLE_DISPLAY)
+    Scheduler.addPeriodic("buttons", 10, buttonTask, TaskPriority::NORMAL);
+#endif
+#ifdef HAS_DISPLAY
+    g_mutationTask = Scheduler.addEvent("mutation", mutationTask, TaskPriority::URGENT);
+#endif
+
+    Scheduler.addPeriodic("web", 10, webTask, TaskPriority::NORMAL);
+    Scheduler.addPeriodic("wifi", 20, wifiTask, TaskPriority::NORMAL);
+
+    // Housekeeping
+    Scheduler.addPeriodic("log", 20, logTask, TaskPriority::BACKGROUND);
+    Scheduler.addPeriodic("coex", 50, coexTask, TaskPriority::BACKGROUND);
+    Scheduler.addPeriodic("config", 100, configTask, TaskPriority::BACKGROUND);
+    Scheduler.addPeriodic("journal", 1000, journalTask, TaskPriority::BACKGROUND);
+    Scheduler.addPeriodic("telemetry", 1000, telemetryTask, TaskPriority::BACKGROUND);
+#ifdef ENABLE_BLE_CAPTURE
+    Scheduler.addPeriodic("capture", 50, captureTask, TaskPriority::BACKGROUND);
 #endif
 }
 
+/**
+ * Main loop accounting: per-task runs, CPU time and lateness, plus busy vs
+ * idle time. POST resets the counters.
+ */
+void registerSchedulerRoutes() {
+    WebConfig.on("/api/scheduler", HTTP_GET, [](WebServer& server) {
+        static const char* PRIORITY_NAMES[] = {"urgent", "normal", "background"};
+        const SchedulerStats& loopStats = Scheduler.getStats();
+
+        JsonDocument doc;
+        doc["windowMs"] = millis() - loopStats.sinceMs;
+        doc["passes"] = loopStats.passes;
+        doc["busyMs"] = (uint32_t)(loopStats.busyUs / 1000);
+        doc["idleMs"] = (uint32_t)(loopStats.idleUs / 1000);
+
+        JsonArray tasks = doc["tasks"].to<JsonArray>();
+        for (SchedulerTaskId id = 0; id < Scheduler.getTaskCount(); id++) {
+            const SchedulerTaskStats& stats = Scheduler.getTaskStats(id);
+            JsonObject task = tasks.add<JsonObject>();
+            task["name"] = Scheduler.getTaskName(id);
+            task["priority"] = PRIORITY_NAMES[(int)Scheduler.getTaskPriority(id)];
+            task["runs"] = stats.runs;
+            task["cpuMs"] = (uint32_t)(stats.totalUs / 1000);
+            task["avgUs"] = stats.runs ? (uint32_t)(stats.totalUs / stats.runs) : 0;
+            task["maxUs"] = stats.maxUs;
+            task["maxLatenessMs"] = stats.maxLatenessMs;
+            task["deadlineMisses"] = stats.deadlineMisses;
+        }
+        WebConfig.sendJson(200, doc);
+    });
+
+    WebConfig.on("/api/scheduler", HTTP_POST, [](WebServer& server) {
+        Scheduler.resetStats();
+        WebConfig.sendJson(200, "{}");
+    });
+}
+
+#ifdef ENABLE_BLE_PROXY
+/**
+ * Append one board link's connection profile and per-profile usage.
+ * Interval and timeout are the requested parameters converted to ms.
+ */
+void addLinkMetrics(JsonArray links, BLEClientConnection& client) {
+    static const char* PROFILE_NAMES[BLE_LINK_PROFILE_COUNT] = {"low-latency", "idle"};
+    BLELinkStats linkStats = client.getLinkStats();
+    const BLELinkParams& params = BLEClientConnection::getLinkParams(linkStats.profile);
+
+    JsonObject link = links.add<JsonObject>();
+    link["board"] = client.getConnectedAddress();
+    link["connected"] = client.isConnected();
+    link["profile"] = PROFILE_NAMES[(int)linkStats.profile];
+    link["intervalMs"] = params.maxInterval * 1.25f;
+    link["latency"] = params.latency;
+    link["timeoutMs"] = params.supervisionTimeout * 10;
+    link["profileSwitches"] = linkStats.profileSwitches;
+    link["paramUpdateFailures"] = linkStats.paramUpdateFailures;
+
+    JsonArray profiles = link["profiles"].to<JsonArray>();
+    for (int i = 0; i < BLE_LINK_PROFILE_COUNT; i++) {
+        JsonObject profile = profiles.add<JsonObject>();
+        profile["name"] = PROFILE_NAMES[i];
+        profile["ms"] = linkStats.timeInProfileMs[i];
+        profile["writes"] = linkStats.writesInProfile[i];
+        profile["bytes"] = linkStats.bytesInProfile[i];
+        profile["eventUtilisation"] = client.getConnectionEventUtilisation((BLELinkProfile)i);
+    }
+}
+#endif
+
+/**
+ * Loop latency profile: per-phase (scheduler task) count, average, p99 and
+ * max run time, stall counts against the budget (config key `stall_ms`) and
+ * the most recent stalls with their tags. POST resets them. Also reports
+ * config flash wear, climb journal state, log records dropped, telemetry
+ * uplink counters, the BLE/WiFi airtime split and, in proxy builds, each
+ * board link's connection profile and connection-event use since boot.
+ */
+void registerMetricsRoutes() {
+    WebConfig.on("/api/metrics", HTTP_GET, [](WebServer& server) {
+        JsonDocument doc;
+        doc["uptimeMs"] = millis();
+        doc["budgetUs"] = Profiler.getDefaultBudget();
+        doc["totalStalls"] = Profiler.getTotalStalls();
+
+        JsonArray phases = doc["phases"].to<JsonArray>();
+        for (ProfilerPhaseId id = 0; id < Profiler.getPhaseCount(); id++) {
+            const PhaseHistogram& h = Profiler.getHistogram(id);
+            JsonObject phase = phases.add<JsonObject>();
+            phase["name"] = Profiler.getPhaseName(id);
+            phase["count"] = h.count;
+            phase["avgUs"] = h.avgUs();
+            phase["p50Us"] = h.percentile(50);
+            phase["p99Us"] = h.percentile(99);
+            phase["maxUs"] = h.maxUs;
+            phase["budgetUs"] = Profiler.getBudget(id);
+            phase["stalls"] = Profiler.getStallCount(id);
+        }
+
+        JsonArray stalls = doc["recentStalls"].to<JsonArray>();
+        for (int i = 0; i < Profiler.getRecentStallCount(); i++) {
+            const PhaseStall& record = Profiler.getRecentStall(i);
+            JsonObject stall = stalls.add<JsonObject>();
+            stall["phase"] = Profiler.getPhaseName(record.phase);
+            stall["us"] = record.durationUs;
+            stall["agoMs"] = millis() - record.atMs;
+            stall["tag"] = record.tag;
+        }
+
+        const ConfigWearStats& wear = Config.getWearStats();
+        JsonObject config = doc["config"].to<JsonObject>();
+        config["pending"] = Config.hasPendingWrites();
+        config["commits"] = wear.commits;
+        config["keysWritten"] = wear.keysWritten;
+        config["bytesWritten"] = wear.bytesWritten;
+        config["coalesced"] = wear.writesCoalesced;
+        config["skipped"] = wear.writesSkipped;
+        config["failures"] = wear.failures;
+        config["nvsReads"] = wear.nvsReads;
+
+        const ClimbJournalStats& journalStats = Journal.getStats();
+        JsonObject journal = doc["journal"].to<JsonObject>();
+        journal["ready"] = Journal.isReady();
+        journal["pending"] = Journal.getPendingCount();
+        journal["nextSeq"] = Journal.getNextSeq();
+        journal["ackedSeq"] = Journal.getAckedSeq();
+        journal["recorded"] = journalStats.eventsRecorded;
+        journal["dropped"] = journalStats.eventsDropped;
+        journal["blocksWritten"] = journalStats.blocksWritten;
+        journal["uploaded"] = journalStats.eventsUploaded;
+        journal["uploadFailures"] = journalStats.uploadFailures;
+
+        JsonObject logStats = doc["log"].to<JsonObject>();
+        logStats["pendingBytes"] = Logger.getPendingBytes();
+        logStats["dropped"] = Logger.getDroppedCount();
+
+        const TelemetryStats& telemetryStats = Telemetry.getStats();
+        JsonObject telemetry = doc["telemetry"].to<JsonObject>();
+        telemetry["enabled"] = Telemetry.isEnabled();
+        telemetry["queued"] = Telemetry.getQueuedCount();
+        telemetry["linesQueued"] = telemetryStats.linesQueued;
+        telemetry["collapsed"] = telemetryStats.linesCollapsed;
+        telemetry["dropped"] = telemetryStats.linesDropped;
+        telemetry["linesSent"] = telemetryStats.linesSent;
+        telemetry["snapshotsSent"] = telemetryStats.snapshotsSent;
+        telemetry["batches"] = telemetryStats.batchesSent;
+        telemetry["failures"] = telemetryStats.batchFailures;
+        telemetry["bytesSent"] = telemetryStats.bytesSent;
+
+#ifdef ENABLE_BLE_PROXY
+        JsonObject ble = doc["ble"].to<JsonObject>();
+        ble["proxyEnabled"] = Proxy.isEnabled();
+        ble["fanout"] = Proxy.isFanoutMode();
+        JsonArray links = ble["links"].to<JsonArray>();
+        if (Proxy.isFanoutMode()) {
+            for (int i = 0; i < Fanout.getBoardCount(); i++) {
+                addLinkMetrics(links, Fanout.getClient(i));
+            }
+        } else if (Proxy.isEnabled()) {
+            addLinkMetrics(links, BoardClient);
+        }
+#endif
+
+        CoexStats coexStats = Coex.getStats();
+        JsonObject coex = doc["coex"].to<JsonObject>();
+        coex["preference"] = RadioCoex::getPreferenceName(coexStats.preference);
+        coex["switches"] = coexStats.preferenceSwitches;
+        coex["scansDeferred"] = coexStats.scansDeferred;
+        coex["wifiHandshakeMs"] = coexStats.activityMs[(int)CoexActivity::WIFI_HANDSHAKE];
+        coex["wifiTransferMs"] = coexStats.activityMs[(int)CoexActivity::WIFI_TRANSFER];
+        coex["bleTransferMs"] = coexStats.activityMs[(int)CoexActivity::BLE_TRANSFER];
+        coex["bleScanMs"] = coexStats.activityMs[(int)CoexActivity::BLE_SCAN];
+        JsonArray preferences = coex["preferences"].to<JsonArray>();
+        for (int i = 0; i < COEX_PREFERENCE_COUNT; i++) {
+            const CoexLatencyHistogram& latency = Coex.getLedLatencyHistogram((CoexPreference)i);
+            JsonObject preference = preferences.add<JsonObject>();
+            preference["name"] = RadioCoex::getPreferenceName((CoexPreference)i);
+            preference["ms"] = coexStats.preferenceMs[i];
+            preference["ledUpdates"] = latency.count;
+            preference["ledP99Ms"] = latency.percentile(99);
+            preference["ledMaxMs"] = latency.maxMs;
+        }
+
+        const WebUIStats& uiStats = WebConfig.getUIStats();
+        JsonObject web = doc["web"].to<JsonObject>();
+        web["served"] = uiStats.pageServed;
+        web["notModified"] = uiStats.notModified;
+        web["maxServeUs"] = uiStats.maxServeUs;
+        web["maxHeapDrop"] = uiStats.maxHeapDrop;
+        web["lastLoadMs"] = uiStats.lastLoadMs;
+        web["maxLoadMs"] = uiStats.maxLoadMs;
+        WebConfig.sendJson(200, doc);
+    });
+
+    WebConfig.on("/api/metrics", HTTP_POST, [](WebServer& server) {
+        Profiler.resetStats();
+        WebConfig.sendJson(200, "{}");
+    });
+}
+
+void loop() {
+    Scheduler.loop();
+}
+
 void onWiFiStateChange(WiFiConnectionState state) {
     switch (state) {
         case WiFiConnectionState::CONNECTED: {
@@ -544,6 +1001,9 @@ void onWiFiStateChange(WiFiConnectionState state) {
             // Initialize BLE now that WiFi is connected (if not already done)
             initializeBLE();
 
+            // Wall clock for journal timestamps
+            configTime(0, 0, "pool.ntp.org");
+
             // Get backend config
             String host = Config.getString("backend_host", DEFAULT_BACKEND_HOST);
             int port = Config.getInt("backend_port", DEFAULT_BACKEND_PORT);
@@ -561,10 +1021,12 @@ void onWiFiStateChange(WiFiConnectionState state) {
             Logger.logln("Connecting to backend: %s:%d%s", host.c_str(), port, path.c_str());
             GraphQL.setStateCallback(onGraphQLStateChange);
             GraphQL.setMessageCallback(onGraphQLMessage);
+            GraphQL.setActivityCallback(wakeGraphQLTask);
 #ifdef ENABLE_BLE_PROXY
             // Set up LED update callback for proxy forwarding
             GraphQL.setLedUpdateCallback(onWebSocketLedUpdate);
 #endif
+            Profiler.tag("graphql-connect");
             GraphQL.begin(host.c_str(), port, path.c_str(), apiKey.c_str());
             break;
         }
@@ -626,8 +1088,168 @@ void onBLEConnect(bool connected) {
 
 void onBLEData(const uint8_t* data, size_t len) {
     // Raw BLE data callback - Aurora parsing is handled by nordic_uart_ble library
+#ifdef ENABLE_BLE_CAPTURE
+    Capture.record(BLECaptureDirection::APP_TO_BOARD, data, len);
+#endif
 }
 
+#ifdef ENABLE_BLE_CAPTURE
+/**
+ * Capture control. Download the file with GET /api/capture and replay it
+ * with the test_ble_replay native test (BLE_CAPTURE_FILE=<path>).
+ */
+void sendCaptureStatus(WebServer& server) {
+    const BLECaptureStats& stats = Capture.getStats();
+    JsonDocument doc;
+    doc["recording"] = Capture.isRecording();
+    doc["records"] = stats.records;
+    doc["payloadBytes"] = stats.payloadBytes;
+    doc["fileBytes"] = stats.fileBytes;
+    doc["dropped"] = stats.recordsDropped;
+    WebConfig.sendJson(200, doc);
+}
+
+void registerCaptureRoutes() {
+    WebConfig.on("/api/capture", HTTP_GET, [](WebServer& server) {
+        if (Capture.isRecording()) {
+            WebConfig.sendError(409, "Stop the capture before downloading");
+            return;
+        }
+        File file = LittleFS.open(Capture.getPath(), "r");
+        if (!file) {
+            WebConfig.sendError(404, "No capture recorded");
+            return;
+        }
+        server.sendHeader("Content-Disposition", "attachment; filename=\"ble_capture.bin\"");
+        server.streamFile(file, "application/octet-stream");
+        file.close();
+    });
+
+    WebConfig.on("/api/capture/start", HTTP_POST, [](WebServer& server) {
+        if (!Capture.start()) {
+            WebConfig.sendError(500, "Cannot create capture file");
+            return;
+        }
+        sendCaptureStatus(server);
+    });
+
+    WebConfig.on("/api/capture/stop", HTTP_POST, [](WebServer& server) {
+        Capture.stop();
+        sendCaptureStatus(server);
+    });
+}
+#endif
+
+#ifdef ENABLE_WAVESHARE_DISPLAY
+/**
+ * Display pipeline stats: bounce buffer refill ISR timing and underruns,
+ * buffer swaps, widget render totals, and render task frame time and
+ * state-to-pixels latency. POST resets the refill and render task counters.
+ */
+void registerDisplayRoutes() {
+    WebConfig.on("/api/display/stats", HTTP_GET, [](WebServer& server) {
+        LGFX_Waveshare7& lcd = Display.getDisplay();
+        const lgfx::Bus_RGB_Bounce::stats_t& bounce = lcd.getBounceStats();
+        uint32_t cyclesPerUs = getCpuFrequencyMhz();
+        int64_t elapsedUs = esp_timer_get_time() - bounce.since_us;
+
+        JsonDocument doc;
+        JsonObject refill = doc["bounce"].to<JsonObject>();
+        refill["lines"] = lcd.getBounceLines();
+        refill["refills"] = bounce.refills;
+        refill["avgUs"] = bounce.refills ? (float)bounce.total_cycles / bounce.refills / cyclesPerUs : 0.0f;
+        refill["maxUs"] = (float)bounce.max_cycles / cyclesPerUs;
+        refill["cpuPercent"] = elapsedUs > 0 ? 100.0f * bounce.total_cycles / cyclesPerUs / elapsedUs : 0.0f;
+        refill["underruns"] = bounce.underruns;
+        refill["lateFrames"] = bounce.late_frames;
+        refill["frames"] = bounce.frames;
+
+        doc["doubleBuffered"] = lcd.isDoubleBuffered();
+        doc["swaps"] = lcd.getSwapCount();
+        doc["lastCopyForwardBytes"] = lcd.getLastCopyForwardBytes();
+
+        const WidgetRenderTotals& render = Display.getRenderTotals();
+        JsonObject widgets = doc["render"].to<JsonObject>();
+        widgets["frames"] = render.frames;
+        widgets["widgetsDrawn"] = render.widgetsDrawn;
+        widgets["maxFrameUs"] = render.maxFrameUs;
+        widgets["maxFramePixels"] = render.maxFramePixels;
+
+        const RenderMetrics& frames = Display.getRenderMetrics();
+        JsonObject task = doc["renderTask"].to<JsonObject>();
+        task["running"] = Display.isRenderTaskRunning();
+        task["published"] = frames.published;
+        task["rendered"] = frames.rendered;
+        task["dropped"] = frames.dropped;
+        task["lastRenderUs"] = frames.lastRenderUs;
+        task["avgRenderUs"] = frames.avgRenderUs();
+        task["maxRenderUs"] = frames.maxRenderUs;
+        task["lastLatencyUs"] = frames.lastLatencyUs;
+        task["avgLatencyUs"] = frames.avgLatencyUs();
+        task["maxLatencyUs"] = frames.maxLatencyUs;
+
+        const TextCacheStats& text = Display.getTextCacheStats();
+        JsonObject textCache = doc["textCache"].to<JsonObject>();
+        textCache["hits"] = text.hits;
+        textCache["misses"] = text.misses;
+        textCache["evictions"] = text.evictions;
+        WebConfig.sendJson(200, doc);
+    });
+
+    WebConfig.on("/api/display/stats", HTTP_POST, [](WebServer& server) {
+        Display.getDisplay().resetBounceStats();
+        Display.resetRenderMetrics();
+        WebConfig.sendJson(200, "{}");
+    });
+}
+#elif defined(ENABLE_DISPLAY)
+/**
+ * Display pipeline stats: per-region draw time (rasterise into the band
+ * sprites plus DMA push), refresh totals and render task frame time. POST
+ * resets them.
+ */
+void registerDisplayRoutes() {
+    WebConfig.on("/api/display/stats", HTTP_GET, [](WebServer& server) {
+        JsonDocument doc;
+        doc["bandRendering"] = Display.isBandRendering();
+
+        JsonObject regions = doc["regions"].to<JsonObject>();
+        for (uint8_t id = 0; id < LilyGoDisplay::REGION_COUNT; id++) {
+            const WidgetTiming& timing = Display.getRegionTiming(id);
+            JsonObject region = regions[LilyGoDisplay::regionName(id)].to<JsonObject>();
+            region["draws"] = timing.draws;
+            region["lastUs"] = timing.lastUs;
+            region["avgUs"] = timing.avgUs();
+            region["maxUs"] = timing.maxUs;
+        }
+
+        const WidgetRenderTotals& render = Display.getRenderTotals();
+        JsonObject widgets = doc["render"].to<JsonObject>();
+        widgets["frames"] = render.frames;
+        widgets["widgetsDrawn"] = render.widgetsDrawn;
+        widgets["maxFrameUs"] = render.maxFrameUs;
+        widgets["maxFramePixels"] = render.maxFramePixels;
+
+        const RenderMetrics& frames = Display.getRenderMetrics();
+        JsonObject task = doc["renderTask"].to<JsonObject>();
+        task["running"] = Display.isRenderTaskRunning();
+        task["rendered"] = frames.rendered;
+        task["dropped"] = frames.dropped;
+        task["avgRenderUs"] = frames.avgRenderUs();
+        task["maxRenderUs"] = frames.maxRenderUs;
+        task["avgLatencyUs"] = frames.avgLatencyUs();
+        task["maxLatencyUs"] = frames.maxLatencyUs;
+        WebConfig.sendJson(200, doc);
+    });
+
+    WebConfig.on("/api/display/stats", HTTP_POST, [](WebServer& server) {
+        Display.resetRenderTotals();
+        Display.resetRenderMetrics();
+        WebConfig.sendJson(200, "{}");
+    });
+}
+#endif
+
 #ifdef ENABLE_BLE_PROXY
 void onBLERawForward(const uint8_t* data, size_t len) {
     // Forward raw BLE data to the actual board via proxy
@@ -669,6 +1291,15 @@ void onWebSocketLedUpdate(const LedCommand* commands, int count) {
     std::vector<std::vector<uint8_t>> packets;
     AuroraProtocol::encodeLedCommands(commands, count, packets);
 
+    // Fan-out queues the packets per board and paces writes from Proxy.loop()
+    if (Proxy.isFanoutMode()) {
+        Proxy.sendPacketsToBoards(packets);
+        return;
+    }
+
+    // Paced with delay() below; a stall report for this phase names it
+    Profiler.tag("proxy-forward");
+
     // BLE max write size is 20 bytes (matches TypeScript MAX_BLUETOOTH_MESSAGE_SIZE)
     const size_t MAX_BLE_CHUNK_SIZE = 20;
     int totalChunks = 0;
@@ -699,9 +1330,19 @@ void onBLELedData(const LedCommand* commands, int count, int angle) {
 
     // Forward to backend via WebSocket to match climb
     if (GraphQL.isSubscribed()) {
+        Telemetry.linkActivity();
         GraphQL.sendLedPositions(commands, count, angle);
     } else {
         Logger.logln("Main: Cannot forward LED data - not subscribed to backend");
+
+        // Journal the holds so the backend can match the climb later
+        static ClimbJournalHold holds[CLIMB_JOURNAL_MAX_HOLDS];
+        int holdCount = min(count, CLIMB_JOURNAL_MAX_HOLDS);
+        for (int i = 0; i < holdCount; i++) {
+            holds[i].position = commands[i].position;
+            holds[i].role = colorToRole(commands[i].r, commands[i].g, commands[i].b);
+        }
+        Journal.bleClimbShown(holds, holdCount, angle);
     }
 }
 
@@ -761,8 +1402,6 @@ void onGraphQLStateChange(GraphQLConnectionState state) {
 }
 
 void onGraphQLMessage(JsonDocument& doc) {
-#ifdef HAS_DISPLAY
-    // Handle extended LedUpdate data (for display)
     JsonObject payloadObj = doc["payload"];
     if (payloadObj["data"].is<JsonObject>()) {
         JsonObject data = payloadObj["data"];
@@ -771,13 +1410,44 @@ void onGraphQLMessage(JsonDocument& doc) {
             const char* typename_ = event["__typename"];
 
             if (typename_ && strcmp(typename_, "LedUpdate") == 0) {
+                Telemetry.linkActivity();
+                journalLedUpdate(event);
+#ifdef HAS_DISPLAY
+                // Handle extended LedUpdate data (for display)
                 handleLedUpdateExtended(event);
+#endif
             }
         }
     }
-#else
-    (void)doc;  // Suppress unused parameter warning
+}
+
+/**
+ * Record a climb shown or cleared by the backend in the climb journal.
+ */
+void journalLedUpdate(JsonObject& data) {
+    const char* climbUuid = data["climbUuid"];
+    const char* climbName = data["climbName"];
+    const char* clientId = data["clientId"];
+    JsonArray commands = data["commands"];
+
+    // Updates with our own MAC as clientId echo a climb the official app sent over BLE
+    ClimbEventSource source =
+        clientId && WiFi.macAddress() == clientId ? ClimbEventSource::BLE : ClimbEventSource::BACKEND;
+#ifdef HAS_DISPLAY
+    // ...or confirm navigation from this controller (checked before handleLedUpdateExtended clears it)
+    const char* queueItemUuid = data["queueItemUuid"];
+    const char* pendingUuid = Display.hasPendingNavigation() ? Display.getPendingQueueItemUuid() : nullptr;
+    if (queueItemUuid && pendingUuid && strcmp(queueItemUuid, pendingUuid) == 0) {
+        source = ClimbEventSource::DEVICE;
+    }
 #endif
+
+    if (!commands.isNull() && commands.size() > 0 && climbUuid) {
+        Journal.climbShown(climbUuid, source);
+    } else if (!climbName || strcmp(climbName, "Unknown Climb") != 0) {
+        // An unknown BLE climb also arrives without commands; its holds already went to the backend
+        Journal.climbCleared(source);
+    }
 }
 
 #ifdef HAS_DISPLAY
@@ -804,8 +1474,8 @@ void onQueueSync(const ControllerQueueSyncData& data) {
         strncpy(g_queueSyncBuffer[i].grade, data.items[i].grade, sizeof(g_queueSyncBuffer[i].grade) - 1);
         g_queueSyncBuffer[i].grade[sizeof(g_queueSyncBuffer[i].grade) - 1] = '\0';
 
-        // Convert hex color to RGB565 using fast helper (no String allocations)
-        g_queueSyncBuffer[i].gradeColorRgb = hexToRgb565Fast(data.items[i].gradeColor);
+        // Resolve the grade once so drawing a row is a GRADE_INFO index
+        g_queueSyncBuffer[i].gradeId = gradeIdFromString(data.items[i].grade);
     }
 
     // Update display queue state (no delete needed - using static buffer)
@@ -834,6 +1504,9 @@ void handleLedUpdateExtended(JsonObject& data) {
     Logger.logln("LED Update: %s [%s] @ %d degrees (%d holds), queueItemUuid: %s", climbName ? climbName : "(none)",
                  climbGrade ? climbGrade : "?", angle, count, queueItemUuid ? queueItemUuid : "(none)");
 
+    // Apply this update's display changes as one; the render task draws the result once released
+    DisplayLock displayLock(Display);
+
     // Check if this confirms a pending navigation
     if (Display.hasPendingNavigation() && queueItemUuid) {
         const char* pendingUuid = Display.getPendingQueueItemUuid();
@@ -936,6 +1609,19 @@ void handleLedUpdateExtended(JsonObject& data) {
                 Logger.logln("Board image: loaded config '%s' (%dx%d, %d holds)",
                              configKey.c_str(), currentBoardConfig->imageWidth,
                              currentBoardConfig->imageHeight, currentBoardConfig->holdCount);
+
+                // First-show latency for comparing JPEG against RGB565 tile builds
+                static const char* const IMAGE_FORMAT_NAMES[] = {"jpeg", "rgb565", "rgb565-rle"};
+                const char* formatName = currentBoardConfig->imageFormat <= BOARD_IMAGE_RGB565_RLE
+                                             ? IMAGE_FORMAT_NAMES[currentBoardConfig->imageFormat]
+                                             : "unknown";
+                if (Display.preloadBoardImage()) {
+                    Logger.logln("Board image: %s decoded in %lu us (%u bytes flash)", formatName,
+                                 (unsigned long)Display.getLastImageDecodeUs(),
+                                 (unsigned)currentBoardConfig->imageSize);
+                } else {
+                    Logger.logln("Board image: no PSRAM sprite, drawing %s from flash each refresh", formatName);
+                }
             } else {
                 Display.setBoardConfig(nullptr);
                 Logger.logln("Board image: no config found for '%s'", configKey.c_str());
@@ -945,18 +1631,10 @@ void handleLedUpdateExtended(JsonObject& data) {
 
     // Pass LED commands to display for hold overlay rendering
     if (!commands.isNull() && count > 0 && currentBoardConfig) {
-        WaveshareDisplay::LedCmd ledCmds[512];
-        int cmdCount = min(count, 512);
-        int idx = 0;
+        Display.clearLedCommands();
         for (JsonObject cmd : commands) {
-            if (idx >= cmdCount) break;
-            ledCmds[idx].position = cmd["position"] | 0;
-            ledCmds[idx].r = cmd["r"] | 0;
-            ledCmds[idx].g = cmd["g"] | 0;
-            ledCmds[idx].b = cmd["b"] | 0;
-            idx++;
+            Display.addLedCommand(cmd["position"] | 0, cmd["r"] | 0, cmd["g"] | 0, cmd["b"] | 0);
         }
-        Display.setLedCommands(ledCmds, idx);
     }
 #endif
 
@@ -1027,17 +1705,18 @@ void handleLedUpdateExtended(JsonObject& data) {
  * Send navigation mutation to backend
  */
 void sendNavigationMutation(const char* queueItemUuid) {
-    String sessionId = Config.getString("session_id");
-    if (sessionId.length() == 0) {
+    const char* sessionId = Config.getCString("session_id");
+    if (sessionId[0] == '\0') {
         Logger.logln("Navigation: No session ID configured");
         return;
     }
 
     // Use queueItemUuid for direct navigation (most reliable)
-    String vars = "{\"sessionId\":\"" + sessionId + "\",\"direction\":\"next\"";
+    String vars = "{\"sessionId\":\"" + String(sessionId) + "\",\"direction\":\"next\"";
     vars += ",\"queueItemUuid\":\"" + String(queueItemUuid) + "\"";
     vars += "}";
 
+    Journal.navigated(queueItemUuid);
     GraphQL.sendMutation("nav-direct",
                          "mutation NavDirect($sessionId: ID!, $direction: String!, $queueItemUuid: String) { "
                          "navigateQueue(sessionId: $sessionId, direction: $direction, queueItemUuid: $queueItemUuid) { "
@@ -1069,6 +1748,7 @@ void navigatePrevious() {
     }
 
     // Optimistic update - immediately show previous climb info (no board image redraw)
+    DisplayLock displayLock(Display);
     if (Display.navigateToPrevious()) {
         const LocalQueueItem* newCurrent = Display.getCurrentQueueItem();
         if (newCurrent) {
@@ -1086,7 +1766,7 @@ void navigatePrevious() {
             // Store the UUID so it persists even if Display state changes from incoming updates
             strncpy(g_pendingMutationUuid, newCurrent->uuid, sizeof(g_pendingMutationUuid) - 1);
             g_pendingMutationUuid[sizeof(g_pendingMutationUuid) - 1] = '\0';
-            g_pendingMutationTime = millis() + G_MUTATION_DEBOUNCE_MS;
+            Scheduler.runAfter(g_mutationTask, G_MUTATION_DEBOUNCE_MS);
             g_mutationPending = true;
         }
     }
@@ -1114,6 +1794,7 @@ void navigateNext() {
     }
 
     // Optimistic update - immediately show next climb info (no board image redraw)
+    DisplayLock displayLock(Display);
     if (Display.navigateToNext()) {
         const LocalQueueItem* newCurrent = Display.getCurrentQueueItem();
         if (newCurrent) {
@@ -1130,7 +1811,7 @@ void navigateNext() {
             // Store the UUID so it persists even if Display state changes from incoming updates
             strncpy(g_pendingMutationUuid, newCurrent->uuid, sizeof(g_pendingMutationUuid) - 1);
             g_pendingMutationUuid[sizeof(g_pendingMutationUuid) - 1] = '\0';
-            g_pendingMutationTime = millis() + G_MUTATION_DEBOUNCE_MS;
+            Scheduler.runAfter(g_mutationTask, G_MUTATION_DEBOUNCE_MS);
             g_mutationPending = true;
         }
     }
@@ -1156,6 +1837,7 @@ void navigateToIndex(int index) {
         return;
     }
 
+    DisplayLock displayLock(Display);
     if (Display.navigateToIndex(index)) {
         const LocalQueueItem* newCurrent = Display.getCurrentQueueItem();
         if (newCurrent) {
@@ -1169,7 +1851,7 @@ void navigateToIndex(int index) {
 
             strncpy(g_pendingMutationUuid, newCurrent->uuid, sizeof(g_pendingMutationUuid) - 1);
             g_pendingMutationUuid[sizeof(g_pendingMutationUuid) - 1] = '\0';
-            g_pendingMutationTime = millis() + G_MUTATION_DEBOUNCE_MS;
+            Scheduler.runAfter(g_mutationTask, G_MUTATION_DEBOUNCE_MS);
             g_mutationPending = true;
         }
     }
@@ -10,10 +10,15 @@
  * render board images with colored hold circle overlays at runtime.
  *
  * Usage:
- *   node embedded/scripts/generate-board-data.mjs
+ *   node embedded/scripts/generate-board-data.mjs [--image-format=jpeg|rgb565|rgb565-rle]
  *
  * Or via npm script:
  *   bun run controller:codegen:board-data
+ *
+ * Image formats (also settable via BOARD_IMAGE_FORMAT):
+ *   jpeg        - JPEG, decoded on the device (smallest flash, slowest first show)
+ *   rgb565      - raw RGB565 in panel byte order, stored in 16-row tiles
+ *   rgb565-rle  - the same tiles, each run-length encoded independently
  */
 
 import * as fs from 'fs';
@@ -36,6 +41,14 @@ const MAX_IMAGE_WIDTH = 460;
 const MAX_IMAGE_HEIGHT = 560;
 const JPEG_QUALITY = 85;
 
+// Pre-decoded image formats; values match BOARD_IMAGE_* in board_hold_data.h
+const IMAGE_FORMATS = {
+  jpeg: 0,
+  rgb565: 1,
+  'rgb565-rle': 2,
+};
+const TILE_HEIGHT = 16;
+
 // Only generate for these boards (skip moonboard)
 const BOARD_NAMES = ['kilter', 'tension'];
 
@@ -265,16 +278,49 @@ function computeHoldMap(config, targetWidth, targetHeight) {
     holdMap.push({ ledPosition, cx, cy, r });
   }
 
-  // Sort by ledPosition for binary search on firmware
+  // Sorted by ledPosition for stable output (lookups go through the LED index)
   holdMap.sort((a, b) => a.ledPosition - b.ledPosition);
 
   return holdMap;
 }
 
 /**
- * Composite multiple PNG layers and convert to JPEG buffer
+ * Build the dense ledPosition -> holdMap index table for a config.
+ * Entries without a hold are NO_HOLD (0xFFFF), so firmware resolves each
+ * LED command with a single array read instead of searching holdMap.
+ */
+const NO_HOLD = 0xFFFF;
+
+function computeLedIndex(holdMap) {
+  if (holdMap.length === 0) return [];
+
+  const size = Math.max(...holdMap.map(h => h.ledPosition)) + 1;
+  const table = new Array(size).fill(NO_HOLD);
+  holdMap.forEach((h, index) => {
+    // Keep the first hold if two placements share an LED
+    if (table[h.ledPosition] === NO_HOLD) {
+      table[h.ledPosition] = index;
+    }
+  });
+  return table;
+}
+
+/**
+ * Format a uint16 array as a C++ array initializer
  */
-async function compositeAndResize(config) {
+function formatUint16Array(values, indent = '    ') {
+  const lines = [];
+  for (let i = 0; i < values.length; i += 16) {
+    const chunk = values.slice(i, i + 16);
+    lines.push(indent + chunk.map(v => (v === NO_HOLD ? 'NO_HOLD' : String(v))).join(', '));
+  }
+  return lines.join(',\n');
+}
+
+/**
+ * Composite multiple PNG layers and encode as JPEG or RGB565 tiles
+ */
+async function compositeAndResize(config, format) {
   const sharp = (await import('sharp')).default;
   const { boardName, imageFiles, boardImageDimensions } = config;
 
@@ -330,13 +376,102 @@ async function compositeAndResize(config) {
     baseBuffer = await sharp(baseBuffer).composite(overlays).png().toBuffer();
   }
 
-  // Resize composited image to target dimensions and convert to JPEG
-  const jpegBuffer = await sharp(baseBuffer)
-    .resize(targetWidth, targetHeight, { fit: 'fill', kernel: 'lanczos3' })
-    .jpeg({ quality: JPEG_QUALITY })
-    .toBuffer();
+  // Resize composited image to target dimensions and encode
+  const resized = sharp(baseBuffer)
+    .resize(targetWidth, targetHeight, { fit: 'fill', kernel: 'lanczos3' });
 
-  return { buffer: jpegBuffer, width: targetWidth, height: targetHeight };
+  if (format === 'jpeg') {
+    const jpegBuffer = await resized.jpeg({ quality: JPEG_QUALITY }).toBuffer();
+    return { buffer: jpegBuffer, width: targetWidth, height: targetHeight, tileOffsets: [] };
+  }
+
+  const rgb = await resized.removeAlpha().raw().toBuffer();
+  const tiles = encodeRgb565Tiles(toRgb565(rgb, targetWidth, targetHeight), targetWidth, targetHeight,
+    format === 'rgb565-rle');
+  return { buffer: tiles.buffer, width: targetWidth, height: targetHeight, tileOffsets: tiles.offsets };
+}
+
+/**
+ * Convert packed 8-bit RGB to RGB565 in panel byte order (high byte first),
+ * so tiles can be copied straight into a sprite or framebuffer.
+ */
+function toRgb565(rgb, width, height) {
+  const out = Buffer.alloc(width * height * 2);
+  for (let i = 0, o = 0; o < out.length; i += 3, o += 2) {
+    const value = ((rgb[i] & 0xF8) << 8) | ((rgb[i + 1] & 0xFC) << 3) | (rgb[i + 2] >> 3);
+    out[o] = value >> 8;
+    out[o + 1] = value & 0xFF;
+  }
+  return out;
+}
+
+/**
+ * Run-length encode RGB565 pixels (2 bytes each, copied verbatim).
+ * Control byte c < 0x80: c + 1 literal pixels follow.
+ * Control byte c >= 0x80: the next pixel repeats (c & 0x7F) + 2 times.
+ * Runs shorter than 3 stay in the literal block so literals remain long
+ * memcpy-able spans.
+ */
+function encodeRle565(pixels) {
+  const count = pixels.length / 2;
+  const pixelAt = i => pixels.readUInt16BE(i * 2);
+  const out = [];
+  let literalStart = 0;
+  let i = 0;
+
+  const flushLiterals = end => {
+    while (literalStart < end) {
+      const n = Math.min(128, end - literalStart);
+      out.push(n - 1);
+      for (let k = 0; k < n * 2; k++) out.push(pixels[literalStart * 2 + k]);
+      literalStart += n;
+    }
+  };
+
+  while (i < count) {
+    let run = 1;
+    while (i + run < count && run < 129 && pixelAt(i + run) === pixelAt(i)) run++;
+    if (run >= 3) {
+      flushLiterals(i);
+      out.push(0x80 | (run - 2), pixels[i * 2], pixels[i * 2 + 1]);
+      i += run;
+      literalStart = i;
+    } else {
+      i += run;
+    }
+  }
+  flushLiterals(count);
+  return Buffer.from(out);
+}
+
+/**
+ * Split an RGB565 image into TILE_HEIGHT-row tiles, optionally RLE encoding
+ * each one. offsets has tileCount + 1 entries; tile t spans
+ * [offsets[t], offsets[t + 1]) so any tile can be decoded on its own.
+ */
+function encodeRgb565Tiles(pixels, width, height, rle) {
+  const parts = [];
+  const offsets = [0];
+  for (let y = 0; y < height; y += TILE_HEIGHT) {
+    const rows = Math.min(TILE_HEIGHT, height - y);
+    const tile = pixels.subarray(y * width * 2, (y + rows) * width * 2);
+    const encoded = rle ? encodeRle565(tile) : tile;
+    parts.push(encoded);
+    offsets.push(offsets[offsets.length - 1] + encoded.length);
+  }
+  return { buffer: Buffer.concat(parts), offsets };
+}
+
+/**
+ * Resolve the image format from --image-format=... or BOARD_IMAGE_FORMAT.
+ */
+function parseImageFormat(argv, env) {
+  const arg = argv.find(a => a.startsWith('--image-format='));
+  const format = arg ? arg.split('=')[1] : (env.BOARD_IMAGE_FORMAT || 'jpeg');
+  if (!(format in IMAGE_FORMATS)) {
+    throw new Error(`Unknown image format "${format}" (expected ${Object.keys(IMAGE_FORMATS).join(', ')})`);
+  }
+  return format;
 }
 
 /**
@@ -353,16 +488,28 @@ function formatByteArray(buffer, indent = '    ') {
 }
 
 /**
- * Generate the board_image_data.h header with PROGMEM JPEG arrays
+ * Format a uint32 array as a C++ array initializer
+ */
+function formatUint32Array(values, indent = '    ') {
+  const lines = [];
+  for (let i = 0; i < values.length; i += 8) {
+    lines.push(indent + values.slice(i, i + 8).join(', '));
+  }
+  return lines.join(',\n');
+}
+
+/**
+ * Generate the board_image_data.h header with PROGMEM image arrays
  */
-function generateImageHeader(configResults) {
+function generateImageHeader(configResults, format = 'jpeg') {
+  const tiled = format !== 'jpeg';
   let content = `/**
  * Auto-generated Board Image Data for ESP32 Firmware
  *
  * DO NOT EDIT MANUALLY - This file is generated by:
  *   bun run controller:codegen:board-data
  *
- * Contains JPEG image data for each board configuration,
+ * Contains ${tiled ? `${format} image tiles (${TILE_HEIGHT} rows each)` : 'JPEG image data'} for each board configuration,
  * stored in PROGMEM for direct rendering on the display.
  *
  * Generated at: ${new Date().toISOString()}
@@ -378,8 +525,18 @@ function generateImageHeader(configResults) {
   for (const result of configResults) {
     const id = sanitizeId(result.configKey);
     content += `// ${result.configKey} (${result.width}x${result.height}, ${result.buffer.length} bytes)\n`;
-    content += `static const uint8_t image_${id}[] PROGMEM = {\n`;
+    if (!tiled) {
+      content += `static const uint8_t image_${id}[] PROGMEM = {\n`;
+      content += formatByteArray(result.buffer);
+      content += '\n};\n\n';
+      continue;
+    }
+    // Word-aligned so tiles copy into sprite memory with 32-bit moves
+    content += `static const uint8_t image_${id}[] PROGMEM __attribute__((aligned(4))) = {\n`;
     content += formatByteArray(result.buffer);
+    content += '\n};\n';
+    content += `static const uint32_t imageTiles_${id}[] PROGMEM = {\n`;
+    content += formatUint32Array(result.tileOffsets);
     content += '\n};\n\n';
   }
 
@@ -414,6 +571,14 @@ struct HoldMapEntry {
     uint8_t radius;  // pixel radius for circle overlay
 };
 
+// ledToHold entry for LED positions with no hold
+#define BOARD_NO_HOLD 0xFFFF
+
+// BoardConfig::imageFormat values
+#define BOARD_IMAGE_JPEG 0
+#define BOARD_IMAGE_RGB565 1      // Raw RGB565 tiles, panel byte order
+#define BOARD_IMAGE_RGB565_RLE 2  // RLE-encoded RGB565 tiles
+
 struct BoardConfig {
     const char* configKey;      // e.g., "kilter/1/7/1,20" (no angle)
     const uint8_t* imageData;
@@ -422,12 +587,27 @@ struct BoardConfig {
     uint16_t imageHeight;
     const HoldMapEntry* holdMap;
     uint16_t holdCount;
+    const uint16_t* ledToHold;  // ledPosition -> holdMap index (BOARD_NO_HOLD if none)
+    uint16_t ledToHoldSize;
+    uint8_t imageFormat;           // BOARD_IMAGE_*
+    uint16_t tileHeight;           // Rows per tile (RGB565 formats only)
+    const uint32_t* tileOffsets;   // tileCount + 1 byte offsets into imageData (nullptr for JPEG)
+    uint16_t tileCount;
 };
 
 extern const BoardConfig BOARD_CONFIGS[];
 extern const int BOARD_CONFIG_COUNT;
 
 const BoardConfig* findBoardConfig(const char* configKey);
+
+/**
+ * Look up the holdMap index for an LED position in O(1).
+ * Returns BOARD_NO_HOLD if no hold on this board uses that LED.
+ */
+inline uint16_t findHoldIndex(const BoardConfig* config, uint16_t ledPosition) {
+    if (ledPosition >= config->ledToHoldSize) return BOARD_NO_HOLD;
+    return config->ledToHold[ledPosition];
+}
 `;
 
   return content;
@@ -437,16 +617,17 @@ const BoardConfig* findBoardConfig(const char* configKey);
  * Generate board_data.cpp with all data arrays, lookup table, and findBoardConfig.
  * This file is compiled once and links the image data with hold mappings.
  */
-function generateDataCpp(configResults) {
+function generateDataCpp(configResults, format = 'jpeg') {
+  const tiled = format !== 'jpeg';
   let content = `/**
  * Auto-generated Board Data Implementation for ESP32 Firmware
  *
  * DO NOT EDIT MANUALLY - This file is generated by:
  *   bun run controller:codegen:board-data
  *
- * Contains hold mapping arrays, the master lookup table (BOARD_CONFIGS),
- * and the findBoardConfig() implementation. Includes board_image_data.h
- * for the JPEG image arrays.
+ * Contains hold mapping arrays, dense LED position -> hold index tables,
+ * the master lookup table (BOARD_CONFIGS), and the findBoardConfig()
+ * implementation. Includes board_image_data.h for the image arrays.
  *
  * Generated at: ${new Date().toISOString()}
  */
@@ -456,9 +637,11 @@ function generateDataCpp(configResults) {
 #include <string.h>
 #include <pgmspace.h>
 
+#define NO_HOLD BOARD_NO_HOLD
+
 `;
 
-  // Generate hold mapping arrays
+  // Generate hold mapping arrays and LED index tables
   for (const result of configResults) {
     const id = sanitizeId(result.configKey);
     if (result.holdMap.length === 0) {
@@ -473,6 +656,15 @@ function generateDataCpp(configResults) {
       content += entries.join(',\n');
       content += '\n};\n\n';
     }
+
+    if (result.ledIndex.length === 0) {
+      content += `static const uint16_t ledToHold_${id}[] PROGMEM = {NO_HOLD};\n\n`;
+    } else {
+      content += `// ${result.configKey}: LED positions 0-${result.ledIndex.length - 1} -> hold index\n`;
+      content += `static const uint16_t ledToHold_${id}[] PROGMEM = {\n`;
+      content += formatUint16Array(result.ledIndex);
+      content += '\n};\n\n';
+    }
   }
 
   // Generate master lookup table
@@ -481,7 +673,10 @@ function generateDataCpp(configResults) {
   for (const result of configResults) {
     const id = sanitizeId(result.configKey);
     const holdCount = result.holdMap.length || 0;
-    content += `    {"${result.configKey}", image_${id}, sizeof(image_${id}), ${result.width}, ${result.height}, holds_${id}, ${holdCount}},\n`;
+    const image = tiled
+      ? `${IMAGE_FORMATS[format]}, ${TILE_HEIGHT}, imageTiles_${id}, ${result.tileOffsets.length - 1}`
+      : `${IMAGE_FORMATS[format]}, 0, nullptr, 0`;
+    content += `    {"${result.configKey}", image_${id}, sizeof(image_${id}), ${result.width}, ${result.height}, holds_${id}, ${holdCount}, ledToHold_${id}, ${result.ledIndex.length}, ${image}},\n`;
   }
   content += `};\n`;
   content += `const int BOARD_CONFIG_COUNT = ${configResults.length};\n\n`;
@@ -509,6 +704,9 @@ async function main() {
   console.log('Board Data Code Generator');
   console.log('=========================\n');
 
+  const format = parseImageFormat(process.argv.slice(2), process.env);
+  console.log(`Image format: ${format}\n`);
+
   // Load source data
   const data = loadBoardData();
 
@@ -524,20 +722,23 @@ async function main() {
     process.stdout.write(`  Processing ${config.configKey}... `);
 
     try {
-      const imageResult = await compositeAndResize(config);
+      const imageResult = await compositeAndResize(config, format);
       if (!imageResult) {
         console.log('SKIPPED (no images)');
         continue;
       }
 
       const holdMap = computeHoldMap(config, imageResult.width, imageResult.height);
+      const ledIndex = computeLedIndex(holdMap);
 
       results.push({
         configKey: config.configKey,
         buffer: imageResult.buffer,
         width: imageResult.width,
         height: imageResult.height,
+        tileOffsets: imageResult.tileOffsets,
         holdMap,
+        ledIndex,
       });
 
       totalImageBytes += imageResult.buffer.length;
@@ -561,7 +762,7 @@ async function main() {
   }
 
   // Generate image data header
-  const imageHeader = generateImageHeader(results);
+  const imageHeader = generateImageHeader(results, format);
   const imageHeaderPath = path.join(OUTPUT_DIR, 'board_image_data.h');
   fs.writeFileSync(imageHeaderPath, imageHeader);
   console.log(`  Written: ${imageHeaderPath} (${(imageHeader.length / 1024).toFixed(0)} KB source)`);
@@ -573,24 +774,47 @@ async function main() {
   console.log(`  Written: ${holdHeaderPath} (${(holdHeader.length / 1024).toFixed(0)} KB source)`);
 
   // Generate board data implementation (all data arrays + lookup)
-  const dataCpp = generateDataCpp(results);
+  const dataCpp = generateDataCpp(results, format);
   const dataCppPath = path.join(OUTPUT_DIR, 'board_data.cpp');
   fs.writeFileSync(dataCppPath, dataCpp);
   console.log(`  Written: ${dataCppPath} (${(dataCpp.length / 1024).toFixed(0)} KB source)`);
 
-  // Verify JPEG magic bytes
-  let validJpegs = 0;
-  for (const result of results) {
-    if (result.buffer[0] === 0xFF && result.buffer[1] === 0xD8) {
-      validJpegs++;
+  if (format === 'jpeg') {
+    // Verify JPEG magic bytes
+    let validJpegs = 0;
+    for (const result of results) {
+      if (result.buffer[0] === 0xFF && result.buffer[1] === 0xD8) {
+        validJpegs++;
+      }
     }
+    console.log(`\nJPEG validation: ${validJpegs}/${results.length} valid`);
+  } else {
+    const rawBytes = results.reduce((sum, r) => sum + r.width * r.height * 2, 0);
+    console.log(`\n${format}: ${(totalImageBytes / 1024 / 1024).toFixed(2)} MB flash ` +
+      `(${((totalImageBytes / rawBytes) * 100).toFixed(0)}% of raw RGB565)`);
   }
-  console.log(`\nJPEG validation: ${validJpegs}/${results.length} valid`);
 
   console.log('\nDone!');
 }
 
-main().catch(err => {
-  console.error('Fatal error:', err);
-  process.exit(1);
-});
+// Run main only when script is executed directly (not when imported for testing)
+const isMainModule = process.argv[1] &&
+  fileURLToPath(import.meta.url) === process.argv[1];
+
+if (isMainModule) {
+  main().catch(err => {
+    console.error('Fatal error:', err);
+    process.exit(1);
+  });
+}
+
+// Export functions for testing
+export {
+  computeLedIndex,
+  toRgb565,
+  encodeRle565,
+  encodeRgb565Tiles,
+  parseImageFormat,
+  IMAGE_FORMATS,
+  TILE_HEIGHT,
+};
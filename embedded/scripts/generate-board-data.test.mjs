@@ -8,6 +8,7 @@
  * 3. Verifying JPEG magic bytes in image data
  * 4. Verifying hold coordinate sanity
  * 5. Verifying config key format and lookup table completeness
+ * 6. Round-tripping the RGB565 tile / RLE encoders used by --image-format
  *
  * Output structure:
  *   board_image_data.h  - PROGMEM JPEG arrays (header, included by board_data.cpp)
@@ -25,6 +26,14 @@ import * as path from 'path';
 import { fileURLToPath } from 'url';
 import { execSync } from 'child_process';
 
+import {
+  toRgb565,
+  encodeRle565,
+  encodeRgb565Tiles,
+  parseImageFormat,
+  TILE_HEIGHT,
+} from './generate-board-data.mjs';
+
 const __filename = fileURLToPath(import.meta.url);
 const __dirname = path.dirname(__filename);
 const OUTPUT_DIR = path.join(__dirname, '../libs/board-data/src');
@@ -228,3 +237,92 @@ describe('generate-board-data', () => {
     });
   });
 });
+
+/**
+ * Reference decoder for the RLE stream (mirrors rle565Decode in display-base)
+ */
+function decodeRle565(encoded) {
+  const out = [];
+  let i = 0;
+  while (i < encoded.length) {
+    const control = encoded[i++];
+    if (control & 0x80) {
+      const n = (control & 0x7F) + 2;
+      for (let k = 0; k < n; k++) out.push(encoded[i], encoded[i + 1]);
+      i += 2;
+    } else {
+      const n = (control + 1) * 2;
+      for (let k = 0; k < n; k++) out.push(encoded[i + k]);
+      i += n;
+    }
+  }
+  return Buffer.from(out);
+}
+
+function pixelBuffer(values) {
+  const buf = Buffer.alloc(values.length * 2);
+  values.forEach((v, i) => buf.writeUInt16BE(v, i * 2));
+  return buf;
+}
+
+describe('RGB565 tile encoding', () => {
+  it('should convert RGB to RGB565 in panel byte order', () => {
+    const rgb = Buffer.from([255, 0, 0, 0, 255, 0, 0, 0, 255, 255, 255, 255]);
+    const out = toRgb565(rgb, 4, 1);
+    assert.deepEqual([...out], [0xF8, 0x00, 0x07, 0xE0, 0x00, 0x1F, 0xFF, 0xFF]);
+  });
+
+  it('should encode long runs as a single run packet', () => {
+    const encoded = encodeRle565(pixelBuffer(new Array(100).fill(0x1234)));
+    assert.deepEqual([...encoded], [0x80 | 98, 0x12, 0x34]);
+  });
+
+  it('should split runs longer than 129 pixels', () => {
+    const encoded = encodeRle565(pixelBuffer(new Array(300).fill(7)));
+    assert.equal(encoded.length, 9);
+    assert.deepEqual(decodeRle565(encoded), pixelBuffer(new Array(300).fill(7)));
+  });
+
+  it('should keep short repeats inside literal blocks', () => {
+    const encoded = encodeRle565(pixelBuffer([1, 1, 2, 3, 3, 4]));
+    assert.equal(encoded[0], 5, 'one literal block of 6 pixels');
+    assert.equal(encoded.length, 1 + 12);
+  });
+
+  it('should round-trip mixed literal and run data', () => {
+    const values = [];
+    for (let i = 0; i < 1000; i++) values.push(i % 7 === 0 ? 0xFFFF : (i * 37) & 0xFFFF);
+    for (let i = 0; i < 200; i++) values.push(0x0841);
+    const pixels = pixelBuffer(values);
+    assert.deepEqual(decodeRle565(encodeRle565(pixels)), pixels);
+  });
+
+  it('should split an image into independently decodable tiles', () => {
+    const width = 10;
+    const height = TILE_HEIGHT * 2 + 5;
+    const values = [];
+    for (let i = 0; i < width * height; i++) values.push(Math.floor(i / 30));
+    const pixels = pixelBuffer(values);
+
+    const { buffer, offsets } = encodeRgb565Tiles(pixels, width, height, true);
+    assert.equal(offsets.length, 4, 'three tiles plus end offset');
+    assert.equal(offsets[3], buffer.length);
+
+    const lastTile = decodeRle565(buffer.subarray(offsets[2], offsets[3]));
+    assert.deepEqual(lastTile, pixels.subarray(TILE_HEIGHT * 2 * width * 2));
+  });
+
+  it('should store raw tiles at fixed offsets', () => {
+    const pixels = pixelBuffer(new Array(8 * (TILE_HEIGHT + 1)).fill(3));
+    const { buffer, offsets } = encodeRgb565Tiles(pixels, 8, TILE_HEIGHT + 1, false);
+    assert.deepEqual(offsets, [0, 8 * TILE_HEIGHT * 2, 8 * (TILE_HEIGHT + 1) * 2]);
+    assert.deepEqual(buffer, pixels);
+  });
+
+  it('should resolve the image format from argv, then env, then default', () => {
+    assert.equal(parseImageFormat([], {}), 'jpeg');
+    assert.equal(parseImageFormat([], { BOARD_IMAGE_FORMAT: 'rgb565' }), 'rgb565');
+    assert.equal(parseImageFormat(['--image-format=rgb565-rle'], { BOARD_IMAGE_FORMAT: 'rgb565' }), 'rgb565-rle');
+    assert.throws(() => parseImageFormat(['--image-format=lz4'], {}));
+  });
+});
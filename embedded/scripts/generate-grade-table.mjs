@@ -0,0 +1,373 @@
+#!/usr/bin/env node
+/**
+ * Grade Table Code Generator for ESP32 Firmware
+ *
+ * Reads the boulder grade scale (BOULDER_GRADES) and grade colors
+ * (V_GRADE_COLORS) from the web app and produces a C++ header with:
+ *
+ *   - one grade ID per grade on the scale, plus V-grades with no Font equivalent
+ *   - RGB565 background and contrasting text color per grade ID
+ *   - a perfect hash over every grade string the backend emits ("6a/V3",
+ *     "6a", "V3"), so a string resolves to its ID with one hash and one compare
+ *
+ * The firmware resolves grade strings to IDs once when the queue syncs; drawing
+ * a row is then an array index.
+ *
+ * Usage:
+ *   node embedded/scripts/generate-grade-table.mjs
+ *
+ * Or via npm script:
+ *   bun run controller:codegen:grade-table
+ */
+
+import * as fs from 'fs';
+import * as path from 'path';
+import { fileURLToPath } from 'url';
+
+// ESM-compatible __dirname
+const __filename = fileURLToPath(import.meta.url);
+const __dirname = path.dirname(__filename);
+
+// Path configuration
+const PROJECT_ROOT = path.join(__dirname, '../..');
+const WEB_LIB = path.join(PROJECT_ROOT, 'packages/web/app/lib');
+export const OUTPUT_PATH = path.join(__dirname, '../libs/display-base/src/grade_table.h');
+
+// Firmware default for grades it cannot resolve (light gray)
+const DEFAULT_GRADE_COLOR = '#C8C8C8';
+
+const FNV_OFFSET = 2166136261;
+const FNV_PRIME = 16777619;
+const MAX_SEED_ATTEMPTS = 200000;
+
+/**
+ * Extract a JavaScript object/array literal from TypeScript source.
+ * Same balanced-brace approach as generate-board-data.mjs; input is trusted
+ * local source.
+ */
+function extractJsObject(content, varName) {
+  const regex = new RegExp(`(?:export\\s+)?const\\s+${varName}\\s*(?::[^=]+=|=)\\s*`);
+  const match = regex.exec(content);
+  if (!match) return null;
+
+  const startIdx = match.index + match[0].length;
+  let depth = 0;
+  let inString = false;
+  let stringChar = '';
+  let i = startIdx;
+
+  for (; i < content.length; i++) {
+    const ch = content[i];
+    if (inString) {
+      if (ch === '\\') { i++; continue; }
+      if (ch === stringChar) inString = false;
+      continue;
+    }
+    if (ch === "'" || ch === '"' || ch === '`') {
+      inString = true;
+      stringChar = ch;
+      continue;
+    }
+    if (ch === '/' && content[i + 1] === '/') {
+      // Skip line comments so apostrophes in them don't open a string
+      while (i < content.length && content[i] !== '\n') i++;
+      continue;
+    }
+    if (ch === '{' || ch === '[') depth++;
+    if (ch === '}' || ch === ']') {
+      depth--;
+      if (depth === 0) { i++; break; }
+    }
+  }
+
+  const objStr = content.substring(startIdx, i);
+  const cleaned = objStr.replace(/\s*as\s+const\s*;?\s*$/, '').replace(/;\s*$/, '');
+  try {
+    // SAFETY: input is from local TS source files, not user input.
+    return (0, eval)('(' + cleaned + ')');
+  } catch (e) {
+    console.error(`Failed to parse ${varName}:`, e.message);
+    return null;
+  }
+}
+
+/**
+ * Load the grade scale and colors from the web app sources
+ */
+function loadGradeData() {
+  const boardData = fs.readFileSync(path.join(WEB_LIB, 'board-data.ts'), 'utf-8');
+  const gradeColors = fs.readFileSync(path.join(WEB_LIB, 'grade-colors.ts'), 'utf-8');
+
+  const BOULDER_GRADES = extractJsObject(boardData, 'BOULDER_GRADES');
+  const V_GRADE_COLORS = extractJsObject(gradeColors, 'V_GRADE_COLORS');
+  const FONT_GRADE_COLORS = extractJsObject(gradeColors, 'FONT_GRADE_COLORS');
+
+  if (!BOULDER_GRADES || !V_GRADE_COLORS || !FONT_GRADE_COLORS) {
+    throw new Error('Failed to load BOULDER_GRADES, V_GRADE_COLORS or FONT_GRADE_COLORS');
+  }
+  return { BOULDER_GRADES, V_GRADE_COLORS, FONT_GRADE_COLORS };
+}
+
+/**
+ * Convert "#RRGGBB" to RGB565
+ */
+function hexToRgb565(hex) {
+  const r = parseInt(hex.slice(1, 3), 16);
+  const g = parseInt(hex.slice(3, 5), 16);
+  const b = parseInt(hex.slice(5, 7), 16);
+  return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
+}
+
+/**
+ * Black or white text for a RGB565 background, matching isLightColor()
+ */
+function textColorFor(color565) {
+  const r = (color565 >> 11) << 3;
+  const g = ((color565 >> 5) & 0x3F) << 2;
+  const b = (color565 & 0x1F) << 3;
+  const luminance = (0.299 * r + 0.587 * g + 0.114 * b) / 255;
+  return luminance > 0.5 ? 0x0000 : 0xFFFF;
+}
+
+/**
+ * Case-insensitive FNV-1a, identical to gradeHash() in the generated header
+ */
+function gradeHash(str, seed) {
+  let h = (FNV_OFFSET ^ seed) >>> 0;
+  for (const ch of str) {
+    let c = ch.charCodeAt(0);
+    if (c >= 65 && c <= 90) c += 32;
+    h = Math.imul(h ^ c, FNV_PRIME) >>> 0;
+  }
+  return h;
+}
+
+/**
+ * Build grade IDs and the lookup keys that resolve to them.
+ * ID 0 is reserved for unknown grades.
+ */
+function buildGrades({ BOULDER_GRADES, V_GRADE_COLORS, FONT_GRADE_COLORS }) {
+  const grades = [{ name: '', vGrade: '', hex: DEFAULT_GRADE_COLOR }];
+  const keys = new Map();
+
+  const addKey = (key, id) => {
+    const lower = key.toLowerCase();
+    if (!keys.has(lower)) keys.set(lower, id);
+  };
+
+  for (const g of BOULDER_GRADES) {
+    const hex = V_GRADE_COLORS[g.v_grade];
+    if (!hex) throw new Error(`No color for ${g.v_grade}`);
+    if (FONT_GRADE_COLORS[g.font_grade] && FONT_GRADE_COLORS[g.font_grade] !== hex) {
+      throw new Error(`Font color for ${g.font_grade} disagrees with ${g.v_grade}`);
+    }
+    const id = grades.length;
+    grades.push({ name: g.difficulty_name, vGrade: g.v_grade, hex });
+    addKey(g.difficulty_name, id);
+    addKey(g.font_grade, id);
+    // A bare V-grade resolves to the easiest grade that carries it
+    addKey(g.v_grade, id);
+  }
+
+  // V-grades above the Font scale (e.g. V17) still need a color
+  for (const [vGrade, hex] of Object.entries(V_GRADE_COLORS)) {
+    if (keys.has(vGrade.toLowerCase())) continue;
+    const id = grades.length;
+    grades.push({ name: vGrade, vGrade, hex });
+    addKey(vGrade, id);
+  }
+
+  if (grades.length > 255) throw new Error('Grade IDs no longer fit in uint8_t');
+  return { grades, keys: [...keys.entries()].map(([key, id]) => ({ key, id })) };
+}
+
+/**
+ * Find the smallest power-of-two table and a seed that place every key in its
+ * own slot
+ */
+function findPerfectHash(keys) {
+  for (let slots = 64; slots <= 4096; slots *= 2) {
+    if (slots < keys.length * 2) continue;
+    for (let seed = 0; seed < MAX_SEED_ATTEMPTS; seed++) {
+      const table = new Array(slots).fill(0);
+      let ok = true;
+      for (let i = 0; i < keys.length; i++) {
+        const slot = gradeHash(keys[i].key, seed) & (slots - 1);
+        if (table[slot] !== 0) { ok = false; break; }
+        table[slot] = i + 1;
+      }
+      if (ok) return { seed, slots, table };
+    }
+  }
+  throw new Error('No perfect hash found for grade keys');
+}
+
+function hex16(v) {
+  return '0x' + v.toString(16).toUpperCase().padStart(4, '0');
+}
+
+/**
+ * Pad [code, comment] rows so trailing comments line up (as clang-format does)
+ */
+function alignComments(rows) {
+  const width = Math.max(...rows.map(([code]) => code.length));
+  return rows.map(([code, comment]) => `${code.padEnd(width)}  // ${comment}`);
+}
+
+/**
+ * Render grade_table.h
+ */
+function generateHeader({ grades, keys }, { seed, slots, table }) {
+  const vMax = Math.max(...grades.filter(g => g.vGrade).map(g => parseInt(g.vGrade.slice(1), 10)));
+  const idByV = new Array(vMax + 1).fill(0);
+  for (let id = grades.length - 1; id > 0; id--) {
+    idByV[parseInt(grades[id].vGrade.slice(1), 10)] = id;
+  }
+
+  const colorName = (g) => (g.vGrade ? `COLOR_${g.vGrade}` : 'COLOR_GRADE_DEFAULT');
+  const lines = [];
+  lines.push(`/**
+ * Grade Lookup Table
+ * Source: packages/web/app/lib/board-data.ts (BOULDER_GRADES)
+ *         packages/web/app/lib/grade-colors.ts (V_GRADE_COLORS)
+ *
+ * DO NOT EDIT MANUALLY - This file is generated by:
+ *   bun run controller:codegen:grade-table
+ *
+ * Every grade string the backend emits ("6a/V3", "6a", "V3", any case) maps
+ * to a grade ID through a perfect hash; the ID indexes GRADE_INFO for colors.
+ */
+
+#ifndef GRADE_TABLE_H
+#define GRADE_TABLE_H
+
+#include <stdint.h>
+
+// V-grade colors (RGB565)`);
+
+  const seenV = new Set();
+  const colorRows = [];
+  for (const g of grades) {
+    if (!g.vGrade || seenV.has(g.vGrade)) continue;
+    seenV.add(g.vGrade);
+    colorRows.push([`#define COLOR_${g.vGrade} ${hex16(hexToRgb565(g.hex))}`, g.hex]);
+  }
+  lines.push(...alignComments(colorRows));
+
+  lines.push(`
+// Default color for unknown grades
+#define COLOR_GRADE_DEFAULT ${hex16(hexToRgb565(DEFAULT_GRADE_COLOR))}  // ${DEFAULT_GRADE_COLOR}
+
+#define GRADE_ID_UNKNOWN 0
+#define GRADE_COUNT ${grades.length}
+#define GRADE_V_MAX ${vMax}
+#define GRADE_KEY_COUNT ${keys.length}
+#define GRADE_HASH_SLOTS ${slots}
+#define GRADE_HASH_SEED ${seed}u
+
+struct GradeInfo {
+    const char* name;    // Canonical difficulty name ("6a/V3"), empty if unknown
+    const char* vGrade;  // V-grade label ("V3"), empty if unknown
+    uint16_t color;      // RGB565 background
+    uint16_t textColor;  // Black or white, whichever reads on color
+};
+
+struct GradeKey {
+    const char* key;  // Lowercase grade string
+    uint8_t id;
+};
+
+// Indexed by grade ID
+constexpr GradeInfo GRADE_INFO[GRADE_COUNT] = {`);
+
+  lines.push(...alignComments(grades.map((g, id) => {
+    const text = hex16(textColorFor(hexToRgb565(g.hex)));
+    return [`    {"${g.name}", "${g.vGrade}", ${colorName(g)}, ${text}},`, id === 0 ? 'Unknown' : `${id}`];
+  })));
+
+  lines.push(`};
+
+// Easiest grade ID carrying each V-grade
+constexpr uint8_t GRADE_ID_BY_V[GRADE_V_MAX + 1] = {${idByV.join(', ')}};
+
+constexpr GradeKey GRADE_KEYS[GRADE_KEY_COUNT] = {`);
+  for (const k of keys) {
+    lines.push(`    {"${k.key}", ${k.id}},`);
+  }
+  lines.push('};');
+
+  lines.push(`
+// Hash slot -> GRADE_KEYS index + 1 (0 = empty)
+constexpr uint8_t GRADE_HASH_TABLE[GRADE_HASH_SLOTS] = {`);
+  for (let i = 0; i < table.length; i += 16) {
+    lines.push(`    ${table.slice(i, i + 16).join(', ')},`);
+  }
+  lines.push(`};
+
+constexpr char gradeLower(char c) {
+    return (c >= 'A' && c <= 'Z') ? (char)(c + ('a' - 'A')) : c;
+}
+
+/** Case-insensitive FNV-1a over a grade string */
+constexpr uint32_t gradeHash(const char* s, uint32_t h = 2166136261u ^ GRADE_HASH_SEED) {
+    return *s ? gradeHash(s + 1, (h ^ (uint8_t)gradeLower(*s)) * 16777619u) : h;
+}
+
+/**
+ * Exact lookup of a grade string
+ * @return Grade ID, GRADE_ID_UNKNOWN if the string is not on the scale
+ */
+inline uint8_t gradeIdLookup(const char* grade) {
+    if (!grade || !grade[0]) return GRADE_ID_UNKNOWN;
+    uint8_t entry = GRADE_HASH_TABLE[gradeHash(grade) & (GRADE_HASH_SLOTS - 1)];
+    if (entry == 0) return GRADE_ID_UNKNOWN;
+
+    const char* key = GRADE_KEYS[entry - 1].key;
+    const char* p = grade;
+    while (*p && gradeLower(*p) == *key) {
+        p++;
+        key++;
+    }
+    return (*p == '\\0' && *key == '\\0') ? GRADE_KEYS[entry - 1].id : GRADE_ID_UNKNOWN;
+}
+
+#endif  // GRADE_TABLE_H
+`);
+  return lines.join('\n');
+}
+
+function main() {
+  console.log('Loading grade scale from TypeScript source files...');
+  const data = loadGradeData();
+  const built = buildGrades(data);
+  const hash = findPerfectHash(built.keys);
+
+  fs.writeFileSync(OUTPUT_PATH, generateHeader(built, hash));
+  console.log(`  ${built.grades.length} grade IDs, ${built.keys.length} keys`);
+  console.log(`  Perfect hash: ${hash.slots} slots, seed ${hash.seed}`);
+  console.log(`Wrote ${path.relative(PROJECT_ROOT, OUTPUT_PATH)}`);
+}
+
+// Run main only when script is executed directly (not when imported for testing)
+const isMainModule = process.argv[1] &&
+  fileURLToPath(import.meta.url) === process.argv[1];
+
+if (isMainModule) {
+  try {
+    main();
+  } catch (err) {
+    console.error('Fatal error:', err);
+    process.exit(1);
+  }
+}
+
+// Export functions for testing
+export {
+  loadGradeData,
+  buildGrades,
+  findPerfectHash,
+  generateHeader,
+  gradeHash,
+  hexToRgb565,
+  textColorFor,
+};
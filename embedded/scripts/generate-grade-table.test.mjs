@@ -0,0 +1,85 @@
+#!/usr/bin/env node
+/**
+ * Tests for the grade table code generator.
+ *
+ * Validates that:
+ * 1. Every BOULDER_GRADES entry gets an ID and every V-grade a color
+ * 2. The perfect hash places each key in its own slot
+ * 3. Text colors follow the firmware's isLightColor() rule
+ * 4. The checked-in grade_table.h matches the current web app grade scale
+ *
+ * Usage:
+ *   node --test embedded/scripts/generate-grade-table.test.mjs
+ */
+
+import { describe, it } from 'node:test';
+import assert from 'node:assert/strict';
+import * as fs from 'fs';
+
+import {
+  loadGradeData,
+  buildGrades,
+  findPerfectHash,
+  generateHeader,
+  gradeHash,
+  hexToRgb565,
+  textColorFor,
+  OUTPUT_PATH,
+} from './generate-grade-table.mjs';
+
+describe('generate-grade-table', () => {
+  const data = loadGradeData();
+  const built = buildGrades(data);
+
+  it('assigns an ID to every grade on the scale', () => {
+    for (const g of data.BOULDER_GRADES) {
+      const key = built.keys.find(k => k.key === g.difficulty_name.toLowerCase());
+      assert.ok(key, `missing ${g.difficulty_name}`);
+      assert.equal(built.grades[key.id].name, g.difficulty_name);
+    }
+  });
+
+  it('reserves ID 0 for unknown grades', () => {
+    assert.equal(built.grades[0].name, '');
+    assert.ok(built.keys.every(k => k.id > 0));
+  });
+
+  it('resolves every V-grade color', () => {
+    for (const [vGrade, hex] of Object.entries(data.V_GRADE_COLORS)) {
+      const key = built.keys.find(k => k.key === vGrade.toLowerCase());
+      assert.ok(key, `missing ${vGrade}`);
+      assert.equal(built.grades[key.id].hex, hex);
+    }
+  });
+
+  it('maps bare V-grades to the easiest grade carrying them', () => {
+    const v3 = built.keys.find(k => k.key === 'v3');
+    assert.equal(built.grades[v3.id].name, '6a/V3');
+  });
+
+  it('finds a collision-free hash', () => {
+    const { seed, slots } = findPerfectHash(built.keys);
+    const used = new Set(built.keys.map(k => gradeHash(k.key, seed) & (slots - 1)));
+    assert.equal(used.size, built.keys.length);
+  });
+
+  it('hashes case-insensitively', () => {
+    assert.equal(gradeHash('6A+/V3', 7), gradeHash('6a+/v3', 7));
+  });
+
+  it('converts hex colors to RGB565', () => {
+    assert.equal(hexToRgb565('#FFFFFF'), 0xFFFF);
+    assert.equal(hexToRgb565('#FFEB3B'), 0xFF47);
+  });
+
+  it('picks black text on light colors and white on dark', () => {
+    assert.equal(textColorFor(hexToRgb565('#FFEB3B')), 0x0000);
+    assert.equal(textColorFor(hexToRgb565('#2A0054')), 0xFFFF);
+  });
+
+  it('matches the checked-in header', () => {
+    const expected = generateHeader(built, findPerfectHash(built.keys));
+    const actual = fs.readFileSync(OUTPUT_PATH, 'utf-8');
+    assert.equal(actual, expected, 'grade_table.h is stale; run bun run controller:codegen:grade-table');
+  });
+});
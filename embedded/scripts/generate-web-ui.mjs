@@ -0,0 +1,122 @@
+#!/usr/bin/env node
+/**
+ * Web UI Code Generator for ESP32 Firmware
+ *
+ * Gzips the configuration page (embedded/libs/esp-web-server/web/index.html)
+ * and writes it as a byte array the firmware serves straight from flash with
+ * Content-Encoding: gzip. The header also carries an ETag derived from the
+ * compressed bytes, so browsers can revalidate with If-None-Match and get a
+ * 304 instead of the page.
+ *
+ * The output is byte-for-byte reproducible: the gzip header has no file name
+ * or timestamp and a fixed OS byte.
+ *
+ * Usage:
+ *   node embedded/scripts/generate-web-ui.mjs
+ *
+ * Or via npm script:
+ *   bun run controller:codegen:web-ui
+ */
+
+import * as crypto from 'crypto';
+import * as fs from 'fs';
+import * as path from 'path';
+import * as zlib from 'zlib';
+import { fileURLToPath } from 'url';
+
+// ESM-compatible __dirname
+const __filename = fileURLToPath(import.meta.url);
+const __dirname = path.dirname(__filename);
+
+// Path configuration
+const PROJECT_ROOT = path.join(__dirname, '../..');
+export const SOURCE_PATH = path.join(__dirname, '../libs/esp-web-server/web/index.html');
+export const OUTPUT_PATH = path.join(__dirname, '../libs/esp-web-server/src/web_ui.h');
+
+// gzip header byte 9 (OS); zlib fills in the build host's, which would make
+// the output differ between machines
+const GZIP_OS_UNIX = 3;
+
+/**
+ * Gzip the page at maximum compression, reproducibly
+ */
+function compressPage(html) {
+  const gz = zlib.gzipSync(Buffer.from(html, 'utf-8'), { level: 9, memLevel: 9 });
+  gz[9] = GZIP_OS_UNIX;
+  return gz;
+}
+
+/**
+ * Strong ETag for the compressed page (quoted, as sent in the header)
+ */
+function etagFor(gz) {
+  return '"' + crypto.createHash('sha256').update(gz).digest('hex').slice(0, 16) + '"';
+}
+
+/**
+ * Render web_ui.h
+ */
+function generateHeader(html, gz) {
+  const etag = etagFor(gz);
+  const htmlBytes = Buffer.byteLength(html, 'utf-8');
+  const lines = [];
+  lines.push(`/**
+ * Configuration Web UI (gzip)
+ * Source: embedded/libs/esp-web-server/web/index.html
+ *
+ * DO NOT EDIT MANUALLY - This file is generated by:
+ *   bun run controller:codegen:web-ui
+ *
+ * ${htmlBytes} bytes of HTML, ${gz.length} bytes gzipped.
+ */
+
+#ifndef WEB_UI_H
+#define WEB_UI_H
+
+#include <stdint.h>
+
+#define WEB_UI_HTML_SIZE ${htmlBytes}
+#define WEB_UI_GZ_SIZE ${gz.length}
+#define WEB_UI_ETAG "${etag.replace(/"/g, '\\"')}"
+
+// Constant data stays in flash (memory-mapped); nothing is copied to RAM
+alignas(4) static const uint8_t WEB_UI_GZ[WEB_UI_GZ_SIZE] = {`);
+  for (let i = 0; i < gz.length; i += 16) {
+    const row = [...gz.subarray(i, i + 16)].map(b => '0x' + b.toString(16).padStart(2, '0'));
+    lines.push(`    ${row.join(', ')},`);
+  }
+  lines.push(`};
+
+#endif  // WEB_UI_H
+`);
+  return lines.join('\n');
+}
+
+function main() {
+  const html = fs.readFileSync(SOURCE_PATH, 'utf-8');
+  const gz = compressPage(html);
+
+  fs.writeFileSync(OUTPUT_PATH, generateHeader(html, gz));
+  console.log(`  ${Buffer.byteLength(html, 'utf-8')} bytes of HTML -> ${gz.length} bytes gzipped, ETag ${etagFor(gz)}`);
+  console.log(`Wrote ${path.relative(PROJECT_ROOT, OUTPUT_PATH)}`);
+}
+
+// Run main only when script is executed directly (not when imported for testing)
+const isMainModule = process.argv[1] &&
+  fileURLToPath(import.meta.url) === process.argv[1];
+
+if (isMainModule) {
+  try {
+    main();
+  } catch (err) {
+    console.error('Fatal error:', err);
+    process.exit(1);
+  }
+}
+
+// Export functions for testing
+export {
+  compressPage,
+  etagFor,
+  generateHeader,
+};
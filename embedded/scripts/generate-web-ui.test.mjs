@@ -0,0 +1,62 @@
+#!/usr/bin/env node
+/**
+ * Tests for the web UI code generator.
+ *
+ * Validates that:
+ * 1. The compressed page decompresses to the source HTML
+ * 2. Output is reproducible and the ETag follows the compressed bytes
+ * 3. The checked-in web_ui.h matches web/index.html
+ *
+ * Usage:
+ *   node --test embedded/scripts/generate-web-ui.test.mjs
+ */
+
+import { describe, it } from 'node:test';
+import assert from 'node:assert/strict';
+import * as fs from 'fs';
+import * as zlib from 'zlib';
+
+import {
+  compressPage,
+  etagFor,
+  generateHeader,
+  SOURCE_PATH,
+  OUTPUT_PATH,
+} from './generate-web-ui.mjs';
+
+describe('generate-web-ui', () => {
+  const html = fs.readFileSync(SOURCE_PATH, 'utf-8');
+  const gz = compressPage(html);
+
+  it('round-trips through gunzip', () => {
+    assert.equal(zlib.gunzipSync(gz).toString('utf-8'), html);
+  });
+
+  it('compresses the page well', () => {
+    assert.ok(gz.length < html.length / 2, `${gz.length} of ${html.length} bytes`);
+  });
+
+  it('writes a gzip header with no timestamp and a fixed OS byte', () => {
+    assert.deepEqual([...gz.subarray(0, 4)], [0x1f, 0x8b, 0x08, 0x00]);
+    assert.equal(gz.readUInt32LE(4), 0);
+    assert.equal(gz[9], 3);
+    assert.deepEqual(compressPage(html), gz);
+  });
+
+  it('changes the ETag when the page changes', () => {
+    const etag = etagFor(gz);
+    assert.match(etag, /^"[0-9a-f]{16}"$/);
+    assert.notEqual(etagFor(compressPage(html + ' ')), etag);
+  });
+
+  it('emits every byte', () => {
+    const header = generateHeader(html, gz);
+    assert.equal((header.match(/0x[0-9a-f]{2}/g) || []).length, gz.length);
+    assert.ok(header.includes(`#define WEB_UI_GZ_SIZE ${gz.length}\n`));
+  });
+
+  it('matches the checked-in header', () => {
+    const actual = fs.readFileSync(OUTPUT_PATH, 'utf-8');
+    assert.equal(actual, generateHeader(html, gz), 'web_ui.h is stale; run bun run controller:codegen:web-ui');
+  });
+});
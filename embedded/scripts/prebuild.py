@@ -40,10 +40,36 @@ BOARD_DATA_OUTPUT = SCRIPT_DIR.parent / "libs" / "board-data" / "src" / "board_h
 BOARD_DATA_HASH_FILE = SCRIPT_DIR.parent / "libs" / "board-data" / ".board_data_hash"
 BOARD_DATA_CODEGEN_SCRIPT = SCRIPT_DIR / "generate-board-data.mjs"
 
+# Grade table codegen paths
+GRADE_TABLE_SOURCES = [
+    PROJECT_ROOT / "packages" / "web" / "app" / "lib" / "board-data.ts",
+    PROJECT_ROOT / "packages" / "web" / "app" / "lib" / "grade-colors.ts",
+]
+GRADE_TABLE_OUTPUT = SCRIPT_DIR.parent / "libs" / "display-base" / "src" / "grade_table.h"
+GRADE_TABLE_HASH_FILE = SCRIPT_DIR.parent / "libs" / "display-base" / ".grade_table_hash"
+GRADE_TABLE_CODEGEN_SCRIPT = SCRIPT_DIR / "generate-grade-table.mjs"
+
+# Web UI codegen paths
+WEB_UI_SOURCE = SCRIPT_DIR.parent / "libs" / "esp-web-server" / "web" / "index.html"
+WEB_UI_OUTPUT = SCRIPT_DIR.parent / "libs" / "esp-web-server" / "src" / "web_ui.h"
+WEB_UI_HASH_FILE = SCRIPT_DIR.parent / "libs" / "esp-web-server" / ".web_ui_hash"
+WEB_UI_CODEGEN_SCRIPT = SCRIPT_DIR / "generate-web-ui.mjs"
+
+
+def get_board_image_format() -> str:
+    """Board image format from `custom_board_image_format` in platformio.ini (default jpeg)."""
+    try:
+        value = env.GetProjectOption("custom_board_image_format", "")
+    except Exception:
+        value = ""
+    return value or os.environ.get("BOARD_IMAGE_FORMAT", "") or "jpeg"
+
 # Use environment variable to track execution across potential script reloads.
 # This is more robust than a module-level variable if PlatformIO reloads scripts.
 _CODEGEN_RAN_ENV_KEY = "_GRAPHQL_CODEGEN_RAN"
 _BOARD_DATA_RAN_ENV_KEY = "_BOARD_DATA_CODEGEN_RAN"
+_GRADE_TABLE_RAN_ENV_KEY = "_GRADE_TABLE_CODEGEN_RAN"
+_WEB_UI_RAN_ENV_KEY = "_WEB_UI_CODEGEN_RAN"
 
 
 def _has_codegen_run() -> bool:
@@ -117,12 +143,15 @@ def run_codegen():
 
 
 def get_board_data_hash() -> str:
-    """Get combined hash of board data source files."""
+    """Get combined hash of board data sources, the generator and the image format."""
     hasher = hashlib.sha256()
-    for filepath in BOARD_DATA_SOURCES:
+    # Generator changes (new tables, new formats) must regenerate too
+    for filepath in BOARD_DATA_SOURCES + [BOARD_DATA_CODEGEN_SCRIPT]:
         if filepath.exists():
             with open(filepath, "rb") as f:
                 hasher.update(f.read())
+    # Switching formats must regenerate even when the sources are unchanged
+    hasher.update(get_board_image_format().encode())
     return hasher.hexdigest()
 
 
@@ -147,7 +176,7 @@ def run_board_data_codegen():
 
     try:
         result = subprocess.run(
-            ["node", str(BOARD_DATA_CODEGEN_SCRIPT)],
+            ["node", str(BOARD_DATA_CODEGEN_SCRIPT), f"--image-format={get_board_image_format()}"],
             cwd=str(PROJECT_ROOT),
             capture_output=True,
             text=True,
@@ -206,12 +235,158 @@ def check_board_data_codegen():
         print("[Board Data Codegen] Board data is up-to-date")
 
 
+def get_grade_table_hash() -> str:
+    """Get combined hash of the grade scale and grade color sources and the generator."""
+    hasher = hashlib.sha256()
+    for filepath in GRADE_TABLE_SOURCES + [GRADE_TABLE_CODEGEN_SCRIPT]:
+        if filepath.exists():
+            with open(filepath, "rb") as f:
+                hasher.update(f.read())
+    return hasher.hexdigest()
+
+
+def run_grade_table_codegen():
+    """Run the grade table code generator."""
+    print("=" * 60)
+    print("Grade Table Codegen: Generating C++ grade lookup table...")
+    print("=" * 60)
+
+    try:
+        result = subprocess.run(
+            ["node", str(GRADE_TABLE_CODEGEN_SCRIPT)],
+            cwd=str(PROJECT_ROOT),
+            capture_output=True,
+            text=True,
+            timeout=60,
+        )
+
+        if result.returncode != 0:
+            print(f"Error running grade table codegen:\n{result.stderr}")
+            print("Warning: Grade table codegen failed, using existing table")
+            return False
+
+        print(result.stdout)
+        return True
+
+    except FileNotFoundError:
+        print("Warning: Node.js not found. Skipping grade table codegen.")
+        return False
+    except subprocess.TimeoutExpired:
+        print("Warning: Grade table codegen timed out")
+        return False
+    except Exception as e:
+        print(f"Warning: Grade table codegen error: {e}")
+        return False
+
+
+def check_grade_table_codegen():
+    """Regenerate the grade table if the web app's grade scale changed.
+
+    grade_table.h is checked in so native tests and builds without Node.js
+    have it; this only refreshes it.
+    """
+    if os.environ.get(_GRADE_TABLE_RAN_ENV_KEY) == "1":
+        return
+    os.environ[_GRADE_TABLE_RAN_ENV_KEY] = "1"
+
+    print("\n[Grade Table Codegen] Checking if grade table needs regeneration...")
+
+    if not all(p.exists() for p in GRADE_TABLE_SOURCES):
+        print("[Grade Table Codegen] Source files not found, skipping")
+        return
+
+    current_hash = get_grade_table_hash()
+    stored_hash = GRADE_TABLE_HASH_FILE.read_text().strip() if GRADE_TABLE_HASH_FILE.exists() else ""
+
+    if not GRADE_TABLE_OUTPUT.exists() or current_hash != stored_hash:
+        print("[Grade Table Codegen] Grade scale changed, regenerating...")
+        if run_grade_table_codegen():
+            GRADE_TABLE_HASH_FILE.write_text(current_hash)
+    else:
+        print("[Grade Table Codegen] Grade table is up-to-date")
+
+
+def run_web_ui_codegen():
+    """Run the web UI code generator."""
+    print("=" * 60)
+    print("Web UI Codegen: Compressing the configuration page...")
+    print("=" * 60)
+
+    try:
+        result = subprocess.run(
+            ["node", str(WEB_UI_CODEGEN_SCRIPT)],
+            cwd=str(PROJECT_ROOT),
+            capture_output=True,
+            text=True,
+            timeout=60,
+        )
+
+        if result.returncode != 0:
+            print(f"Error running web UI codegen:\n{result.stderr}")
+            print("Warning: Web UI codegen failed, using existing page")
+            return False
+
+        print(result.stdout)
+        return True
+
+    except FileNotFoundError:
+        print("Warning: Node.js not found. Skipping web UI codegen.")
+        return False
+    except subprocess.TimeoutExpired:
+        print("Warning: Web UI codegen timed out")
+        return False
+    except Exception as e:
+        print(f"Warning: Web UI codegen error: {e}")
+        return False
+
+
+def get_web_ui_hash() -> str:
+    """Get combined hash of the source page and the generator."""
+    hasher = hashlib.sha256()
+    for filepath in [WEB_UI_SOURCE, WEB_UI_CODEGEN_SCRIPT]:
+        if filepath.exists():
+            with open(filepath, "rb") as f:
+                hasher.update(f.read())
+    return hasher.hexdigest()
+
+
+def check_web_ui_codegen():
+    """Regenerate web_ui.h if the configuration page changed.
+
+    web_ui.h is checked in so native tests and builds without Node.js have
+    it; this only refreshes it.
+    """
+    if os.environ.get(_WEB_UI_RAN_ENV_KEY) == "1":
+        return
+    os.environ[_WEB_UI_RAN_ENV_KEY] = "1"
+
+    print("\n[Web UI Codegen] Checking if the web UI needs regeneration...")
+
+    if not WEB_UI_SOURCE.exists():
+        print("[Web UI Codegen] Source page not found, skipping")
+        return
+
+    current_hash = get_web_ui_hash()
+    stored_hash = WEB_UI_HASH_FILE.read_text().strip() if WEB_UI_HASH_FILE.exists() else ""
+
+    if not WEB_UI_OUTPUT.exists() or current_hash != stored_hash:
+        print("[Web UI Codegen] Page changed, regenerating...")
+        if run_web_ui_codegen():
+            WEB_UI_HASH_FILE.write_text(current_hash)
+    else:
+        print("[Web UI Codegen] Web UI is up-to-date")
+
+
 def before_build(source, target, env):
     """Pre-build hook to check and regenerate types if needed."""
     if _has_codegen_run():
         return
     _mark_codegen_run()
 
+    # Independent of the schema checks below, which can return early
+    check_grade_table_codegen()
+    check_web_ui_codegen()
+
     print("\n[GraphQL Codegen] Checking if types need regeneration...")
 
     # Check if schema exists
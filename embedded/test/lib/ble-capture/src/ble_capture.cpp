@@ -0,0 +1 @@
+../../../../libs/ble-capture/src/ble_capture.cpp
\ No newline at end of file
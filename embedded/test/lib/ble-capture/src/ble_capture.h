@@ -0,0 +1 @@
+../../../../libs/ble-capture/src/ble_capture.h
\ No newline at end of file
@@ -0,0 +1 @@
+../../../../libs/ble-proxy/src/ble_board_cache.cpp
\ No newline at end of file
@@ -0,0 +1 @@
+../../../../libs/ble-proxy/src/ble_board_fanout.cpp
\ No newline at end of file
@@ -0,0 +1 @@
+../../../../libs/ble-proxy/src/ble_board_fanout.h
\ No newline at end of file
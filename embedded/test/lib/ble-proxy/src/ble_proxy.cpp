@@ -0,0 +1 @@
+../../../../libs/ble-proxy/src/ble_proxy.cpp
\ No newline at end of file
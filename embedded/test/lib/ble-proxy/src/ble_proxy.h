@@ -0,0 +1 @@
+../../../../libs/ble-proxy/src/ble_proxy.h
\ No newline at end of file
@@ -0,0 +1 @@
+../../../../libs/ble-proxy/src/ble_scanner.cpp
\ No newline at end of file
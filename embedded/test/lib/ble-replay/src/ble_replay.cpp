@@ -0,0 +1,181 @@
+#include "ble_replay.h"
+
+#include <chrono>
+#include <cstdio>
+#include <thread>
+
+// =============================================================================
+// ReplayReport
+// =============================================================================
+
+double ReplayReport::bytesPerSecond() const {
+    if (cpuSeconds <= 0) {
+        return 0;
+    }
+    return (double)(appToBoardBytes + boardToAppBytes) / cpuSeconds;
+}
+
+uint64_t ReplayReport::meanFrameLatencyUs() const {
+    return updates > 0 ? totalFrameLatencyUs / updates : 0;
+}
+
+// =============================================================================
+// CaptureBuilder
+// =============================================================================
+
+CaptureBuilder::CaptureBuilder() : clockUs(0) {
+    capture.resize(BLE_CAPTURE_HEADER_SIZE);
+    BLECaptureEncoder::writeHeader(capture.data());
+    encoder.reset(0);
+}
+
+void CaptureBuilder::add(uint32_t gapUs, BLECaptureDirection direction, const uint8_t* data, size_t len) {
+    clockUs += gapUs;
+    size_t offset = capture.size();
+    capture.resize(offset + BLECaptureEncoder::maxRecordSize(len));
+    size_t written = encoder.encodeRecord(capture.data() + offset, capture.size() - offset, clockUs, direction, data, len);
+    capture.resize(offset + written);
+}
+
+void CaptureBuilder::addLedUpdate(const std::vector<LedCommand>& commands, uint32_t gapUs, size_t chunkSize,
+                                  uint32_t chunkGapUs) {
+    std::vector<std::vector<uint8_t>> packets;
+    AuroraProtocol::encodeLedCommands(commands.data(), commands.size(), packets);
+
+    std::vector<uint8_t> stream;
+    for (const auto& packet : packets) {
+        stream.insert(stream.end(), packet.begin(), packet.end());
+    }
+
+    uint32_t gap = gapUs;
+    for (size_t offset = 0; offset < stream.size(); offset += chunkSize) {
+        size_t len = std::min(chunkSize, stream.size() - offset);
+        add(gap, BLECaptureDirection::APP_TO_BOARD, stream.data() + offset, len);
+        gap = chunkGapUs;
+    }
+}
+
+const std::vector<uint8_t>& CaptureBuilder::bytes() const {
+    return capture;
+}
+
+// =============================================================================
+// CaptureReplayer
+// =============================================================================
+
+CaptureReplayer::CaptureReplayer(const std::vector<uint8_t>& data)
+    : capture(data), tick(nullptr), tickIntervalMs(0), realTime(false) {}
+
+void CaptureReplayer::setTickHandler(TickHandler handler, unsigned long intervalMs) {
+    tick = handler;
+    tickIntervalMs = intervalMs;
+}
+
+void CaptureReplayer::setRealTime(bool enabled) {
+    realTime = enabled;
+}
+
+bool CaptureReplayer::run(RecordHandler handler, ReplayReport& report, unsigned long startMs) {
+    typedef std::chrono::steady_clock Clock;
+
+    report = ReplayReport();
+    BLECaptureReader reader(capture.data(), capture.size());
+    if (!reader.isValid()) {
+        return false;
+    }
+
+    mockSetMillis(startMs);
+    unsigned long lastTickMs = startMs;
+    uint64_t previousUs = 0;
+    bool updateStarted = false;
+    uint64_t updateStartUs = 0;
+    double cpuNs = 0;
+
+    BLECaptureRecord record;
+    while (reader.next(record)) {
+        unsigned long recordMs = startMs + (unsigned long)(record.timestampUs / 1000);
+
+        // Let time-driven code run through the gap as it would have on device
+        if (tick && tickIntervalMs > 0) {
+            while (recordMs - lastTickMs >= tickIntervalMs) {
+                lastTickMs += tickIntervalMs;
+                mockSetMillis(lastTickMs);
+                tick();
+            }
+        }
+        if (realTime && record.timestampUs > previousUs) {
+            std::this_thread::sleep_for(std::chrono::microseconds(record.timestampUs - previousUs));
+        }
+        previousUs = record.timestampUs;
+        mockSetMillis(recordMs);
+
+        if (record.direction == BLECaptureDirection::APP_TO_BOARD) {
+            report.appToBoardRecords++;
+            report.appToBoardBytes += record.length;
+            if (!updateStarted) {
+                updateStarted = true;
+                updateStartUs = record.timestampUs;
+            }
+        } else {
+            report.boardToAppRecords++;
+            report.boardToAppBytes += record.length;
+        }
+        report.records++;
+
+        Clock::time_point begin = Clock::now();
+        bool completed = handler(record);
+        uint64_t elapsedNs = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - begin).count();
+        cpuNs += elapsedNs;
+        if (elapsedNs > report.maxRecordCpuNs) {
+            report.maxRecordCpuNs = elapsedNs;
+        }
+
+        if (completed) {
+            uint64_t latency = updateStarted ? record.timestampUs - updateStartUs : 0;
+            report.updates++;
+            report.totalFrameLatencyUs += latency;
+            if (latency > report.maxFrameLatencyUs) {
+                report.maxFrameLatencyUs = latency;
+            }
+            updateStarted = false;
+        }
+    }
+
+    report.captureDurationUs = previousUs;
+    report.truncated = reader.isTruncated();
+    report.cpuSeconds = cpuNs / 1e9;
+    return true;
+}
+
+// =============================================================================
+// Helpers
+// =============================================================================
+
+bool loadCaptureFile(const char* path, std::vector<uint8_t>& out) {
+    FILE* file = fopen(path, "rb");
+    if (!file) {
+        return false;
+    }
+    out.clear();
+    uint8_t chunk[4096];
+    size_t n;
+    while ((n = fread(chunk, 1, sizeof(chunk), file)) > 0) {
+        out.insert(out.end(), chunk, chunk + n);
+    }
+    fclose(file);
+    return true;
+}
+
+void printReplayReport(const char* label, const ReplayReport& report) {
+    printf("\n--- Replay: %s ---\n", label);
+    printf("  records:        %u (%u app->board, %u board->app)%s\n", report.records, report.appToBoardRecords,
+           report.boardToAppRecords, report.truncated ? ", truncated" : "");
+    printf("  bytes:          %llu app->board, %llu board->app\n", (unsigned long long)report.appToBoardBytes,
+           (unsigned long long)report.boardToAppBytes);
+    printf("  capture span:   %.3f s\n", report.captureDurationUs / 1e6);
+    printf("  LED updates:    %u\n", report.updates);
+    printf("  frame latency:  mean %llu us, max %llu us\n", (unsigned long long)report.meanFrameLatencyUs(),
+           (unsigned long long)report.maxFrameLatencyUs);
+    printf("  decode:         %.3f ms CPU, %.2f MB/s, worst record %llu ns\n", report.cpuSeconds * 1e3,
+           report.bytesPerSecond() / 1e6, (unsigned long long)report.maxRecordCpuNs);
+}
@@ -0,0 +1,118 @@
+#ifndef BLE_REPLAY_H
+#define BLE_REPLAY_H
+
+/**
+ * Native replay harness for BLE captures.
+ *
+ * Replays a capture (recorded on device with ENABLE_BLE_CAPTURE, or built
+ * synthetically with CaptureBuilder) through a handler that feeds the real
+ * protocol, BLE server or proxy code. The mock millis()/micros() clock
+ * follows the recorded timestamps, so time-based logic sees the original
+ * inter-arrival gaps; set realTime to also sleep between records.
+ */
+
+#include <Arduino.h>
+#include <aurora_protocol.h>
+#include <ble_capture_format.h>
+
+#include <functional>
+#include <vector>
+
+/**
+ * Replay results. Latencies are in capture time, CPU figures in host time.
+ */
+struct ReplayReport {
+    uint32_t records;
+    uint32_t appToBoardRecords;
+    uint32_t boardToAppRecords;
+    uint64_t appToBoardBytes;
+    uint64_t boardToAppBytes;
+    uint64_t captureDurationUs;
+    bool truncated;
+
+    // LED updates completed, and the time from the first byte of each
+    // update to the record that completed it
+    uint32_t updates;
+    uint64_t totalFrameLatencyUs;
+    uint64_t maxFrameLatencyUs;
+
+    double cpuSeconds;
+    uint64_t maxRecordCpuNs;
+
+    double bytesPerSecond() const;
+    uint64_t meanFrameLatencyUs() const;
+};
+
+/**
+ * Builds capture files in memory.
+ */
+class CaptureBuilder {
+  public:
+    CaptureBuilder();
+
+    /**
+     * Append one record after the given gap.
+     */
+    void add(uint32_t gapUs, BLECaptureDirection direction, const uint8_t* data, size_t len);
+
+    /**
+     * Append an LED update the way the app sends it: encoded packets split
+     * into writes of chunkSize bytes, chunkGapUs apart.
+     */
+    void addLedUpdate(const std::vector<LedCommand>& commands, uint32_t gapUs, size_t chunkSize = 20,
+                      uint32_t chunkGapUs = 7500);
+
+    const std::vector<uint8_t>& bytes() const;
+
+  private:
+    std::vector<uint8_t> capture;
+    BLECaptureEncoder encoder;
+    uint32_t clockUs;
+};
+
+/**
+ * Drives a capture through a handler with recorded timing.
+ */
+class CaptureReplayer {
+  public:
+    // Return true when the record completed an LED update
+    typedef std::function<bool(const BLECaptureRecord&)> RecordHandler;
+    typedef std::function<void()> TickHandler;
+
+    explicit CaptureReplayer(const std::vector<uint8_t>& capture);
+
+    /**
+     * Call tick (e.g. a loop() function) every intervalMs of capture time
+     * between records.
+     */
+    void setTickHandler(TickHandler tick, unsigned long intervalMs);
+
+    /**
+     * Sleep for the recorded gaps as well as moving the mock clock.
+     */
+    void setRealTime(bool enabled);
+
+    /**
+     * Replay every record, starting the mock clock at startMs.
+     * @return false if the capture is not valid
+     */
+    bool run(RecordHandler handler, ReplayReport& report, unsigned long startMs = 0);
+
+  private:
+    const std::vector<uint8_t>& capture;
+    TickHandler tick;
+    unsigned long tickIntervalMs;
+    bool realTime;
+};
+
+/**
+ * Load a capture file downloaded from the device.
+ */
+bool loadCaptureFile(const char* path, std::vector<uint8_t>& out);
+
+/**
+ * Print a report as one benchmark block.
+ */
+void printReplayReport(const char* label, const ReplayReport& report);
+
+#endif
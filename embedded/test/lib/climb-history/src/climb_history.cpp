@@ -1,20 +1,20 @@
 #include "climb_history.h"
 
-#include <ArduinoJson.h>
-
 #include <config_manager.h>
 
+#include <stddef.h>
+
 ClimbHistory ClimbHistoryMgr;
 
 const char* ClimbHistory::NVS_KEY_HISTORY = "climb_hist";
 
-ClimbHistory::ClimbHistory() : hasCurrentClimb_(false) {
-    // Initialize all entries as invalid
-    for (int i = 0; i < MAX_CLIMB_HISTORY; i++) {
-        history[i] = ClimbEntry();
-    }
+static void copyField(char* dest, const char* src, size_t len) {
+    strncpy(dest, src, len - 1);
+    dest[len - 1] = '\0';
 }
 
+ClimbHistory::ClimbHistory() : head(0), count(0), hasCurrentClimb_(false), newestSeq(0) {}
+
 void ClimbHistory::begin() {
     load();
 }
@@ -24,36 +24,36 @@ void ClimbHistory::addClimb(const char* name, const char* grade, const char* uui
         return;
 
     // Check if this is the same as the current climb (update)
-    if (hasCurrentClimb_ && history[0].valid && strcmp(history[0].uuid, uuid) == 0) {
-        // Same climb - just update name/grade in case they changed
-        strncpy(history[0].name, name, MAX_CLIMB_NAME_LEN - 1);
-        history[0].name[MAX_CLIMB_NAME_LEN - 1] = '\0';
-        if (grade) {
-            strncpy(history[0].grade, grade, MAX_CLIMB_GRADE_LEN - 1);
-            history[0].grade[MAX_CLIMB_GRADE_LEN - 1] = '\0';
+    if (hasCurrentClimb()) {
+        ClimbEntry& current = history[head];
+        if (strcmp(current.uuid, uuid) == 0) {
+            // Same climb - update name/grade in case they changed, and only
+            // touch flash if they did
+            ClimbEntry updated = current;
+            copyField(updated.name, name, MAX_CLIMB_NAME_LEN);
+            if (grade) {
+                copyField(updated.grade, grade, MAX_CLIMB_GRADE_LEN);
+            }
+            if (strcmp(updated.name, current.name) == 0 && strcmp(updated.grade, current.grade) == 0) {
+                return;
+            }
+            current = updated;
+            save();
+            return;
         }
-        save();
-        return;
     }
 
-    // Shift existing entries down
-    shiftDown();
-
-    // Add new climb at position 0
-    strncpy(history[0].name, name, MAX_CLIMB_NAME_LEN - 1);
-    history[0].name[MAX_CLIMB_NAME_LEN - 1] = '\0';
+    // New climb replaces the oldest entry
+    push();
+    newestSeq++;
 
+    ClimbEntry& entry = history[head];
+    copyField(entry.name, name, MAX_CLIMB_NAME_LEN);
     if (grade) {
-        strncpy(history[0].grade, grade, MAX_CLIMB_GRADE_LEN - 1);
-        history[0].grade[MAX_CLIMB_GRADE_LEN - 1] = '\0';
-    } else {
-        history[0].grade[0] = '\0';
+        copyField(entry.grade, grade, MAX_CLIMB_GRADE_LEN);
     }
-
-    strncpy(history[0].uuid, uuid, MAX_CLIMB_UUID_LEN - 1);
-    history[0].uuid[MAX_CLIMB_UUID_LEN - 1] = '\0';
-
-    history[0].valid = true;
+    copyField(entry.uuid, uuid, MAX_CLIMB_UUID_LEN);
+    entry.valid = true;
     hasCurrentClimb_ = true;
 
     save();
@@ -66,115 +66,155 @@ void ClimbHistory::clearCurrent() {
 }
 
 const ClimbEntry* ClimbHistory::getCurrentClimb() const {
-    if (!hasCurrentClimb_ || !history[0].valid) {
+    if (!hasCurrentClimb()) {
         return nullptr;
     }
-    return &history[0];
+    return &history[head];
 }
 
 const ClimbEntry* ClimbHistory::getClimb(int index) const {
-    if (index < 0 || index >= MAX_CLIMB_HISTORY) {
-        return nullptr;
-    }
-    if (!history[index].valid) {
+    if (index < 0 || index >= count) {
         return nullptr;
     }
-    return &history[index];
+    return &history[(head - index + MAX_CLIMB_HISTORY) % MAX_CLIMB_HISTORY];
 }
 
 int ClimbHistory::getCount() const {
-    int count = 0;
-    for (int i = 0; i < MAX_CLIMB_HISTORY; i++) {
-        if (history[i].valid) {
-            count++;
-        }
-    }
     return count;
 }
 
 bool ClimbHistory::hasCurrentClimb() const {
-    return hasCurrentClimb_ && history[0].valid;
+    return hasCurrentClimb_ && count > 0;
 }
 
-void ClimbHistory::shiftDown() {
-    // Move each entry to the next position, oldest is discarded
-    for (int i = MAX_CLIMB_HISTORY - 1; i > 0; i--) {
-        history[i] = history[i - 1];
+void ClimbHistory::push() {
+    head = (head + 1) % MAX_CLIMB_HISTORY;
+    if (count < MAX_CLIMB_HISTORY) {
+        count++;
     }
-    // Position 0 is now ready for new entry
-    history[0] = ClimbEntry();
+    // Position head is now ready for the new entry
+    history[head] = ClimbEntry();
 }
 
-void ClimbHistory::save() {
-    // Serialize history to JSON
-    JsonDocument doc;
-    JsonArray arr = doc.to<JsonArray>();
-
-    for (int i = 0; i < MAX_CLIMB_HISTORY; i++) {
-        if (history[i].valid) {
-            JsonObject obj = arr.add<JsonObject>();
-            obj["n"] = history[i].name;
-            obj["g"] = history[i].grade;
-            obj["u"] = history[i].uuid;
-        }
-    }
-
-    String json;
-    serializeJson(doc, json);
+// =============================================================================
+// Persistence
+// =============================================================================
 
-    // Store in NVS
-    Config.setString(NVS_KEY_HISTORY, json.c_str());
+void ClimbHistory::slotKey(uint32_t seq, char* key, size_t len) {
+    snprintf(key, len, "ch_%u", (unsigned)(seq % MAX_CLIMB_HISTORY));
 }
 
-void ClimbHistory::load() {
-    String json = Config.getString(NVS_KEY_HISTORY);
-    if (json.length() == 0) {
-        return;
+uint32_t ClimbHistory::crc32(const uint8_t* data, size_t len) {
+    uint32_t crc = 0xFFFFFFFF;
+    for (size_t i = 0; i < len; i++) {
+        crc ^= data[i];
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+        }
     }
+    return ~crc;
+}
 
-    JsonDocument doc;
-    DeserializationError error = deserializeJson(doc, json);
-    if (error) {
+void ClimbHistory::save() {
+    if (count == 0) {
         return;
     }
 
-    JsonArray arr = doc.as<JsonArray>();
-    int index = 0;
-
-    for (JsonObject obj : arr) {
-        if (index >= MAX_CLIMB_HISTORY)
-            break;
-
-        const char* name = obj["n"];
-        const char* grade = obj["g"];
-        const char* uuid = obj["u"];
+    const ClimbEntry& entry = history[head];
+    Record record;
+    memset(&record, 0, sizeof(record));
+    record.version = CLIMB_RECORD_VERSION;
+    record.seq = newestSeq;
+    copyField(record.name, entry.name, MAX_CLIMB_NAME_LEN);
+    copyField(record.grade, entry.grade, MAX_CLIMB_GRADE_LEN);
+    copyField(record.uuid, entry.uuid, MAX_CLIMB_UUID_LEN);
+    record.crc = crc32((const uint8_t*)&record, offsetof(Record, crc));
+
+    char key[8];
+    slotKey(newestSeq, key, sizeof(key));
+    Config.setBytes(key, (const uint8_t*)&record, sizeof(record));
+}
 
-        if (name && uuid) {
-            strncpy(history[index].name, name, MAX_CLIMB_NAME_LEN - 1);
-            history[index].name[MAX_CLIMB_NAME_LEN - 1] = '\0';
+void ClimbHistory::load() {
+    // The JSON history this replaced is not migrated
+    if (Config.hasKey(NVS_KEY_HISTORY)) {
+        Config.remove(NVS_KEY_HISTORY);
+    }
 
-            if (grade) {
-                strncpy(history[index].grade, grade, MAX_CLIMB_GRADE_LEN - 1);
-                history[index].grade[MAX_CLIMB_GRADE_LEN - 1] = '\0';
-            }
+    // Read every slot into the ring position of the same index
+    uint32_t seqs[MAX_CLIMB_HISTORY];
+    uint32_t maxSeq = 0;
+    for (int slot = 0; slot < MAX_CLIMB_HISTORY; slot++) {
+        seqs[slot] = 0;
+        history[slot] = ClimbEntry();
+
+        char key[8];
+        slotKey(slot, key, sizeof(key));
+        if (!Config.hasKey(key)) {
+            continue;
+        }
+        Record record;
+        size_t len = Config.getBytes(key, (uint8_t*)&record, sizeof(record));
+        if (len != sizeof(record) || record.version != CLIMB_RECORD_VERSION || record.seq == 0 ||
+            record.seq % MAX_CLIMB_HISTORY != (uint32_t)slot ||
+            record.crc != crc32((const uint8_t*)&record, offsetof(Record, crc))) {
+            continue;
+        }
 
-            strncpy(history[index].uuid, uuid, MAX_CLIMB_UUID_LEN - 1);
-            history[index].uuid[MAX_CLIMB_UUID_LEN - 1] = '\0';
+        ClimbEntry& entry = history[slot];
+        copyField(entry.name, record.name, MAX_CLIMB_NAME_LEN);
+        copyField(entry.grade, record.grade, MAX_CLIMB_GRADE_LEN);
+        copyField(entry.uuid, record.uuid, MAX_CLIMB_UUID_LEN);
+        entry.valid = true;
+        seqs[slot] = record.seq;
+        if (record.seq > maxSeq) {
+            maxSeq = record.seq;
+        }
+    }
 
-            history[index].valid = true;
-            index++;
+    // Walk the newest MAX_CLIMB_HISTORY sequence numbers oldest first and
+    // close any gaps left by missing, corrupt or stale records
+    count = 0;
+    int write = (int)((maxSeq + 1) % MAX_CLIMB_HISTORY);
+    int start = write;
+    for (int i = 0; i < MAX_CLIMB_HISTORY; i++) {
+        int slot = (start + i) % MAX_CLIMB_HISTORY;
+        uint32_t seq = maxSeq - (MAX_CLIMB_HISTORY - 1) + i;
+        if (seqs[slot] == 0 || seqs[slot] != seq) {
+            history[slot] = ClimbEntry();
+            continue;
         }
+        if (slot != write) {
+            history[write] = history[slot];
+            history[slot] = ClimbEntry();
+        }
+        write = (write + 1) % MAX_CLIMB_HISTORY;
+        count++;
     }
+    head = (write - 1 + MAX_CLIMB_HISTORY) % MAX_CLIMB_HISTORY;
+    newestSeq = maxSeq;
 
     // Note: We don't set hasCurrentClimb_ = true here because loaded history
     // represents past climbs, not an active current climb. The current climb
     // is only set when a new climb is explicitly added via addClimb().
+    hasCurrentClimb_ = false;
 }
 
 void ClimbHistory::clear() {
     for (int i = 0; i < MAX_CLIMB_HISTORY; i++) {
         history[i] = ClimbEntry();
+
+        char key[8];
+        slotKey(i, key, sizeof(key));
+        if (Config.hasKey(key)) {
+            Config.remove(key);
+        }
     }
+    head = 0;
+    count = 0;
+    newestSeq = 0;
     hasCurrentClimb_ = false;
-    Config.remove(NVS_KEY_HISTORY);
+    if (Config.hasKey(NVS_KEY_HISTORY)) {
+        Config.remove(NVS_KEY_HISTORY);
+    }
 }
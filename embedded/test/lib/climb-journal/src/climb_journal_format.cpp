@@ -0,0 +1 @@
+../../../../libs/climb-journal/src/climb_journal_format.cpp
\ No newline at end of file
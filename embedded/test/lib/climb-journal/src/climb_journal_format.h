@@ -0,0 +1 @@
+../../../../libs/climb-journal/src/climb_journal_format.h
\ No newline at end of file
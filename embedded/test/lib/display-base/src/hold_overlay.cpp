@@ -0,0 +1 @@
+../../../../libs/display-base/src/hold_overlay.cpp
\ No newline at end of file
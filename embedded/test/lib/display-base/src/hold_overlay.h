@@ -0,0 +1 @@
+../../../../libs/display-base/src/hold_overlay.h
\ No newline at end of file
@@ -0,0 +1 @@
+../../../../libs/display-base/src/kinetic_scroll.cpp
\ No newline at end of file
@@ -0,0 +1 @@
+../../../../libs/display-base/src/kinetic_scroll.h
\ No newline at end of file
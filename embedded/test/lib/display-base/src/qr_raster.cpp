@@ -0,0 +1 @@
+../../../../libs/display-base/src/qr_raster.cpp
\ No newline at end of file
@@ -0,0 +1 @@
+../../../../libs/display-base/src/qr_raster.h
\ No newline at end of file
@@ -0,0 +1 @@
+../../../../libs/display-base/src/render_queue.cpp
\ No newline at end of file
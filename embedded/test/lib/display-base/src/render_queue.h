@@ -0,0 +1 @@
+../../../../libs/display-base/src/render_queue.h
\ No newline at end of file
@@ -0,0 +1 @@
+../../../../libs/display-base/src/rgb565_tiles.cpp
\ No newline at end of file
@@ -0,0 +1 @@
+../../../../libs/display-base/src/rgb565_tiles.h
\ No newline at end of file
@@ -0,0 +1 @@
+../../../../libs/display-base/src/text_cache.cpp
\ No newline at end of file
@@ -0,0 +1 @@
+../../../../libs/display-base/src/text_cache.h
\ No newline at end of file
@@ -0,0 +1 @@
+../../../../libs/display-base/src/widget_renderer.cpp
\ No newline at end of file
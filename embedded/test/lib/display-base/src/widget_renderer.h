@@ -0,0 +1 @@
+../../../../libs/display-base/src/widget_renderer.h
\ No newline at end of file
@@ -0,0 +1 @@
+../../../../libs/esp-web-server/src/web_ui.h
\ No newline at end of file
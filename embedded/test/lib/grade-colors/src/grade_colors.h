@@ -0,0 +1 @@
+../../../../libs/display-base/src/grade_colors.h
\ No newline at end of file
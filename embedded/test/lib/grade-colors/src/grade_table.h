@@ -0,0 +1 @@
+../../../../libs/display-base/src/grade_table.h
\ No newline at end of file
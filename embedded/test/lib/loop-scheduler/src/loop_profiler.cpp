@@ -0,0 +1 @@
+../../../../libs/loop-scheduler/src/loop_profiler.cpp
\ No newline at end of file
@@ -0,0 +1 @@
+../../../../libs/loop-scheduler/src/loop_profiler.h
\ No newline at end of file
@@ -0,0 +1 @@
+../../../../libs/loop-scheduler/src/loop_scheduler.cpp
\ No newline at end of file
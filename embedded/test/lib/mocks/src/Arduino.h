@@ -9,6 +9,7 @@
 #define ARDUINO_MOCK_H
 
 #include <algorithm>
+#include <cctype>
 #include <cstdarg>
 #include <cstddef>
 #include <cstdint>
@@ -53,11 +54,19 @@ inline typename std::common_type<T, U>::type max(T a, U b) {
 #define HIGH 1
 
 // Time functions (mock implementations)
+// Time stands still unless a test moves it with mockSetMillis()/mockAdvanceMillis()
+inline unsigned long mockMillisValue = 0;
 inline unsigned long millis() {
-    return 0;
+    return mockMillisValue;
 }
 inline unsigned long micros() {
-    return 0;
+    return mockMillisValue * 1000UL;
+}
+inline void mockSetMillis(unsigned long ms) {
+    mockMillisValue = ms;
+}
+inline void mockAdvanceMillis(unsigned long ms) {
+    mockMillisValue += ms;
 }
 inline void delay(unsigned long ms) {
     (void)ms;
@@ -168,11 +177,36 @@ class String {
         return pos == std::string::npos ? -1 : (int)pos;
     }
 
+    int indexOf(char c, unsigned int fromIndex) const {
+        size_t pos = data_.find(c, fromIndex);
+        return pos == std::string::npos ? -1 : (int)pos;
+    }
+
     int indexOf(const String& str) const {
         size_t pos = data_.find(str.data_);
         return pos == std::string::npos ? -1 : (int)pos;
     }
 
+    bool equalsIgnoreCase(const String& other) const {
+        if (data_.length() != other.data_.length())
+            return false;
+        for (size_t i = 0; i < data_.length(); i++) {
+            if (tolower((unsigned char)data_[i]) != tolower((unsigned char)other.data_[i]))
+                return false;
+        }
+        return true;
+    }
+
+    void trim() {
+        size_t begin = data_.find_first_not_of(" \t\r\n");
+        if (begin == std::string::npos) {
+            data_.clear();
+            return;
+        }
+        size_t end = data_.find_last_not_of(" \t\r\n");
+        data_ = data_.substr(begin, end - begin + 1);
+    }
+
     String substring(unsigned int beginIndex) const {
         if (beginIndex >= data_.length())
             return String();
@@ -47,6 +47,25 @@ struct ble_gap_conn_desc {
     uint8_t key_size;
 };
 
+// GAP events (only what the client's custom handler looks at)
+#define BLE_GAP_EVENT_CONN_UPDATE 3
+
+struct ble_gap_event {
+    uint8_t type;
+    struct {
+        int status;
+        uint16_t conn_handle;
+    } conn_update;
+};
+
+typedef int (*gap_event_handler)(ble_gap_event* event, void* arg);
+
+// Handler installed with NimBLEDevice::setCustomGapHandler
+inline gap_event_handler& mockCustomGapHandler() {
+    static gap_event_handler handler = nullptr;
+    return handler;
+}
+
 // Forward declarations
 class NimBLEServer;
 class NimBLEService;
@@ -380,7 +399,7 @@ class NimBLEClientCallbacks {
 // NimBLEClient - represents a connection to a remote BLE server
 class NimBLEClient {
   public:
-    NimBLEClient() : callbacks_(nullptr), connected_(false) {}
+    NimBLEClient() : callbacks_(nullptr), connected_(false), connId_(nextConnId()++) {}
 
     void setClientCallbacks(NimBLEClientCallbacks* callbacks) { callbacks_ = callbacks; }
 
@@ -393,6 +412,17 @@ class NimBLEClient {
 
     void setConnectTimeout(uint8_t timeout) { connectTimeout_ = timeout; }
 
+    bool updateConnParams(uint16_t minInterval, uint16_t maxInterval, uint16_t latency, uint16_t timeout) {
+        if (!connected_)
+            return false;
+        minInterval_ = minInterval;
+        maxInterval_ = maxInterval;
+        latency_ = latency;
+        timeout_ = timeout;
+        updateConnParamsCount_++;
+        return true;
+    }
+
     bool connect(const NimBLEAddress& address, bool deleteAttributes = true) {
         (void)deleteAttributes;
         connectAttempts_++;
@@ -414,6 +444,8 @@ class NimBLEClient {
 
     bool isConnected() const { return connected_; }
 
+    uint16_t getConnId() const { return connected_ ? connId_ : BLE_HS_CONN_HANDLE_NONE; }
+
     NimBLERemoteService* getService(const char* uuid) {
         for (auto* s : services_) {
             if (s->getUUID() == uuid)
@@ -432,8 +464,23 @@ class NimBLEClient {
         if (callbacks_)
             callbacks_->onDisconnect(this);
     }
+    // Deliver the controller's connection-update completion for this link
+    void mockCompleteConnParamsUpdate(bool success = true) {
+        ble_gap_event event = {};
+        event.type = BLE_GAP_EVENT_CONN_UPDATE;
+        event.conn_update.status = success ? 0 : 1;
+        event.conn_update.conn_handle = connId_;
+        if (mockCustomGapHandler())
+            mockCustomGapHandler()(&event, nullptr);
+    }
     int getConnectAttempts() const { return connectAttempts_; }
     NimBLEClientCallbacks* getCallbacks() const { return callbacks_; }
+    uint16_t getMinInterval() const { return minInterval_; }
+    uint16_t getMaxInterval() const { return maxInterval_; }
+    uint16_t getLatency() const { return latency_; }
+    uint16_t getSupervisionTimeout() const { return timeout_; }
+    uint8_t getConnectTimeout() const { return connectTimeout_; }
+    int getUpdateConnParamsCount() const { return updateConnParamsCount_; }
 
     ~NimBLEClient() {
         for (auto* s : services_)
@@ -441,8 +488,14 @@ class NimBLEClient {
     }
 
   private:
+    static uint16_t& nextConnId() {
+        static uint16_t id = 1;
+        return id;
+    }
+
     NimBLEClientCallbacks* callbacks_;
     bool connected_;
+    uint16_t connId_;
     bool mockConnectSuccess_ = true;
     int connectAttempts_ = 0;
     uint16_t minInterval_ = 0;
@@ -450,9 +503,103 @@ class NimBLEClient {
     uint16_t latency_ = 0;
     uint16_t timeout_ = 0;
     uint8_t connectTimeout_ = 0;
+    int updateConnParamsCount_ = 0;
     std::vector<NimBLERemoteService*> services_;
 };
 
+// =============================================================================
+// Scan classes (for the board scanner)
+// =============================================================================
+
+class NimBLEScanResults {};
+
+// NimBLEAdvertisedDevice - an advertisement seen while scanning
+class NimBLEAdvertisedDevice {
+  public:
+    NimBLEAdvertisedDevice(const NimBLEAddress& address, const std::string& name, int rssi,
+                           const char* serviceUuid = nullptr)
+        : address_(address), name_(name), rssi_(rssi), serviceUuid_(serviceUuid ? serviceUuid : "") {}
+
+    bool isAdvertisingService(const NimBLEUUID& uuid) const { return uuid.toString() == serviceUuid_; }
+    NimBLEAddress getAddress() const { return address_; }
+    std::string getName() const { return name_; }
+    int getRSSI() const { return rssi_; }
+
+  private:
+    NimBLEAddress address_;
+    std::string name_;
+    int rssi_;
+    std::string serviceUuid_;
+};
+
+class NimBLEAdvertisedDeviceCallbacks {
+  public:
+    virtual ~NimBLEAdvertisedDeviceCallbacks() {}
+    virtual void onResult(NimBLEAdvertisedDevice* advertisedDevice) = 0;
+};
+
+// NimBLEScan - scan control; tests deliver adverts with mockAdvertise()
+class NimBLEScan {
+  public:
+    void setAdvertisedDeviceCallbacks(NimBLEAdvertisedDeviceCallbacks* callbacks, bool wantDuplicates = false) {
+        callbacks_ = callbacks;
+        wantDuplicates_ = wantDuplicates;
+    }
+    void setActiveScan(bool active) { active_ = active; }
+    void setInterval(uint16_t intervalMs) { interval_ = intervalMs; }
+    void setWindow(uint16_t windowMs) { window_ = windowMs; }
+    void setMaxResults(uint8_t maxResults) { (void)maxResults; }
+    void setDuplicateFilter(bool enabled) { duplicateFilter_ = enabled; }
+
+    bool start(uint32_t duration, void (*scanCompleteCB)(NimBLEScanResults), bool isContinue = false) {
+        (void)isContinue;
+        duration_ = duration;
+        completeCB_ = scanCompleteCB;
+        scanning_ = true;
+        startCount_++;
+        return true;
+    }
+
+    bool stop() {
+        scanning_ = false;
+        return true;
+    }
+
+    void clearResults() {}
+    bool isScanning() const { return scanning_; }
+
+    // Test helpers
+    void mockAdvertise(NimBLEAdvertisedDevice* device) {
+        if (scanning_ && callbacks_)
+            callbacks_->onResult(device);
+    }
+    void mockComplete() {
+        scanning_ = false;
+        if (completeCB_)
+            completeCB_(NimBLEScanResults());
+    }
+    bool getActiveScan() const { return active_; }
+    uint16_t getInterval() const { return interval_; }
+    uint16_t getWindow() const { return window_; }
+    uint32_t getDuration() const { return duration_; }
+    bool getDuplicateFilter() const { return duplicateFilter_; }
+    bool getWantDuplicates() const { return wantDuplicates_; }
+    int getStartCount() const { return startCount_; }
+    void mockReset() { *this = NimBLEScan(); }
+
+  private:
+    NimBLEAdvertisedDeviceCallbacks* callbacks_ = nullptr;
+    void (*completeCB_)(NimBLEScanResults) = nullptr;
+    bool wantDuplicates_ = false;
+    bool active_ = false;
+    bool duplicateFilter_ = false;
+    bool scanning_ = false;
+    uint16_t interval_ = 0;
+    uint16_t window_ = 0;
+    uint32_t duration_ = 0;
+    int startCount_ = 0;
+};
+
 // =============================================================================
 // NimBLEDevice static class
 // =============================================================================
@@ -483,19 +630,28 @@ class NimBLEDevice {
 
     static NimBLEAdvertising* getAdvertising() { return &advertising_; }
 
+    static NimBLEScan* getScan() { return &scan_; }
+
     static NimBLEClient* createClient() {
         NimBLEClient* client = new NimBLEClient();
         // Apply global mock settings to new clients
         client->mockSetConnectSuccess(mockNextConnectSuccess_);
+        if (mockClientSetup_)
+            mockClientSetup_(client);
         clients_.push_back(client);
         return client;
     }
 
     static bool getInitialized() { return initialized_; }
 
+    static void setCustomGapHandler(gap_event_handler handler) { mockCustomGapHandler() = handler; }
+
     // Set whether the next created client's connect() will succeed
     static void mockSetNextConnectSuccess(bool success) { mockNextConnectSuccess_ = success; }
 
+    // Run a setup hook on every client created (e.g. to add remote services)
+    static void mockSetClientSetup(std::function<void(NimBLEClient*)> setup) { mockClientSetup_ = setup; }
+
     // Test helpers
     static const std::string& getDeviceName() { return deviceName_; }
     static bool isInitialized() { return initialized_; }
@@ -507,12 +663,15 @@ class NimBLEDevice {
         deviceName_ = "";
         power_ = 0;
         mockNextConnectSuccess_ = true;
+        mockClientSetup_ = nullptr;
+        mockCustomGapHandler() = nullptr;
         delete server_;
         server_ = nullptr;
         for (auto* c : clients_)
             delete c;
         clients_.clear();
         advertising_.mockReset();
+        scan_.mockReset();
     }
 
   private:
@@ -520,8 +679,10 @@ class NimBLEDevice {
     static std::string deviceName_;
     static int power_;
     static bool mockNextConnectSuccess_;
+    static std::function<void(NimBLEClient*)> mockClientSetup_;
     static NimBLEServer* server_;
     static NimBLEAdvertising advertising_;
+    static NimBLEScan scan_;
     static std::vector<NimBLEClient*> clients_;
 };
 
@@ -530,8 +691,10 @@ inline bool NimBLEDevice::initialized_ = false;
 inline std::string NimBLEDevice::deviceName_ = "";
 inline int NimBLEDevice::power_ = 0;
 inline bool NimBLEDevice::mockNextConnectSuccess_ = true;
+inline std::function<void(NimBLEClient*)> NimBLEDevice::mockClientSetup_ = nullptr;
 inline NimBLEServer* NimBLEDevice::server_ = nullptr;
 inline NimBLEAdvertising NimBLEDevice::advertising_;
+inline NimBLEScan NimBLEDevice::scan_;
 inline std::vector<NimBLEClient*> NimBLEDevice::clients_;
 
 #endif  // NIMBLEDEVICE_MOCK_H
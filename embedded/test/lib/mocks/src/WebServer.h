@@ -95,6 +95,31 @@ class WebServer {
 
     void sendHeader(const char* name, const char* value) { lastHeaders_[name ? name : ""] = value ? value : ""; }
 
+    void setContentLength(size_t length) { contentLength_ = length; }
+
+    // Appends to the body of the last send()
+    void sendContent(const char* content, size_t length) {
+        lastResponseBody_.append(content, length);
+        if (!responses_.empty())
+            responses_.back().body = lastResponseBody_;
+        contentChunks_++;
+    }
+
+    void collectHeaders(const char* headerKeys[], size_t count) {
+        collectedHeaders_.clear();
+        for (size_t i = 0; i < count; i++)
+            collectedHeaders_.push_back(headerKeys[i]);
+    }
+
+    bool hasHeader(const char* name) const { return requestHeaders_.find(name ? name : "") != requestHeaders_.end(); }
+
+    String header(const char* name) const {
+        auto it = requestHeaders_.find(name ? name : "");
+        if (it != requestHeaders_.end())
+            return it->second.c_str();
+        return String();
+    }
+
     bool hasArg(const char* name) const { return args_.find(name ? name : "") != args_.end(); }
 
     String arg(const char* name) const {
@@ -209,13 +234,19 @@ class WebServer {
 
     void mockClearArgs() { args_.clear(); }
 
+    void mockSetRequestHeader(const char* name, const char* value) { requestHeaders_[name] = value; }
+
     void mockReset() {
         running_ = false;
         routes_.clear();
         uploadHandlers_.clear();
         args_.clear();
         lastHeaders_.clear();
+        requestHeaders_.clear();
+        collectedHeaders_.clear();
         responses_.clear();
+        contentLength_ = 0;
+        contentChunks_ = 0;
         lastResponseCode_ = 0;
         lastContentType_ = "";
         lastResponseBody_ = "";
@@ -232,6 +263,9 @@ class WebServer {
     const std::string& getLastResponseBody() const { return lastResponseBody_; }
     const std::map<std::string, std::string>& getLastHeaders() const { return lastHeaders_; }
     size_t getResponseCount() const { return responses_.size(); }
+    size_t getContentLength() const { return contentLength_; }
+    int getContentChunks() const { return contentChunks_; }
+    const std::vector<std::string>& getCollectedHeaders() const { return collectedHeaders_; }
 
     struct Response {
         int code;
@@ -248,7 +282,11 @@ class WebServer {
     THandlerFunction notFoundHandler_;
     std::map<std::string, std::string> args_;
     std::map<std::string, std::string> lastHeaders_;
+    std::map<std::string, std::string> requestHeaders_;
+    std::vector<std::string> collectedHeaders_;
     std::vector<Response> responses_;
+    size_t contentLength_ = 0;
+    int contentChunks_ = 0;
     int lastResponseCode_ = 0;
     std::string lastContentType_;
     std::string lastResponseBody_;
@@ -0,0 +1 @@
+../../../../libs/radio-coex/src/radio_coex.cpp
\ No newline at end of file
@@ -0,0 +1 @@
+../../../../libs/telemetry-uplink/src/telemetry_uplink.cpp
\ No newline at end of file
@@ -0,0 +1 @@
+../../../../libs/telemetry-uplink/src/telemetry_uplink.h
\ No newline at end of file
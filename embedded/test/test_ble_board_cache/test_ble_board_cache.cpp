@@ -0,0 +1,238 @@
+/**
+ * Unit Tests for BLE Board Cache
+ *
+ * Tests the deduplicated, RSSI-smoothed cache that the scanner fills from
+ * passive background scans. The proxy relies on it to reconnect to a board
+ * as soon as it advertises again, without a full discovery scan.
+ */
+
+#include <NimBLEDevice.h>
+#include <unity.h>
+
+#include <ble_board_cache.h>
+
+static const uint8_t ADDR_A[6] = {0x11, 0x22, 0x33, 0x44, 0x55, 0x66};
+static const uint8_t ADDR_B[6] = {0xAA, 0xBB, 0xCC, 0xDD, 0xEE, 0xFF};
+
+static NimBLEAddress addressFor(uint8_t lastByte) {
+    uint8_t addr[6] = {lastByte, 0x00, 0x00, 0x00, 0x00, 0x01};
+    return NimBLEAddress(addr);
+}
+
+void setUp(void) {}
+
+void tearDown(void) {}
+
+// =============================================================================
+// Insert / Dedup Tests
+// =============================================================================
+
+void test_empty_cache_has_no_boards(void) {
+    BoardCache cache;
+    TEST_ASSERT_EQUAL(0, cache.size());
+    TEST_ASSERT_NULL(cache.getBest(0));
+}
+
+void test_update_inserts_new_board(void) {
+    BoardCache cache;
+    const CachedBoard& board = cache.update(NimBLEAddress(ADDR_A), "Kilter Board", -60, 1000);
+
+    TEST_ASSERT_EQUAL(1, cache.size());
+    TEST_ASSERT_TRUE(board.valid);
+    TEST_ASSERT_EQUAL_STRING("Kilter Board", board.name.c_str());
+    TEST_ASSERT_EQUAL(-60, board.lastRssi);
+    TEST_ASSERT_EQUAL(1000, board.firstSeenMs);
+    TEST_ASSERT_EQUAL(1000, board.lastSeenMs);
+    TEST_ASSERT_EQUAL(1, board.seenCount);
+}
+
+void test_repeated_adverts_do_not_duplicate(void) {
+    BoardCache cache;
+    cache.update(NimBLEAddress(ADDR_A), "Kilter Board", -60, 1000);
+    cache.update(NimBLEAddress(ADDR_A), "Kilter Board", -62, 1100);
+    cache.update(NimBLEAddress(ADDR_A), "Kilter Board", -61, 1200);
+
+    TEST_ASSERT_EQUAL(1, cache.size());
+    const CachedBoard* board = cache.find(NimBLEAddress(ADDR_A));
+    TEST_ASSERT_NOT_NULL(board);
+    TEST_ASSERT_EQUAL(3, board->seenCount);
+    TEST_ASSERT_EQUAL(1000, board->firstSeenMs);
+    TEST_ASSERT_EQUAL(1200, board->lastSeenMs);
+}
+
+void test_empty_name_uses_placeholder(void) {
+    BoardCache cache;
+    const CachedBoard& board = cache.update(NimBLEAddress(ADDR_A), "", -60, 0);
+    TEST_ASSERT_EQUAL_STRING("Unknown Board", board.name.c_str());
+}
+
+void test_empty_name_keeps_previous_name(void) {
+    BoardCache cache;
+    cache.update(NimBLEAddress(ADDR_A), "Tension Board", -60, 0);
+    const CachedBoard& board = cache.update(NimBLEAddress(ADDR_A), "", -60, 100);
+    TEST_ASSERT_EQUAL_STRING("Tension Board", board.name.c_str());
+}
+
+// =============================================================================
+// RSSI Smoothing Tests
+// =============================================================================
+
+void test_first_sample_seeds_smoothed_rssi(void) {
+    BoardCache cache;
+    const CachedBoard& board = cache.update(NimBLEAddress(ADDR_A), "A", -70, 0);
+    TEST_ASSERT_FLOAT_WITHIN(0.01, -70.0, board.smoothedRssi);
+}
+
+void test_smoothed_rssi_is_ewma(void) {
+    BoardCache cache;
+    cache.update(NimBLEAddress(ADDR_A), "A", -70, 0);
+    const CachedBoard& board = cache.update(NimBLEAddress(ADDR_A), "A", -50, 100);
+
+    // -70 + alpha * (-50 - -70)
+    float expected = -70.0f + BOARD_CACHE_RSSI_ALPHA * 20.0f;
+    TEST_ASSERT_FLOAT_WITHIN(0.01, expected, board.smoothedRssi);
+    TEST_ASSERT_EQUAL(-50, board.lastRssi);
+}
+
+void test_single_faded_packet_does_not_flip_best_board(void) {
+    BoardCache cache;
+    for (int i = 0; i < 10; i++) {
+        cache.update(NimBLEAddress(ADDR_A), "A", -55, i * 100);
+        cache.update(NimBLEAddress(ADDR_B), "B", -70, i * 100);
+    }
+    // One deep fade on A, one strong packet on B
+    cache.update(NimBLEAddress(ADDR_A), "A", -80, 1000);
+    cache.update(NimBLEAddress(ADDR_B), "B", -50, 1000);
+
+    const CachedBoard* best = cache.getBest(1000);
+    TEST_ASSERT_NOT_NULL(best);
+    TEST_ASSERT_TRUE(best->address == NimBLEAddress(ADDR_A));
+}
+
+// =============================================================================
+// Freshness Tests
+// =============================================================================
+
+void test_get_best_ignores_stale_boards(void) {
+    BoardCache cache;
+    cache.update(NimBLEAddress(ADDR_A), "A", -40, 0);
+    cache.update(NimBLEAddress(ADDR_B), "B", -80, 15000);
+
+    const CachedBoard* best = cache.getBest(20000, BOARD_CACHE_FRESH_MS);
+    TEST_ASSERT_NOT_NULL(best);
+    TEST_ASSERT_TRUE(best->address == NimBLEAddress(ADDR_B));
+}
+
+void test_get_best_returns_null_when_all_stale(void) {
+    BoardCache cache;
+    cache.update(NimBLEAddress(ADDR_A), "A", -40, 0);
+    TEST_ASSERT_NULL(cache.getBest(BOARD_CACHE_FRESH_MS + 1));
+}
+
+void test_seen_since_detects_board_returning(void) {
+    BoardCache cache;
+    cache.update(NimBLEAddress(ADDR_A), "A", -60, 1000);
+
+    // Disconnect at t=2000: the old sighting must not count
+    TEST_ASSERT_FALSE(cache.seenSince(NimBLEAddress(ADDR_A), 2000));
+
+    // Board reboots and advertises again
+    cache.update(NimBLEAddress(ADDR_A), "A", -60, 2400);
+    TEST_ASSERT_TRUE(cache.seenSince(NimBLEAddress(ADDR_A), 2000));
+}
+
+void test_seen_since_unknown_board_is_false(void) {
+    BoardCache cache;
+    TEST_ASSERT_FALSE(cache.seenSince(NimBLEAddress(ADDR_A), 0));
+}
+
+void test_seen_since_handles_millis_wraparound(void) {
+    BoardCache cache;
+    unsigned long beforeWrap = (unsigned long)-100;
+    cache.update(NimBLEAddress(ADDR_A), "A", -60, 50);  // after wrap
+    TEST_ASSERT_TRUE(cache.seenSince(NimBLEAddress(ADDR_A), beforeWrap));
+}
+
+void test_prune_removes_stale_entries(void) {
+    BoardCache cache;
+    cache.update(NimBLEAddress(ADDR_A), "A", -60, 0);
+    cache.update(NimBLEAddress(ADDR_B), "B", -60, 50000);
+
+    TEST_ASSERT_EQUAL(1, cache.prune(60000, 30000));
+    TEST_ASSERT_EQUAL(1, cache.size());
+    TEST_ASSERT_NULL(cache.find(NimBLEAddress(ADDR_A)));
+    TEST_ASSERT_NOT_NULL(cache.find(NimBLEAddress(ADDR_B)));
+}
+
+// =============================================================================
+// Lookup / Eviction Tests
+// =============================================================================
+
+void test_find_by_mac_is_case_insensitive(void) {
+    BoardCache cache;
+    cache.update(NimBLEAddress(ADDR_B), "B", -60, 0);
+
+    TEST_ASSERT_NOT_NULL(cache.findByMac("FF:EE:DD:CC:BB:AA"));
+    TEST_ASSERT_NOT_NULL(cache.findByMac("ff:ee:dd:cc:bb:aa"));
+    TEST_ASSERT_NULL(cache.findByMac("00:00:00:00:00:00"));
+}
+
+void test_full_cache_evicts_least_recently_seen(void) {
+    BoardCache cache;
+    for (int i = 0; i < BOARD_CACHE_MAX_ENTRIES; i++) {
+        cache.update(addressFor(i), "Board", -60, 1000 + i);
+    }
+    TEST_ASSERT_EQUAL(BOARD_CACHE_MAX_ENTRIES, cache.size());
+
+    // Refresh board 0 so board 1 becomes the oldest
+    cache.update(addressFor(0), "Board", -60, 5000);
+    cache.update(addressFor(200), "New", -60, 6000);
+
+    TEST_ASSERT_EQUAL(BOARD_CACHE_MAX_ENTRIES, cache.size());
+    TEST_ASSERT_NOT_NULL(cache.find(addressFor(0)));
+    TEST_ASSERT_NULL(cache.find(addressFor(1)));
+    TEST_ASSERT_NOT_NULL(cache.find(addressFor(200)));
+}
+
+void test_clear_removes_everything(void) {
+    BoardCache cache;
+    cache.update(NimBLEAddress(ADDR_A), "A", -60, 0);
+    cache.update(NimBLEAddress(ADDR_B), "B", -60, 0);
+    cache.clear();
+    TEST_ASSERT_EQUAL(0, cache.size());
+}
+
+// =============================================================================
+// Main
+// =============================================================================
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+
+    // Insert / dedup
+    RUN_TEST(test_empty_cache_has_no_boards);
+    RUN_TEST(test_update_inserts_new_board);
+    RUN_TEST(test_repeated_adverts_do_not_duplicate);
+    RUN_TEST(test_empty_name_uses_placeholder);
+    RUN_TEST(test_empty_name_keeps_previous_name);
+
+    // RSSI smoothing
+    RUN_TEST(test_first_sample_seeds_smoothed_rssi);
+    RUN_TEST(test_smoothed_rssi_is_ewma);
+    RUN_TEST(test_single_faded_packet_does_not_flip_best_board);
+
+    // Freshness
+    RUN_TEST(test_get_best_ignores_stale_boards);
+    RUN_TEST(test_get_best_returns_null_when_all_stale);
+    RUN_TEST(test_seen_since_detects_board_returning);
+    RUN_TEST(test_seen_since_unknown_board_is_false);
+    RUN_TEST(test_seen_since_handles_millis_wraparound);
+    RUN_TEST(test_prune_removes_stale_entries);
+
+    // Lookup / eviction
+    RUN_TEST(test_find_by_mac_is_case_insensitive);
+    RUN_TEST(test_full_cache_evicts_least_recently_seen);
+    RUN_TEST(test_clear_removes_everything);
+
+    return UNITY_END();
+}
@@ -0,0 +1,449 @@
+/**
+ * Unit Tests for BLE Board Fan-out
+ *
+ * Tests the multi-board proxy path: every connected board gets its own
+ * write queue and reconnect timer, so the same packets reach all boards
+ * and a slow or missing board never delays the others.
+ */
+
+#include <Arduino.h>
+#include <NimBLEDevice.h>
+#include <unity.h>
+
+#include <ble_board_fanout.h>
+
+static int dataCallbackCount = 0;
+
+static void testDataCallback(const uint8_t* data, size_t len) {
+    dataCallbackCount++;
+}
+
+// Give every mock client a Nordic UART service so connect() fully succeeds
+static void addNusService(NimBLEClient* c) {
+    NimBLERemoteService* svc = new NimBLERemoteService(NUS_SERVICE_UUID);
+    svc->mockAddCharacteristic(new NimBLERemoteCharacteristic(NUS_RX_CHARACTERISTIC));
+    svc->mockAddCharacteristic(new NimBLERemoteCharacteristic(NUS_TX_CHARACTERISTIC));
+    c->mockAddService(svc);
+}
+
+static NimBLEAddress boardAddress(uint8_t id) {
+    uint8_t addr[6] = {id, 0x22, 0x33, 0x44, 0x55, 0x66};
+    return NimBLEAddress(addr);
+}
+
+// Mock clients are created in connect order, which is board order here
+static NimBLERemoteCharacteristic* characteristicFor(int clientIndex, const char* uuid) {
+    NimBLEClient* client = NimBLEDevice::getClients()[clientIndex];
+    return client->getService(NUS_SERVICE_UUID)->getCharacteristic(uuid);
+}
+
+static int writesTo(int clientIndex) {
+    return characteristicFor(clientIndex, NUS_RX_CHARACTERISTIC)->getWriteCount();
+}
+
+// One connect per loop(), so n boards need n calls
+static void connectBoards(BLEBoardFanout& fanout, int count) {
+    for (int i = 0; i < count; i++) {
+        fanout.addBoard(boardAddress(i + 1));
+    }
+    for (int i = 0; i < count; i++) {
+        fanout.loop();
+    }
+}
+
+// Run loop() with time advancing by the write gap each step
+static void drain(BLEBoardFanout& fanout, int steps) {
+    for (int i = 0; i < steps; i++) {
+        mockAdvanceMillis(BLE_FANOUT_WRITE_GAP_MS);
+        fanout.loop();
+    }
+}
+
+static std::vector<std::vector<uint8_t>> makePackets(size_t packetSize, int packetCount) {
+    std::vector<std::vector<uint8_t>> packets;
+    for (int p = 0; p < packetCount; p++) {
+        packets.push_back(std::vector<uint8_t>(packetSize, (uint8_t)p));
+    }
+    return packets;
+}
+
+void setUp(void) {
+    dataCallbackCount = 0;
+    mockSetMillis(1000);
+    NimBLEDevice::mockReset();
+    NimBLEDevice::init("TestDevice");
+    NimBLEDevice::mockSetClientSetup(addNusService);
+}
+
+void tearDown(void) {
+    NimBLEDevice::mockReset();
+}
+
+// =============================================================================
+// Write Queue Tests
+// =============================================================================
+
+void test_queue_is_fifo(void) {
+    BoardWriteQueue queue;
+    uint8_t a[] = {1, 2};
+    uint8_t b[] = {3};
+    queue.push(a, sizeof(a));
+    queue.push(b, sizeof(b));
+
+    size_t len;
+    const uint8_t* front = queue.front(len);
+    TEST_ASSERT_EQUAL(2, len);
+    TEST_ASSERT_EQUAL(1, front[0]);
+    queue.pop();
+
+    front = queue.front(len);
+    TEST_ASSERT_EQUAL(1, len);
+    TEST_ASSERT_EQUAL(3, front[0]);
+    queue.pop();
+    TEST_ASSERT_TRUE(queue.isEmpty());
+}
+
+void test_queue_rejects_oversized_chunk(void) {
+    BoardWriteQueue queue;
+    uint8_t big[BLE_FANOUT_CHUNK_SIZE + 1] = {0};
+    TEST_ASSERT_FALSE(queue.push(big, sizeof(big)));
+}
+
+void test_queue_rejects_when_full(void) {
+    BoardWriteQueue queue;
+    uint8_t chunk[1] = {0};
+    for (int i = 0; i < BLE_FANOUT_QUEUE_CHUNKS; i++) {
+        TEST_ASSERT_TRUE(queue.push(chunk, 1));
+    }
+    TEST_ASSERT_FALSE(queue.push(chunk, 1));
+    TEST_ASSERT_EQUAL(0, queue.available());
+}
+
+// =============================================================================
+// Board Management Tests
+// =============================================================================
+
+void test_add_board_rejects_duplicates(void) {
+    BLEBoardFanout fanout;
+    TEST_ASSERT_EQUAL(0, fanout.addBoard(boardAddress(1)));
+    TEST_ASSERT_EQUAL(-1, fanout.addBoard(boardAddress(1)));
+    TEST_ASSERT_EQUAL(1, fanout.getBoardCount());
+}
+
+void test_add_board_respects_limit(void) {
+    BLEBoardFanout fanout;
+    for (int i = 0; i < BLE_FANOUT_MAX_BOARDS; i++) {
+        TEST_ASSERT_EQUAL(i, fanout.addBoard(boardAddress(i + 1)));
+    }
+    TEST_ASSERT_EQUAL(-1, fanout.addBoard(boardAddress(100)));
+}
+
+void test_loop_connects_one_board_per_call(void) {
+    BLEBoardFanout fanout;
+    fanout.addBoard(boardAddress(1));
+    fanout.addBoard(boardAddress(2));
+
+    fanout.loop();
+    TEST_ASSERT_EQUAL(1, fanout.getConnectedCount());
+    fanout.loop();
+    TEST_ASSERT_EQUAL(2, fanout.getConnectedCount());
+}
+
+void test_connect_held_while_scanning(void) {
+    BLEBoardFanout fanout;
+    fanout.addBoard(boardAddress(1));
+
+    TEST_ASSERT_TRUE(fanout.hasPendingConnect());
+    fanout.loop(false);
+    TEST_ASSERT_EQUAL(0, fanout.getConnectedCount());
+
+    fanout.loop(true);
+    TEST_ASSERT_EQUAL(1, fanout.getConnectedCount());
+    TEST_ASSERT_FALSE(fanout.isConnecting());
+    TEST_ASSERT_FALSE(fanout.hasPendingConnect());
+}
+
+// =============================================================================
+// Fan-out Delivery Tests
+// =============================================================================
+
+void test_send_packets_reaches_every_board(void) {
+    BLEBoardFanout fanout;
+    connectBoards(fanout, 3);
+
+    // Two 30-byte packets = 4 chunks per board
+    TEST_ASSERT_EQUAL(3, fanout.sendPackets(makePackets(30, 2)));
+    drain(fanout, 4);
+
+    for (int i = 0; i < 3; i++) {
+        TEST_ASSERT_EQUAL(4, writesTo(i));
+        TEST_ASSERT_EQUAL(4, fanout.getStats(i).chunksWritten);
+        TEST_ASSERT_EQUAL(60, fanout.getStats(i).bytesWritten);
+    }
+}
+
+void test_send_packets_chunks_at_packet_boundaries(void) {
+    BLEBoardFanout fanout;
+    connectBoards(fanout, 1);
+
+    // 21 + 5 bytes must become 20/1/5, never merging packets
+    std::vector<std::vector<uint8_t>> packets;
+    packets.push_back(std::vector<uint8_t>(21, 0xAA));
+    packets.push_back(std::vector<uint8_t>(5, 0xBB));
+    fanout.sendPackets(packets);
+    TEST_ASSERT_EQUAL(3, fanout.getQueueDepth(0));
+}
+
+void test_writes_are_paced_per_board(void) {
+    BLEBoardFanout fanout;
+    connectBoards(fanout, 2);
+    fanout.sendPackets(makePackets(20, 5));
+
+    // Same instant: no more than one chunk per board
+    mockAdvanceMillis(BLE_FANOUT_WRITE_GAP_MS);
+    fanout.loop();
+    fanout.loop();
+    TEST_ASSERT_EQUAL(1, writesTo(0));
+    TEST_ASSERT_EQUAL(1, writesTo(1));
+}
+
+void test_slow_board_does_not_delay_others(void) {
+    BLEBoardFanout fanout;
+    connectBoards(fanout, 2);
+
+    // Board 1 refuses every write
+    characteristicFor(1, NUS_RX_CHARACTERISTIC)->mockSetWriteSuccess(false);
+    fanout.sendPackets(makePackets(20, 4));
+    drain(fanout, 4);
+
+    TEST_ASSERT_EQUAL(4, writesTo(0));
+    TEST_ASSERT_EQUAL(0, fanout.getQueueDepth(0));
+    TEST_ASSERT_TRUE(fanout.getStats(1).writeFailures > 0);
+}
+
+void test_failing_board_drops_update_after_retries(void) {
+    BLEBoardFanout fanout;
+    connectBoards(fanout, 1);
+    characteristicFor(0, NUS_RX_CHARACTERISTIC)->mockSetWriteSuccess(false);
+
+    fanout.sendPackets(makePackets(20, 3));
+    drain(fanout, BLE_FANOUT_MAX_WRITE_RETRIES);
+
+    TEST_ASSERT_EQUAL(0, fanout.getQueueDepth(0));
+    TEST_ASSERT_EQUAL(1, fanout.getStats(0).updatesDropped);
+}
+
+void test_new_update_supersedes_backlog(void) {
+    BLEBoardFanout fanout;
+    connectBoards(fanout, 1);
+
+    fanout.sendPackets(makePackets(20, 10));
+    drain(fanout, 2);
+    fanout.sendPackets(makePackets(20, 3));
+
+    TEST_ASSERT_EQUAL(3, fanout.getQueueDepth(0));
+    TEST_ASSERT_EQUAL(1, fanout.getStats(0).updatesSuperseded);
+}
+
+void test_update_larger_than_queue_is_dropped(void) {
+    BLEBoardFanout fanout;
+    connectBoards(fanout, 1);
+
+    TEST_ASSERT_EQUAL(0, fanout.sendPackets(makePackets(20, BLE_FANOUT_QUEUE_CHUNKS + 1)));
+    TEST_ASSERT_EQUAL(0, fanout.getQueueDepth(0));
+    TEST_ASSERT_EQUAL(1, fanout.getStats(0).updatesDropped);
+}
+
+void test_forward_appends_to_queue(void) {
+    BLEBoardFanout fanout;
+    connectBoards(fanout, 2);
+
+    uint8_t data[25] = {0};
+    TEST_ASSERT_EQUAL(2, fanout.forward(data, sizeof(data)));
+    TEST_ASSERT_EQUAL(2, fanout.forward(data, sizeof(data)));
+    TEST_ASSERT_EQUAL(4, fanout.getQueueDepth(0));
+    TEST_ASSERT_EQUAL(4, fanout.getQueueDepth(1));
+}
+
+void test_send_skips_disconnected_boards(void) {
+    BLEBoardFanout fanout;
+    fanout.addBoard(boardAddress(1));
+    fanout.addBoard(boardAddress(2));
+    fanout.loop();  // Only board 0 connects
+
+    TEST_ASSERT_EQUAL(1, fanout.sendPackets(makePackets(20, 1)));
+    TEST_ASSERT_EQUAL(0, fanout.getQueueDepth(1));
+}
+
+// =============================================================================
+// Reconnect Tests
+// =============================================================================
+
+void test_disconnect_clears_queue_and_keeps_others_running(void) {
+    BLEBoardFanout fanout;
+    connectBoards(fanout, 2);
+    fanout.sendPackets(makePackets(20, 4));
+
+    NimBLEDevice::getClients()[1]->mockTriggerDisconnect();
+    drain(fanout, 4);
+
+    TEST_ASSERT_EQUAL(1, fanout.getConnectedCount());
+    TEST_ASSERT_EQUAL(0, fanout.getQueueDepth(1));
+    TEST_ASSERT_EQUAL(1, fanout.getStats(1).disconnects);
+    TEST_ASSERT_EQUAL(4, writesTo(0));
+}
+
+void test_disconnected_board_reconnects_after_delay(void) {
+    BLEBoardFanout fanout;
+    connectBoards(fanout, 2);
+
+    NimBLEDevice::getClients()[1]->mockTriggerDisconnect();
+    fanout.loop();
+    TEST_ASSERT_FALSE(fanout.isBoardConnected(1));
+
+    mockAdvanceMillis(BLE_FANOUT_RECONNECT_MIN_MS);
+    fanout.loop();
+    TEST_ASSERT_TRUE(fanout.isBoardConnected(1));
+    TEST_ASSERT_EQUAL(2, fanout.getStats(1).connects);
+}
+
+void test_connect_failures_back_off(void) {
+    BLEBoardFanout fanout;
+    NimBLEDevice::mockSetNextConnectSuccess(false);
+    fanout.addBoard(boardAddress(1));
+
+    fanout.loop();
+    TEST_ASSERT_EQUAL(1, fanout.getStats(0).connectFailures);
+    TEST_ASSERT_FALSE(fanout.isConnecting());
+
+    // First retry after the minimum delay
+    mockAdvanceMillis(BLE_FANOUT_RECONNECT_MIN_MS - 1);
+    TEST_ASSERT_FALSE(fanout.hasPendingConnect());
+    mockAdvanceMillis(1);
+    fanout.loop();
+    TEST_ASSERT_EQUAL(2, fanout.getStats(0).connectFailures);
+
+    // Second retry waits twice as long
+    mockAdvanceMillis(BLE_FANOUT_RECONNECT_MIN_MS);
+    TEST_ASSERT_FALSE(fanout.hasPendingConnect());
+    mockAdvanceMillis(BLE_FANOUT_RECONNECT_MIN_MS);
+    TEST_ASSERT_TRUE(fanout.hasPendingConnect());
+}
+
+void test_unreachable_board_does_not_block_other_connects(void) {
+    BLEBoardFanout fanout;
+    NimBLEDevice::mockSetNextConnectSuccess(false);
+    fanout.addBoard(boardAddress(1));
+    fanout.loop();  // Board 0 fails and backs off
+
+    NimBLEDevice::mockSetNextConnectSuccess(true);
+    fanout.addBoard(boardAddress(2));
+    fanout.loop();
+
+    TEST_ASSERT_FALSE(fanout.isBoardConnected(0));
+    TEST_ASSERT_TRUE(fanout.isBoardConnected(1));
+}
+
+// =============================================================================
+// Board → App Tests
+// =============================================================================
+
+void test_only_first_board_answers_app(void) {
+    BLEBoardFanout fanout;
+    fanout.setDataCallback(testDataCallback);
+    connectBoards(fanout, 2);
+
+    uint8_t data[] = {0x01, 0x02};
+    characteristicFor(0, NUS_TX_CHARACTERISTIC)->mockReceiveNotify(data, sizeof(data));
+    characteristicFor(1, NUS_TX_CHARACTERISTIC)->mockReceiveNotify(data, sizeof(data));
+
+    TEST_ASSERT_EQUAL(1, dataCallbackCount);
+    TEST_ASSERT_EQUAL(0, fanout.getResponder());
+}
+
+void test_responses_move_to_next_board_when_responder_drops(void) {
+    BLEBoardFanout fanout;
+    fanout.setDataCallback(testDataCallback);
+    connectBoards(fanout, 2);
+
+    NimBLEDevice::getClients()[0]->mockTriggerDisconnect();
+    fanout.loop();
+    TEST_ASSERT_EQUAL(1, fanout.getResponder());
+
+    uint8_t data[] = {0x01, 0x02};
+    characteristicFor(1, NUS_TX_CHARACTERISTIC)->mockReceiveNotify(data, sizeof(data));
+    TEST_ASSERT_EQUAL(1, dataCallbackCount);
+
+    // The original board reconnecting does not take the app back
+    mockAdvanceMillis(BLE_FANOUT_RECONNECT_MIN_MS);
+    fanout.loop();
+    TEST_ASSERT_TRUE(fanout.isBoardConnected(0));
+    TEST_ASSERT_EQUAL(1, fanout.getResponder());
+}
+
+void test_responder_elected_when_first_board_never_connects(void) {
+    BLEBoardFanout fanout;
+    fanout.setDataCallback(testDataCallback);
+    NimBLEDevice::mockSetNextConnectSuccess(false);
+    fanout.addBoard(boardAddress(1));
+    fanout.loop();
+    TEST_ASSERT_EQUAL(-1, fanout.getResponder());
+
+    NimBLEDevice::mockSetNextConnectSuccess(true);
+    fanout.addBoard(boardAddress(2));
+    fanout.loop();
+    TEST_ASSERT_EQUAL(1, fanout.getResponder());
+}
+
+void test_clear_disconnects_all_boards(void) {
+    BLEBoardFanout fanout;
+    connectBoards(fanout, 2);
+    fanout.clear();
+
+    TEST_ASSERT_EQUAL(0, fanout.getBoardCount());
+    TEST_ASSERT_EQUAL(0, fanout.getConnectedCount());
+}
+
+// =============================================================================
+// Main
+// =============================================================================
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+
+    // Write queue
+    RUN_TEST(test_queue_is_fifo);
+    RUN_TEST(test_queue_rejects_oversized_chunk);
+    RUN_TEST(test_queue_rejects_when_full);
+
+    // Board management
+    RUN_TEST(test_add_board_rejects_duplicates);
+    RUN_TEST(test_add_board_respects_limit);
+    RUN_TEST(test_loop_connects_one_board_per_call);
+    RUN_TEST(test_connect_held_while_scanning);
+
+    // Fan-out delivery
+    RUN_TEST(test_send_packets_reaches_every_board);
+    RUN_TEST(test_send_packets_chunks_at_packet_boundaries);
+    RUN_TEST(test_writes_are_paced_per_board);
+    RUN_TEST(test_slow_board_does_not_delay_others);
+    RUN_TEST(test_failing_board_drops_update_after_retries);
+    RUN_TEST(test_new_update_supersedes_backlog);
+    RUN_TEST(test_update_larger_than_queue_is_dropped);
+    RUN_TEST(test_forward_appends_to_queue);
+    RUN_TEST(test_send_skips_disconnected_boards);
+
+    // Reconnect
+    RUN_TEST(test_disconnect_clears_queue_and_keeps_others_running);
+    RUN_TEST(test_disconnected_board_reconnects_after_delay);
+    RUN_TEST(test_connect_failures_back_off);
+    RUN_TEST(test_unreachable_board_does_not_block_other_connects);
+
+    // Board -> app
+    RUN_TEST(test_only_first_board_answers_app);
+    RUN_TEST(test_responses_move_to_next_board_when_responder_drops);
+    RUN_TEST(test_responder_elected_when_first_board_never_connects);
+    RUN_TEST(test_clear_disconnects_all_boards);
+
+    return UNITY_END();
+}
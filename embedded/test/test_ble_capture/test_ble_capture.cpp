@@ -0,0 +1,360 @@
+/**
+ * Unit Tests for BLE Capture
+ *
+ * Tests the compact capture file format and the recorder that stages BLE
+ * traffic in RAM and flushes it from loop().
+ */
+
+#include <Arduino.h>
+#include <unity.h>
+
+#include <ble_capture.h>
+#include <ble_capture_format.h>
+#include <vector>
+
+static std::vector<uint8_t> sinkOutput;
+
+static void testSink(const uint8_t* data, size_t len) {
+    sinkOutput.insert(sinkOutput.end(), data, data + len);
+}
+
+// Encode records into a complete capture buffer
+static std::vector<uint8_t> makeCapture(BLECaptureEncoder& encoder, const uint32_t* timestamps, int count,
+                                        size_t payloadLen) {
+    std::vector<uint8_t> out(BLE_CAPTURE_HEADER_SIZE);
+    BLECaptureEncoder::writeHeader(out.data());
+    for (int i = 0; i < count; i++) {
+        std::vector<uint8_t> payload(payloadLen, (uint8_t)i);
+        size_t offset = out.size();
+        out.resize(offset + BLECaptureEncoder::maxRecordSize(payloadLen));
+        BLECaptureDirection dir = i % 2 ? BLECaptureDirection::BOARD_TO_APP : BLECaptureDirection::APP_TO_BOARD;
+        size_t n = encoder.encodeRecord(out.data() + offset, out.size() - offset, timestamps[i], dir, payload.data(),
+                                        payload.size());
+        out.resize(offset + n);
+    }
+    return out;
+}
+
+static int countRecords(const std::vector<uint8_t>& capture) {
+    BLECaptureReader reader(capture.data(), capture.size());
+    BLECaptureRecord record;
+    int count = 0;
+    while (reader.next(record)) {
+        count++;
+    }
+    return count;
+}
+
+void setUp(void) {
+    sinkOutput.clear();
+    mockSetMillis(1000);
+}
+
+void tearDown(void) {}
+
+// =============================================================================
+// Format Tests
+// =============================================================================
+
+void test_header_is_valid(void) {
+    uint8_t header[BLE_CAPTURE_HEADER_SIZE];
+    TEST_ASSERT_EQUAL(BLE_CAPTURE_HEADER_SIZE, BLECaptureEncoder::writeHeader(header));
+    TEST_ASSERT_EQUAL_MEMORY("BSCP", header, 4);
+    TEST_ASSERT_EQUAL(BLE_CAPTURE_VERSION, header[4]);
+
+    BLECaptureReader reader(header, sizeof(header));
+    TEST_ASSERT_TRUE(reader.isValid());
+
+    BLECaptureRecord record;
+    TEST_ASSERT_FALSE(reader.next(record));
+    TEST_ASSERT_FALSE(reader.isTruncated());
+}
+
+void test_reader_rejects_bad_magic(void) {
+    uint8_t header[BLE_CAPTURE_HEADER_SIZE];
+    BLECaptureEncoder::writeHeader(header);
+    header[0] = 'X';
+    BLECaptureReader reader(header, sizeof(header));
+    TEST_ASSERT_FALSE(reader.isValid());
+}
+
+void test_reader_rejects_unknown_version(void) {
+    uint8_t header[BLE_CAPTURE_HEADER_SIZE];
+    BLECaptureEncoder::writeHeader(header);
+    header[4] = BLE_CAPTURE_VERSION + 1;
+    BLECaptureReader reader(header, sizeof(header));
+    TEST_ASSERT_FALSE(reader.isValid());
+}
+
+void test_reader_rejects_short_buffer(void) {
+    uint8_t data[] = {'B', 'S', 'C'};
+    BLECaptureReader reader(data, sizeof(data));
+    TEST_ASSERT_FALSE(reader.isValid());
+}
+
+void test_round_trip_preserves_records(void) {
+    BLECaptureEncoder encoder;
+    const uint32_t timestamps[] = {500, 7500, 15000, 2015000};
+    std::vector<uint8_t> capture = makeCapture(encoder, timestamps, 4, 20);
+
+    BLECaptureReader reader(capture.data(), capture.size());
+    BLECaptureRecord record;
+    for (int i = 0; i < 4; i++) {
+        TEST_ASSERT_TRUE(reader.next(record));
+        TEST_ASSERT_EQUAL(timestamps[i], (uint32_t)record.timestampUs);
+        TEST_ASSERT_EQUAL(20, record.length);
+        TEST_ASSERT_EQUAL(i, record.data[0]);
+        TEST_ASSERT_TRUE(record.direction ==
+                         (i % 2 ? BLECaptureDirection::BOARD_TO_APP : BLECaptureDirection::APP_TO_BOARD));
+    }
+    TEST_ASSERT_FALSE(reader.next(record));
+    TEST_ASSERT_FALSE(reader.isTruncated());
+}
+
+void test_small_write_overhead_is_compact(void) {
+    BLECaptureEncoder encoder;
+    uint8_t out[64];
+    uint8_t payload[20] = {0};
+
+    // 7.5ms gap (the app's write interval) fits a 2-byte varint
+    size_t n = encoder.encodeRecord(out, sizeof(out), 7500, BLECaptureDirection::APP_TO_BOARD, payload, 20);
+    TEST_ASSERT_EQUAL(2 + 1 + 1 + 20, n);
+}
+
+void test_large_gap_round_trips(void) {
+    BLECaptureEncoder encoder;
+    const uint32_t timestamps[] = {10, 4000000000UL};
+    std::vector<uint8_t> capture = makeCapture(encoder, timestamps, 2, 4);
+
+    BLECaptureReader reader(capture.data(), capture.size());
+    BLECaptureRecord record;
+    TEST_ASSERT_TRUE(reader.next(record));
+    TEST_ASSERT_TRUE(reader.next(record));
+    TEST_ASSERT_TRUE(record.timestampUs == 4000000000ULL);
+}
+
+void test_micros_wrap_keeps_timestamps_increasing(void) {
+    BLECaptureEncoder encoder;
+    encoder.reset(0xFFFFFF00UL);
+    const uint32_t timestamps[] = {0xFFFFFFF0UL, 0x00000100UL};
+    std::vector<uint8_t> capture = makeCapture(encoder, timestamps, 2, 1);
+
+    BLECaptureReader reader(capture.data(), capture.size());
+    BLECaptureRecord first, second;
+    TEST_ASSERT_TRUE(reader.next(first));
+    TEST_ASSERT_TRUE(reader.next(second));
+    TEST_ASSERT_EQUAL(0xF0, (uint32_t)first.timestampUs);
+    TEST_ASSERT_EQUAL(0xF0 + 0x110, (uint32_t)second.timestampUs);
+}
+
+void test_empty_payload_record(void) {
+    BLECaptureEncoder encoder;
+    const uint32_t timestamps[] = {1};
+    std::vector<uint8_t> capture = makeCapture(encoder, timestamps, 1, 0);
+
+    BLECaptureReader reader(capture.data(), capture.size());
+    BLECaptureRecord record;
+    TEST_ASSERT_TRUE(reader.next(record));
+    TEST_ASSERT_EQUAL(0, record.length);
+}
+
+void test_encode_fails_without_room(void) {
+    BLECaptureEncoder encoder;
+    uint8_t out[16];
+    uint8_t payload[20] = {0};
+    TEST_ASSERT_EQUAL(0, encoder.encodeRecord(out, sizeof(out), 1, BLECaptureDirection::APP_TO_BOARD, payload, 20));
+}
+
+void test_truncated_capture_reads_complete_records(void) {
+    BLECaptureEncoder encoder;
+    const uint32_t timestamps[] = {100, 200, 300};
+    std::vector<uint8_t> capture = makeCapture(encoder, timestamps, 3, 20);
+    capture.resize(capture.size() - 5);
+
+    BLECaptureReader reader(capture.data(), capture.size());
+    BLECaptureRecord record;
+    TEST_ASSERT_TRUE(reader.next(record));
+    TEST_ASSERT_TRUE(reader.next(record));
+    TEST_ASSERT_FALSE(reader.next(record));
+    TEST_ASSERT_TRUE(reader.isTruncated());
+}
+
+void test_rewind_restarts_timestamps(void) {
+    BLECaptureEncoder encoder;
+    const uint32_t timestamps[] = {100, 200};
+    std::vector<uint8_t> capture = makeCapture(encoder, timestamps, 2, 2);
+
+    BLECaptureReader reader(capture.data(), capture.size());
+    BLECaptureRecord record;
+    reader.next(record);
+    reader.next(record);
+    reader.rewind();
+    TEST_ASSERT_TRUE(reader.next(record));
+    TEST_ASSERT_EQUAL(100, (uint32_t)record.timestampUs);
+}
+
+// =============================================================================
+// Recorder Tests
+// =============================================================================
+
+void test_recorder_idle_by_default(void) {
+    BLECapture capture;
+    capture.setSink(testSink);
+    uint8_t data[] = {1, 2, 3};
+    capture.record(BLECaptureDirection::APP_TO_BOARD, data, sizeof(data));
+
+    TEST_ASSERT_FALSE(capture.isRecording());
+    TEST_ASSERT_EQUAL(0, capture.getStats().records);
+}
+
+void test_recorder_start_writes_header(void) {
+    BLECapture capture;
+    capture.setSink(testSink);
+    TEST_ASSERT_TRUE(capture.start());
+    TEST_ASSERT_TRUE(capture.isRecording());
+    TEST_ASSERT_EQUAL(BLE_CAPTURE_HEADER_SIZE, sinkOutput.size());
+
+    BLECaptureReader reader(sinkOutput.data(), sinkOutput.size());
+    TEST_ASSERT_TRUE(reader.isValid());
+}
+
+void test_recorder_start_without_filesystem_fails(void) {
+    BLECapture capture;
+    TEST_ASSERT_FALSE(capture.start());
+    TEST_ASSERT_FALSE(capture.isRecording());
+}
+
+void test_recorder_stages_until_flush_interval(void) {
+    BLECapture capture;
+    capture.setSink(testSink);
+    capture.start();
+    uint8_t data[20] = {0};
+    capture.record(BLECaptureDirection::APP_TO_BOARD, data, sizeof(data));
+
+    capture.loop();
+    TEST_ASSERT_EQUAL(BLE_CAPTURE_HEADER_SIZE, sinkOutput.size());
+
+    mockAdvanceMillis(BLE_CAPTURE_FLUSH_INTERVAL_MS);
+    capture.loop();
+    TEST_ASSERT_EQUAL(1, countRecords(sinkOutput));
+}
+
+void test_recorder_flushes_half_full_buffer(void) {
+    BLECapture capture;
+    capture.setSink(testSink);
+    capture.start();
+    uint8_t data[20] = {0};
+    // Same timestamp: 1-byte delta + direction + 1-byte length + payload
+    int records = BLE_CAPTURE_STAGING_SIZE / 2 / 23 + 1;
+    for (int i = 0; i < records; i++) {
+        capture.record(BLECaptureDirection::APP_TO_BOARD, data, sizeof(data));
+    }
+
+    capture.loop();
+    TEST_ASSERT_EQUAL(records, countRecords(sinkOutput));
+}
+
+void test_recorder_stop_flushes_and_preserves_timing(void) {
+    BLECapture capture;
+    capture.setSink(testSink);
+    capture.start();
+
+    uint8_t request[] = {0x01, 0x02};
+    uint8_t response[] = {0x03};
+    mockAdvanceMillis(10);
+    capture.record(BLECaptureDirection::APP_TO_BOARD, request, sizeof(request));
+    mockAdvanceMillis(25);
+    capture.record(BLECaptureDirection::BOARD_TO_APP, response, sizeof(response));
+    capture.stop();
+
+    TEST_ASSERT_FALSE(capture.isRecording());
+    BLECaptureReader reader(sinkOutput.data(), sinkOutput.size());
+    BLECaptureRecord record;
+    TEST_ASSERT_TRUE(reader.next(record));
+    TEST_ASSERT_EQUAL(10000, (uint32_t)record.timestampUs);
+    TEST_ASSERT_EQUAL(2, record.length);
+    TEST_ASSERT_TRUE(reader.next(record));
+    TEST_ASSERT_EQUAL(35000, (uint32_t)record.timestampUs);
+    TEST_ASSERT_TRUE(record.direction == BLECaptureDirection::BOARD_TO_APP);
+    TEST_ASSERT_EQUAL(sinkOutput.size(), capture.getStats().fileBytes);
+}
+
+void test_recorder_counts_drops_when_staging_full(void) {
+    BLECapture capture;
+    capture.setSink(testSink);
+    capture.start();
+    uint8_t data[200] = {0};
+    for (int i = 0; i < 20; i++) {
+        capture.record(BLECaptureDirection::APP_TO_BOARD, data, sizeof(data));
+    }
+
+    const BLECaptureStats& stats = capture.getStats();
+    TEST_ASSERT_EQUAL(20, stats.records + stats.recordsDropped);
+    TEST_ASSERT_TRUE(stats.recordsDropped > 0);
+    TEST_ASSERT_TRUE(capture.isRecording());
+}
+
+void test_recorder_stops_at_size_limit(void) {
+    BLECapture capture;
+    capture.setSink(testSink);
+    capture.setMaxSize(100);
+    capture.start();
+    uint8_t data[20] = {0};
+    for (int i = 0; i < 10; i++) {
+        capture.record(BLECaptureDirection::APP_TO_BOARD, data, sizeof(data));
+    }
+    capture.loop();
+
+    TEST_ASSERT_FALSE(capture.isRecording());
+    TEST_ASSERT_TRUE(sinkOutput.size() <= 100);
+    TEST_ASSERT_EQUAL(capture.getStats().records, countRecords(sinkOutput));
+}
+
+void test_recorder_restart_resets_stats(void) {
+    BLECapture capture;
+    capture.setSink(testSink);
+    capture.start();
+    uint8_t data[4] = {0};
+    capture.record(BLECaptureDirection::APP_TO_BOARD, data, sizeof(data));
+    capture.stop();
+
+    sinkOutput.clear();
+    capture.start();
+    TEST_ASSERT_EQUAL(0, capture.getStats().records);
+    TEST_ASSERT_EQUAL(BLE_CAPTURE_HEADER_SIZE, capture.getStats().fileBytes);
+}
+
+// =============================================================================
+// Main
+// =============================================================================
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+
+    // Format tests
+    RUN_TEST(test_header_is_valid);
+    RUN_TEST(test_reader_rejects_bad_magic);
+    RUN_TEST(test_reader_rejects_unknown_version);
+    RUN_TEST(test_reader_rejects_short_buffer);
+    RUN_TEST(test_round_trip_preserves_records);
+    RUN_TEST(test_small_write_overhead_is_compact);
+    RUN_TEST(test_large_gap_round_trips);
+    RUN_TEST(test_micros_wrap_keeps_timestamps_increasing);
+    RUN_TEST(test_empty_payload_record);
+    RUN_TEST(test_encode_fails_without_room);
+    RUN_TEST(test_truncated_capture_reads_complete_records);
+    RUN_TEST(test_rewind_restarts_timestamps);
+
+    // Recorder tests
+    RUN_TEST(test_recorder_idle_by_default);
+    RUN_TEST(test_recorder_start_writes_header);
+    RUN_TEST(test_recorder_start_without_filesystem_fails);
+    RUN_TEST(test_recorder_stages_until_flush_interval);
+    RUN_TEST(test_recorder_flushes_half_full_buffer);
+    RUN_TEST(test_recorder_stop_flushes_and_preserves_timing);
+    RUN_TEST(test_recorder_counts_drops_when_staging_full);
+    RUN_TEST(test_recorder_stops_at_size_limit);
+    RUN_TEST(test_recorder_restart_resets_stats);
+
+    return UNITY_END();
+}
@@ -98,6 +98,16 @@ void test_connect_triggers_callback(void) {
     TEST_ASSERT_TRUE(connectCallbackCount >= 1);
 }
 
+void test_connect_async_reports_through_state_only(void) {
+    BLEClientConnection client;
+    client.setConnectCallback(testConnectCallback);
+
+    uint8_t addr[6] = {0x11, 0x22, 0x33, 0x44, 0x55, 0x66};
+    NimBLEDevice::mockSetNextConnectSuccess(true);
+    TEST_ASSERT_TRUE(client.connectAsync(NimBLEAddress(addr)));
+    TEST_ASSERT_EQUAL(0, connectCallbackCount);
+}
+
 // =============================================================================
 // Connect Failure Tests - CRITICAL REGRESSION TESTS
 // =============================================================================
@@ -285,6 +295,205 @@ void test_send_when_not_connected_returns_false(void) {
     TEST_ASSERT_FALSE(result);
 }
 
+// =============================================================================
+// Link Profile Tests
+// =============================================================================
+
+// Give every mock client a Nordic UART service so connect() fully succeeds
+static void addNusService(NimBLEClient* c) {
+    NimBLERemoteService* svc = new NimBLERemoteService(NUS_SERVICE_UUID);
+    svc->mockAddCharacteristic(new NimBLERemoteCharacteristic(NUS_RX_CHARACTERISTIC));
+    svc->mockAddCharacteristic(new NimBLERemoteCharacteristic(NUS_TX_CHARACTERISTIC));
+    c->mockAddService(svc);
+}
+
+static void connectWithService(BLEClientConnection& client) {
+    NimBLEDevice::mockSetClientSetup(addNusService);
+    uint8_t addr[6] = {0x11, 0x22, 0x33, 0x44, 0x55, 0x66};
+    client.connect(NimBLEAddress(addr));
+}
+
+void test_low_latency_profile_is_7_5ms_interval(void) {
+    const BLELinkParams& params = BLEClientConnection::getLinkParams(BLELinkProfile::LOW_LATENCY);
+    TEST_ASSERT_EQUAL(6, params.minInterval);  // 6 * 1.25 ms = 7.5 ms
+    TEST_ASSERT_EQUAL(6, params.maxInterval);
+    TEST_ASSERT_EQUAL(0, params.latency);
+}
+
+void test_idle_profile_uses_longer_interval_and_latency(void) {
+    const BLELinkParams& low = BLEClientConnection::getLinkParams(BLELinkProfile::LOW_LATENCY);
+    const BLELinkParams& idle = BLEClientConnection::getLinkParams(BLELinkProfile::IDLE);
+    TEST_ASSERT_TRUE(idle.minInterval > low.maxInterval);
+    TEST_ASSERT_TRUE(idle.latency > 0);
+}
+
+void test_profile_supervision_timeouts_are_valid(void) {
+    // BLE spec: timeout (10 ms units) > (1 + latency) * interval (1.25 ms units) * 2
+    for (int i = 0; i < BLE_LINK_PROFILE_COUNT; i++) {
+        const BLELinkParams& p = BLEClientConnection::getLinkParams((BLELinkProfile)i);
+        float minTimeoutMs = (1 + p.latency) * p.maxInterval * 1.25f * 2;
+        TEST_ASSERT_TRUE(p.supervisionTimeout * 10.0f > minTimeoutMs);
+    }
+}
+
+void test_connect_uses_low_latency_params(void) {
+    BLEClientConnection client;
+    connectWithService(client);
+
+    TEST_ASSERT_TRUE(client.isConnected());
+    TEST_ASSERT_EQUAL(BLELinkProfile::LOW_LATENCY, client.getLinkProfile());
+    NimBLEClient* mock = NimBLEDevice::getClients().back();
+    TEST_ASSERT_EQUAL(6, mock->getMinInterval());
+    TEST_ASSERT_EQUAL(5, mock->getConnectTimeout());
+}
+
+void test_set_link_profile_updates_connection(void) {
+    BLEClientConnection client;
+    connectWithService(client);
+
+    TEST_ASSERT_TRUE(client.setLinkProfile(BLELinkProfile::IDLE));
+
+    NimBLEClient* mock = NimBLEDevice::getClients().back();
+    const BLELinkParams& idle = BLEClientConnection::getLinkParams(BLELinkProfile::IDLE);
+    TEST_ASSERT_EQUAL(1, mock->getUpdateConnParamsCount());
+    TEST_ASSERT_EQUAL(idle.maxInterval, mock->getMaxInterval());
+    TEST_ASSERT_EQUAL(idle.latency, mock->getLatency());
+
+    // Nothing changes until the controller reports the update done
+    TEST_ASSERT_TRUE(client.isLinkUpdatePending());
+    TEST_ASSERT_EQUAL(BLELinkProfile::LOW_LATENCY, client.getLinkProfile());
+    TEST_ASSERT_EQUAL(0, client.getLinkStats().profileSwitches);
+
+    mock->mockCompleteConnParamsUpdate();
+    client.loop();
+    TEST_ASSERT_FALSE(client.isLinkUpdatePending());
+    TEST_ASSERT_EQUAL(BLELinkProfile::IDLE, client.getLinkProfile());
+    TEST_ASSERT_EQUAL(1, client.getLinkStats().profileSwitches);
+}
+
+void test_rejected_link_update_keeps_profile(void) {
+    BLEClientConnection client;
+    connectWithService(client);
+
+    client.setLinkProfile(BLELinkProfile::IDLE);
+    NimBLEDevice::getClients().back()->mockCompleteConnParamsUpdate(false);
+    client.loop();
+
+    TEST_ASSERT_EQUAL(BLELinkProfile::LOW_LATENCY, client.getLinkProfile());
+    TEST_ASSERT_EQUAL(0, client.getLinkStats().profileSwitches);
+    TEST_ASSERT_EQUAL(1, client.getLinkStats().paramUpdateFailures);
+}
+
+void test_profile_request_during_update_is_sent_after(void) {
+    BLEClientConnection client;
+    connectWithService(client);
+    NimBLEClient* mock = NimBLEDevice::getClients().back();
+
+    client.setLinkProfile(BLELinkProfile::IDLE);
+    TEST_ASSERT_TRUE(client.setLinkProfile(BLELinkProfile::LOW_LATENCY));
+    TEST_ASSERT_EQUAL(1, mock->getUpdateConnParamsCount());
+
+    // IDLE lands, then the held-back request goes out
+    mock->mockCompleteConnParamsUpdate();
+    client.loop();
+    TEST_ASSERT_EQUAL(BLELinkProfile::IDLE, client.getLinkProfile());
+    TEST_ASSERT_EQUAL(2, mock->getUpdateConnParamsCount());
+    TEST_ASSERT_EQUAL(6, mock->getMaxInterval());
+
+    mock->mockCompleteConnParamsUpdate();
+    client.loop();
+    TEST_ASSERT_EQUAL(BLELinkProfile::LOW_LATENCY, client.getLinkProfile());
+    TEST_ASSERT_EQUAL(2, client.getLinkStats().profileSwitches);
+}
+
+void test_send_on_idle_link_requests_low_latency_first(void) {
+    BLEClientConnection client;
+    connectWithService(client);
+    NimBLEClient* mock = NimBLEDevice::getClients().back();
+    client.setLinkProfile(BLELinkProfile::IDLE);
+    mock->mockCompleteConnParamsUpdate();
+    client.loop();
+
+    uint8_t data[20] = {0};
+    TEST_ASSERT_TRUE(client.send(data, sizeof(data)));
+    TEST_ASSERT_EQUAL(2, mock->getUpdateConnParamsCount());
+    TEST_ASSERT_EQUAL(6, mock->getMaxInterval());
+    TEST_ASSERT_TRUE(client.isLinkUpdatePending());
+
+    // A second write of the burst does not ask again
+    TEST_ASSERT_TRUE(client.send(data, sizeof(data)));
+    TEST_ASSERT_EQUAL(2, mock->getUpdateConnParamsCount());
+}
+
+void test_set_same_profile_does_not_update(void) {
+    BLEClientConnection client;
+    connectWithService(client);
+
+    TEST_ASSERT_TRUE(client.setLinkProfile(BLELinkProfile::LOW_LATENCY));
+    TEST_ASSERT_EQUAL(0, NimBLEDevice::getClients().back()->getUpdateConnParamsCount());
+}
+
+void test_set_link_profile_when_disconnected_fails(void) {
+    BLEClientConnection client;
+    TEST_ASSERT_FALSE(client.setLinkProfile(BLELinkProfile::IDLE));
+    TEST_ASSERT_EQUAL(BLELinkProfile::LOW_LATENCY, client.getLinkProfile());
+}
+
+void test_link_stats_track_writes_and_time_per_profile(void) {
+    mockSetMillis(1000);
+    BLEClientConnection client;
+    connectWithService(client);
+
+    uint8_t data[20] = {0};
+    TEST_ASSERT_TRUE(client.send(data, sizeof(data)));
+    TEST_ASSERT_TRUE(client.send(data, 10));
+
+    mockAdvanceMillis(75);  // 10 low-latency connection events
+    client.setLinkProfile(BLELinkProfile::IDLE);
+    NimBLEDevice::getClients().back()->mockCompleteConnParamsUpdate();
+    client.loop();
+    mockAdvanceMillis(600);
+
+    BLELinkStats stats = client.getLinkStats();
+    TEST_ASSERT_EQUAL(2, stats.writesInProfile[(int)BLELinkProfile::LOW_LATENCY]);
+    TEST_ASSERT_EQUAL(30, stats.bytesInProfile[(int)BLELinkProfile::LOW_LATENCY]);
+    TEST_ASSERT_EQUAL(75, stats.timeInProfileMs[(int)BLELinkProfile::LOW_LATENCY]);
+    TEST_ASSERT_EQUAL(600, stats.timeInProfileMs[(int)BLELinkProfile::IDLE]);
+
+    // 2 writes over 10 events
+    TEST_ASSERT_FLOAT_WITHIN(0.001, 0.2, client.getConnectionEventUtilisation(BLELinkProfile::LOW_LATENCY));
+    TEST_ASSERT_FLOAT_WITHIN(0.001, 0.0, client.getConnectionEventUtilisation(BLELinkProfile::IDLE));
+    mockSetMillis(0);
+}
+
+void test_reconnect_delay_is_configurable(void) {
+    mockSetMillis(1000);
+    BLEClientConnection client;
+    client.setReconnectDelay(250);
+    NimBLEDevice::mockSetNextConnectSuccess(false);
+
+    uint8_t addr[6] = {0x11, 0x22, 0x33, 0x44, 0x55, 0x66};
+    client.connect(NimBLEAddress(addr));
+    NimBLEClient* mock = NimBLEDevice::getClients().back();
+    TEST_ASSERT_EQUAL(1, mock->getConnectAttempts());
+
+    mockAdvanceMillis(200);
+    client.loop();
+    TEST_ASSERT_EQUAL(1, mock->getConnectAttempts());
+
+    mockAdvanceMillis(100);
+    client.loop();
+    TEST_ASSERT_EQUAL(2, mock->getConnectAttempts());
+    mockSetMillis(0);
+}
+
+void test_connect_timeout_is_rounded_up_to_seconds(void) {
+    BLEClientConnection client;
+    client.setConnectTimeout(1500);
+    connectWithService(client);
+    TEST_ASSERT_EQUAL(2, NimBLEDevice::getClients().back()->getConnectTimeout());
+}
+
 // =============================================================================
 // Main
 // =============================================================================
@@ -300,6 +509,7 @@ int main(int argc, char** argv) {
     // Connect basic tests
     RUN_TEST(test_connect_returns_true_when_ble_connect_succeeds);
     RUN_TEST(test_connect_triggers_callback);
+    RUN_TEST(test_connect_async_reports_through_state_only);
 
     // Connect failure tests - CRITICAL REGRESSION TESTS
     RUN_TEST(test_connect_failure_triggers_callback_with_false);
@@ -321,5 +531,20 @@ int main(int argc, char** argv) {
     // Send tests
     RUN_TEST(test_send_when_not_connected_returns_false);
 
+    // Link profile tests
+    RUN_TEST(test_low_latency_profile_is_7_5ms_interval);
+    RUN_TEST(test_idle_profile_uses_longer_interval_and_latency);
+    RUN_TEST(test_profile_supervision_timeouts_are_valid);
+    RUN_TEST(test_connect_uses_low_latency_params);
+    RUN_TEST(test_set_link_profile_updates_connection);
+    RUN_TEST(test_rejected_link_update_keeps_profile);
+    RUN_TEST(test_profile_request_during_update_is_sent_after);
+    RUN_TEST(test_send_on_idle_link_requests_low_latency_first);
+    RUN_TEST(test_set_same_profile_does_not_update);
+    RUN_TEST(test_set_link_profile_when_disconnected_fails);
+    RUN_TEST(test_link_stats_track_writes_and_time_per_profile);
+    RUN_TEST(test_reconnect_delay_is_configurable);
+    RUN_TEST(test_connect_timeout_is_rounded_up_to_seconds);
+
     return UNITY_END();
 }
@@ -0,0 +1,406 @@
+/**
+ * Unit Tests and Benchmark for BLE Capture Replay
+ *
+ * Replays captured (or synthetic) BLE traffic with its recorded timing
+ * through AuroraProtocol, the NordicUartBLE server and the BLEProxy relay,
+ * and reports decode throughput, frame latency and resync behaviour.
+ *
+ * To replay a capture downloaded from a device built with
+ * ENABLE_BLE_CAPTURE (GET /api/capture), point BLE_CAPTURE_FILE at it.
+ * Set BLE_REPLAY_REALTIME=1 to also sleep for the recorded gaps.
+ */
+
+#include <Arduino.h>
+#include <NimBLEDevice.h>
+#include <Preferences.h>
+#include <unity.h>
+
+#include <aurora_protocol.h>
+#include <ble_capture_format.h>
+#include <ble_proxy.h>
+#include <ble_replay.h>
+#include <config_manager.h>
+#include <cstdlib>
+#include <log_buffer.h>
+#include <nordic_uart_ble.h>
+#include <radio_coex.h>
+
+static const uint32_t CHUNK_GAP_US = 7500;
+static const uint32_t CLIMB_GAP_US = 2000000;
+
+static int ledUpdateCount = 0;
+static size_t lastLedCount = 0;
+static size_t bytesSentToApp = 0;
+static bool proxyReady = false;
+
+static void onLedData(const LedCommand* commands, int count, int angle) {
+    ledUpdateCount++;
+    lastLedCount = count;
+}
+
+static void onRawForward(const uint8_t* data, size_t len) {
+    Proxy.forwardToBoard(data, len);
+}
+
+static void onSendToApp(const uint8_t* data, size_t len) {
+    bytesSentToApp += len;
+}
+
+// Give every mock board a Nordic UART service so the proxy can connect
+static void addNusService(NimBLEClient* c) {
+    NimBLERemoteService* svc = new NimBLERemoteService(NUS_SERVICE_UUID);
+    svc->mockAddCharacteristic(new NimBLERemoteCharacteristic(NUS_RX_CHARACTERISTIC));
+    svc->mockAddCharacteristic(new NimBLERemoteCharacteristic(NUS_TX_CHARACTERISTIC));
+    c->mockAddService(svc);
+}
+
+static NimBLECharacteristic* serverRx() {
+    return NimBLEDevice::getServer()->getServiceByUUID(NUS_SERVICE_UUID)->getCharacteristic(NUS_RX_CHARACTERISTIC);
+}
+
+static NimBLERemoteCharacteristic* boardCharacteristic(const char* uuid) {
+    return NimBLEDevice::getClients().back()->getService(NUS_SERVICE_UUID)->getCharacteristic(uuid);
+}
+
+// A climb of holdCount holds with the usual role colours
+static std::vector<LedCommand> makeClimb(int holdCount, int seed) {
+    static const uint8_t COLORS[4][3] = {{0, 255, 0}, {0, 255, 255}, {255, 0, 255}, {255, 170, 0}};
+    std::vector<LedCommand> climb;
+    for (int i = 0; i < holdCount; i++) {
+        const uint8_t* c = COLORS[(i + seed) % 4];
+        climb.push_back({(int32_t)((i * 37 + seed * 11) % 480), c[0], c[1], c[2]});
+    }
+    return climb;
+}
+
+static std::vector<uint8_t> makeSession(int climbs, int holdCount) {
+    CaptureBuilder builder;
+    for (int i = 0; i < climbs; i++) {
+        builder.addLedUpdate(makeClimb(holdCount, i), CLIMB_GAP_US);
+        uint8_t ack[] = {0x01};
+        builder.add(20000, BLECaptureDirection::BOARD_TO_APP, ack, sizeof(ack));
+    }
+    return builder.bytes();
+}
+
+static int chunksFor(int holdCount) {
+    std::vector<std::vector<uint8_t>> packets;
+    std::vector<LedCommand> climb = makeClimb(holdCount, 0);
+    AuroraProtocol::encodeLedCommands(climb.data(), climb.size(), packets);
+    size_t bytes = 0;
+    for (const auto& packet : packets) {
+        bytes += packet.size();
+    }
+    return (bytes + 19) / 20;
+}
+
+// Connect the proxy to a mock board once; BoardClient keeps its NimBLE
+// client for the rest of the run
+static bool bringUpProxy() {
+    if (proxyReady) {
+        return Proxy.isConnectedToBoard();
+    }
+    proxyReady = true;
+
+    Config.setBool("proxy_en", true);
+    Proxy.begin("");
+    Proxy.setSendToAppCallback(onSendToApp);
+    Proxy.loop();
+
+    uint8_t addr[6] = {0x10, 0x20, 0x30, 0x40, 0x50, 0x60};
+    NimBLEAdvertisedDevice board(NimBLEAddress(addr), "Kilter Board", -55, AURORA_ADVERTISED_SERVICE_UUID);
+    NimBLEDevice::getScan()->mockAdvertise(&board);
+
+    for (int i = 0; i < 100 && !Proxy.isConnectedToBoard(); i++) {
+        mockAdvanceMillis(50);
+        Proxy.loop();
+    }
+    return Proxy.isConnectedToBoard();
+}
+
+static CaptureReplayer::RecordHandler protocolHandler(AuroraProtocol& protocol) {
+    return [&protocol](const BLECaptureRecord& record) {
+        if (record.direction != BLECaptureDirection::APP_TO_BOARD) {
+            return false;
+        }
+        return protocol.processPacket(record.data, record.length);
+    };
+}
+
+static bool nusHandler(const BLECaptureRecord& record) {
+    if (record.direction != BLECaptureDirection::APP_TO_BOARD) {
+        return false;
+    }
+    int before = ledUpdateCount;
+    serverRx()->mockWrite(record.data, record.length);
+    return ledUpdateCount != before;
+}
+
+static bool proxyHandler(const BLECaptureRecord& record) {
+    if (record.direction == BLECaptureDirection::BOARD_TO_APP) {
+        std::vector<uint8_t> copy(record.data, record.data + record.length);
+        boardCharacteristic(NUS_TX_CHARACTERISTIC)->mockReceiveNotify(copy.data(), copy.size());
+        return false;
+    }
+    return nusHandler(record);
+}
+
+static void configureReplayer(CaptureReplayer& replayer) {
+    const char* realTime = getenv("BLE_REPLAY_REALTIME");
+    replayer.setRealTime(realTime && realTime[0] == '1');
+}
+
+void setUp(void) {
+    ledUpdateCount = 0;
+    lastLedCount = 0;
+    bytesSentToApp = 0;
+}
+
+void tearDown(void) {}
+
+// =============================================================================
+// Replayer Tests
+// =============================================================================
+
+void test_invalid_capture_is_rejected(void) {
+    std::vector<uint8_t> bogus = {1, 2, 3, 4, 5, 6, 7, 8};
+    CaptureReplayer replayer(bogus);
+    ReplayReport report;
+    TEST_ASSERT_FALSE(replayer.run([](const BLECaptureRecord&) { return false; }, report));
+}
+
+void test_mock_clock_follows_recorded_timestamps(void) {
+    CaptureBuilder builder;
+    uint8_t data[] = {0};
+    builder.add(5000, BLECaptureDirection::APP_TO_BOARD, data, 1);
+    builder.add(250000, BLECaptureDirection::BOARD_TO_APP, data, 1);
+
+    std::vector<unsigned long> seen;
+    CaptureReplayer replayer(builder.bytes());
+    ReplayReport report;
+    replayer.run(
+        [&seen](const BLECaptureRecord&) {
+            seen.push_back(millis());
+            return false;
+        },
+        report, 1000);
+
+    TEST_ASSERT_EQUAL(2, seen.size());
+    TEST_ASSERT_EQUAL(1005, seen[0]);
+    TEST_ASSERT_EQUAL(1255, seen[1]);
+    TEST_ASSERT_EQUAL(255000, report.captureDurationUs);
+    TEST_ASSERT_EQUAL(1, report.appToBoardRecords);
+    TEST_ASSERT_EQUAL(1, report.boardToAppRecords);
+}
+
+void test_tick_handler_runs_through_gaps(void) {
+    CaptureBuilder builder;
+    uint8_t data[] = {0};
+    builder.add(100000, BLECaptureDirection::APP_TO_BOARD, data, 1);
+
+    int ticks = 0;
+    CaptureReplayer replayer(builder.bytes());
+    replayer.setTickHandler([&ticks]() { ticks++; }, 10);
+    ReplayReport report;
+    replayer.run([](const BLECaptureRecord&) { return false; }, report);
+
+    TEST_ASSERT_EQUAL(10, ticks);
+}
+
+// =============================================================================
+// AuroraProtocol Replay Tests
+// =============================================================================
+
+void test_protocol_replay_decodes_every_climb(void) {
+    std::vector<uint8_t> session = makeSession(5, 30);
+    AuroraProtocol protocol;
+    CaptureReplayer replayer(session);
+    ReplayReport report;
+    TEST_ASSERT_TRUE(replayer.run(protocolHandler(protocol), report));
+
+    TEST_ASSERT_EQUAL(5, report.updates);
+    TEST_ASSERT_EQUAL(30, protocol.getLedCommands().size());
+    TEST_ASSERT_EQUAL(5, protocol.getStats().updatesCompleted);
+    TEST_ASSERT_EQUAL(0, protocol.getStats().checksumErrors);
+    TEST_ASSERT_EQUAL(0, protocol.getStats().bytesDiscarded);
+}
+
+void test_protocol_frame_latency_matches_write_spacing(void) {
+    std::vector<uint8_t> session = makeSession(3, 30);
+    AuroraProtocol protocol;
+    CaptureReplayer replayer(session);
+    ReplayReport report;
+    replayer.run(protocolHandler(protocol), report);
+
+    uint64_t expected = (uint64_t)(chunksFor(30) - 1) * CHUNK_GAP_US;
+    TEST_ASSERT_EQUAL(expected, report.maxFrameLatencyUs);
+    TEST_ASSERT_EQUAL(expected, report.meanFrameLatencyUs());
+}
+
+void test_protocol_resyncs_after_garbage(void) {
+    CaptureBuilder builder;
+    builder.addLedUpdate(makeClimb(20, 0), CLIMB_GAP_US);
+    uint8_t noise[] = {0x55, 0xAA, 0x00, 0x7F, 0x10, 0x20};
+    builder.add(CLIMB_GAP_US, BLECaptureDirection::APP_TO_BOARD, noise, sizeof(noise));
+    builder.addLedUpdate(makeClimb(20, 1), CLIMB_GAP_US);
+
+    AuroraProtocol protocol;
+    CaptureReplayer replayer(builder.bytes());
+    ReplayReport report;
+    replayer.run(protocolHandler(protocol), report);
+
+    TEST_ASSERT_EQUAL(2, report.updates);
+    TEST_ASSERT_TRUE(protocol.getStats().bytesDiscarded >= sizeof(noise));
+}
+
+void test_protocol_recovers_after_bad_checksum(void) {
+    std::vector<std::vector<uint8_t>> packets;
+    std::vector<LedCommand> climb = makeClimb(5, 0);
+    AuroraProtocol::encodeLedCommands(climb.data(), climb.size(), packets);
+    std::vector<uint8_t> corrupt = packets[0];
+    corrupt[2] ^= 0xFF;
+
+    CaptureBuilder builder;
+    builder.add(1000, BLECaptureDirection::APP_TO_BOARD, corrupt.data(), corrupt.size());
+    builder.addLedUpdate(climb, CLIMB_GAP_US);
+
+    AuroraProtocol protocol;
+    CaptureReplayer replayer(builder.bytes());
+    ReplayReport report;
+    replayer.run(protocolHandler(protocol), report);
+
+    TEST_ASSERT_EQUAL(1, report.updates);
+    TEST_ASSERT_EQUAL(1, protocol.getStats().checksumErrors);
+}
+
+// =============================================================================
+// NordicUartBLE Replay Tests
+// =============================================================================
+
+void test_nus_replay_updates_leds(void) {
+    std::vector<uint8_t> session = makeSession(4, 25);
+    CaptureReplayer replayer(session);
+    ReplayReport report;
+    replayer.run(nusHandler, report);
+
+    TEST_ASSERT_EQUAL(4, report.updates);
+    TEST_ASSERT_EQUAL(4, ledUpdateCount);
+    TEST_ASSERT_EQUAL(25, lastLedCount);
+}
+
+// =============================================================================
+// BLEProxy Replay Tests
+// =============================================================================
+
+void test_proxy_relays_app_writes_to_board(void) {
+    TEST_ASSERT_TRUE(bringUpProxy());
+    int writesBefore = boardCharacteristic(NUS_RX_CHARACTERISTIC)->getWriteCount();
+
+    std::vector<uint8_t> session = makeSession(3, 25);
+    CaptureReplayer replayer(session);
+    replayer.setTickHandler([]() { Proxy.loop(); }, 10);
+    ReplayReport report;
+    replayer.run(proxyHandler, report, millis());
+
+    TEST_ASSERT_EQUAL(3, report.updates);
+    TEST_ASSERT_EQUAL((int)report.appToBoardRecords,
+                      boardCharacteristic(NUS_RX_CHARACTERISTIC)->getWriteCount() - writesBefore);
+}
+
+void test_proxy_relays_board_notifications_to_app(void) {
+    TEST_ASSERT_TRUE(bringUpProxy());
+
+    std::vector<uint8_t> session = makeSession(3, 10);
+    CaptureReplayer replayer(session);
+    ReplayReport report;
+    replayer.run(proxyHandler, report, millis());
+
+    TEST_ASSERT_EQUAL(report.boardToAppBytes, bytesSentToApp);
+}
+
+// =============================================================================
+// Benchmark
+// =============================================================================
+
+static void runBenchmark(const char* label, const std::vector<uint8_t>& capture) {
+    Logger.enableSerial(false);
+
+    AuroraProtocol protocol;
+    CaptureReplayer protocolReplayer(capture);
+    configureReplayer(protocolReplayer);
+    ReplayReport report;
+    protocolReplayer.run(protocolHandler(protocol), report);
+    printReplayReport((std::string(label) + " / AuroraProtocol").c_str(), report);
+    const AuroraProtocolStats& stats = protocol.getStats();
+    printf("  resync:         %u frames, %u framing errors, %u checksum errors, %u bytes discarded\n",
+           stats.framesDecoded, stats.framingErrors, stats.checksumErrors, stats.bytesDiscarded);
+
+    CaptureReplayer nusReplayer(capture);
+    configureReplayer(nusReplayer);
+    nusReplayer.run(nusHandler, report);
+    printReplayReport((std::string(label) + " / NordicUartBLE").c_str(), report);
+
+    if (bringUpProxy()) {
+        CaptureReplayer proxyReplayer(capture);
+        configureReplayer(proxyReplayer);
+        proxyReplayer.setTickHandler([]() { Proxy.loop(); }, 10);
+        proxyReplayer.run(proxyHandler, report, millis());
+        printReplayReport((std::string(label) + " / BLEProxy").c_str(), report);
+    }
+
+    Logger.enableSerial(true);
+}
+
+void test_benchmark_replay(void) {
+    std::vector<uint8_t> session = makeSession(200, 40);
+    runBenchmark("synthetic 200 climbs", session);
+
+    const char* path = getenv("BLE_CAPTURE_FILE");
+    if (path) {
+        std::vector<uint8_t> capture;
+        TEST_ASSERT_TRUE(loadCaptureFile(path, capture));
+        runBenchmark(path, capture);
+    }
+}
+
+// =============================================================================
+// Main
+// =============================================================================
+
+int main(int argc, char** argv) {
+    // The replay paths share the global BLE server, proxy and board client
+    Preferences::resetAll();
+    Config.reset();
+    NimBLEDevice::mockReset();
+    NimBLEDevice::mockSetClientSetup(addNusService);
+    Coex.reset();
+    mockSetMillis(1000);
+    BLE.begin("Replay Test");
+    BLE.setLedDataCallback(onLedData);
+    BLE.setRawForwardCallback(onRawForward);
+
+    UNITY_BEGIN();
+
+    // Replayer tests
+    RUN_TEST(test_invalid_capture_is_rejected);
+    RUN_TEST(test_mock_clock_follows_recorded_timestamps);
+    RUN_TEST(test_tick_handler_runs_through_gaps);
+
+    // AuroraProtocol replay tests
+    RUN_TEST(test_protocol_replay_decodes_every_climb);
+    RUN_TEST(test_protocol_frame_latency_matches_write_spacing);
+    RUN_TEST(test_protocol_resyncs_after_garbage);
+    RUN_TEST(test_protocol_recovers_after_bad_checksum);
+
+    // NordicUartBLE replay tests
+    RUN_TEST(test_nus_replay_updates_leds);
+
+    // BLEProxy replay tests
+    RUN_TEST(test_proxy_relays_app_writes_to_board);
+    RUN_TEST(test_proxy_relays_board_notifications_to_app);
+
+    // Benchmark
+    RUN_TEST(test_benchmark_replay);
+
+    return UNITY_END();
+}
@@ -7,12 +7,24 @@
 #include <Preferences.h>
 
 #include <climb_history.h>
+#include <config_manager.h>
 #include <cstring>
 #include <unity.h>
 
+static void addNumbered(int first, int last) {
+    for (int i = first; i <= last; i++) {
+        char name[32];
+        char uuid[32];
+        snprintf(name, sizeof(name), "Climb %d", i);
+        snprintf(uuid, sizeof(uuid), "uuid-%d", i);
+        ClimbHistoryMgr.addClimb(name, "V1", uuid);
+    }
+}
+
 // Test instance (use the global ClimbHistoryMgr)
 void setUp(void) {
     Preferences::resetAll();  // Clear all mock storage between tests
+    Config.reset();           // Drop cached keys and wear stats
     ClimbHistoryMgr.clear();  // Clear history state
 }
 
@@ -95,20 +107,16 @@ void test_history_maintains_order(void) {
 }
 
 void test_history_limits_to_max(void) {
-    // Add more than MAX_CLIMB_HISTORY (5) climbs
-    for (int i = 0; i < 7; i++) {
-        char name[32];
-        char uuid[32];
-        snprintf(name, sizeof(name), "Climb %d", i);
-        snprintf(uuid, sizeof(uuid), "uuid-%d", i);
-        ClimbHistoryMgr.addClimb(name, "V1", uuid);
-    }
+    // Add two more than MAX_CLIMB_HISTORY climbs
+    addNumbered(0, MAX_CLIMB_HISTORY + 1);
 
     // Should only have MAX_CLIMB_HISTORY entries
     TEST_ASSERT_EQUAL(MAX_CLIMB_HISTORY, ClimbHistoryMgr.getCount());
 
-    // Most recent should be Climb 6
-    TEST_ASSERT_EQUAL_STRING("Climb 6", ClimbHistoryMgr.getClimb(0)->name);
+    // Most recent should be the last one added
+    char newest[32];
+    snprintf(newest, sizeof(newest), "Climb %d", MAX_CLIMB_HISTORY + 1);
+    TEST_ASSERT_EQUAL_STRING(newest, ClimbHistoryMgr.getClimb(0)->name);
 
     // Oldest in history should be Climb 2 (0 and 1 were pushed out)
     TEST_ASSERT_EQUAL_STRING("Climb 2", ClimbHistoryMgr.getClimb(MAX_CLIMB_HISTORY - 1)->name);
@@ -243,6 +251,124 @@ void test_clear_removes_all_history(void) {
     TEST_ASSERT_NULL(ClimbHistoryMgr.getCurrentClimb());
 }
 
+// =============================================================================
+// Persistence Tests
+// =============================================================================
+
+void test_reload_replays_newest_in_order(void) {
+    addNumbered(0, MAX_CLIMB_HISTORY + 2);
+
+    ClimbHistory reloaded;
+    reloaded.begin();
+
+    TEST_ASSERT_EQUAL(MAX_CLIMB_HISTORY, reloaded.getCount());
+    for (int i = 0; i < MAX_CLIMB_HISTORY; i++) {
+        TEST_ASSERT_EQUAL_STRING(ClimbHistoryMgr.getClimb(i)->name, reloaded.getClimb(i)->name);
+        TEST_ASSERT_EQUAL_STRING(ClimbHistoryMgr.getClimb(i)->uuid, reloaded.getClimb(i)->uuid);
+    }
+}
+
+void test_reload_has_no_current_climb(void) {
+    ClimbHistoryMgr.addClimb("Climb", "V1", "uuid-1");
+
+    ClimbHistory reloaded;
+    reloaded.begin();
+
+    TEST_ASSERT_EQUAL(1, reloaded.getCount());
+    TEST_ASSERT_FALSE(reloaded.hasCurrentClimb());
+    TEST_ASSERT_EQUAL_STRING("V1", reloaded.getClimb(0)->grade);
+}
+
+void test_each_climb_writes_one_record(void) {
+    ClimbHistoryMgr.addClimb("Climb 0", "V1", "uuid-0");
+    const ConfigWearStats& wear = Config.getWearStats();
+    uint32_t recordBytes = wear.bytesWritten;
+    TEST_ASSERT_EQUAL(1, wear.keysWritten);
+
+    // Cost per climb does not grow with the history, even once it wraps
+    addNumbered(1, MAX_CLIMB_HISTORY * 2);
+    TEST_ASSERT_EQUAL(MAX_CLIMB_HISTORY * 2 + 1, wear.keysWritten);
+    TEST_ASSERT_EQUAL(recordBytes * (MAX_CLIMB_HISTORY * 2 + 1), wear.bytesWritten);
+}
+
+void test_update_rewrites_current_record(void) {
+    ClimbHistoryMgr.addClimb("Original", "V3", "uuid-1");
+    ClimbHistoryMgr.addClimb("Updated", "V4", "uuid-1");
+
+    ClimbHistory reloaded;
+    reloaded.begin();
+
+    TEST_ASSERT_EQUAL(1, reloaded.getCount());
+    TEST_ASSERT_EQUAL_STRING("Updated", reloaded.getClimb(0)->name);
+    TEST_ASSERT_EQUAL_STRING("V4", reloaded.getClimb(0)->grade);
+}
+
+void test_unchanged_update_writes_nothing(void) {
+    ClimbHistoryMgr.addClimb("Climb", "V3", "uuid-1");
+    uint32_t written = Config.getWearStats().keysWritten;
+
+    ClimbHistoryMgr.addClimb("Climb", "V3", "uuid-1");
+    ClimbHistoryMgr.addClimb("Climb", nullptr, "uuid-1");
+
+    TEST_ASSERT_EQUAL(written, Config.getWearStats().keysWritten);
+}
+
+void test_corrupt_record_is_skipped(void) {
+    addNumbered(1, 3);
+
+    // Flip one byte of the middle climb's record
+    Preferences prefs;
+    prefs.begin(CONFIG_NAMESPACE, false);
+    uint8_t record[256];
+    size_t len = prefs.getBytes("ch_2", record, sizeof(record));
+    TEST_ASSERT_TRUE(len > 10);
+    record[10] ^= 0xFF;
+    prefs.putBytes("ch_2", record, len);
+    prefs.end();
+
+    ClimbHistory reloaded;
+    reloaded.begin();
+
+    TEST_ASSERT_EQUAL(2, reloaded.getCount());
+    TEST_ASSERT_EQUAL_STRING("Climb 3", reloaded.getClimb(0)->name);
+    TEST_ASSERT_EQUAL_STRING("Climb 1", reloaded.getClimb(1)->name);
+    TEST_ASSERT_NULL(reloaded.getClimb(2));
+}
+
+void test_sequence_continues_after_reload(void) {
+    addNumbered(1, 3);
+    ClimbHistoryMgr.load();
+
+    ClimbHistoryMgr.addClimb("Climb 4", "V1", "uuid-4");
+
+    ClimbHistory reloaded;
+    reloaded.begin();
+
+    TEST_ASSERT_EQUAL(4, reloaded.getCount());
+    TEST_ASSERT_EQUAL_STRING("Climb 4", reloaded.getClimb(0)->name);
+    TEST_ASSERT_EQUAL_STRING("Climb 1", reloaded.getClimb(3)->name);
+}
+
+void test_legacy_json_history_removed_on_load(void) {
+    Config.setString("climb_hist", "[{\"n\":\"Old\",\"g\":\"V1\",\"u\":\"uuid-old\"}]");
+    Config.flush();
+
+    ClimbHistoryMgr.load();
+
+    TEST_ASSERT_EQUAL(0, ClimbHistoryMgr.getCount());
+    TEST_ASSERT_FALSE(Config.hasKey("climb_hist"));
+}
+
+void test_clear_removes_records(void) {
+    addNumbered(1, 3);
+    ClimbHistoryMgr.clear();
+
+    ClimbHistory reloaded;
+    reloaded.begin();
+
+    TEST_ASSERT_EQUAL(0, reloaded.getCount());
+}
+
 // =============================================================================
 // Main
 // =============================================================================
@@ -284,5 +410,16 @@ int main(int argc, char** argv) {
     RUN_TEST(test_addClimb_truncates_long_name);
     RUN_TEST(test_clear_removes_all_history);
 
+    // Persistence tests
+    RUN_TEST(test_reload_replays_newest_in_order);
+    RUN_TEST(test_reload_has_no_current_climb);
+    RUN_TEST(test_each_climb_writes_one_record);
+    RUN_TEST(test_update_rewrites_current_record);
+    RUN_TEST(test_unchanged_update_writes_nothing);
+    RUN_TEST(test_corrupt_record_is_skipped);
+    RUN_TEST(test_sequence_continues_after_reload);
+    RUN_TEST(test_legacy_json_history_removed_on_load);
+    RUN_TEST(test_clear_removes_records);
+
     return UNITY_END();
 }
@@ -0,0 +1,564 @@
+/**
+ * Unit Tests for the Climb Journal
+ *
+ * Tests the block format, and the journal that records climbs into a ring
+ * of blocks and hands them out in upload batches.
+ */
+
+#include <Arduino.h>
+#include <Preferences.h>
+#include <unity.h>
+
+#include <climb_journal.h>
+#include <climb_journal_format.h>
+#include <config_manager.h>
+#include <string>
+#include <vector>
+
+/**
+ * Block storage in RAM that survives re-creating the journal, like flash
+ * survives a reboot.
+ */
+class RamStorage : public ClimbJournalStorage {
+  public:
+    std::vector<uint8_t> data;
+    int writes = 0;
+    bool failWrites = false;
+
+    bool begin(size_t size) override {
+        if (data.size() != size) {
+            data.assign(size, 0);
+        }
+        return true;
+    }
+    bool read(size_t offset, uint8_t* out, size_t len) override {
+        if (offset + len > data.size()) {
+            return false;
+        }
+        memcpy(out, data.data() + offset, len);
+        return true;
+    }
+    bool write(size_t offset, const uint8_t* in, size_t len) override {
+        if (failWrites || offset + len > data.size()) {
+            return false;
+        }
+        memcpy(data.data() + offset, in, len);
+        writes++;
+        return true;
+    }
+};
+
+static RamStorage* storage;
+static ClimbJournal* journal;
+static uint32_t clockSeconds;
+static char upload[8192];
+
+static uint32_t testClock() {
+    return clockSeconds;
+}
+
+// Simulate a reboot: a new journal over the same storage
+static void reboot() {
+    delete journal;
+    journal = new ClimbJournal();
+    journal->setClock(testClock);
+    journal->begin(storage);
+}
+
+static void showClimbs(int count, int first = 0) {
+    for (int i = 0; i < count; i++) {
+        char uuid[40];
+        snprintf(uuid, sizeof(uuid), "%032x", first + i + 1);
+        journal->climbShown(uuid, ClimbEventSource::BACKEND);
+        mockAdvanceMillis(1000);
+        journal->loop();
+    }
+}
+
+static int countOccurrences(const char* haystack, const char* needle) {
+    int count = 0;
+    for (const char* p = strstr(haystack, needle); p; p = strstr(p + 1, needle)) {
+        count++;
+    }
+    return count;
+}
+
+// Encode events into a block and return it
+static std::vector<uint8_t> makeBlock(const ClimbEvent* events, int count) {
+    std::vector<uint8_t> block(CLIMB_JOURNAL_BLOCK_SIZE, 0);
+    ClimbJournalBlockHeader header = {};
+    header.firstSeq = 10;
+    header.startUptimeMs = 5000;
+    header.bootId = 3;
+    for (int i = 0; i < count; i++) {
+        size_t n = ClimbJournalEncoder::encodeEvent(block.data() + CLIMB_JOURNAL_HEADER_SIZE + header.used,
+                                                    CLIMB_JOURNAL_BLOCK_SIZE - CLIMB_JOURNAL_HEADER_SIZE - header.used,
+                                                    events[i], 100);
+        header.used += n;
+        header.count++;
+    }
+    ClimbJournalEncoder::writeHeader(block.data(), header);
+    return block;
+}
+
+void setUp(void) {
+    Preferences::resetAll();
+    Config.reset();
+    mockSetMillis(1000);
+    clockSeconds = 0;
+    storage = new RamStorage();
+    journal = new ClimbJournal();
+    journal->setClock(testClock);
+    journal->begin(storage);
+}
+
+void tearDown(void) {
+    delete journal;
+    journal = nullptr;
+    delete storage;
+    storage = nullptr;
+}
+
+// =============================================================================
+// Format Tests
+// =============================================================================
+
+void test_hex_uuid_round_trips_packed(void) {
+    ClimbEvent event;
+    strcpy(event.uuid, "0123456789abcdef0123456789abcdef");
+    event.dwellMs = 300;
+    std::vector<uint8_t> block = makeBlock(&event, 1);
+
+    ClimbJournalReader reader(block.data(), block.size());
+    TEST_ASSERT_TRUE(reader.isValid());
+    // Flags, delta, 2-byte dwell, length, 16 packed bytes
+    TEST_ASSERT_EQUAL(21, reader.getHeader().used);
+
+    ClimbEvent decoded;
+    TEST_ASSERT_TRUE(reader.next(decoded));
+    TEST_ASSERT_EQUAL_STRING(event.uuid, decoded.uuid);
+    TEST_ASSERT_EQUAL(300, decoded.dwellMs);
+    TEST_ASSERT_EQUAL(10, decoded.seq);
+    TEST_ASSERT_EQUAL(3, decoded.bootId);
+    TEST_ASSERT_EQUAL(5100, decoded.uptimeMs);
+    TEST_ASSERT_FALSE(reader.next(decoded));
+}
+
+void test_dashed_and_upper_case_uuids_round_trip(void) {
+    ClimbEvent events[2];
+    strcpy(events[0].uuid, "123e4567-e89b-12d3-a456-426614174000");
+    events[0].type = ClimbEventType::NAVIGATED;
+    events[0].source = ClimbEventSource::DEVICE;
+    strcpy(events[1].uuid, "ABCDEF0123456789ABCDEF0123456789");
+    std::vector<uint8_t> block = makeBlock(events, 2);
+
+    ClimbJournalReader reader(block.data(), block.size());
+    ClimbEvent decoded;
+    TEST_ASSERT_TRUE(reader.next(decoded));
+    TEST_ASSERT_EQUAL_STRING(events[0].uuid, decoded.uuid);
+    TEST_ASSERT_TRUE(decoded.type == ClimbEventType::NAVIGATED);
+    TEST_ASSERT_TRUE(decoded.source == ClimbEventSource::DEVICE);
+    TEST_ASSERT_TRUE(reader.next(decoded));
+    TEST_ASSERT_EQUAL_STRING(events[1].uuid, decoded.uuid);
+    TEST_ASSERT_EQUAL(5200, decoded.uptimeMs);
+}
+
+void test_non_hex_uuid_stored_raw(void) {
+    ClimbEvent events[2];
+    strcpy(events[0].uuid, "climb-42_b");
+    strcpy(events[1].uuid, "AbCd");  // Mixed case cannot be packed
+    std::vector<uint8_t> block = makeBlock(events, 2);
+
+    ClimbJournalReader reader(block.data(), block.size());
+    ClimbEvent decoded;
+    TEST_ASSERT_TRUE(reader.next(decoded));
+    TEST_ASSERT_EQUAL_STRING("climb-42_b", decoded.uuid);
+    TEST_ASSERT_TRUE(reader.next(decoded));
+    TEST_ASSERT_EQUAL_STRING("AbCd", decoded.uuid);
+}
+
+void test_holds_round_trip(void) {
+    ClimbEvent event;
+    event.source = ClimbEventSource::BLE;
+    event.angle = 40;
+    event.holdCount = 3;
+    event.holds[0] = {5, 42};
+    event.holds[1] = {300, 43};
+    event.holds[2] = {301, 45};
+    std::vector<uint8_t> block = makeBlock(&event, 1);
+
+    ClimbJournalReader reader(block.data(), block.size());
+    ClimbEvent decoded;
+    TEST_ASSERT_TRUE(reader.next(decoded));
+    TEST_ASSERT_EQUAL_STRING("", decoded.uuid);
+    TEST_ASSERT_EQUAL(40, decoded.angle);
+    TEST_ASSERT_EQUAL(3, decoded.holdCount);
+    TEST_ASSERT_EQUAL(5, decoded.holds[0].position);
+    TEST_ASSERT_EQUAL(300, decoded.holds[1].position);
+    TEST_ASSERT_EQUAL(301, decoded.holds[2].position);
+    TEST_ASSERT_EQUAL(45, decoded.holds[2].role);
+}
+
+void test_reader_rejects_bad_blocks(void) {
+    ClimbEvent event;
+    std::vector<uint8_t> block = makeBlock(&event, 1);
+
+    std::vector<uint8_t> badMagic = block;
+    badMagic[0] = 'X';
+    TEST_ASSERT_FALSE(ClimbJournalReader(badMagic.data(), badMagic.size()).isValid());
+
+    std::vector<uint8_t> badVersion = block;
+    badVersion[2] = CLIMB_JOURNAL_VERSION + 1;
+    TEST_ASSERT_FALSE(ClimbJournalReader(badVersion.data(), badVersion.size()).isValid());
+
+    std::vector<uint8_t> erased(CLIMB_JOURNAL_BLOCK_SIZE, 0);
+    TEST_ASSERT_FALSE(ClimbJournalReader(erased.data(), erased.size()).isValid());
+}
+
+void test_reader_stops_at_truncated_event(void) {
+    ClimbEvent event;
+    strcpy(event.uuid, "0123456789abcdef0123456789abcdef");
+    std::vector<uint8_t> block = makeBlock(&event, 1);
+    // Claim one more event than the bytes hold
+    block[6] = 2;
+
+    ClimbJournalReader reader(block.data(), block.size());
+    ClimbEvent decoded;
+    TEST_ASSERT_TRUE(reader.next(decoded));
+    TEST_ASSERT_FALSE(reader.next(decoded));
+}
+
+// =============================================================================
+// Recording Tests
+// =============================================================================
+
+void test_begin_without_storage_is_a_no_op(void) {
+    ClimbJournal offline;
+    TEST_ASSERT_FALSE(offline.begin());
+    TEST_ASSERT_FALSE(offline.isReady());
+    offline.climbShown("abcd", ClimbEventSource::BACKEND);
+    offline.loop();
+    TEST_ASSERT_EQUAL(0, offline.getStats().eventsRecorded);
+}
+
+void test_events_are_staged_until_loop(void) {
+    journal->climbShown("abcd", ClimbEventSource::BACKEND);
+    TEST_ASSERT_EQUAL(0, journal->getPendingCount());
+    journal->loop();
+    TEST_ASSERT_EQUAL(1, journal->getPendingCount());
+    TEST_ASSERT_EQUAL(2, journal->getNextSeq());
+}
+
+void test_block_written_after_flush_delay(void) {
+    journal->climbShown("abcd", ClimbEventSource::BACKEND);
+    journal->loop();
+    TEST_ASSERT_EQUAL(0, storage->writes);
+
+    mockAdvanceMillis(CLIMB_JOURNAL_FLUSH_DELAY_MS - 1);
+    journal->climbShown("ef01", ClimbEventSource::BACKEND);
+    journal->loop();
+    TEST_ASSERT_EQUAL(0, storage->writes);
+
+    // One write covers both events
+    mockAdvanceMillis(1);
+    journal->loop();
+    TEST_ASSERT_EQUAL(1, storage->writes);
+    journal->loop();
+    TEST_ASSERT_EQUAL(1, storage->writes);
+}
+
+void test_repeated_climb_is_ignored(void) {
+    journal->climbShown("abcd", ClimbEventSource::BACKEND);
+    journal->climbShown("abcd", ClimbEventSource::BLE);
+    journal->loop();
+    TEST_ASSERT_EQUAL(1, journal->getPendingCount());
+}
+
+void test_clear_without_climb_is_ignored(void) {
+    journal->climbCleared(ClimbEventSource::BACKEND);
+    journal->loop();
+    TEST_ASSERT_EQUAL(0, journal->getPendingCount());
+}
+
+void test_dwell_time_recorded_on_next_event(void) {
+    journal->climbShown("aaaa", ClimbEventSource::BACKEND);
+    mockAdvanceMillis(42000);
+    journal->climbShown("bbbb", ClimbEventSource::BACKEND);
+    mockAdvanceMillis(7000);
+    journal->climbCleared(ClimbEventSource::BACKEND);
+    journal->loop();
+
+    TEST_ASSERT_EQUAL(3, journal->beginUpload(upload, sizeof(upload)));
+    TEST_ASSERT_NOT_NULL(strstr(upload, "\\\"dwell_ms\\\":0,\\\"climb_uuid\\\":\\\"aaaa\\\""));
+    TEST_ASSERT_NOT_NULL(strstr(upload, "\\\"dwell_ms\\\":42000,\\\"climb_uuid\\\":\\\"bbbb\\\""));
+    TEST_ASSERT_NOT_NULL(strstr(upload, "\"message\":\"climb_cleared\""));
+    TEST_ASSERT_NOT_NULL(strstr(upload, "\\\"dwell_ms\\\":7000"));
+}
+
+void test_navigation_keeps_current_climb(void) {
+    journal->climbShown("aaaa", ClimbEventSource::BACKEND);
+    journal->navigated("123e4567-e89b-12d3-a456-426614174000");
+    journal->climbShown("aaaa", ClimbEventSource::BACKEND);
+    journal->loop();
+
+    TEST_ASSERT_EQUAL(2, journal->beginUpload(upload, sizeof(upload)));
+    TEST_ASSERT_NOT_NULL(strstr(upload, "\"message\":\"queue_navigated\""));
+    TEST_ASSERT_NOT_NULL(strstr(upload, "\\\"queue_item_uuid\\\":\\\"123e4567-e89b-12d3-a456-426614174000\\\""));
+    TEST_ASSERT_NOT_NULL(strstr(upload, "\\\"source\\\":\\\"device\\\""));
+}
+
+void test_ble_climb_holds_sorted_and_deduplicated(void) {
+    ClimbJournalHold holds[] = {{300, 43}, {5, 42}, {120, 44}};
+    journal->bleClimbShown(holds, 3, 40);
+    ClimbJournalHold reordered[] = {{120, 44}, {300, 43}, {5, 42}};
+    journal->bleClimbShown(reordered, 3, 40);
+    journal->loop();
+
+    TEST_ASSERT_EQUAL(1, journal->beginUpload(upload, sizeof(upload)));
+    TEST_ASSERT_NOT_NULL(strstr(upload, "\\\"angle\\\":40,\\\"holds\\\":[[5,42],[120,44],[300,43]]"));
+    TEST_ASSERT_NOT_NULL(strstr(upload, "\\\"source\\\":\\\"ble\\\""));
+}
+
+void test_uuid_limited_to_safe_characters(void) {
+    journal->climbShown("ab\"c\\d", ClimbEventSource::BACKEND);
+    journal->loop();
+    journal->beginUpload(upload, sizeof(upload));
+    TEST_ASSERT_NOT_NULL(strstr(upload, "\\\"climb_uuid\\\":\\\"abcd\\\""));
+}
+
+void test_staging_overflow_counts_drops(void) {
+    showClimbs(0);
+    for (int i = 0; i < CLIMB_JOURNAL_STAGING + 2; i++) {
+        char uuid[8];
+        snprintf(uuid, sizeof(uuid), "%04x", i);
+        journal->climbShown(uuid, ClimbEventSource::BACKEND);
+    }
+    TEST_ASSERT_EQUAL(CLIMB_JOURNAL_STAGING, journal->getStats().eventsRecorded);
+    TEST_ASSERT_EQUAL(2, journal->getStats().eventsDropped);
+    journal->loop();
+    TEST_ASSERT_EQUAL(CLIMB_JOURNAL_STAGING, journal->getPendingCount());
+}
+
+// =============================================================================
+// Ring Tests
+// =============================================================================
+
+void test_sequence_numbers_continue_after_reboot(void) {
+    showClimbs(3);
+    journal->flush();
+    uint16_t firstBoot = journal->getBootId();
+    reboot();
+
+    TEST_ASSERT_EQUAL(4, journal->getNextSeq());
+    TEST_ASSERT_EQUAL(firstBoot + 1, journal->getBootId());
+    TEST_ASSERT_EQUAL(3, journal->getPendingCount());
+}
+
+void test_unflushed_events_lost_on_reboot(void) {
+    showClimbs(2);
+    journal->flush();
+    showClimbs(1, 2);
+    reboot();
+    TEST_ASSERT_EQUAL(3, journal->getNextSeq());
+}
+
+void test_reboot_starts_new_block(void) {
+    showClimbs(2);
+    journal->flush();
+    reboot();
+    showClimbs(2, 2);
+    journal->flush();
+
+    ClimbJournalReader first(storage->data.data(), CLIMB_JOURNAL_BLOCK_SIZE);
+    ClimbJournalReader second(storage->data.data() + CLIMB_JOURNAL_BLOCK_SIZE, CLIMB_JOURNAL_BLOCK_SIZE);
+    TEST_ASSERT_EQUAL(2, first.getHeader().count);
+    TEST_ASSERT_EQUAL(3, second.getHeader().firstSeq);
+    TEST_ASSERT_EQUAL(journal->getBootId(), second.getHeader().bootId);
+}
+
+void test_ring_overwrites_oldest_block(void) {
+    // About 20 events fill a block; fill more than the whole ring
+    int total = CLIMB_JOURNAL_BLOCK_COUNT * 25;
+    showClimbs(total);
+    journal->flush();
+
+    TEST_ASSERT_EQUAL(total + 1, journal->getNextSeq());
+    TEST_ASSERT_TRUE(journal->getPendingCount() < (uint32_t)total);
+    TEST_ASSERT_EQUAL(total - journal->getPendingCount(), journal->getStats().eventsDropped);
+
+    // The oldest surviving event is the first one offered
+    reboot();
+    uint32_t oldest = journal->getNextSeq() - journal->getPendingCount();
+    journal->beginUpload(upload, sizeof(upload));
+    char expected[32];
+    snprintf(expected, sizeof(expected), "{\\\"seq\\\":%u,", (unsigned)oldest);
+    TEST_ASSERT_NOT_NULL(strstr(upload, expected));
+}
+
+void test_write_failure_retried(void) {
+    showClimbs(1);
+    storage->failWrites = true;
+    journal->flush();
+    TEST_ASSERT_EQUAL(0, journal->getStats().blocksWritten);
+
+    storage->failWrites = false;
+    mockAdvanceMillis(CLIMB_JOURNAL_FLUSH_DELAY_MS);
+    journal->loop();
+    TEST_ASSERT_EQUAL(1, journal->getStats().blocksWritten);
+}
+
+// =============================================================================
+// Upload Tests
+// =============================================================================
+
+void test_upload_batch_format(void) {
+    clockSeconds = 1700000000;
+    showClimbs(2);
+
+    TEST_ASSERT_TRUE(journal->isUploadDue());
+    TEST_ASSERT_EQUAL(2, journal->beginUpload(upload, sizeof(upload)));
+    TEST_ASSERT_TRUE(journal->isUploadInFlight());
+    TEST_ASSERT_FALSE(journal->isUploadDue());
+
+    TEST_ASSERT_EQUAL(0, strncmp(upload, "{\"input\":{\"logs\":[{", 19));
+    TEST_ASSERT_EQUAL(0, strcmp(upload + strlen(upload) - 5, "\"}]}}"));
+    // Second event at uptime 2000 ms, dated from a clock read at uptime 3000 ms
+    TEST_ASSERT_NOT_NULL(strstr(upload, "\"ts\":1699999999000,"));
+    TEST_ASSERT_NOT_NULL(strstr(upload, "\"component\":\"climb-journal\""));
+    TEST_ASSERT_NOT_NULL(strstr(upload, "{\\\"seq\\\":1,"));
+    TEST_ASSERT_NOT_NULL(strstr(upload, "{\\\"seq\\\":2,"));
+    TEST_ASSERT_NULL(strstr(upload, "clock"));
+}
+
+void test_upload_without_clock_marks_timestamps(void) {
+    showClimbs(1);
+    journal->beginUpload(upload, sizeof(upload));
+    TEST_ASSERT_NOT_NULL(strstr(upload, "\"ts\":0,"));
+    TEST_ASSERT_NOT_NULL(strstr(upload, "\\\"clock\\\":\\\"upload\\\""));
+}
+
+void test_upload_limited_to_batch_size(void) {
+    showClimbs(CLIMB_JOURNAL_UPLOAD_BATCH + 5);
+    TEST_ASSERT_EQUAL(CLIMB_JOURNAL_UPLOAD_BATCH, journal->beginUpload(upload, sizeof(upload)));
+    journal->endUpload(true);
+    TEST_ASSERT_EQUAL(5, journal->getPendingCount());
+    TEST_ASSERT_EQUAL(5, journal->beginUpload(upload, sizeof(upload)));
+}
+
+void test_upload_limited_to_buffer(void) {
+    showClimbs(5);
+    char small[700];
+    int count = journal->beginUpload(small, sizeof(small));
+    TEST_ASSERT_TRUE(count > 0 && count < 5);
+    TEST_ASSERT_EQUAL(count, countOccurrences(small, "\"level\""));
+    TEST_ASSERT_EQUAL(0, strcmp(small + strlen(small) - 3, "]}}"));
+}
+
+void test_upload_spans_blocks(void) {
+    showClimbs(10);
+    journal->flush();
+    reboot();
+    showClimbs(4, 10);
+
+    TEST_ASSERT_EQUAL(14, journal->beginUpload(upload, sizeof(upload)));
+    TEST_ASSERT_NOT_NULL(strstr(upload, "{\\\"seq\\\":14,"));
+}
+
+void test_ack_persists_across_reboot(void) {
+    showClimbs(3);
+    journal->flush();
+    journal->beginUpload(upload, sizeof(upload));
+    journal->endUpload(true);
+    TEST_ASSERT_EQUAL(3, journal->getAckedSeq());
+    TEST_ASSERT_EQUAL(0, journal->getPendingCount());
+    TEST_ASSERT_EQUAL(3, journal->getStats().eventsUploaded);
+
+    reboot();
+    TEST_ASSERT_EQUAL(3, journal->getAckedSeq());
+    TEST_ASSERT_EQUAL(0, journal->getPendingCount());
+    TEST_ASSERT_EQUAL(0, journal->beginUpload(upload, sizeof(upload)));
+}
+
+void test_failed_upload_resends_same_events(void) {
+    showClimbs(2);
+    journal->beginUpload(upload, sizeof(upload));
+    std::string first = upload;
+    journal->endUpload(false);
+
+    TEST_ASSERT_EQUAL(1, journal->getStats().uploadFailures);
+    TEST_ASSERT_FALSE(journal->isUploadDue());
+    mockAdvanceMillis(CLIMB_JOURNAL_RETRY_MS);
+    TEST_ASSERT_TRUE(journal->isUploadDue());
+
+    journal->beginUpload(upload, sizeof(upload));
+    TEST_ASSERT_EQUAL_STRING(first.c_str(), upload);
+}
+
+void test_events_during_upload_wait_for_next_batch(void) {
+    showClimbs(2);
+    journal->beginUpload(upload, sizeof(upload));
+    showClimbs(1, 2);
+    journal->endUpload(true);
+
+    TEST_ASSERT_EQUAL(2, journal->getAckedSeq());
+    TEST_ASSERT_EQUAL(1, journal->getPendingCount());
+}
+
+void test_lost_journal_does_not_reuse_acked_numbers(void) {
+    showClimbs(3);
+    journal->beginUpload(upload, sizeof(upload));
+    journal->endUpload(true);
+
+    storage->data.assign(storage->data.size(), 0);
+    reboot();
+    TEST_ASSERT_EQUAL(4, journal->getNextSeq());
+    TEST_ASSERT_EQUAL(0, journal->getPendingCount());
+}
+
+// =============================================================================
+// Main
+// =============================================================================
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+
+    // Format tests
+    RUN_TEST(test_hex_uuid_round_trips_packed);
+    RUN_TEST(test_dashed_and_upper_case_uuids_round_trip);
+    RUN_TEST(test_non_hex_uuid_stored_raw);
+    RUN_TEST(test_holds_round_trip);
+    RUN_TEST(test_reader_rejects_bad_blocks);
+    RUN_TEST(test_reader_stops_at_truncated_event);
+
+    // Recording tests
+    RUN_TEST(test_begin_without_storage_is_a_no_op);
+    RUN_TEST(test_events_are_staged_until_loop);
+    RUN_TEST(test_block_written_after_flush_delay);
+    RUN_TEST(test_repeated_climb_is_ignored);
+    RUN_TEST(test_clear_without_climb_is_ignored);
+    RUN_TEST(test_dwell_time_recorded_on_next_event);
+    RUN_TEST(test_navigation_keeps_current_climb);
+    RUN_TEST(test_ble_climb_holds_sorted_and_deduplicated);
+    RUN_TEST(test_uuid_limited_to_safe_characters);
+    RUN_TEST(test_staging_overflow_counts_drops);
+
+    // Ring tests
+    RUN_TEST(test_sequence_numbers_continue_after_reboot);
+    RUN_TEST(test_unflushed_events_lost_on_reboot);
+    RUN_TEST(test_reboot_starts_new_block);
+    RUN_TEST(test_ring_overwrites_oldest_block);
+    RUN_TEST(test_write_failure_retried);
+
+    // Upload tests
+    RUN_TEST(test_upload_batch_format);
+    RUN_TEST(test_upload_without_clock_marks_timestamps);
+    RUN_TEST(test_upload_limited_to_batch_size);
+    RUN_TEST(test_upload_limited_to_buffer);
+    RUN_TEST(test_upload_spans_blocks);
+    RUN_TEST(test_ack_persists_across_reboot);
+    RUN_TEST(test_failed_upload_resends_same_events);
+    RUN_TEST(test_events_during_upload_wait_for_next_batch);
+    RUN_TEST(test_lost_journal_does_not_reuse_acked_numbers);
+
+    return UNITY_END();
+}
@@ -1,7 +1,8 @@
 /**
  * Unit Tests for Config Manager Library
  *
- * Tests the NVS (Non-Volatile Storage) configuration persistence layer.
+ * Tests the NVS (Non-Volatile Storage) configuration persistence layer,
+ * its RAM cache, write coalescing, change notifications and wear counters.
  */
 
 #include <Preferences.h>
@@ -351,6 +352,189 @@ void test_overwrite_different_type(void) {
     TEST_ASSERT_EQUAL(999, config->getInt("mixed"));
 }
 
+// =============================================================================
+// Cache and Write Coalescing Tests
+// =============================================================================
+
+static int changeCount = 0;
+static String lastChangedKey;
+
+static void onConfigChange(const char* key) {
+    changeCount++;
+    lastChangedKey = key ? key : "<all>";
+}
+
+static bool nvsHasKey(const char* key) {
+    Preferences nvs;
+    nvs.begin(CONFIG_NAMESPACE, true);
+    return nvs.isKey(key);
+}
+
+static int32_t nvsGetInt(const char* key) {
+    Preferences nvs;
+    nvs.begin(CONFIG_NAMESPACE, true);
+    return nvs.getInt(key, -1);
+}
+
+void test_set_is_not_written_until_settled(void) {
+    mockSetMillis(1000);
+    config->setInt("brightness", 100);
+    TEST_ASSERT_EQUAL(100, config->getInt("brightness"));
+    TEST_ASSERT_FALSE(nvsHasKey("brightness"));
+    TEST_ASSERT_TRUE(config->hasPendingWrites());
+
+    mockAdvanceMillis(CONFIG_COMMIT_DELAY_MS - 1);
+    config->loop();
+    TEST_ASSERT_FALSE(nvsHasKey("brightness"));
+
+    mockAdvanceMillis(1);
+    config->loop();
+    TEST_ASSERT_EQUAL(100, nvsGetInt("brightness"));
+    TEST_ASSERT_FALSE(config->hasPendingWrites());
+}
+
+void test_repeated_sets_coalesce_into_one_write(void) {
+    mockSetMillis(1000);
+    for (int i = 0; i < 10; i++) {
+        config->setInt("brightness", i);
+        mockAdvanceMillis(100);
+        config->loop();
+    }
+    mockAdvanceMillis(CONFIG_COMMIT_DELAY_MS);
+    config->loop();
+
+    const ConfigWearStats& wear = config->getWearStats();
+    TEST_ASSERT_EQUAL(1, wear.commits);
+    TEST_ASSERT_EQUAL(1, wear.keysWritten);
+    TEST_ASSERT_EQUAL(9, wear.writesCoalesced);
+    TEST_ASSERT_EQUAL(9, nvsGetInt("brightness"));
+}
+
+void test_continuous_changes_commit_by_max_delay(void) {
+    mockSetMillis(1000);
+    for (unsigned long t = 0; t < CONFIG_MAX_COMMIT_DELAY_MS; t += 500) {
+        config->setInt("brightness", (int32_t)t);
+        mockAdvanceMillis(500);
+        config->loop();
+    }
+    TEST_ASSERT_EQUAL(1, config->getWearStats().commits);
+}
+
+void test_unchanged_set_skips_write(void) {
+    config->setBool("proxy_en", true);
+    config->flush();
+    config->setBool("proxy_en", true);
+
+    TEST_ASSERT_FALSE(config->hasPendingWrites());
+    TEST_ASSERT_EQUAL(1, config->getWearStats().writesSkipped);
+    TEST_ASSERT_EQUAL(1, config->getWearStats().keysWritten);
+}
+
+void test_batch_commits_all_changed_keys(void) {
+    config->setString("backend_host", "example.com");
+    config->setInt("backend_port", 443);
+    config->setBool("proxy_en", true);
+    TEST_ASSERT_TRUE(config->flush());
+
+    TEST_ASSERT_EQUAL(1, config->getWearStats().commits);
+    TEST_ASSERT_EQUAL(3, config->getWearStats().keysWritten);
+    TEST_ASSERT_TRUE(nvsHasKey("backend_host"));
+    TEST_ASSERT_TRUE(nvsHasKey("proxy_en"));
+}
+
+void test_reads_hit_nvs_once_per_key(void) {
+    Preferences nvs;
+    nvs.begin(CONFIG_NAMESPACE, false);
+    nvs.putString("session_id", "abc");
+
+    for (int i = 0; i < 5; i++) {
+        TEST_ASSERT_EQUAL_STRING("abc", config->getCString("session_id"));
+    }
+    config->getString("missing");
+    config->getString("missing");
+    TEST_ASSERT_EQUAL(2, config->getWearStats().nvsReads);
+}
+
+void test_end_flushes_pending_writes(void) {
+    config->setInt("disp_mode", 1);
+    config->end();
+    TEST_ASSERT_EQUAL(1, nvsGetInt("disp_mode"));
+}
+
+void test_remove_drops_pending_write(void) {
+    config->setString("api_key", "secret");
+    config->remove("api_key");
+    TEST_ASSERT_FALSE(config->hasPendingWrites());
+    TEST_ASSERT_FALSE(config->hasKey("api_key"));
+    config->flush();
+    TEST_ASSERT_FALSE(nvsHasKey("api_key"));
+}
+
+void test_get_cstring_default_when_missing(void) {
+    TEST_ASSERT_EQUAL_STRING("fallback", config->getCString("missing", "fallback"));
+}
+
+void test_clear_restarts_commit_delay(void) {
+    mockSetMillis(1000);
+    config->setInt("brightness", 1);
+    config->clear();
+
+    // A change made long after clear() still waits to settle
+    mockAdvanceMillis(CONFIG_MAX_COMMIT_DELAY_MS);
+    config->setInt("brightness", 2);
+    config->loop();
+    TEST_ASSERT_FALSE(nvsHasKey("brightness"));
+
+    mockAdvanceMillis(CONFIG_COMMIT_DELAY_MS);
+    config->loop();
+    TEST_ASSERT_EQUAL(2, nvsGetInt("brightness"));
+}
+
+void test_change_listener_called_on_change_only(void) {
+    changeCount = 0;
+    TEST_ASSERT_TRUE(config->onChange(onConfigChange));
+
+    config->setInt("stall_ms", 40);
+    config->setInt("stall_ms", 40);
+    TEST_ASSERT_EQUAL(1, changeCount);
+    TEST_ASSERT_EQUAL_STRING("stall_ms", lastChangedKey.c_str());
+
+    config->clear();
+    TEST_ASSERT_EQUAL(2, changeCount);
+    TEST_ASSERT_EQUAL_STRING("<all>", lastChangedKey.c_str());
+}
+
+void test_listener_slots_are_bounded(void) {
+    for (int i = 0; i < CONFIG_MAX_LISTENERS; i++) {
+        TEST_ASSERT_TRUE(config->onChange(onConfigChange));
+    }
+    TEST_ASSERT_FALSE(config->onChange(onConfigChange));
+}
+
+void test_cache_full_writes_through(void) {
+    char key[8];
+    for (int i = 0; i < CONFIG_MAX_ENTRIES; i++) {
+        snprintf(key, sizeof(key), "k%d", i);
+        config->setInt(key, i);
+    }
+    config->setInt("overflow", 7);
+
+    TEST_ASSERT_EQUAL(7, nvsGetInt("overflow"));
+    TEST_ASSERT_EQUAL(7, config->getInt("overflow"));
+}
+
+void test_cache_full_cstring_reads_nvs(void) {
+    char key[8];
+    for (int i = 0; i < CONFIG_MAX_ENTRIES; i++) {
+        snprintf(key, sizeof(key), "k%d", i);
+        config->setInt(key, i);
+    }
+    config->setString("session_id", "abc");
+
+    TEST_ASSERT_EQUAL_STRING("abc", config->getCString("session_id"));
+    TEST_ASSERT_EQUAL_STRING("fallback", config->getCString("missing", "fallback"));
+}
+
 // =============================================================================
 // Main
 // =============================================================================
@@ -416,5 +600,21 @@ int main(int argc, char** argv) {
     RUN_TEST(test_different_keys_are_independent);
     RUN_TEST(test_overwrite_different_type);
 
+    // Cache and write coalescing tests
+    RUN_TEST(test_set_is_not_written_until_settled);
+    RUN_TEST(test_repeated_sets_coalesce_into_one_write);
+    RUN_TEST(test_continuous_changes_commit_by_max_delay);
+    RUN_TEST(test_unchanged_set_skips_write);
+    RUN_TEST(test_batch_commits_all_changed_keys);
+    RUN_TEST(test_reads_hit_nvs_once_per_key);
+    RUN_TEST(test_end_flushes_pending_writes);
+    RUN_TEST(test_remove_drops_pending_write);
+    RUN_TEST(test_get_cstring_default_when_missing);
+    RUN_TEST(test_clear_restarts_commit_delay);
+    RUN_TEST(test_change_listener_called_on_change_only);
+    RUN_TEST(test_listener_slots_are_bounded);
+    RUN_TEST(test_cache_full_writes_through);
+    RUN_TEST(test_cache_full_cstring_reads_nvs);
+
     return UNITY_END();
 }
@@ -8,6 +8,7 @@
 #include <Update.h>
 #include <WebServer.h>
 #include <esp_web_server.h>
+#include <web_ui.h>
 #include <wifi_utils.h>
 
 #include <config_manager.h>
@@ -25,6 +26,7 @@ void setUp(void) {
     s_handlerCalled = false;
     s_receivedBody = "";
     Preferences::resetAll();
+    Config.reset();
     WiFi.mockReset();
     ESP.mockReset();
     Update.mockReset();
@@ -516,6 +518,118 @@ void test_firmware_upload_passes_total_size_to_update(void) {
     TEST_ASSERT_TRUE(Update.wasBeginCalled());
 }
 
+// =============================================================================
+// Web UI Tests
+// =============================================================================
+
+void test_root_serves_gzipped_page_from_flash(void) {
+    webServer->begin();
+    webServer->getServer().mockRequest("/", HTTP_GET);
+
+    WebServer& server = webServer->getServer();
+    TEST_ASSERT_EQUAL(200, server.getLastResponseCode());
+    TEST_ASSERT_EQUAL_STRING("gzip", server.getLastHeaders().at("Content-Encoding").c_str());
+    TEST_ASSERT_EQUAL(WEB_UI_GZ_SIZE, server.getContentLength());
+    TEST_ASSERT_EQUAL(WEB_UI_GZ_SIZE, server.getLastResponseBody().size());
+    TEST_ASSERT_EQUAL_MEMORY(WEB_UI_GZ, server.getLastResponseBody().data(), WEB_UI_GZ_SIZE);
+
+    // gzip magic
+    TEST_ASSERT_EQUAL_UINT8(0x1f, WEB_UI_GZ[0]);
+    TEST_ASSERT_EQUAL_UINT8(0x8b, WEB_UI_GZ[1]);
+}
+
+void test_root_streams_in_chunks(void) {
+    webServer->begin();
+    webServer->getServer().mockRequest("/", HTTP_GET);
+
+    int expected = (WEB_UI_GZ_SIZE + WEB_UI_CHUNK_SIZE - 1) / WEB_UI_CHUNK_SIZE;
+    TEST_ASSERT_EQUAL(expected, webServer->getServer().getContentChunks());
+}
+
+void test_root_sends_cache_headers(void) {
+    webServer->begin();
+    webServer->getServer().mockRequest("/", HTTP_GET);
+
+    const std::map<std::string, std::string>& headers = webServer->getServer().getLastHeaders();
+    TEST_ASSERT_EQUAL_STRING(WEB_UI_ETAG, headers.at("ETag").c_str());
+    TEST_ASSERT_EQUAL_STRING("no-cache", headers.at("Cache-Control").c_str());
+}
+
+void test_begin_collects_if_none_match(void) {
+    webServer->begin();
+
+    const std::vector<std::string>& keys = webServer->getServer().getCollectedHeaders();
+    TEST_ASSERT_EQUAL(1, keys.size());
+    TEST_ASSERT_EQUAL_STRING("If-None-Match", keys[0].c_str());
+}
+
+void test_root_matching_etag_returns_304(void) {
+    webServer->begin();
+    webServer->getServer().mockSetRequestHeader("If-None-Match", WEB_UI_ETAG);
+    webServer->getServer().mockRequest("/", HTTP_GET);
+
+    TEST_ASSERT_EQUAL(304, webServer->getServer().getLastResponseCode());
+    TEST_ASSERT_EQUAL(0, webServer->getServer().getLastResponseBody().size());
+    TEST_ASSERT_EQUAL(0, webServer->getServer().getContentChunks());
+    TEST_ASSERT_EQUAL_STRING(WEB_UI_ETAG, webServer->getServer().getLastHeaders().at("ETag").c_str());
+}
+
+void test_root_stale_etag_returns_page(void) {
+    webServer->begin();
+    webServer->getServer().mockSetRequestHeader("If-None-Match", "\"0000000000000000\"");
+    webServer->getServer().mockRequest("/", HTTP_GET);
+
+    TEST_ASSERT_EQUAL(200, webServer->getServer().getLastResponseCode());
+    TEST_ASSERT_EQUAL(WEB_UI_GZ_SIZE, webServer->getServer().getLastResponseBody().size());
+}
+
+void test_web_ui_stats_count_serves(void) {
+    webServer->begin();
+    webServer->getServer().mockRequest("/", HTTP_GET);
+    webServer->getServer().mockRequest("/", HTTP_GET);
+    webServer->getServer().mockSetRequestHeader("If-None-Match", WEB_UI_ETAG);
+    webServer->getServer().mockRequest("/", HTTP_GET);
+
+    const WebUIStats& stats = webServer->getUIStats();
+    TEST_ASSERT_EQUAL(2, stats.pageServed);
+    TEST_ASSERT_EQUAL(1, stats.notModified);
+
+    webServer->getServer().mockRequest("/api/web/stats", HTTP_GET);
+    TEST_ASSERT_EQUAL(200, webServer->getServer().getLastResponseCode());
+    const std::string& body = webServer->getServer().getLastResponseBody();
+    TEST_ASSERT_TRUE(body.find("served") != std::string::npos);
+    TEST_ASSERT_TRUE(body.find("maxHeapDrop") != std::string::npos);
+    TEST_ASSERT_TRUE(body.find("lastLoadMs") != std::string::npos);
+}
+
+void test_web_timing_report_recorded(void) {
+    webServer->begin();
+    webServer->getServer().mockRequest("/api/web/timing", HTTP_POST,
+                                       "{\"loadMs\":850,\"responseMs\":120,\"transferBytes\":4951}");
+
+    TEST_ASSERT_EQUAL(200, webServer->getServer().getLastResponseCode());
+    const WebUIStats& stats = webServer->getUIStats();
+    TEST_ASSERT_EQUAL(1, stats.loadReports);
+    TEST_ASSERT_EQUAL(850, stats.lastLoadMs);
+    TEST_ASSERT_EQUAL(850, stats.maxLoadMs);
+    TEST_ASSERT_EQUAL(120, stats.lastResponseMs);
+    TEST_ASSERT_EQUAL(4951, stats.lastTransferBytes);
+}
+
+void test_web_timing_rejects_invalid_report(void) {
+    webServer->begin();
+    webServer->getServer().mockRequest("/api/web/timing", HTTP_POST, "{\"loadMs\":0}");
+    TEST_ASSERT_EQUAL(400, webServer->getServer().getLastResponseCode());
+
+    webServer->getServer().mockRequest("/api/web/timing", HTTP_POST, "{\"responseMs\":10}");
+    TEST_ASSERT_EQUAL(400, webServer->getServer().getLastResponseCode());
+
+    webServer->getServer().mockRequest("/api/web/timing", HTTP_POST, "not json");
+    TEST_ASSERT_EQUAL(400, webServer->getServer().getLastResponseCode());
+
+    TEST_ASSERT_EQUAL(0, webServer->getUIStats().loadReports);
+}
+
 // =============================================================================
 // Port Constant Test
 // =============================================================================
@@ -598,6 +712,17 @@ int main(int argc, char** argv) {
     RUN_TEST(test_firmware_upload_rejects_short_filename);
     RUN_TEST(test_firmware_upload_passes_total_size_to_update);
 
+    // Web UI tests
+    RUN_TEST(test_root_serves_gzipped_page_from_flash);
+    RUN_TEST(test_root_streams_in_chunks);
+    RUN_TEST(test_root_sends_cache_headers);
+    RUN_TEST(test_begin_collects_if_none_match);
+    RUN_TEST(test_root_matching_etag_returns_304);
+    RUN_TEST(test_root_stale_etag_returns_page);
+    RUN_TEST(test_web_ui_stats_count_serves);
+    RUN_TEST(test_web_timing_report_recorded);
+    RUN_TEST(test_web_timing_rejects_invalid_report);
+
     // Port constant test
     RUN_TEST(test_web_server_port_constant);
 
@@ -1,7 +1,8 @@
 /**
  * Unit Tests for Grade Colors Library
  *
- * Tests the V-grade color scheme functions for climbing grades.
+ * Tests the V-grade color scheme functions for climbing grades and the
+ * generated grade ID table behind them.
  * These are pure functions that require no hardware mocks.
  */
 
@@ -282,6 +283,63 @@ void test_text_color_on_default_gray_is_black(void) {
     TEST_ASSERT_EQUAL_UINT16(0x0000, textColor);  // Black (gray is light)
 }
 
+// =============================================================================
+// Grade Table Tests
+// =============================================================================
+
+void test_grade_id_every_key_resolves_to_its_id(void) {
+    // The generated hash must be perfect: each key finds itself
+    for (int i = 0; i < GRADE_KEY_COUNT; i++) {
+        TEST_ASSERT_EQUAL_UINT8(GRADE_KEYS[i].id, gradeIdLookup(GRADE_KEYS[i].key));
+    }
+}
+
+void test_grade_id_combined_font_and_v_share_one_id(void) {
+    uint8_t id = gradeIdFromString("6a+/V3");
+    TEST_ASSERT_TRUE(id != GRADE_ID_UNKNOWN);
+    TEST_ASSERT_EQUAL_UINT8(id, gradeIdFromString("6a+"));
+    TEST_ASSERT_EQUAL_STRING("6a+/V3", GRADE_INFO[id].name);
+    TEST_ASSERT_EQUAL_STRING("V3", getGradeLabelById(id));
+}
+
+void test_grade_id_lookup_is_case_insensitive(void) {
+    TEST_ASSERT_EQUAL_UINT8(gradeIdFromString("7b+/V8"), gradeIdFromString("7B+/v8"));
+    TEST_ASSERT_EQUAL_UINT8(gradeIdFromString("v12"), gradeIdFromString("V12"));
+}
+
+void test_grade_id_bare_v_grade_is_easiest_font_grade(void) {
+    TEST_ASSERT_EQUAL_UINT8(gradeIdFromString("6a/V3"), gradeIdFromString("V3"));
+    TEST_ASSERT_EQUAL_STRING("V17", getGradeLabelById(gradeIdFromString("V17")));
+}
+
+void test_grade_id_unlisted_strings_fall_back_to_parsing(void) {
+    // Not on the scale verbatim, but the V-grade or Font grade inside is
+    TEST_ASSERT_EQUAL_UINT8(gradeIdFromString("V5"), gradeIdFromString("V5+"));
+    TEST_ASSERT_EQUAL_UINT8(gradeIdFromString("V17"), gradeIdFromString("V20"));
+    TEST_ASSERT_EQUAL_UINT8(gradeIdFromString("7a"), gradeIdFromString("Font 7A"));
+}
+
+void test_grade_id_unknown_strings(void) {
+    TEST_ASSERT_EQUAL_UINT8(GRADE_ID_UNKNOWN, gradeIdFromString(nullptr));
+    TEST_ASSERT_EQUAL_UINT8(GRADE_ID_UNKNOWN, gradeIdFromString(""));
+    TEST_ASSERT_EQUAL_UINT8(GRADE_ID_UNKNOWN, gradeIdFromString("project"));
+    TEST_ASSERT_EQUAL_UINT8(GRADE_ID_UNKNOWN, gradeIdFromString("9a"));
+}
+
+void test_grade_id_colors_index_table(void) {
+    uint8_t id = gradeIdFromString("7c+/V10");
+    TEST_ASSERT_EQUAL_UINT16(COLOR_V10, getGradeColorById(id));
+    TEST_ASSERT_EQUAL_UINT16(0xFFFF, getGradeTextColorById(id));
+    TEST_ASSERT_EQUAL_UINT16(COLOR_GRADE_DEFAULT, getGradeColorById(GRADE_ID_UNKNOWN));
+    TEST_ASSERT_EQUAL_UINT16(COLOR_GRADE_DEFAULT, getGradeColorById(255));
+}
+
+void test_grade_id_text_colors_match_contrast_rule(void) {
+    for (int id = 0; id < GRADE_COUNT; id++) {
+        TEST_ASSERT_EQUAL_UINT16(getGradeTextColor(getGradeColorById(id)), getGradeTextColorById(id));
+    }
+}
+
 // =============================================================================
 // Main
 // =============================================================================
@@ -342,5 +400,15 @@ int main(int argc, char** argv) {
     RUN_TEST(test_text_color_on_black_is_white);
     RUN_TEST(test_text_color_on_default_gray_is_black);
 
+    // Grade table tests
+    RUN_TEST(test_grade_id_every_key_resolves_to_its_id);
+    RUN_TEST(test_grade_id_combined_font_and_v_share_one_id);
+    RUN_TEST(test_grade_id_lookup_is_case_insensitive);
+    RUN_TEST(test_grade_id_bare_v_grade_is_easiest_font_grade);
+    RUN_TEST(test_grade_id_unlisted_strings_fall_back_to_parsing);
+    RUN_TEST(test_grade_id_unknown_strings);
+    RUN_TEST(test_grade_id_colors_index_table);
+    RUN_TEST(test_grade_id_text_colors_match_contrast_rule);
+
     return UNITY_END();
 }
@@ -10,6 +10,7 @@
 #include <WebSocketsClient.h>
 #include <cstring>
 #include <graphql_ws_client.h>
+#include <radio_coex.h>
 #include <unity.h>
 
 // Access the global WebSocket mock through GraphQL client
@@ -33,8 +34,20 @@ void messageCallback(JsonDocument& doc) {
     messageCallbackCount++;
 }
 
+// Test operation callback tracking
+static int operationCallbackCount = 0;
+static bool lastOperationDataNull = false;
+
+void operationCallback(const char* operationId, JsonObject data) {
+    (void)operationId;
+    lastOperationDataNull = data.isNull();
+    operationCallbackCount++;
+}
+
 void setUp(void) {
     Preferences::resetAll();
+    operationCallbackCount = 0;
+    lastOperationDataNull = false;
     lastCallbackState = GraphQLConnectionState::DISCONNECTED;
     stateCallbackCount = 0;
     messageCallbackCount = 0;
@@ -186,6 +199,27 @@ void test_loop_maintains_state_when_connecting(void) {
     TEST_ASSERT_EQUAL(GraphQLConnectionState::CONNECTING, client->getState());
 }
 
+void test_silent_reconnect_attempts_are_marked_as_handshakes(void) {
+    mockSetMillis(1000);
+    Coex.reset();
+    client->begin("test.host.com", 443, "/graphql", nullptr);
+    TEST_ASSERT_TRUE(Coex.isActive(CoexActivity::WIFI_HANDSHAKE));
+
+    // The attempt failed without an event: free the radio after the hold
+    mockAdvanceMillis(WS_HANDSHAKE_HOLD_MS);
+    client->loop();
+    TEST_ASSERT_FALSE(Coex.isActive(CoexActivity::WIFI_HANDSHAKE));
+
+    // WebSocketsClient retries on its own after the reconnect interval
+    mockAdvanceMillis(WS_RECONNECT_INTERVAL - WS_HANDSHAKE_HOLD_MS);
+    client->loop();
+    TEST_ASSERT_TRUE(Coex.isActive(CoexActivity::WIFI_HANDSHAKE));
+
+    client->disconnect();
+    TEST_ASSERT_FALSE(Coex.isActive(CoexActivity::WIFI_HANDSHAKE));
+    mockSetMillis(0);
+}
+
 // =============================================================================
 // Subscribe Tests
 // =============================================================================
@@ -303,6 +337,62 @@ void test_send_led_positions_repeated_calls_preserve_state(void) {
     TEST_ASSERT_EQUAL(GraphQLConnectionState::SUBSCRIBED, client->getState());
 }
 
+// =============================================================================
+// Operation Tests
+// =============================================================================
+
+void test_send_operation_rejected_when_not_connected(void) {
+    client->begin("test.host.com", 443, "/graphql", nullptr);
+    TEST_ASSERT_FALSE(client->sendOperation("op", "mutation { test }", nullptr, operationCallback));
+    TEST_ASSERT_FALSE(client->isOperationPending());
+}
+
+void test_send_operation_pending_until_result(void) {
+    client->begin("test.host.com", 443, "/graphql", nullptr);
+    client->subscribe("test-sub", "subscription { test }", nullptr);
+    TEST_ASSERT_TRUE(client->sendOperation("op", "mutation Test($input: In!) { test(input: $input) }",
+                                           "{\"input\":{\"logs\":[]}}", operationCallback));
+    TEST_ASSERT_TRUE(client->isOperationPending());
+    TEST_ASSERT_EQUAL(0, operationCallbackCount);
+    // Independent of sendMutation()
+    TEST_ASSERT_FALSE(client->isMutationInFlight());
+}
+
+void test_second_operation_rejected_while_pending(void) {
+    client->begin("test.host.com", 443, "/graphql", nullptr);
+    client->subscribe("test-sub", "subscription { test }", nullptr);
+    TEST_ASSERT_TRUE(client->sendOperation("op1", "mutation { test }", nullptr, operationCallback));
+    TEST_ASSERT_FALSE(client->sendOperation("op2", "mutation { test }", nullptr, operationCallback));
+}
+
+void test_disconnect_fails_pending_operation(void) {
+    client->begin("test.host.com", 443, "/graphql", nullptr);
+    client->subscribe("test-sub", "subscription { test }", nullptr);
+    client->sendOperation("op", "mutation { test }", nullptr, operationCallback);
+
+    client->disconnect();
+    TEST_ASSERT_EQUAL(1, operationCallbackCount);
+    TEST_ASSERT_TRUE(lastOperationDataNull);
+    TEST_ASSERT_FALSE(client->isOperationPending());
+}
+
+void test_operation_times_out(void) {
+    mockSetMillis(1000);
+    client->begin("test.host.com", 443, "/graphql", nullptr);
+    client->subscribe("test-sub", "subscription { test }", nullptr);
+    client->sendOperation("op", "mutation { test }", nullptr, operationCallback);
+
+    mockAdvanceMillis(GQL_OPERATION_TIMEOUT_MS);
+    client->loop();
+    TEST_ASSERT_EQUAL(0, operationCallbackCount);
+
+    mockAdvanceMillis(1);
+    client->loop();
+    TEST_ASSERT_EQUAL(1, operationCallbackCount);
+    TEST_ASSERT_TRUE(lastOperationDataNull);
+    TEST_ASSERT_TRUE(client->sendOperation("op", "mutation { test }", nullptr, operationCallback));
+}
+
 // =============================================================================
 // State Transitions Tests
 // =============================================================================
@@ -376,6 +466,7 @@ int main(int argc, char** argv) {
     // Loop behavior tests
     RUN_TEST(test_loop_maintains_state_when_disconnected);
     RUN_TEST(test_loop_maintains_state_when_connecting);
+    RUN_TEST(test_silent_reconnect_attempts_are_marked_as_handshakes);
 
     // Subscribe tests
     RUN_TEST(test_subscribe_changes_state_to_subscribed);
@@ -394,6 +485,13 @@ int main(int argc, char** argv) {
     RUN_TEST(test_send_led_positions_handles_empty_array);
     RUN_TEST(test_send_led_positions_repeated_calls_preserve_state);
 
+    // Operation tests
+    RUN_TEST(test_send_operation_rejected_when_not_connected);
+    RUN_TEST(test_send_operation_pending_until_result);
+    RUN_TEST(test_second_operation_rejected_while_pending);
+    RUN_TEST(test_disconnect_fails_pending_operation);
+    RUN_TEST(test_operation_times_out);
+
     // State transition tests
     RUN_TEST(test_multiple_state_transitions);
 
@@ -0,0 +1,189 @@
+/**
+ * Unit Tests for the Incremental Hold Overlay
+ *
+ * Tests the diff between the hold circles on screen and the next climb's
+ * circles: which background rects are restored and which circles are drawn.
+ */
+
+#include <Arduino.h>
+
+#include <hold_overlay.h>
+#include <unity.h>
+#include <vector>
+
+static HoldOverlay overlay;
+
+static HoldCircle circle(uint16_t position, int16_t x, int16_t y, uint16_t color, int16_t radius = 10) {
+    HoldCircle c;
+    c.position = position;
+    c.x = x;
+    c.y = y;
+    c.radius = radius;
+    c.innerRadius = radius - 3;
+    c.color = color;
+    return c;
+}
+
+// Apply an update and return the positions drawn
+static std::vector<uint16_t> apply(std::vector<HoldCircle> next) {
+    overlay.update(next.data(), (int)next.size());
+    std::vector<uint16_t> drawn;
+    for (int i = 0; i < overlay.drawCount(); i++) {
+        drawn.push_back(next[overlay.drawIndex(i)].position);
+    }
+    return drawn;
+}
+
+void setUp(void) {
+    overlay.reset();
+}
+
+void tearDown(void) {}
+
+// =============================================================================
+// Full Draw Tests
+// =============================================================================
+
+void test_first_update_draws_every_circle(void) {
+    std::vector<uint16_t> drawn = apply({circle(5, 100, 100, 0xF800), circle(2, 200, 100, 0x07E0)});
+    TEST_ASSERT_EQUAL(2, (int)drawn.size());
+    TEST_ASSERT_EQUAL(0, overlay.restoreCount());
+    TEST_ASSERT_EQUAL(2, overlay.circleCount());
+}
+
+void test_circles_are_drawn_in_position_order(void) {
+    std::vector<uint16_t> drawn = apply({circle(9, 100, 100, 1), circle(3, 200, 100, 1), circle(6, 300, 100, 1)});
+    TEST_ASSERT_EQUAL(3, drawn[0]);
+    TEST_ASSERT_EQUAL(6, drawn[1]);
+    TEST_ASSERT_EQUAL(9, drawn[2]);
+}
+
+void test_reset_forgets_circles_on_screen(void) {
+    apply({circle(1, 100, 100, 1)});
+    overlay.reset();
+    std::vector<uint16_t> drawn = apply({circle(1, 100, 100, 1)});
+    TEST_ASSERT_EQUAL(1, (int)drawn.size());
+    TEST_ASSERT_EQUAL(0, overlay.restoreCount());
+}
+
+// =============================================================================
+// Incremental Update Tests
+// =============================================================================
+
+void test_identical_climb_draws_nothing(void) {
+    apply({circle(1, 100, 100, 1), circle(2, 200, 100, 2)});
+    std::vector<uint16_t> drawn = apply({circle(2, 200, 100, 2), circle(1, 100, 100, 1)});
+    TEST_ASSERT_EQUAL(0, (int)drawn.size());
+    TEST_ASSERT_EQUAL(0, overlay.restoreCount());
+    TEST_ASSERT_EQUAL_UINT32(0, overlay.lastRestoredPixels());
+}
+
+void test_removed_hold_restores_its_bounds(void) {
+    apply({circle(1, 100, 100, 1), circle(2, 200, 100, 2)});
+    std::vector<uint16_t> drawn = apply({circle(1, 100, 100, 1)});
+    TEST_ASSERT_EQUAL(0, (int)drawn.size());
+    TEST_ASSERT_EQUAL(1, overlay.restoreCount());
+    TEST_ASSERT_TRUE(overlay.restoreRect(0) == WidgetRect(190, 90, 21, 21));
+    TEST_ASSERT_EQUAL_UINT32(21 * 21, overlay.lastRestoredPixels());
+}
+
+void test_added_hold_is_drawn_without_restore(void) {
+    apply({circle(1, 100, 100, 1)});
+    std::vector<uint16_t> drawn = apply({circle(1, 100, 100, 1), circle(7, 300, 300, 3)});
+    TEST_ASSERT_EQUAL(1, (int)drawn.size());
+    TEST_ASSERT_EQUAL(7, drawn[0]);
+    TEST_ASSERT_EQUAL(0, overlay.restoreCount());
+}
+
+void test_color_change_redraws_without_restore(void) {
+    apply({circle(1, 100, 100, 0xF800)});
+    std::vector<uint16_t> drawn = apply({circle(1, 100, 100, 0x001F)});
+    TEST_ASSERT_EQUAL(1, (int)drawn.size());
+    TEST_ASSERT_EQUAL(0, overlay.restoreCount());
+}
+
+void test_shape_change_restores_and_redraws(void) {
+    apply({circle(1, 100, 100, 1, 10)});
+    std::vector<uint16_t> drawn = apply({circle(1, 100, 100, 1, 6)});
+    TEST_ASSERT_EQUAL(1, (int)drawn.size());
+    TEST_ASSERT_EQUAL(1, overlay.restoreCount());
+}
+
+void test_kept_neighbour_of_removed_hold_is_redrawn(void) {
+    // Holds 1 and 2 overlap; removing 2 restores background over part of 1
+    apply({circle(1, 100, 100, 1), circle(2, 112, 100, 2), circle(3, 400, 400, 3)});
+    std::vector<uint16_t> drawn = apply({circle(1, 100, 100, 1), circle(3, 400, 400, 3)});
+    TEST_ASSERT_EQUAL(1, (int)drawn.size());
+    TEST_ASSERT_EQUAL(1, drawn[0]);
+}
+
+void test_kept_circle_above_changed_circle_is_redrawn(void) {
+    // Hold 2 sits on top of hold 1; recolouring 1 must not cover 2
+    apply({circle(1, 100, 100, 1), circle(2, 112, 100, 2)});
+    std::vector<uint16_t> drawn = apply({circle(1, 100, 100, 9), circle(2, 112, 100, 2)});
+    TEST_ASSERT_EQUAL(2, (int)drawn.size());
+    TEST_ASSERT_EQUAL(1, drawn[0]);
+    TEST_ASSERT_EQUAL(2, drawn[1]);
+}
+
+void test_switching_climbs_touches_only_changed_holds(void) {
+    std::vector<HoldCircle> first;
+    std::vector<HoldCircle> second;
+    for (int i = 0; i < 20; i++) {
+        first.push_back(circle(i, 30 + i * 40, 100, 1));
+        second.push_back(circle(i, 30 + i * 40, 100, 1));
+    }
+    // Swap two far-apart holds for two new ones
+    second.erase(second.begin() + 15);
+    second.erase(second.begin() + 5);
+    second.push_back(circle(100, 30, 400, 2));
+    second.push_back(circle(101, 600, 400, 2));
+
+    apply(first);
+    std::vector<uint16_t> drawn = apply(second);
+    TEST_ASSERT_EQUAL(2, overlay.restoreCount());
+    TEST_ASSERT_EQUAL(2, (int)drawn.size());
+    TEST_ASSERT_EQUAL(100, drawn[0]);
+    TEST_ASSERT_EQUAL(101, drawn[1]);
+    TEST_ASSERT_EQUAL(20, overlay.circleCount());
+}
+
+void test_clearing_all_holds_restores_each(void) {
+    apply({circle(1, 100, 100, 1), circle(2, 300, 100, 2), circle(3, 500, 100, 3)});
+    std::vector<uint16_t> drawn = apply({});
+    TEST_ASSERT_EQUAL(0, (int)drawn.size());
+    TEST_ASSERT_EQUAL(3, overlay.restoreCount());
+    TEST_ASSERT_EQUAL(0, overlay.circleCount());
+}
+
+void test_count_is_capped(void) {
+    std::vector<HoldCircle> many;
+    for (int i = 0; i < HOLD_OVERLAY_MAX_CIRCLES + 10; i++) {
+        many.push_back(circle(i, (i % 40) * 20, (i / 40) * 20, 1));
+    }
+    apply(many);
+    TEST_ASSERT_EQUAL(HOLD_OVERLAY_MAX_CIRCLES, overlay.circleCount());
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+
+    // Full draw tests
+    RUN_TEST(test_first_update_draws_every_circle);
+    RUN_TEST(test_circles_are_drawn_in_position_order);
+    RUN_TEST(test_reset_forgets_circles_on_screen);
+
+    // Incremental update tests
+    RUN_TEST(test_identical_climb_draws_nothing);
+    RUN_TEST(test_removed_hold_restores_its_bounds);
+    RUN_TEST(test_added_hold_is_drawn_without_restore);
+    RUN_TEST(test_color_change_redraws_without_restore);
+    RUN_TEST(test_shape_change_restores_and_redraws);
+    RUN_TEST(test_kept_neighbour_of_removed_hold_is_redrawn);
+    RUN_TEST(test_kept_circle_above_changed_circle_is_redrawn);
+    RUN_TEST(test_switching_climbs_touches_only_changed_holds);
+    RUN_TEST(test_clearing_all_holds_restores_each);
+    RUN_TEST(test_count_is_capped);
+
+    return UNITY_END();
+}
@@ -0,0 +1,211 @@
+/**
+ * Unit Tests for Kinetic Scrolling
+ *
+ * Tests tap versus drag detection, drag tracking and clamping, and the
+ * exponentially decaying fling used by the landscape queue panel.
+ */
+
+#include <Arduino.h>
+
+#include <kinetic_scroll.h>
+#include <unity.h>
+
+static KineticScroll scroll;
+
+// Drag from y0 to y1 in 10 px steps every 10 ms, returning the end time
+static uint32_t drag(int16_t y0, int16_t y1, uint32_t startMs) {
+    uint32_t t = startMs;
+    scroll.press(y0, t);
+    int16_t step = y1 > y0 ? 10 : -10;
+    for (int16_t y = y0; y != y1; y += step) {
+        t += 10;
+        scroll.move(y + step, t);
+    }
+    return t;
+}
+
+// Step a fling until it settles, returning the settle time
+static uint32_t settle(uint32_t t) {
+    while (scroll.isFlinging() && t < 60000) {
+        t += 16;
+        scroll.step(t);
+    }
+    return t;
+}
+
+void setUp(void) {
+    scroll = KineticScroll();
+    // 150 rows of 48 px in a 416 px viewport
+    scroll.setExtent(150 * 48, 416);
+}
+
+void tearDown(void) {}
+
+// =============================================================================
+// Extent Tests
+// =============================================================================
+
+void test_extent_sets_max_offset(void) {
+    TEST_ASSERT_EQUAL(0, scroll.offset());
+    TEST_ASSERT_EQUAL(150 * 48 - 416, scroll.maxOffset());
+}
+
+void test_short_content_cannot_scroll(void) {
+    scroll.setExtent(300, 416);
+    TEST_ASSERT_EQUAL(0, scroll.maxOffset());
+    scroll.scrollTo(100);
+    TEST_ASSERT_EQUAL(0, scroll.offset());
+}
+
+void test_shrinking_extent_clamps_offset(void) {
+    scroll.scrollTo(5000);
+    scroll.setExtent(1000, 416);
+    TEST_ASSERT_EQUAL(584, scroll.offset());
+}
+
+// =============================================================================
+// Drag Tests
+// =============================================================================
+
+void test_small_movement_is_a_tap(void) {
+    scroll.press(200, 0);
+    TEST_ASSERT_FALSE(scroll.move(205, 10));
+    TEST_ASSERT_FALSE(scroll.isDragging());
+    TEST_ASSERT_TRUE(scroll.release(20));
+    TEST_ASSERT_EQUAL(0, scroll.offset());
+}
+
+void test_drag_follows_finger_after_slop(void) {
+    scroll.press(300, 0);
+    scroll.move(280, 10);  // Crosses the slop; tracking starts here
+    TEST_ASSERT_TRUE(scroll.isDragging());
+    TEST_ASSERT_EQUAL(0, scroll.offset());
+
+    TEST_ASSERT_TRUE(scroll.move(200, 20));
+    TEST_ASSERT_EQUAL(80, scroll.offset());
+    TEST_ASSERT_TRUE(scroll.move(250, 30));
+    TEST_ASSERT_EQUAL(30, scroll.offset());
+    TEST_ASSERT_FALSE(scroll.release(200));
+}
+
+void test_drag_clamps_at_both_ends(void) {
+    scroll.press(100, 0);
+    scroll.move(130, 10);
+    scroll.move(400, 20);
+    TEST_ASSERT_EQUAL(0, scroll.offset());
+
+    scroll.release(500);
+    scroll.scrollTo(scroll.maxOffset());
+    scroll.press(400, 1000);
+    scroll.move(370, 1010);
+    TEST_ASSERT_FALSE(scroll.move(100, 1020));
+    TEST_ASSERT_EQUAL(scroll.maxOffset(), scroll.offset());
+}
+
+// =============================================================================
+// Fling Tests
+// =============================================================================
+
+void test_fast_release_flings_and_settles(void) {
+    // 1 px/ms upward drag
+    uint32_t t = drag(400, 100, 0);
+    int32_t released = scroll.offset();
+    TEST_ASSERT_FALSE(scroll.release(t));
+    TEST_ASSERT_TRUE(scroll.isFlinging());
+
+    TEST_ASSERT_TRUE(scroll.step(t + 16));
+    TEST_ASSERT_TRUE(scroll.offset() > released);
+
+    settle(t);
+    TEST_ASSERT_FALSE(scroll.isFlinging());
+    // Total travel is velocity * time constant
+    int32_t travel = scroll.offset() - released;
+    TEST_ASSERT_TRUE(travel > 300 && travel < 340);
+}
+
+void test_fling_slows_down(void) {
+    uint32_t t = drag(400, 100, 0);
+    scroll.release(t);
+
+    scroll.step(t + 100);
+    int32_t first = scroll.offset();
+    scroll.step(t + 200);
+    int32_t second = scroll.offset();
+    scroll.step(t + 300);
+    int32_t third = scroll.offset();
+    TEST_ASSERT_TRUE(third - second < second - first);
+}
+
+void test_fling_stops_at_edge(void) {
+    scroll.scrollTo(100);
+    uint32_t t = drag(100, 400, 0);  // Downward drag scrolls towards the start
+    scroll.release(t);
+    settle(t);
+    TEST_ASSERT_EQUAL(0, scroll.offset());
+    TEST_ASSERT_FALSE(scroll.isFlinging());
+}
+
+void test_resting_finger_cancels_fling(void) {
+    uint32_t t = drag(400, 100, 0);
+    scroll.move(100, t + 100);
+    TEST_ASSERT_FALSE(scroll.release(t + 100));
+    TEST_ASSERT_FALSE(scroll.isFlinging());
+}
+
+void test_slow_drag_does_not_fling(void) {
+    scroll.press(300, 0);
+    uint32_t t = 0;
+    for (int16_t y = 288; y >= 240; y -= 2) {
+        t += 20;  // 0.1 px/ms
+        scroll.move(y, t);
+    }
+    scroll.release(t);
+    TEST_ASSERT_FALSE(scroll.isFlinging());
+}
+
+void test_press_catches_fling_without_tapping(void) {
+    uint32_t t = drag(400, 100, 0);
+    scroll.release(t);
+    scroll.step(t + 50);
+    int32_t caught = scroll.offset();
+
+    scroll.press(200, t + 60);
+    TEST_ASSERT_FALSE(scroll.isFlinging());
+    TEST_ASSERT_FALSE(scroll.step(t + 100));
+    TEST_ASSERT_FALSE(scroll.release(t + 120));
+    TEST_ASSERT_EQUAL(caught, scroll.offset());
+}
+
+void test_scroll_to_stops_fling(void) {
+    uint32_t t = drag(400, 100, 0);
+    scroll.release(t);
+    scroll.scrollTo(48 * 10);
+    TEST_ASSERT_FALSE(scroll.isFlinging());
+    TEST_ASSERT_FALSE(scroll.step(t + 16));
+    TEST_ASSERT_EQUAL(480, scroll.offset());
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+
+    // Extent tests
+    RUN_TEST(test_extent_sets_max_offset);
+    RUN_TEST(test_short_content_cannot_scroll);
+    RUN_TEST(test_shrinking_extent_clamps_offset);
+
+    // Drag tests
+    RUN_TEST(test_small_movement_is_a_tap);
+    RUN_TEST(test_drag_follows_finger_after_slop);
+    RUN_TEST(test_drag_clamps_at_both_ends);
+
+    // Fling tests
+    RUN_TEST(test_fast_release_flings_and_settles);
+    RUN_TEST(test_fling_slows_down);
+    RUN_TEST(test_fling_stops_at_edge);
+    RUN_TEST(test_resting_finger_cancels_fling);
+    RUN_TEST(test_slow_drag_does_not_fling);
+    RUN_TEST(test_press_catches_fling_without_tapping);
+    RUN_TEST(test_scroll_to_stops_fling);
+
+    return UNITY_END();
+}
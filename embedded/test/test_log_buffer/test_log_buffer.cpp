@@ -5,9 +5,12 @@
  * for later retrieval (e.g., via web interface).
  */
 
+#include <atomic>
 #include <cstring>
 #include <log_buffer.h>
+#include <thread>
 #include <unity.h>
+#include <vector>
 
 // Test instance - use a fresh instance for each test
 static LogBuffer* logger;
@@ -342,6 +345,194 @@ void test_clear_after_wrap(void) {
     TEST_ASSERT_EQUAL_STRING("Fresh start", logger->getBuffer().c_str());
 }
 
+// =============================================================================
+// Deferred Formatting Tests
+// =============================================================================
+
+void test_log_defers_formatting_until_drain(void) {
+    logger->logln("Deferred %d", 1);
+    TEST_ASSERT_TRUE(logger->getPendingBytes() > 0);
+
+    TEST_ASSERT_EQUAL(1, logger->drain());
+    TEST_ASSERT_EQUAL(0, logger->getPendingBytes());
+    TEST_ASSERT_EQUAL_STRING("Deferred 1\n", logger->getBuffer().c_str());
+}
+
+void test_synchronous_mode_drains_on_log(void) {
+    logger->logln("Queued");
+    logger->setSynchronous(true);
+    TEST_ASSERT_EQUAL(0, logger->getPendingBytes());
+
+    logger->logln("Boot %d", 2);
+    TEST_ASSERT_EQUAL(0, logger->getPendingBytes());
+    TEST_ASSERT_EQUAL_STRING("Queued\nBoot 2\n", logger->getBuffer().c_str());
+
+    logger->setSynchronous(false);
+    logger->logln("Deferred");
+    TEST_ASSERT_TRUE(logger->getPendingBytes() > 0);
+}
+
+void test_string_arguments_are_copied(void) {
+    char name[16];
+    strcpy(name, "before");
+    logger->log("Name: %s", name);
+    strcpy(name, "after");
+
+    TEST_ASSERT_EQUAL_STRING("Name: before", logger->getBuffer().c_str());
+}
+
+void test_null_string_argument(void) {
+    const char* missing = nullptr;
+    logger->log("%s", missing);
+    TEST_ASSERT_EQUAL_STRING("(null)", logger->getBuffer().c_str());
+}
+
+void test_length_modifiers_follow_captured_width(void) {
+    unsigned long ul = 4000000000UL;
+    uint64_t big = 123456789012345ULL;
+    size_t size = 7;
+    logger->log("%lu %llu %zu %d %ld", ul, big, size, -5, (long)-6);
+    TEST_ASSERT_EQUAL_STRING("4000000000 123456789012345 7 -5 -6", logger->getBuffer().c_str());
+}
+
+void test_width_precision_and_other_conversions(void) {
+    logger->log("[%5d] [%-4s] [%.2f] [%c] [%04X] [%.3s]", 42, "ab", 3.14159, 'z', 255, "abcdef");
+    TEST_ASSERT_EQUAL_STRING("[   42] [ab  ] [3.14] [z] [00FF] [abc]", logger->getBuffer().c_str());
+}
+
+void test_missing_argument_prints_placeholder(void) {
+    logger->log("a=%d b=%d", 1);
+    TEST_ASSERT_EQUAL_STRING("a=1 b=?", logger->getBuffer().c_str());
+}
+
+void test_full_ring_drops_and_reports(void) {
+    int logged = 0;
+    while (logger->getDroppedCount() == 0) {
+        logger->logln("Filling the ring %d", logged++);
+    }
+    TEST_ASSERT_TRUE(logged > 1);
+
+    logger->drain(1000);
+    String content = logger->getBuffer();
+    TEST_ASSERT_TRUE(content.indexOf('[') >= 0);
+    TEST_ASSERT_TRUE(strstr(content.c_str(), "[W] [1 log messages dropped]\n") != nullptr);
+
+    // Space is reusable after the drain
+    logger->clear();
+    logger->log("Again");
+    TEST_ASSERT_EQUAL_STRING("Again", logger->getBuffer().c_str());
+}
+
+void test_drain_limits_records(void) {
+    for (int i = 0; i < 5; i++) {
+        logger->logln("Line %d", i);
+    }
+    TEST_ASSERT_EQUAL(2, logger->drain(2));
+    TEST_ASSERT_EQUAL(3, logger->drain());
+    TEST_ASSERT_EQUAL(0, logger->drain());
+}
+
+void test_ring_wraps_records_across_end(void) {
+    // Records of odd sizes land across the end of the ring many times over
+    for (int i = 0; i < 2000; i++) {
+        logger->logln("Wrap %d %s", i, i % 2 ? "x" : "yyyyyyy");
+        TEST_ASSERT_EQUAL(1, logger->drain());
+    }
+    String content = logger->getBuffer();
+    TEST_ASSERT_TRUE(strstr(content.c_str(), "Wrap 1999 x\n") != nullptr);
+    TEST_ASSERT_EQUAL(0, logger->getDroppedCount());
+}
+
+// =============================================================================
+// Level Tests
+// =============================================================================
+
+void test_levels_below_compile_time_level_are_removed(void) {
+    // Default LOG_LEVEL is INFO
+    logger->debugln("Hidden %d", 1);
+    TEST_ASSERT_EQUAL(0, logger->getPendingBytes());
+    TEST_ASSERT_EQUAL(0, logger->getSize());
+}
+
+void test_warn_and_error_are_prefixed(void) {
+    logger->warnln("Careful");
+    logger->errorln("Broken %d", 2);
+    TEST_ASSERT_EQUAL_STRING("[W] Careful\n[E] Broken 2\n", logger->getBuffer().c_str());
+}
+
+// =============================================================================
+// Sink Tests
+// =============================================================================
+
+static int sinkCalls;
+static uint32_t sinkTimestamp;
+static LogLevel sinkLevel;
+static char sinkMessage[64];
+
+static void testSink(uint32_t timestampMs, LogLevel level, const char* message) {
+    sinkCalls++;
+    sinkTimestamp = timestampMs;
+    sinkLevel = level;
+    strncpy(sinkMessage, message, sizeof(sinkMessage) - 1);
+}
+
+void test_sink_receives_formatted_messages(void) {
+    sinkCalls = 0;
+    logger->setSink(testSink);
+    mockSetMillis(1234);
+    logger->warnln("Sink %d", 5);
+    mockSetMillis(9999);
+
+    TEST_ASSERT_EQUAL(0, sinkCalls);
+    logger->drain();
+    TEST_ASSERT_EQUAL(1, sinkCalls);
+    TEST_ASSERT_EQUAL(1234, sinkTimestamp);  // Capture time, not drain time
+    TEST_ASSERT_TRUE(sinkLevel == LogLevel::WARN);
+    TEST_ASSERT_EQUAL_STRING("Sink 5", sinkMessage);
+
+    logger->setSink(nullptr);
+    logger->logln("Not seen");
+    logger->drain();
+    TEST_ASSERT_EQUAL(1, sinkCalls);
+}
+
+// =============================================================================
+// Concurrency Tests
+// =============================================================================
+
+void test_concurrent_producers_lose_nothing_silently(void) {
+    const int PRODUCERS = 4;
+    const int PER_PRODUCER = 2000;
+    std::atomic<bool> done(false);
+    int formatted = 0;
+
+    std::thread consumer([&]() {
+        while (!done.load()) {
+            formatted += logger->drain();
+        }
+    });
+    std::vector<std::thread> producers;
+    for (int p = 0; p < PRODUCERS; p++) {
+        producers.emplace_back([p]() {
+            for (int i = 0; i < PER_PRODUCER; i++) {
+                logger->logln("Producer %d message %d", p, i);
+            }
+        });
+    }
+    for (std::thread& producer : producers) {
+        producer.join();
+    }
+    done.store(true);
+    consumer.join();
+    while (int n = logger->drain()) {
+        formatted += n;
+    }
+
+    // Every record is either formatted or counted as dropped
+    TEST_ASSERT_EQUAL(PRODUCERS * PER_PRODUCER, formatted + (int)logger->getDroppedCount());
+    TEST_ASSERT_EQUAL(0, logger->getPendingBytes());
+}
+
 // =============================================================================
 // Main
 // =============================================================================
@@ -396,5 +587,27 @@ int main(int argc, char** argv) {
     RUN_TEST(test_log_exactly_buffer_size);
     RUN_TEST(test_clear_after_wrap);
 
+    // Deferred formatting tests
+    RUN_TEST(test_log_defers_formatting_until_drain);
+    RUN_TEST(test_synchronous_mode_drains_on_log);
+    RUN_TEST(test_string_arguments_are_copied);
+    RUN_TEST(test_null_string_argument);
+    RUN_TEST(test_length_modifiers_follow_captured_width);
+    RUN_TEST(test_width_precision_and_other_conversions);
+    RUN_TEST(test_missing_argument_prints_placeholder);
+    RUN_TEST(test_full_ring_drops_and_reports);
+    RUN_TEST(test_drain_limits_records);
+    RUN_TEST(test_ring_wraps_records_across_end);
+
+    // Level tests
+    RUN_TEST(test_levels_below_compile_time_level_are_removed);
+    RUN_TEST(test_warn_and_error_are_prefixed);
+
+    // Sink tests
+    RUN_TEST(test_sink_receives_formatted_messages);
+
+    // Concurrency tests
+    RUN_TEST(test_concurrent_producers_lose_nothing_silently);
+
     return UNITY_END();
 }
@@ -0,0 +1,272 @@
+/**
+ * Unit Tests for the Loop Profiler
+ *
+ * Tests phase duration histograms and percentiles, budget checks, stall
+ * records with tags, the stall history, and scheduler integration.
+ */
+
+#include <Arduino.h>
+#include <unity.h>
+
+#include <loop_profiler.h>
+#include <loop_scheduler.h>
+
+static LoopProfiler* profiler = nullptr;
+
+static void runPhase(ProfilerPhaseId id, unsigned long durationMs, const char* label = nullptr) {
+    profiler->beginPhase(id);
+    if (label) {
+        profiler->tag(label);
+    }
+    mockAdvanceMillis(durationMs);
+    profiler->endPhase();
+}
+
+static void taskBlocks() {
+    Profiler.tag("proxy-forward");
+    mockAdvanceMillis(250);
+}
+
+void setUp(void) {
+    mockSetMillis(1000);
+    profiler = new LoopProfiler();
+}
+
+void tearDown(void) {
+    delete profiler;
+    profiler = nullptr;
+}
+
+// =============================================================================
+// Histogram Tests
+// =============================================================================
+
+void test_histogram_empty_percentile_is_zero(void) {
+    PhaseHistogram h;
+    TEST_ASSERT_EQUAL(0, h.percentile(99));
+    TEST_ASSERT_EQUAL(0, h.avgUs());
+}
+
+void test_histogram_p99_reports_tail_bucket(void) {
+    PhaseHistogram h;
+    for (int i = 0; i < 99; i++) {
+        h.record(80);
+    }
+    h.record(15000);
+
+    TEST_ASSERT_EQUAL(100, h.percentile(50));
+    TEST_ASSERT_EQUAL(100, h.percentile(99));
+    TEST_ASSERT_EQUAL(15000, h.percentile(100));
+    TEST_ASSERT_EQUAL(15000, h.maxUs);
+}
+
+void test_histogram_percentile_capped_by_max(void) {
+    PhaseHistogram h;
+    h.record(1200);
+    TEST_ASSERT_EQUAL(1200, h.percentile(99));
+}
+
+void test_histogram_overflow_bucket(void) {
+    PhaseHistogram h;
+    h.record(5000000);
+    TEST_ASSERT_EQUAL(1, h.buckets[PROFILER_HISTOGRAM_BUCKETS - 1]);
+    TEST_ASSERT_EQUAL(5000000, h.percentile(99));
+}
+
+void test_histogram_average(void) {
+    PhaseHistogram h;
+    h.record(100);
+    h.record(300);
+    TEST_ASSERT_EQUAL(200, h.avgUs());
+}
+
+// =============================================================================
+// Phase Tests
+// =============================================================================
+
+void test_add_phase_returns_sequential_ids(void) {
+    TEST_ASSERT_EQUAL(0, profiler->addPhase("a"));
+    TEST_ASSERT_EQUAL(1, profiler->addPhase("b"));
+    TEST_ASSERT_EQUAL(2, profiler->getPhaseCount());
+    TEST_ASSERT_EQUAL_STRING("b", profiler->getPhaseName(1));
+}
+
+void test_add_phase_fails_when_full(void) {
+    for (int i = 0; i < PROFILER_MAX_PHASES; i++) {
+        profiler->addPhase("p");
+    }
+    TEST_ASSERT_EQUAL(PROFILER_INVALID_PHASE, profiler->addPhase("overflow"));
+}
+
+void test_phase_duration_recorded(void) {
+    ProfilerPhaseId id = profiler->addPhase("web");
+    runPhase(id, 3);
+    runPhase(id, 5);
+
+    const PhaseHistogram& h = profiler->getHistogram(id);
+    TEST_ASSERT_EQUAL(2, h.count);
+    TEST_ASSERT_EQUAL(5000, h.maxUs);
+    TEST_ASSERT_EQUAL(4000, h.avgUs());
+}
+
+void test_end_without_begin_is_ignored(void) {
+    ProfilerPhaseId id = profiler->addPhase("web");
+    TEST_ASSERT_EQUAL(0, profiler->endPhase());
+    TEST_ASSERT_EQUAL(0, profiler->getHistogram(id).count);
+}
+
+void test_invalid_phase_not_recorded(void) {
+    profiler->beginPhase(5);
+    mockAdvanceMillis(100);
+    TEST_ASSERT_EQUAL(0, profiler->endPhase());
+    TEST_ASSERT_EQUAL(0, profiler->getTotalStalls());
+}
+
+// =============================================================================
+// Budget and Stall Tests
+// =============================================================================
+
+void test_default_budget_applies(void) {
+    ProfilerPhaseId id = profiler->addPhase("web");
+    TEST_ASSERT_EQUAL(PROFILER_DEFAULT_BUDGET_US, profiler->getBudget(id));
+
+    runPhase(id, PROFILER_DEFAULT_BUDGET_US / 1000);
+    TEST_ASSERT_EQUAL(0, profiler->getStallCount(id));
+
+    runPhase(id, PROFILER_DEFAULT_BUDGET_US / 1000 + 1);
+    TEST_ASSERT_EQUAL(1, profiler->getStallCount(id));
+}
+
+void test_phase_budget_overrides_default(void) {
+    ProfilerPhaseId tight = profiler->addPhase("graphql", 2000);
+    ProfilerPhaseId loose = profiler->addPhase("web");
+    runPhase(tight, 3);
+    runPhase(loose, 3);
+
+    TEST_ASSERT_EQUAL(1, profiler->getStallCount(tight));
+    TEST_ASSERT_EQUAL(0, profiler->getStallCount(loose));
+}
+
+void test_changing_default_budget(void) {
+    ProfilerPhaseId id = profiler->addPhase("web");
+    profiler->setDefaultBudget(10000);
+    runPhase(id, 11);
+    TEST_ASSERT_EQUAL(1, profiler->getStallCount(id));
+
+    profiler->setDefaultBudget(0);
+    TEST_ASSERT_EQUAL(PROFILER_DEFAULT_BUDGET_US, profiler->getDefaultBudget());
+}
+
+void test_stall_captures_tag(void) {
+    ProfilerPhaseId id = profiler->addPhase("web");
+    runPhase(id, 300, "wifi-scan");
+
+    TEST_ASSERT_EQUAL(1, profiler->getRecentStallCount());
+    const PhaseStall& stall = profiler->getRecentStall(0);
+    TEST_ASSERT_EQUAL(id, stall.phase);
+    TEST_ASSERT_EQUAL(300000, stall.durationUs);
+    TEST_ASSERT_EQUAL(1300, stall.atMs);
+    TEST_ASSERT_EQUAL_STRING("wifi-scan", stall.tag);
+}
+
+void test_tag_cleared_between_phases(void) {
+    ProfilerPhaseId id = profiler->addPhase("web");
+    runPhase(id, 1, "wifi-scan");
+    runPhase(id, 100);
+    TEST_ASSERT_EQUAL_STRING("", profiler->getRecentStall(0).tag);
+}
+
+void test_tag_truncated(void) {
+    ProfilerPhaseId id = profiler->addPhase("web");
+    runPhase(id, 100, "a-very-long-tag-that-does-not-fit");
+    TEST_ASSERT_EQUAL(PROFILER_TAG_LEN - 1, strlen(profiler->getRecentStall(0).tag));
+}
+
+void test_stall_history_newest_first_and_bounded(void) {
+    ProfilerPhaseId id = profiler->addPhase("web");
+    for (int i = 0; i < PROFILER_STALL_HISTORY + 3; i++) {
+        runPhase(id, 60 + i);
+    }
+
+    TEST_ASSERT_EQUAL(PROFILER_STALL_HISTORY + 3, profiler->getTotalStalls());
+    TEST_ASSERT_EQUAL(PROFILER_STALL_HISTORY, profiler->getRecentStallCount());
+    TEST_ASSERT_EQUAL((60 + PROFILER_STALL_HISTORY + 2) * 1000, profiler->getRecentStall(0).durationUs);
+    TEST_ASSERT_EQUAL(63 * 1000, profiler->getRecentStall(PROFILER_STALL_HISTORY - 1).durationUs);
+    TEST_ASSERT_EQUAL(PROFILER_INVALID_PHASE, profiler->getRecentStall(PROFILER_STALL_HISTORY).phase);
+}
+
+void test_reset_stats_keeps_phases_and_budgets(void) {
+    ProfilerPhaseId id = profiler->addPhase("web", 1000);
+    runPhase(id, 5);
+    profiler->resetStats();
+
+    TEST_ASSERT_EQUAL(1, profiler->getPhaseCount());
+    TEST_ASSERT_EQUAL(1000, profiler->getBudget(id));
+    TEST_ASSERT_EQUAL(0, profiler->getHistogram(id).count);
+    TEST_ASSERT_EQUAL(0, profiler->getTotalStalls());
+    TEST_ASSERT_EQUAL(0, profiler->getRecentStallCount());
+}
+
+// =============================================================================
+// Scheduler Integration Tests
+// =============================================================================
+
+void test_scheduler_profiles_each_task(void) {
+    Profiler.reset();
+    LoopScheduler sched;
+    sched.setProfiler(&Profiler);
+    SchedulerTaskId id = sched.addEvent("proxy", taskBlocks);
+
+    sched.signal(id);
+    sched.runOnce();
+
+    TEST_ASSERT_EQUAL(1, Profiler.getPhaseCount());
+    TEST_ASSERT_EQUAL_STRING("proxy", Profiler.getPhaseName(0));
+    TEST_ASSERT_EQUAL(1, Profiler.getHistogram(0).count);
+    TEST_ASSERT_EQUAL(1, Profiler.getTotalStalls());
+    TEST_ASSERT_EQUAL_STRING("proxy-forward", Profiler.getRecentStall(0).tag);
+}
+
+void test_scheduler_registers_earlier_tasks_as_phases(void) {
+    Profiler.reset();
+    LoopScheduler sched;
+    sched.addPeriodic("web", 10, taskBlocks);
+    sched.setProfiler(&Profiler);
+
+    TEST_ASSERT_EQUAL(1, Profiler.getPhaseCount());
+    TEST_ASSERT_EQUAL_STRING("web", Profiler.getPhaseName(0));
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+
+    // Histogram
+    RUN_TEST(test_histogram_empty_percentile_is_zero);
+    RUN_TEST(test_histogram_p99_reports_tail_bucket);
+    RUN_TEST(test_histogram_percentile_capped_by_max);
+    RUN_TEST(test_histogram_overflow_bucket);
+    RUN_TEST(test_histogram_average);
+
+    // Phases
+    RUN_TEST(test_add_phase_returns_sequential_ids);
+    RUN_TEST(test_add_phase_fails_when_full);
+    RUN_TEST(test_phase_duration_recorded);
+    RUN_TEST(test_end_without_begin_is_ignored);
+    RUN_TEST(test_invalid_phase_not_recorded);
+
+    // Budgets and stalls
+    RUN_TEST(test_default_budget_applies);
+    RUN_TEST(test_phase_budget_overrides_default);
+    RUN_TEST(test_changing_default_budget);
+    RUN_TEST(test_stall_captures_tag);
+    RUN_TEST(test_tag_cleared_between_phases);
+    RUN_TEST(test_tag_truncated);
+    RUN_TEST(test_stall_history_newest_first_and_bounded);
+    RUN_TEST(test_reset_stats_keeps_phases_and_budgets);
+
+    // Scheduler integration
+    RUN_TEST(test_scheduler_profiles_each_task);
+    RUN_TEST(test_scheduler_registers_earlier_tasks_as_phases);
+
+    return UNITY_END();
+}
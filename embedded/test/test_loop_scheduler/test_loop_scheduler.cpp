@@ -0,0 +1,377 @@
+/**
+ * Unit Tests for the Loop Scheduler
+ *
+ * Tests periodic cadence, one-shot timers, signals, priority ordering,
+ * the idle hint returned to loop(), and per-task run-time accounting.
+ */
+
+#include <Arduino.h>
+#include <unity.h>
+
+#include <loop_scheduler.h>
+
+static LoopScheduler* sched = nullptr;
+
+// Execution trace shared by the task functions below
+static char trace[32];
+static int traceLen = 0;
+static SchedulerTaskId signalTarget = SCHEDULER_INVALID_TASK;
+
+static void record(char c) {
+    if (traceLen < (int)sizeof(trace) - 1) {
+        trace[traceLen++] = c;
+        trace[traceLen] = '\0';
+    }
+}
+
+static void taskA() { record('a'); }
+static void taskB() { record('b'); }
+static void taskC() { record('c'); }
+static void taskSlow() {
+    record('s');
+    mockAdvanceMillis(3);
+}
+static void taskSignalsOther() {
+    record('x');
+    sched->signal(signalTarget);
+}
+
+void setUp(void) {
+    mockSetMillis(1000);
+    sched = new LoopScheduler();
+    traceLen = 0;
+    trace[0] = '\0';
+    signalTarget = SCHEDULER_INVALID_TASK;
+}
+
+void tearDown(void) {
+    delete sched;
+    sched = nullptr;
+}
+
+// =============================================================================
+// Registration Tests
+// =============================================================================
+
+void test_register_returns_sequential_ids(void) {
+    TEST_ASSERT_EQUAL(0, sched->addPeriodic("a", 10, taskA));
+    TEST_ASSERT_EQUAL(1, sched->addEvent("b", taskB, TaskPriority::URGENT));
+    TEST_ASSERT_EQUAL(2, sched->getTaskCount());
+    TEST_ASSERT_EQUAL_STRING("b", sched->getTaskName(1));
+    TEST_ASSERT_TRUE(sched->getTaskPriority(1) == TaskPriority::URGENT);
+}
+
+void test_register_fails_when_full(void) {
+    for (int i = 0; i < SCHEDULER_MAX_TASKS; i++) {
+        TEST_ASSERT_EQUAL(i, sched->addEvent("t", taskA));
+    }
+    TEST_ASSERT_EQUAL(SCHEDULER_INVALID_TASK, sched->addEvent("overflow", taskA));
+}
+
+void test_register_rejects_null_function(void) {
+    TEST_ASSERT_EQUAL(SCHEDULER_INVALID_TASK, sched->addPeriodic("null", 10, nullptr));
+}
+
+void test_invalid_ids_are_ignored(void) {
+    sched->signal(SCHEDULER_INVALID_TASK);
+    sched->runAfter(5, 10);
+    sched->cancel(7);
+    TEST_ASSERT_EQUAL_STRING("", sched->getTaskName(3));
+    TEST_ASSERT_EQUAL(0, sched->getTaskStats(3).runs);
+}
+
+// =============================================================================
+// Periodic Tests
+// =============================================================================
+
+void test_periodic_first_run_after_one_interval(void) {
+    sched->addPeriodic("a", 10, taskA);
+
+    sched->runOnce();
+    TEST_ASSERT_EQUAL_STRING("", trace);
+
+    mockAdvanceMillis(10);
+    sched->runOnce();
+    TEST_ASSERT_EQUAL_STRING("a", trace);
+}
+
+void test_periodic_runs_once_per_pass(void) {
+    sched->addPeriodic("a", 10, taskA);
+    mockAdvanceMillis(35);
+
+    sched->runOnce();
+    sched->runOnce();
+    TEST_ASSERT_EQUAL_STRING("a", trace);
+}
+
+void test_periodic_skips_missed_runs(void) {
+    SchedulerTaskId id = sched->addPeriodic("a", 10, taskA);
+    mockAdvanceMillis(35);
+    sched->runOnce();
+
+    // Next run one interval from now, not a burst catching up
+    TEST_ASSERT_EQUAL(10, sched->runOnce());
+    mockAdvanceMillis(10);
+    sched->runOnce();
+    TEST_ASSERT_EQUAL(2, sched->getTaskStats(id).runs);
+}
+
+void test_periodic_keeps_cadence_when_slightly_late(void) {
+    sched->addPeriodic("a", 10, taskA);
+    mockAdvanceMillis(13);
+    sched->runOnce();
+
+    // Due at 1020, so only 7ms remain
+    TEST_ASSERT_EQUAL(7, sched->runOnce());
+}
+
+void test_cancel_stops_periodic_until_rearmed(void) {
+    SchedulerTaskId id = sched->addPeriodic("a", 10, taskA);
+    sched->cancel(id);
+    mockAdvanceMillis(50);
+    sched->runOnce();
+    TEST_ASSERT_EQUAL_STRING("", trace);
+
+    sched->runAfter(id, 0);
+    sched->runOnce();
+    mockAdvanceMillis(10);
+    sched->runOnce();
+    TEST_ASSERT_EQUAL_STRING("aa", trace);
+}
+
+// =============================================================================
+// Timer and Signal Tests
+// =============================================================================
+
+void test_event_task_idle_until_signalled(void) {
+    SchedulerTaskId id = sched->addEvent("a", taskA);
+    mockAdvanceMillis(1000);
+    sched->runOnce();
+    TEST_ASSERT_EQUAL_STRING("", trace);
+
+    sched->signal(id);
+    sched->runOnce();
+    sched->runOnce();
+    TEST_ASSERT_EQUAL_STRING("a", trace);
+}
+
+void test_run_after_is_one_shot(void) {
+    SchedulerTaskId id = sched->addEvent("a", taskA);
+    sched->runAfter(id, 50);
+
+    mockAdvanceMillis(49);
+    sched->runOnce();
+    TEST_ASSERT_EQUAL_STRING("", trace);
+
+    mockAdvanceMillis(1);
+    sched->runOnce();
+    mockAdvanceMillis(100);
+    sched->runOnce();
+    TEST_ASSERT_EQUAL_STRING("a", trace);
+}
+
+void test_run_after_rearm_debounces(void) {
+    SchedulerTaskId id = sched->addEvent("a", taskA);
+    sched->runAfter(id, 50);
+    mockAdvanceMillis(40);
+    sched->runAfter(id, 50);
+    mockAdvanceMillis(40);
+    sched->runOnce();
+    TEST_ASSERT_EQUAL_STRING("", trace);
+
+    mockAdvanceMillis(10);
+    sched->runOnce();
+    TEST_ASSERT_EQUAL_STRING("a", trace);
+}
+
+void test_signal_and_timer_in_same_pass_run_once(void) {
+    SchedulerTaskId id = sched->addEvent("a", taskA);
+    sched->runAfter(id, 10);
+    mockAdvanceMillis(10);
+    sched->signal(id);
+    sched->runOnce();
+    sched->runOnce();
+    TEST_ASSERT_EQUAL_STRING("a", trace);
+}
+
+void test_cancel_drops_pending_signal(void) {
+    SchedulerTaskId id = sched->addEvent("a", taskA);
+    sched->signal(id);
+    sched->cancel(id);
+    sched->runOnce();
+    TEST_ASSERT_EQUAL_STRING("", trace);
+}
+
+// =============================================================================
+// Priority Tests
+// =============================================================================
+
+void test_priority_orders_ready_tasks(void) {
+    SchedulerTaskId low = sched->addEvent("c", taskC, TaskPriority::BACKGROUND);
+    SchedulerTaskId normal = sched->addEvent("b", taskB, TaskPriority::NORMAL);
+    SchedulerTaskId urgent = sched->addEvent("a", taskA, TaskPriority::URGENT);
+    sched->signal(low);
+    sched->signal(normal);
+    sched->signal(urgent);
+
+    sched->runOnce();
+    TEST_ASSERT_EQUAL_STRING("abc", trace);
+}
+
+void test_same_priority_oldest_first(void) {
+    SchedulerTaskId first = sched->addEvent("a", taskA);
+    SchedulerTaskId second = sched->addEvent("b", taskB);
+    sched->signal(second);
+    mockAdvanceMillis(5);
+    sched->signal(first);
+
+    sched->runOnce();
+    TEST_ASSERT_EQUAL_STRING("ba", trace);
+}
+
+void test_signal_during_pass_preempts_lower_priority(void) {
+    SchedulerTaskId normal = sched->addEvent("x", taskSignalsOther, TaskPriority::NORMAL);
+    SchedulerTaskId low = sched->addEvent("c", taskC, TaskPriority::BACKGROUND);
+    signalTarget = sched->addEvent("a", taskA, TaskPriority::URGENT);
+    sched->signal(normal);
+    sched->signal(low);
+
+    sched->runOnce();
+    TEST_ASSERT_EQUAL_STRING("xac", trace);
+}
+
+void test_task_signalling_itself_runs_next_pass(void) {
+    SchedulerTaskId id = sched->addEvent("x", taskSignalsOther);
+    signalTarget = id;
+    sched->signal(id);
+
+    TEST_ASSERT_EQUAL(0, sched->runOnce());
+    TEST_ASSERT_EQUAL_STRING("x", trace);
+    sched->runOnce();
+    TEST_ASSERT_EQUAL_STRING("xx", trace);
+}
+
+// =============================================================================
+// Idle Hint Tests
+// =============================================================================
+
+void test_idle_capped_without_tasks(void) {
+    TEST_ASSERT_EQUAL(SCHEDULER_MAX_IDLE_MS, sched->runOnce());
+}
+
+void test_idle_until_next_due(void) {
+    sched->addPeriodic("a", 15, taskA);
+    sched->addPeriodic("b", 5, taskB);
+    TEST_ASSERT_EQUAL(5, sched->runOnce());
+}
+
+void test_idle_until_one_shot_timer(void) {
+    SchedulerTaskId id = sched->addEvent("a", taskA);
+    sched->runAfter(id, 50);
+    mockAdvanceMillis(45);
+    TEST_ASSERT_EQUAL(5, sched->runOnce());
+}
+
+// =============================================================================
+// Accounting Tests
+// =============================================================================
+
+void test_stats_track_runs_and_time(void) {
+    SchedulerTaskId id = sched->addEvent("s", taskSlow);
+    sched->signal(id);
+    sched->runOnce();
+    sched->signal(id);
+    sched->runOnce();
+
+    const SchedulerTaskStats& stats = sched->getTaskStats(id);
+    TEST_ASSERT_EQUAL(2, stats.runs);
+    TEST_ASSERT_EQUAL(6000, (uint32_t)stats.totalUs);
+    TEST_ASSERT_EQUAL(3000, stats.maxUs);
+    TEST_ASSERT_EQUAL(6000, (uint32_t)sched->getStats().busyUs);
+    TEST_ASSERT_EQUAL(2, sched->getStats().passes);
+}
+
+void test_lateness_measured_from_ready_time(void) {
+    SchedulerTaskId slow = sched->addEvent("s", taskSlow, TaskPriority::URGENT);
+    SchedulerTaskId other = sched->addEvent("a", taskA);
+    sched->signal(slow);
+    sched->signal(other);
+    sched->runOnce();
+
+    TEST_ASSERT_EQUAL(0, sched->getTaskStats(slow).maxLatenessMs);
+    TEST_ASSERT_EQUAL(3, sched->getTaskStats(other).maxLatenessMs);
+}
+
+void test_deadline_misses_counted(void) {
+    SchedulerTaskId slow = sched->addEvent("s", taskSlow, TaskPriority::URGENT);
+    SchedulerTaskId other = sched->addEvent("a", taskA);
+    sched->setDeadline(other, 2);
+    sched->signal(slow);
+    sched->signal(other);
+    sched->runOnce();
+    TEST_ASSERT_EQUAL(1, sched->getTaskStats(other).deadlineMisses);
+
+    sched->setDeadline(other, 5);
+    sched->signal(slow);
+    sched->signal(other);
+    sched->runOnce();
+    TEST_ASSERT_EQUAL(1, sched->getTaskStats(other).deadlineMisses);
+}
+
+void test_reset_stats_keeps_tasks(void) {
+    SchedulerTaskId id = sched->addEvent("s", taskSlow);
+    sched->signal(id);
+    sched->runOnce();
+    sched->resetStats();
+
+    TEST_ASSERT_EQUAL(1, sched->getTaskCount());
+    TEST_ASSERT_EQUAL(0, sched->getTaskStats(id).runs);
+    TEST_ASSERT_EQUAL(0, (uint32_t)sched->getStats().busyUs);
+
+    sched->signal(id);
+    sched->runOnce();
+    TEST_ASSERT_EQUAL(1, sched->getTaskStats(id).runs);
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+
+    // Registration
+    RUN_TEST(test_register_returns_sequential_ids);
+    RUN_TEST(test_register_fails_when_full);
+    RUN_TEST(test_register_rejects_null_function);
+    RUN_TEST(test_invalid_ids_are_ignored);
+
+    // Periodic
+    RUN_TEST(test_periodic_first_run_after_one_interval);
+    RUN_TEST(test_periodic_runs_once_per_pass);
+    RUN_TEST(test_periodic_skips_missed_runs);
+    RUN_TEST(test_periodic_keeps_cadence_when_slightly_late);
+    RUN_TEST(test_cancel_stops_periodic_until_rearmed);
+
+    // Timers and signals
+    RUN_TEST(test_event_task_idle_until_signalled);
+    RUN_TEST(test_run_after_is_one_shot);
+    RUN_TEST(test_run_after_rearm_debounces);
+    RUN_TEST(test_signal_and_timer_in_same_pass_run_once);
+    RUN_TEST(test_cancel_drops_pending_signal);
+
+    // Priority
+    RUN_TEST(test_priority_orders_ready_tasks);
+    RUN_TEST(test_same_priority_oldest_first);
+    RUN_TEST(test_signal_during_pass_preempts_lower_priority);
+    RUN_TEST(test_task_signalling_itself_runs_next_pass);
+
+    // Idle hint
+    RUN_TEST(test_idle_capped_without_tasks);
+    RUN_TEST(test_idle_until_next_due);
+    RUN_TEST(test_idle_until_one_shot_timer);
+
+    // Accounting
+    RUN_TEST(test_stats_track_runs_and_time);
+    RUN_TEST(test_lateness_measured_from_ready_time);
+    RUN_TEST(test_deadline_misses_counted);
+    RUN_TEST(test_reset_stats_keeps_tasks);
+
+    return UNITY_END();
+}
@@ -22,6 +22,7 @@ static int dataCallbackCount = 0;
 static std::vector<LedCommand> lastLedCommands;
 static int ledDataCallbackCount = 0;
 static int lastAngle = 0;
+static int wakeCallbackCount = 0;
 
 void testConnectCallback(bool connected) {
     lastConnectState = connected;
@@ -42,6 +43,10 @@ void testLedDataCallback(const LedCommand* commands, int count, int angle) {
     lastAngle = angle;
 }
 
+void testWakeCallback() {
+    wakeCallbackCount++;
+}
+
 void setUp(void) {
     Preferences::resetAll();
     NimBLEDevice::mockReset();
@@ -52,6 +57,7 @@ void setUp(void) {
     lastLedCommands.clear();
     ledDataCallbackCount = 0;
     lastAngle = 0;
+    wakeCallbackCount = 0;
     ble = new NordicUartBLE();
 }
 
@@ -172,6 +178,26 @@ void test_set_data_callback_and_verify_invocation(void) {
     TEST_ASSERT_EQUAL(0x01, lastDataReceived[0]);
 }
 
+void test_wake_callback_on_connect_write_and_disconnect(void) {
+    ble->setWakeCallback(testWakeCallback);
+    ble->begin("Test Device");
+
+    ble_gap_conn_desc desc;
+    memset(&desc, 0, sizeof(desc));
+    desc.conn_handle = 1;
+    NimBLEDevice::getServer()->mockConnect(&desc);
+    TEST_ASSERT_EQUAL(1, wakeCallbackCount);
+
+    NimBLEService* service = NimBLEDevice::getServer()->getServiceByUUID(NUS_SERVICE_UUID);
+    NimBLECharacteristic* rxChar = service->getCharacteristic(NUS_RX_CHARACTERISTIC);
+    uint8_t testData[] = {0x01, 0x02, 0x03};
+    rxChar->mockWrite(testData, sizeof(testData));
+    TEST_ASSERT_EQUAL(2, wakeCallbackCount);
+
+    NimBLEDevice::getServer()->mockDisconnect(&desc);
+    TEST_ASSERT_EQUAL(3, wakeCallbackCount);
+}
+
 void test_set_led_data_callback_registration(void) {
     // LED data callback requires full Aurora protocol frames
     // Just verify registration doesn't affect state
@@ -525,6 +551,7 @@ int main(int argc, char** argv) {
     // Callback registration tests
     RUN_TEST(test_set_connect_callback_and_verify_invocation);
     RUN_TEST(test_set_data_callback_and_verify_invocation);
+    RUN_TEST(test_wake_callback_on_connect_write_and_disconnect);
     RUN_TEST(test_set_led_data_callback_registration);
 
     // Connection lifecycle tests
@@ -0,0 +1,150 @@
+/**
+ * Unit Tests for the QR Code Rasteriser
+ *
+ * Tests module scaling, the light border and the 1-bpp sprite bit layout
+ * used to pre-render the session join QR code once per session.
+ */
+
+#include <Arduino.h>
+
+#include <qr_raster.h>
+#include <string>
+#include <unity.h>
+#include <vector>
+
+// Pack a grid of '#'/'.' rows the way qrcode_initText does (row-major, MSB first)
+static std::vector<uint8_t> packModules(const char* const* rows, int size) {
+    std::vector<uint8_t> modules((size * size + 7) / 8, 0);
+    for (int y = 0; y < size; y++) {
+        for (int x = 0; x < size; x++) {
+            if (rows[y][x] == '#') {
+                int bit = y * size + x;
+                modules[bit >> 3] |= 0x80 >> (bit & 7);
+            }
+        }
+    }
+    return modules;
+}
+
+static bool pixel(const std::vector<uint8_t>& bitmap, int side, int x, int y) {
+    int stride = qrRasterStride(side);
+    return bitmap[y * stride + (x >> 3)] & (0x80 >> (x & 7));
+}
+
+void setUp(void) {}
+
+void tearDown(void) {}
+
+// =============================================================================
+// Sizing Tests
+// =============================================================================
+
+void test_scale_fits_target(void) {
+    // Version 6 is 41 modules per side
+    TEST_ASSERT_EQUAL(7, qrModuleScale(41, 300));
+    TEST_ASSERT_EQUAL(1, qrModuleScale(41, 80));
+    TEST_ASSERT_EQUAL(2, qrModuleScale(41, 120));
+}
+
+void test_scale_never_below_one(void) {
+    TEST_ASSERT_EQUAL(1, qrModuleScale(41, 20));
+    TEST_ASSERT_EQUAL(1, qrModuleScale(0, 100));
+}
+
+void test_side_and_stride(void) {
+    TEST_ASSERT_EQUAL(41 * 7 + 16, qrRasterSide(41, 7, 8));
+    TEST_ASSERT_EQUAL(1, qrRasterStride(8));
+    TEST_ASSERT_EQUAL(2, qrRasterStride(9));
+    TEST_ASSERT_EQUAL(38, qrRasterStride(303));
+}
+
+// =============================================================================
+// Rasterise Tests
+// =============================================================================
+
+void test_unscaled_grid_matches_modules(void) {
+    const char* rows[] = {"#..", ".#.", "..#"};
+    std::vector<uint8_t> modules = packModules(rows, 3);
+
+    std::vector<uint8_t> bitmap(qrRasterStride(3) * 3, 0xFF);
+    qrRasterize1bpp(modules.data(), 3, 1, 0, bitmap.data());
+
+    TEST_ASSERT_EQUAL_UINT8(0x80, bitmap[0]);
+    TEST_ASSERT_EQUAL_UINT8(0x40, bitmap[1]);
+    TEST_ASSERT_EQUAL_UINT8(0x20, bitmap[2]);
+}
+
+void test_scaled_modules_fill_blocks(void) {
+    const char* rows[] = {"#.", ".#"};
+    std::vector<uint8_t> modules = packModules(rows, 2);
+    int side = qrRasterSide(2, 3, 0);
+
+    std::vector<uint8_t> bitmap(qrRasterStride(side) * side);
+    qrRasterize1bpp(modules.data(), 2, 3, 0, bitmap.data());
+
+    for (int y = 0; y < side; y++) {
+        for (int x = 0; x < side; x++) {
+            bool dark = (x < 3) == (y < 3);
+            TEST_ASSERT_EQUAL(dark, pixel(bitmap, side, x, y));
+        }
+    }
+}
+
+void test_border_stays_light(void) {
+    const char* rows[] = {"##", "##"};
+    std::vector<uint8_t> modules = packModules(rows, 2);
+    int side = qrRasterSide(2, 2, 4);
+    TEST_ASSERT_EQUAL(12, side);
+
+    std::vector<uint8_t> bitmap(qrRasterStride(side) * side);
+    qrRasterize1bpp(modules.data(), 2, 2, 4, bitmap.data());
+
+    for (int y = 0; y < side; y++) {
+        for (int x = 0; x < side; x++) {
+            bool inside = x >= 4 && x < 8 && y >= 4 && y < 8;
+            TEST_ASSERT_EQUAL(inside, pixel(bitmap, side, x, y));
+        }
+    }
+}
+
+void test_modules_cross_byte_boundaries(void) {
+    // 41 modules packed continuously: row 1 starts mid-byte
+    std::vector<const char*> rows(41);
+    std::string light(41, '.');
+    std::string lastDark(41, '.');
+    lastDark[40] = '#';
+    std::string firstDark(41, '.');
+    firstDark[0] = '#';
+    for (int y = 0; y < 41; y++) {
+        rows[y] = light.c_str();
+    }
+    rows[0] = lastDark.c_str();
+    rows[1] = firstDark.c_str();
+    std::vector<uint8_t> modules = packModules(rows.data(), 41);
+
+    int side = qrRasterSide(41, 1, 2);
+    std::vector<uint8_t> bitmap(qrRasterStride(side) * side);
+    qrRasterize1bpp(modules.data(), 41, 1, 2, bitmap.data());
+
+    TEST_ASSERT_TRUE(pixel(bitmap, side, 42, 2));
+    TEST_ASSERT_TRUE(pixel(bitmap, side, 2, 3));
+    TEST_ASSERT_FALSE(pixel(bitmap, side, 41, 2));
+    TEST_ASSERT_FALSE(pixel(bitmap, side, 3, 3));
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+
+    // Sizing tests
+    RUN_TEST(test_scale_fits_target);
+    RUN_TEST(test_scale_never_below_one);
+    RUN_TEST(test_side_and_stride);
+
+    // Rasterise tests
+    RUN_TEST(test_unscaled_grid_matches_modules);
+    RUN_TEST(test_scaled_modules_fill_blocks);
+    RUN_TEST(test_border_stays_light);
+    RUN_TEST(test_modules_cross_byte_boundaries);
+
+    return UNITY_END();
+}
@@ -0,0 +1,298 @@
+/**
+ * Unit Tests for Radio Coexistence Scheduler
+ *
+ * Tests how RadioCoex tracks WiFi/BLE activity, defers BLE scans during
+ * transfers and handshakes, picks the coex preference, budgets scan duty
+ * and reports LED-update latency percentiles.
+ */
+
+#include <Arduino.h>
+#include <unity.h>
+
+#include <radio_coex.h>
+
+static RadioCoex* coex = nullptr;
+
+void setUp(void) {
+    mockSetMillis(1000);
+    coex = new RadioCoex();
+}
+
+void tearDown(void) {
+    delete coex;
+    coex = nullptr;
+}
+
+// =============================================================================
+// Activity Tests
+// =============================================================================
+
+void test_idle_radio_allows_scan_and_balances(void) {
+    TEST_ASSERT_TRUE(coex->mayScan());
+    TEST_ASSERT_TRUE(coex->getPreference() == CoexPreference::BALANCE);
+}
+
+void test_level_activity_lasts_until_ended(void) {
+    coex->beginActivity(CoexActivity::WIFI_HANDSHAKE);
+    mockAdvanceMillis(5000);
+    TEST_ASSERT_TRUE(coex->isActive(CoexActivity::WIFI_HANDSHAKE));
+
+    coex->endActivity(CoexActivity::WIFI_HANDSHAKE);
+    TEST_ASSERT_FALSE(coex->isActive(CoexActivity::WIFI_HANDSHAKE));
+}
+
+void test_burst_activity_expires_after_hold(void) {
+    coex->noteActivity(CoexActivity::WIFI_TRANSFER);
+    TEST_ASSERT_TRUE(coex->isActive(CoexActivity::WIFI_TRANSFER));
+
+    mockAdvanceMillis(COEX_WIFI_TRANSFER_HOLD_MS - 1);
+    TEST_ASSERT_TRUE(coex->isActive(CoexActivity::WIFI_TRANSFER));
+
+    mockAdvanceMillis(1);
+    TEST_ASSERT_FALSE(coex->isActive(CoexActivity::WIFI_TRANSFER));
+}
+
+void test_burst_never_noted_is_inactive_at_boot(void) {
+    mockSetMillis(0);
+    RadioCoex fresh;
+    TEST_ASSERT_FALSE(fresh.isActive(CoexActivity::BLE_TRANSFER));
+}
+
+// =============================================================================
+// Scan Deferral Tests
+// =============================================================================
+
+void test_scan_deferred_during_websocket_transfer(void) {
+    coex->noteActivity(CoexActivity::WIFI_TRANSFER);
+    TEST_ASSERT_FALSE(coex->requestScan());
+
+    mockAdvanceMillis(COEX_WIFI_TRANSFER_HOLD_MS);
+    TEST_ASSERT_TRUE(coex->requestScan());
+    TEST_ASSERT_EQUAL(1, coex->getStats().scansDeferred);
+}
+
+void test_scan_deferral_counted_once_per_attempt(void) {
+    coex->beginActivity(CoexActivity::WIFI_HANDSHAKE);
+    for (int i = 0; i < 10; i++) {
+        TEST_ASSERT_FALSE(coex->requestScan());
+    }
+    TEST_ASSERT_EQUAL(1, coex->getStats().scansDeferred);
+
+    coex->endActivity(CoexActivity::WIFI_HANDSHAKE);
+    TEST_ASSERT_TRUE(coex->requestScan());
+
+    // The next scan is a new attempt
+    coex->beginActivity(CoexActivity::WIFI_HANDSHAKE);
+    TEST_ASSERT_FALSE(coex->requestScan());
+    TEST_ASSERT_EQUAL(2, coex->getStats().scansDeferred);
+}
+
+void test_scan_deferred_during_handshake(void) {
+    coex->beginActivity(CoexActivity::WIFI_HANDSHAKE);
+    TEST_ASSERT_FALSE(coex->mayScan());
+    coex->endActivity(CoexActivity::WIFI_HANDSHAKE);
+    TEST_ASSERT_TRUE(coex->mayScan());
+}
+
+void test_scan_deferred_during_board_writes(void) {
+    coex->noteActivity(CoexActivity::BLE_TRANSFER);
+    TEST_ASSERT_FALSE(coex->mayScan());
+}
+
+void test_may_scan_does_not_count_deferral(void) {
+    coex->noteActivity(CoexActivity::WIFI_TRANSFER);
+    coex->mayScan();
+    TEST_ASSERT_EQUAL(0, coex->getStats().scansDeferred);
+}
+
+// =============================================================================
+// Preference Tests
+// =============================================================================
+
+void test_handshake_prefers_wifi(void) {
+    coex->beginActivity(CoexActivity::WIFI_HANDSHAKE);
+    TEST_ASSERT_TRUE(coex->getPreference() == CoexPreference::PREFER_WIFI);
+}
+
+void test_board_writes_prefer_bt(void) {
+    coex->noteActivity(CoexActivity::BLE_TRANSFER);
+    TEST_ASSERT_TRUE(coex->getPreference() == CoexPreference::PREFER_BT);
+}
+
+void test_board_writes_win_over_websocket_traffic(void) {
+    coex->noteActivity(CoexActivity::WIFI_TRANSFER);
+    coex->noteActivity(CoexActivity::BLE_TRANSFER);
+    TEST_ASSERT_TRUE(coex->getPreference() == CoexPreference::PREFER_BT);
+}
+
+void test_handshake_wins_over_board_writes(void) {
+    coex->noteActivity(CoexActivity::BLE_TRANSFER);
+    coex->beginActivity(CoexActivity::WIFI_HANDSHAKE);
+    TEST_ASSERT_TRUE(coex->getPreference() == CoexPreference::PREFER_WIFI);
+}
+
+void test_preference_returns_to_balance_in_loop(void) {
+    coex->noteActivity(CoexActivity::BLE_TRANSFER);
+    mockAdvanceMillis(COEX_BLE_TRANSFER_HOLD_MS);
+    coex->loop();
+    TEST_ASSERT_TRUE(coex->getPreference() == CoexPreference::BALANCE);
+    TEST_ASSERT_EQUAL(2, coex->getStats().preferenceSwitches);
+}
+
+// =============================================================================
+// Airtime / Budget Tests
+// =============================================================================
+
+void test_airtime_accumulates_per_activity(void) {
+    coex->beginActivity(CoexActivity::BLE_SCAN);
+    mockAdvanceMillis(400);
+    coex->endActivity(CoexActivity::BLE_SCAN);
+    mockAdvanceMillis(600);
+    coex->loop();
+
+    CoexStats stats = coex->getStats();
+    TEST_ASSERT_EQUAL(400, stats.activityMs[(int)CoexActivity::BLE_SCAN]);
+    TEST_ASSERT_EQUAL(1000, stats.preferenceMs[(int)CoexPreference::BALANCE]);
+}
+
+void test_stats_include_time_since_last_update(void) {
+    coex->beginActivity(CoexActivity::WIFI_HANDSHAKE);
+    mockAdvanceMillis(250);
+    CoexStats stats = coex->getStats();
+    TEST_ASSERT_EQUAL(250, stats.activityMs[(int)CoexActivity::WIFI_HANDSHAKE]);
+    TEST_ASSERT_EQUAL(250, stats.preferenceMs[(int)CoexPreference::PREFER_WIFI]);
+}
+
+void test_scan_window_unrestricted_without_wifi_link(void) {
+    TEST_ASSERT_EQUAL(99, coex->getScanWindow(100));
+}
+
+void test_scan_window_follows_duty_budget(void) {
+    coex->setWifiLinkUp(true);
+    TEST_ASSERT_EQUAL(COEX_DEFAULT_SCAN_DUTY_PCT, coex->getScanWindow(100));
+
+    coex->setScanDutyBudget(30);
+    TEST_ASSERT_EQUAL(30, coex->getScanWindow(100));
+    TEST_ASSERT_EQUAL(96, coex->getScanWindow(320));
+}
+
+void test_scan_duty_budget_is_clamped(void) {
+    coex->setWifiLinkUp(true);
+    coex->setScanDutyBudget(0);
+    TEST_ASSERT_EQUAL(1, coex->getScanDutyBudget());
+    TEST_ASSERT_EQUAL(1, coex->getScanWindow(10));
+
+    coex->setScanDutyBudget(200);
+    TEST_ASSERT_EQUAL(99, coex->getScanDutyBudget());
+    TEST_ASSERT_EQUAL(99, coex->getScanWindow(100));
+}
+
+// =============================================================================
+// Latency Histogram Tests
+// =============================================================================
+
+void test_histogram_empty_percentile_is_zero(void) {
+    CoexLatencyHistogram histogram;
+    TEST_ASSERT_EQUAL(0, histogram.percentile(99));
+}
+
+void test_histogram_p99_reports_tail_bucket(void) {
+    CoexLatencyHistogram histogram;
+    for (int i = 0; i < 99; i++) {
+        histogram.record(4);
+    }
+    histogram.record(150);
+
+    TEST_ASSERT_EQUAL(5, histogram.percentile(50));
+    TEST_ASSERT_EQUAL(5, histogram.percentile(99));
+    TEST_ASSERT_EQUAL(150, histogram.percentile(100));
+    TEST_ASSERT_EQUAL(150, histogram.maxMs);
+}
+
+void test_histogram_percentile_capped_by_max(void) {
+    CoexLatencyHistogram histogram;
+    histogram.record(120);
+    // Bucket bound is 200 ms but nothing slower than 120 ms was seen
+    TEST_ASSERT_EQUAL(120, histogram.percentile(99));
+}
+
+void test_histogram_overflow_bucket(void) {
+    CoexLatencyHistogram histogram;
+    histogram.record(5000);
+    TEST_ASSERT_EQUAL(1, histogram.buckets[COEX_LATENCY_BUCKETS - 1]);
+    TEST_ASSERT_EQUAL(5000, histogram.percentile(99));
+}
+
+void test_led_latency_recorded_per_preference(void) {
+    coex->recordLedUpdateLatency(8);
+    coex->noteActivity(CoexActivity::BLE_TRANSFER);
+    coex->recordLedUpdateLatency(40);
+
+    TEST_ASSERT_EQUAL(1, coex->getLedLatencyHistogram(CoexPreference::BALANCE).count);
+    TEST_ASSERT_EQUAL(1, coex->getLedLatencyHistogram(CoexPreference::PREFER_BT).count);
+    TEST_ASSERT_EQUAL(8, coex->getLedLatencyP99(CoexPreference::BALANCE));
+    TEST_ASSERT_EQUAL(40, coex->getLedLatencyP99(CoexPreference::PREFER_BT));
+    TEST_ASSERT_EQUAL(0, coex->getLedLatencyP99(CoexPreference::PREFER_WIFI));
+}
+
+void test_preference_names(void) {
+    TEST_ASSERT_EQUAL_STRING("balance", RadioCoex::getPreferenceName(CoexPreference::BALANCE));
+    TEST_ASSERT_EQUAL_STRING("wifi", RadioCoex::getPreferenceName(CoexPreference::PREFER_WIFI));
+    TEST_ASSERT_EQUAL_STRING("bt", RadioCoex::getPreferenceName(CoexPreference::PREFER_BT));
+}
+
+void test_reset_clears_state(void) {
+    coex->beginActivity(CoexActivity::WIFI_HANDSHAKE);
+    coex->recordLedUpdateLatency(10);
+    coex->reset();
+
+    TEST_ASSERT_TRUE(coex->mayScan());
+    TEST_ASSERT_TRUE(coex->getPreference() == CoexPreference::BALANCE);
+    TEST_ASSERT_EQUAL(0, coex->getLedLatencyHistogram(CoexPreference::PREFER_WIFI).count);
+}
+
+// =============================================================================
+// Main
+// =============================================================================
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+
+    // Activity
+    RUN_TEST(test_idle_radio_allows_scan_and_balances);
+    RUN_TEST(test_level_activity_lasts_until_ended);
+    RUN_TEST(test_burst_activity_expires_after_hold);
+    RUN_TEST(test_burst_never_noted_is_inactive_at_boot);
+
+    // Scan deferral
+    RUN_TEST(test_scan_deferred_during_websocket_transfer);
+    RUN_TEST(test_scan_deferral_counted_once_per_attempt);
+    RUN_TEST(test_scan_deferred_during_handshake);
+    RUN_TEST(test_scan_deferred_during_board_writes);
+    RUN_TEST(test_may_scan_does_not_count_deferral);
+
+    // Preference
+    RUN_TEST(test_handshake_prefers_wifi);
+    RUN_TEST(test_board_writes_prefer_bt);
+    RUN_TEST(test_board_writes_win_over_websocket_traffic);
+    RUN_TEST(test_handshake_wins_over_board_writes);
+    RUN_TEST(test_preference_returns_to_balance_in_loop);
+
+    // Airtime / budget
+    RUN_TEST(test_airtime_accumulates_per_activity);
+    RUN_TEST(test_stats_include_time_since_last_update);
+    RUN_TEST(test_scan_window_unrestricted_without_wifi_link);
+    RUN_TEST(test_scan_window_follows_duty_budget);
+    RUN_TEST(test_scan_duty_budget_is_clamped);
+
+    // Latency histogram
+    RUN_TEST(test_histogram_empty_percentile_is_zero);
+    RUN_TEST(test_histogram_p99_reports_tail_bucket);
+    RUN_TEST(test_histogram_percentile_capped_by_max);
+    RUN_TEST(test_histogram_overflow_bucket);
+    RUN_TEST(test_led_latency_recorded_per_preference);
+    RUN_TEST(test_preference_names);
+    RUN_TEST(test_reset_clears_state);
+
+    return UNITY_END();
+}
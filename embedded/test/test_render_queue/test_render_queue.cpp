@@ -0,0 +1,153 @@
+/**
+ * Unit Tests for the Coalescing Render Queue
+ *
+ * Tests request merging, dropped-state accounting and the render time and
+ * state-to-pixels latency metrics used by the display render task.
+ */
+
+#include <Arduino.h>
+
+#include <render_queue.h>
+#include <unity.h>
+
+static RenderQueue queue;
+
+void setUp(void) {
+    queue = RenderQueue();
+}
+
+void tearDown(void) {}
+
+// =============================================================================
+// Coalescing Tests
+// =============================================================================
+
+void test_idle_queue_takes_nothing(void) {
+    uint32_t publishedUs = 1234;
+    TEST_ASSERT_FALSE(queue.isPending());
+    TEST_ASSERT_EQUAL(0, queue.take(publishedUs));
+    TEST_ASSERT_EQUAL(1234, publishedUs);
+}
+
+void test_first_publish_wakes_consumer(void) {
+    TEST_ASSERT_TRUE(queue.publish(RENDER_FULL, 100));
+    TEST_ASSERT_FALSE(queue.publish(RENDER_FULL, 200));
+    TEST_ASSERT_TRUE(queue.isPending());
+}
+
+void test_publishes_merge_into_one_frame(void) {
+    queue.publish(RENDER_STATUS, 100);
+    queue.publish(RENDER_INFO, 200);
+    queue.publish(RENDER_INFO, 300);
+
+    uint32_t publishedUs = 0;
+    uint8_t flags = queue.take(publishedUs);
+    TEST_ASSERT_EQUAL(RENDER_STATUS | RENDER_INFO, flags);
+    TEST_ASSERT_EQUAL(100, publishedUs);
+    TEST_ASSERT_FALSE(queue.isPending());
+    TEST_ASSERT_EQUAL(0, queue.take(publishedUs));
+}
+
+void test_superseded_states_are_counted_as_dropped(void) {
+    for (int i = 0; i < 5; i++) {
+        queue.publish(RENDER_INFO, i);
+    }
+    uint32_t publishedUs;
+    queue.take(publishedUs);
+
+    TEST_ASSERT_EQUAL(5, queue.getMetrics().published);
+    TEST_ASSERT_EQUAL(4, queue.getMetrics().dropped);
+}
+
+void test_publish_after_take_wakes_again(void) {
+    uint32_t publishedUs;
+    queue.publish(RENDER_FULL, 100);
+    queue.take(publishedUs);
+
+    // A state change while the frame is being drawn needs another frame
+    TEST_ASSERT_TRUE(queue.publish(RENDER_STATUS, 150));
+    TEST_ASSERT_EQUAL(RENDER_STATUS, queue.take(publishedUs));
+    TEST_ASSERT_EQUAL(150, publishedUs);
+}
+
+void test_discard_drops_pending_states(void) {
+    queue.publish(RENDER_STATUS, 100);
+    queue.publish(RENDER_FULL, 200);
+    queue.discard();
+
+    uint32_t publishedUs;
+    TEST_ASSERT_FALSE(queue.isPending());
+    TEST_ASSERT_EQUAL(0, queue.take(publishedUs));
+    TEST_ASSERT_EQUAL(2, queue.getMetrics().dropped);
+    TEST_ASSERT_TRUE(queue.publish(RENDER_STATUS, 300));
+}
+
+// =============================================================================
+// Metrics Tests
+// =============================================================================
+
+void test_render_records_time_and_latency(void) {
+    queue.recordRender(1000, 4000, 9000);
+
+    const RenderMetrics& m = queue.getMetrics();
+    TEST_ASSERT_EQUAL(1, m.rendered);
+    TEST_ASSERT_EQUAL(5000, m.lastRenderUs);
+    TEST_ASSERT_EQUAL(8000, m.lastLatencyUs);
+}
+
+void test_render_metrics_track_max_and_average(void) {
+    queue.recordRender(0, 0, 2000);
+    queue.recordRender(10000, 11000, 17000);
+    queue.recordRender(20000, 20000, 21000);
+
+    const RenderMetrics& m = queue.getMetrics();
+    TEST_ASSERT_EQUAL(3, m.rendered);
+    TEST_ASSERT_EQUAL(6000, m.maxRenderUs);
+    TEST_ASSERT_EQUAL(3000, m.avgRenderUs());
+    TEST_ASSERT_EQUAL(7000, m.maxLatencyUs);
+    TEST_ASSERT_EQUAL(1000, m.lastLatencyUs);
+    TEST_ASSERT_EQUAL(10000 / 3, m.avgLatencyUs());
+}
+
+void test_latency_survives_micros_wrap(void) {
+    queue.recordRender(0xFFFFF000u, 0xFFFFFF00u, 0x00000400u);
+
+    TEST_ASSERT_EQUAL(0x500, queue.getMetrics().lastRenderUs);
+    TEST_ASSERT_EQUAL(0x1400, queue.getMetrics().lastLatencyUs);
+}
+
+void test_empty_metrics_average_to_zero(void) {
+    TEST_ASSERT_EQUAL(0, queue.getMetrics().avgRenderUs());
+    TEST_ASSERT_EQUAL(0, queue.getMetrics().avgLatencyUs());
+}
+
+void test_reset_metrics_keeps_pending_request(void) {
+    queue.publish(RENDER_FULL, 100);
+    queue.recordRender(0, 0, 100);
+    queue.resetMetrics();
+
+    TEST_ASSERT_EQUAL(0, queue.getMetrics().published);
+    TEST_ASSERT_EQUAL(0, queue.getMetrics().rendered);
+    TEST_ASSERT_TRUE(queue.isPending());
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+
+    // Coalescing tests
+    RUN_TEST(test_idle_queue_takes_nothing);
+    RUN_TEST(test_first_publish_wakes_consumer);
+    RUN_TEST(test_publishes_merge_into_one_frame);
+    RUN_TEST(test_superseded_states_are_counted_as_dropped);
+    RUN_TEST(test_publish_after_take_wakes_again);
+    RUN_TEST(test_discard_drops_pending_states);
+
+    // Metrics tests
+    RUN_TEST(test_render_records_time_and_latency);
+    RUN_TEST(test_render_metrics_track_max_and_average);
+    RUN_TEST(test_latency_survives_micros_wrap);
+    RUN_TEST(test_empty_metrics_average_to_zero);
+    RUN_TEST(test_reset_metrics_keeps_pending_request);
+
+    return UNITY_END();
+}
@@ -0,0 +1,211 @@
+/**
+ * Unit Tests for the RGB565 Tile Decoder
+ *
+ * Tests RLE decoding and per-tile lookup for the pre-decoded board images
+ * emitted by generate-board-data.mjs --image-format=rgb565 / rgb565-rle.
+ */
+
+#include <Arduino.h>
+
+#include <rgb565_tiles.h>
+#include <unity.h>
+#include <vector>
+
+// Encoder matching encodeRle565 in generate-board-data.mjs
+static std::vector<uint8_t> encode(const std::vector<uint16_t>& pixels) {
+    std::vector<uint8_t> out;
+    size_t literalStart = 0;
+    size_t i = 0;
+
+    auto pushPixel = [&out](uint16_t px) {
+        uint8_t bytes[2];
+        memcpy(bytes, &px, 2);
+        out.push_back(bytes[0]);
+        out.push_back(bytes[1]);
+    };
+    auto flushLiterals = [&](size_t end) {
+        while (literalStart < end) {
+            size_t n = min((size_t)128, end - literalStart);
+            out.push_back((uint8_t)(n - 1));
+            for (size_t k = 0; k < n; k++) {
+                pushPixel(pixels[literalStart + k]);
+            }
+            literalStart += n;
+        }
+    };
+
+    while (i < pixels.size()) {
+        size_t run = 1;
+        while (i + run < pixels.size() && run < 129 && pixels[i + run] == pixels[i]) {
+            run++;
+        }
+        if (run >= 3) {
+            flushLiterals(i);
+            out.push_back((uint8_t)(0x80 | (run - 2)));
+            pushPixel(pixels[i]);
+            i += run;
+            literalStart = i;
+        } else {
+            i += run;
+        }
+    }
+    flushLiterals(pixels.size());
+    return out;
+}
+
+void setUp(void) {}
+
+void tearDown(void) {}
+
+// =============================================================================
+// RLE Decode Tests
+// =============================================================================
+
+void test_decode_run_packet(void) {
+    std::vector<uint8_t> stream = encode(std::vector<uint16_t>(50, 0xBEEF));
+    TEST_ASSERT_EQUAL(3, (int)stream.size());
+
+    uint16_t out[50] = {0};
+    TEST_ASSERT_EQUAL(50, (int)rle565Decode(stream.data(), stream.size(), out, 50));
+    TEST_ASSERT_EQUAL_UINT16(0xBEEF, out[0]);
+    TEST_ASSERT_EQUAL_UINT16(0xBEEF, out[49]);
+}
+
+void test_decode_literal_packet(void) {
+    std::vector<uint16_t> pixels = {1, 2, 3, 4, 5};
+    std::vector<uint8_t> stream = encode(pixels);
+    TEST_ASSERT_EQUAL(1 + 10, (int)stream.size());
+
+    uint16_t out[5] = {0};
+    TEST_ASSERT_EQUAL(5, (int)rle565Decode(stream.data(), stream.size(), out, 5));
+    for (int i = 0; i < 5; i++) {
+        TEST_ASSERT_EQUAL(pixels[i], out[i]);
+    }
+}
+
+void test_decode_round_trips_mixed_data(void) {
+    std::vector<uint16_t> pixels;
+    for (int i = 0; i < 2000; i++) {
+        pixels.push_back((i / 40) % 3 == 0 ? 0x0841 : (uint16_t)(i * 2654435761u >> 16));
+    }
+    std::vector<uint8_t> stream = encode(pixels);
+    TEST_ASSERT_TRUE(stream.size() < pixels.size() * 2);
+
+    std::vector<uint16_t> out(pixels.size());
+    TEST_ASSERT_EQUAL((int)pixels.size(), (int)rle565Decode(stream.data(), stream.size(), out.data(), out.size()));
+    TEST_ASSERT_TRUE(out == pixels);
+}
+
+void test_decode_stops_at_destination_size(void) {
+    std::vector<uint8_t> stream = encode(std::vector<uint16_t>(100, 7));
+    uint16_t out[11];
+    out[10] = 0xAAAA;
+    TEST_ASSERT_EQUAL(10, (int)rle565Decode(stream.data(), stream.size(), out, 10));
+    TEST_ASSERT_EQUAL_UINT16(0xAAAA, out[10]);
+}
+
+void test_decode_stops_on_truncated_literal(void) {
+    std::vector<uint8_t> stream = encode({1, 2, 3, 4});
+    stream.pop_back();
+    uint16_t out[4];
+    TEST_ASSERT_EQUAL(0, (int)rle565Decode(stream.data(), stream.size(), out, 4));
+}
+
+void test_decode_stops_on_truncated_run(void) {
+    uint8_t stream[] = {0x85, 0x12};
+    uint16_t out[8];
+    TEST_ASSERT_EQUAL(0, (int)rle565Decode(stream, sizeof(stream), out, 8));
+}
+
+// =============================================================================
+// Tile Tests
+// =============================================================================
+
+void test_raw_tile_copies_its_span(void) {
+    uint16_t image[12];
+    for (int i = 0; i < 12; i++) {
+        image[i] = 100 + i;
+    }
+    // Two tiles of 2 rows x 3 pixels
+    uint32_t offsets[] = {0, 12, 24};
+
+    uint16_t out[6];
+    TEST_ASSERT_TRUE(decodeRgb565Tile((const uint8_t*)image, offsets, 1, false, out, 6));
+    TEST_ASSERT_EQUAL(106, out[0]);
+    TEST_ASSERT_EQUAL(111, out[5]);
+}
+
+void test_rle_tiles_decode_independently(void) {
+    std::vector<uint16_t> first(32, 0x1111);
+    std::vector<uint16_t> second;
+    for (int i = 0; i < 32; i++) {
+        second.push_back(i < 16 ? 0x2222 : (uint16_t)i);
+    }
+    std::vector<uint8_t> data = encode(first);
+    uint32_t split = data.size();
+    std::vector<uint8_t> tail = encode(second);
+    data.insert(data.end(), tail.begin(), tail.end());
+    uint32_t offsets[] = {0, split, (uint32_t)data.size()};
+
+    uint16_t out[32];
+    TEST_ASSERT_TRUE(decodeRgb565Tile(data.data(), offsets, 1, true, out, 32));
+    TEST_ASSERT_EQUAL_UINT16(0x2222, out[0]);
+    TEST_ASSERT_EQUAL(31, out[31]);
+}
+
+void test_short_tile_reports_failure(void) {
+    std::vector<uint8_t> data = encode(std::vector<uint16_t>(8, 5));
+    uint32_t offsets[] = {0, (uint32_t)data.size()};
+    uint16_t out[16];
+    TEST_ASSERT_FALSE(decodeRgb565Tile(data.data(), offsets, 0, true, out, 16));
+}
+
+void test_board_sized_image_round_trips(void) {
+    // 460x560 in 16-row tiles, flat background with scattered detail
+    const int width = 460;
+    const int height = 560;
+    const int tileHeight = 16;
+
+    std::vector<uint16_t> image(width * height);
+    for (int i = 0; i < width * height; i++) {
+        image[i] = (i % 97 < 12) ? (uint16_t)(i * 31) : 0x2104;
+    }
+
+    std::vector<uint8_t> data;
+    std::vector<uint32_t> offsets = {0};
+    for (int y = 0; y < height; y += tileHeight) {
+        std::vector<uint16_t> tile(image.begin() + y * width, image.begin() + (y + tileHeight) * width);
+        std::vector<uint8_t> encoded = encode(tile);
+        data.insert(data.end(), encoded.begin(), encoded.end());
+        offsets.push_back(data.size());
+    }
+    TEST_ASSERT_TRUE(data.size() < image.size());
+
+    std::vector<uint16_t> out(width * height);
+    for (int t = 0; t < height / tileHeight; t++) {
+        TEST_ASSERT_TRUE(
+            decodeRgb565Tile(data.data(), offsets.data(), t, true, out.data() + t * tileHeight * width,
+                             tileHeight * width));
+    }
+    TEST_ASSERT_TRUE(out == image);
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+
+    // RLE decode tests
+    RUN_TEST(test_decode_run_packet);
+    RUN_TEST(test_decode_literal_packet);
+    RUN_TEST(test_decode_round_trips_mixed_data);
+    RUN_TEST(test_decode_stops_at_destination_size);
+    RUN_TEST(test_decode_stops_on_truncated_literal);
+    RUN_TEST(test_decode_stops_on_truncated_run);
+
+    // Tile tests
+    RUN_TEST(test_raw_tile_copies_its_span);
+    RUN_TEST(test_rle_tiles_decode_independently);
+    RUN_TEST(test_short_tile_reports_failure);
+    RUN_TEST(test_board_sized_image_round_trips);
+
+    return UNITY_END();
+}
@@ -0,0 +1,385 @@
+/**
+ * Unit Tests for the Telemetry Uplink
+ *
+ * Tests queueing of log lines, when a batch is due (size, age, link
+ * activity, byte budget), and the sendDeviceLogs batches it produces.
+ */
+
+#include <Arduino.h>
+#include <Preferences.h>
+#include <unity.h>
+
+#include <config_manager.h>
+#include <log_buffer.h>
+#include <string>
+#include <telemetry_uplink.h>
+
+static TelemetryUplink* uplink;
+static uint32_t clockSeconds;
+static char upload[8192];
+
+static uint32_t testClock() {
+    return clockSeconds;
+}
+
+static size_t testMetrics(char* out, size_t capacity) {
+    return snprintf(out, capacity, "{\"heap\":%u,\"rssi\":%d}", 123456u, -60);
+}
+
+static void addLines(int count, LogLevel level = LogLevel::INFO) {
+    for (int i = 0; i < count; i++) {
+        char message[32];
+        snprintf(message, sizeof(message), "Test: line %d", i);
+        uplink->addLog(millis(), level, message);
+    }
+}
+
+static int countOccurrences(const char* haystack, const char* needle) {
+    int count = 0;
+    for (const char* p = strstr(haystack, needle); p; p = strstr(p + 1, needle)) {
+        count++;
+    }
+    return count;
+}
+
+void setUp(void) {
+    Preferences::resetAll();
+    Config.reset();
+    mockSetMillis(100000);
+    clockSeconds = 1700000000;
+    uplink = new TelemetryUplink();
+    uplink->setClock(testClock);
+}
+
+void tearDown(void) {
+    delete uplink;
+    uplink = nullptr;
+    Logger.setSink(nullptr);
+    Logger.clear();
+}
+
+// =============================================================================
+// Queue Tests
+// =============================================================================
+
+void test_lines_below_min_level_ignored(void) {
+    uplink->addLog(millis(), LogLevel::DEBUG, "Test: debug");
+    TEST_ASSERT_EQUAL(0, uplink->getQueuedCount());
+
+    uplink->setMinLevel(LogLevel::WARN);
+    uplink->addLog(millis(), LogLevel::INFO, "Test: info");
+    uplink->addLog(millis(), LogLevel::WARN, "Test: warn");
+    TEST_ASSERT_EQUAL(1, uplink->getQueuedCount());
+}
+
+void test_empty_message_ignored(void) {
+    uplink->addLog(millis(), LogLevel::INFO, "");
+    uplink->addLog(millis(), LogLevel::INFO, nullptr);
+    TEST_ASSERT_EQUAL(0, uplink->getQueuedCount());
+}
+
+void test_repeated_line_collapsed(void) {
+    uplink->addLog(100000, LogLevel::INFO, "Test: same");
+    uplink->addLog(100500, LogLevel::INFO, "Test: same");
+    uplink->addLog(101000, LogLevel::INFO, "Test: same");
+    TEST_ASSERT_EQUAL(1, uplink->getQueuedCount());
+    TEST_ASSERT_EQUAL(2, uplink->getStats().linesCollapsed);
+
+    TEST_ASSERT_EQUAL(1, uplink->beginUpload(upload, sizeof(upload)));
+    TEST_ASSERT_NOT_NULL(strstr(upload, "\\\"repeat\\\":3,\\\"last_uptime_ms\\\":101000"));
+}
+
+void test_same_text_at_other_level_not_collapsed(void) {
+    uplink->addLog(millis(), LogLevel::INFO, "Test: same");
+    uplink->addLog(millis(), LogLevel::WARN, "Test: same");
+    TEST_ASSERT_EQUAL(2, uplink->getQueuedCount());
+}
+
+void test_full_queue_drops_oldest(void) {
+    addLines(TELEMETRY_QUEUE_SIZE + 3);
+    TEST_ASSERT_EQUAL(TELEMETRY_QUEUE_SIZE, uplink->getQueuedCount());
+    TEST_ASSERT_EQUAL(3, uplink->getStats().linesDropped);
+
+    uplink->beginUpload(upload, sizeof(upload));
+    TEST_ASSERT_NULL(strstr(upload, "\"line 2\""));
+    TEST_ASSERT_NOT_NULL(strstr(upload, "\"line 3\""));
+}
+
+void test_long_message_truncated(void) {
+    std::string message = "Test: " + std::string(200, 'x');
+    uplink->addLog(millis(), LogLevel::INFO, message.c_str());
+
+    uplink->beginUpload(upload, sizeof(upload));
+    std::string expected = "\"message\":\"" + std::string(TELEMETRY_MESSAGE_SIZE - 1 - 6, 'x') + "\"";
+    TEST_ASSERT_NOT_NULL(strstr(upload, expected.c_str()));
+}
+
+void test_disable_clears_and_stops_queueing(void) {
+    addLines(3);
+    uplink->setEnabled(false);
+    TEST_ASSERT_EQUAL(0, uplink->getQueuedCount());
+
+    addLines(3);
+    TEST_ASSERT_EQUAL(0, uplink->getQueuedCount());
+    TEST_ASSERT_FALSE(uplink->isUploadDue());
+}
+
+void test_begin_reads_config(void) {
+    Config.setBool(TelemetryUplink::KEY_ENABLED, false);
+    uplink->begin();
+    TEST_ASSERT_FALSE(uplink->isEnabled());
+
+    Config.setBool(TelemetryUplink::KEY_ENABLED, true);
+    Config.setInt(TelemetryUplink::KEY_LEVEL, LOG_LEVEL_ERROR);
+    uplink->begin();
+    TEST_ASSERT_TRUE(uplink->isEnabled());
+    uplink->addLog(millis(), LogLevel::WARN, "Test: warn");
+    TEST_ASSERT_EQUAL(0, uplink->getQueuedCount());
+}
+
+void test_logger_feeds_global_uplink(void) {
+    Telemetry.begin();
+    int before = Telemetry.getQueuedCount();
+
+    Logger.logln("Test: from logger %d", 7);
+    TEST_ASSERT_EQUAL(before, Telemetry.getQueuedCount());  // Not until the log task drains
+    Logger.drain();
+    TEST_ASSERT_EQUAL(before + 1, Telemetry.getQueuedCount());
+}
+
+// =============================================================================
+// Scheduling Tests
+// =============================================================================
+
+void test_not_due_without_clock(void) {
+    addLines(TELEMETRY_BATCH_SIZE);
+    clockSeconds = 0;
+    TEST_ASSERT_FALSE(uplink->isUploadDue());
+    TEST_ASSERT_EQUAL(0, uplink->beginUpload(upload, sizeof(upload)));
+}
+
+void test_partial_batch_waits_for_flush_delay(void) {
+    addLines(3);
+    TEST_ASSERT_FALSE(uplink->isUploadDue());
+
+    mockAdvanceMillis(TELEMETRY_FLUSH_MS);
+    TEST_ASSERT_TRUE(uplink->isUploadDue());
+}
+
+void test_full_batch_due_at_once(void) {
+    addLines(TELEMETRY_BATCH_SIZE);
+    TEST_ASSERT_TRUE(uplink->isUploadDue());
+}
+
+void test_error_line_due_at_once(void) {
+    addLines(1, LogLevel::ERROR);
+    TEST_ASSERT_TRUE(uplink->isUploadDue());
+}
+
+void test_link_activity_holds_off_upload(void) {
+    addLines(TELEMETRY_BATCH_SIZE);
+    uplink->linkActivity();
+    TEST_ASSERT_FALSE(uplink->isUploadDue());
+
+    mockAdvanceMillis(TELEMETRY_QUIET_MS);
+    TEST_ASSERT_TRUE(uplink->isUploadDue());
+}
+
+void test_min_interval_between_batches(void) {
+    addLines(TELEMETRY_BATCH_SIZE);
+    uplink->beginUpload(upload, sizeof(upload));
+    TEST_ASSERT_FALSE(uplink->isUploadDue());
+    uplink->endUpload(true);
+
+    addLines(TELEMETRY_BATCH_SIZE);
+    TEST_ASSERT_FALSE(uplink->isUploadDue());
+    mockAdvanceMillis(TELEMETRY_MIN_INTERVAL_MS);
+    TEST_ASSERT_TRUE(uplink->isUploadDue());
+}
+
+void test_byte_budget_limits_rate(void) {
+    // Far more lines than the budget allows, offered at the batch interval
+    const int ROUNDS = 20;
+    for (int round = 0; round < ROUNDS; round++) {
+        addLines(TELEMETRY_BATCH_SIZE);
+        mockAdvanceMillis(TELEMETRY_MIN_INTERVAL_MS);
+        clockSeconds += TELEMETRY_MIN_INTERVAL_MS / 1000;
+        if (uplink->isUploadDue()) {
+            uplink->beginUpload(upload, sizeof(upload));
+            uplink->endUpload(true);
+        }
+    }
+
+    uint32_t allowed = TELEMETRY_BURST_BYTES + TELEMETRY_RATE_BYTES_PER_S * ROUNDS * TELEMETRY_MIN_INTERVAL_MS / 1000;
+    TEST_ASSERT_TRUE(uplink->getStats().bytesSent <= allowed);
+    TEST_ASSERT_TRUE(uplink->getStats().bytesSent > allowed / 2);
+    TEST_ASSERT_TRUE(uplink->getStats().linesSent < ROUNDS * TELEMETRY_BATCH_SIZE);
+    TEST_ASSERT_TRUE(uplink->getStats().linesDropped > 0);
+}
+
+void test_snapshot_due_on_interval(void) {
+    uplink->setMetricsProvider(testMetrics);
+    TEST_ASSERT_TRUE(uplink->isUploadDue());
+    TEST_ASSERT_EQUAL(1, uplink->beginUpload(upload, sizeof(upload)));
+    uplink->endUpload(true);
+    TEST_ASSERT_EQUAL(1, uplink->getStats().snapshotsSent);
+
+    mockAdvanceMillis(TELEMETRY_MIN_INTERVAL_MS);
+    TEST_ASSERT_FALSE(uplink->isUploadDue());
+    mockAdvanceMillis(TELEMETRY_METRICS_INTERVAL_MS);
+    TEST_ASSERT_TRUE(uplink->isUploadDue());
+}
+
+// =============================================================================
+// Upload Tests
+// =============================================================================
+
+void test_batch_format(void) {
+    uplink->addLog(100000, LogLevel::WARN, "GraphQL: Connected to host");
+    uplink->addLog(100250, LogLevel::INFO, "[Aurora] Frame ok");
+    uplink->addLog(100500, LogLevel::ERROR, "Setup complete!");
+
+    TEST_ASSERT_EQUAL(3, uplink->beginUpload(upload, sizeof(upload)));
+    TEST_ASSERT_EQUAL_STRING(
+        "{\"input\":{\"logs\":["
+        "{\"ts\":1700000000000,\"level\":\"warn\",\"component\":\"graphql\",\"message\":\"Connected to host\","
+        "\"metadata\":\"{\\\"uptime_ms\\\":100000}\"},"
+        "{\"ts\":1700000000250,\"level\":\"info\",\"component\":\"aurora\",\"message\":\"Frame ok\","
+        "\"metadata\":\"{\\\"uptime_ms\\\":100250}\"},"
+        "{\"ts\":1700000000500,\"level\":\"error\",\"component\":\"firmware\",\"message\":\"Setup complete!\","
+        "\"metadata\":\"{\\\"uptime_ms\\\":100500}\"}"
+        "]}}",
+        upload);
+    TEST_ASSERT_TRUE(uplink->isUploadInFlight());
+}
+
+void test_message_escaped(void) {
+    uplink->addLog(millis(), LogLevel::INFO, "Error: \"bad\" path\\x\ttab\x01");
+    uplink->beginUpload(upload, sizeof(upload));
+    TEST_ASSERT_NOT_NULL(strstr(upload, "\"message\":\"\\\"bad\\\" path\\\\x\\ttab\\u0001\""));
+}
+
+void test_snapshot_leads_batch(void) {
+    uplink->setMetricsProvider(testMetrics);
+    addLines(2);
+
+    TEST_ASSERT_EQUAL(3, uplink->beginUpload(upload, sizeof(upload)));
+    TEST_ASSERT_NOT_NULL(strstr(upload, "{\"input\":{\"logs\":[{\"ts\":1700000000000,\"level\":\"info\","
+                                        "\"component\":\"metrics\",\"message\":\"snapshot\","
+                                        "\"metadata\":\"{\\\"heap\\\":123456,\\\"rssi\\\":-60}\"},"));
+}
+
+void test_upload_limited_to_batch_size(void) {
+    addLines(TELEMETRY_BATCH_SIZE + 4);
+    TEST_ASSERT_EQUAL(TELEMETRY_BATCH_SIZE, uplink->beginUpload(upload, sizeof(upload)));
+    uplink->endUpload(true);
+    TEST_ASSERT_EQUAL(4, uplink->getQueuedCount());
+}
+
+void test_upload_limited_to_buffer(void) {
+    addLines(8);
+    char small[400];
+    int sent = uplink->beginUpload(small, sizeof(small));
+    TEST_ASSERT_TRUE(sent > 0 && sent < 8);
+    TEST_ASSERT_TRUE(strlen(small) < sizeof(small));
+    TEST_ASSERT_EQUAL_STRING("]}}", small + strlen(small) - 3);
+}
+
+void test_delivered_lines_removed(void) {
+    addLines(5);
+    uplink->beginUpload(upload, sizeof(upload));
+    uplink->endUpload(true);
+
+    TEST_ASSERT_FALSE(uplink->isUploadInFlight());
+    TEST_ASSERT_EQUAL(0, uplink->getQueuedCount());
+    TEST_ASSERT_EQUAL(5, uplink->getStats().linesSent);
+    TEST_ASSERT_EQUAL(1, uplink->getStats().batchesSent);
+}
+
+void test_failed_batch_resent_after_retry_delay(void) {
+    addLines(TELEMETRY_BATCH_SIZE);
+    uplink->beginUpload(upload, sizeof(upload));
+    std::string first = upload;
+    uplink->endUpload(false);
+
+    TEST_ASSERT_EQUAL(TELEMETRY_BATCH_SIZE, uplink->getQueuedCount());
+    TEST_ASSERT_EQUAL(1, uplink->getStats().batchFailures);
+    TEST_ASSERT_FALSE(uplink->isUploadDue());
+
+    mockAdvanceMillis(TELEMETRY_RETRY_MS);
+    clockSeconds += TELEMETRY_RETRY_MS / 1000;
+    TEST_ASSERT_TRUE(uplink->isUploadDue());
+    uplink->beginUpload(upload, sizeof(upload));
+    TEST_ASSERT_EQUAL_STRING(first.c_str(), upload);
+}
+
+void test_lines_during_upload_wait_for_next_batch(void) {
+    uplink->addLog(millis(), LogLevel::INFO, "Test: same");
+    uplink->beginUpload(upload, sizeof(upload));
+
+    // Not folded into the line already sent
+    uplink->addLog(millis(), LogLevel::INFO, "Test: same");
+    TEST_ASSERT_EQUAL(0, uplink->getStats().linesCollapsed);
+    uplink->endUpload(true);
+    TEST_ASSERT_EQUAL(1, uplink->getQueuedCount());
+}
+
+void test_overflow_while_in_flight(void) {
+    addLines(4);
+    uplink->beginUpload(upload, sizeof(upload));
+
+    // Newer lines push out the batch in flight; delivery removes nothing else
+    for (int i = 0; i < TELEMETRY_QUEUE_SIZE; i++) {
+        char message[32];
+        snprintf(message, sizeof(message), "Test: newer %d", i);
+        uplink->addLog(millis(), LogLevel::INFO, message);
+    }
+    TEST_ASSERT_EQUAL(0, uplink->getStats().linesDropped);
+    uplink->endUpload(true);
+    TEST_ASSERT_EQUAL(TELEMETRY_QUEUE_SIZE, uplink->getQueuedCount());
+
+    uplink->beginUpload(upload, sizeof(upload));
+    TEST_ASSERT_EQUAL(1, countOccurrences(upload, "\"newer 0\""));
+}
+
+// =============================================================================
+// Main
+// =============================================================================
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+
+    // Queue tests
+    RUN_TEST(test_lines_below_min_level_ignored);
+    RUN_TEST(test_empty_message_ignored);
+    RUN_TEST(test_repeated_line_collapsed);
+    RUN_TEST(test_same_text_at_other_level_not_collapsed);
+    RUN_TEST(test_full_queue_drops_oldest);
+    RUN_TEST(test_long_message_truncated);
+    RUN_TEST(test_disable_clears_and_stops_queueing);
+    RUN_TEST(test_begin_reads_config);
+    RUN_TEST(test_logger_feeds_global_uplink);
+
+    // Scheduling tests
+    RUN_TEST(test_not_due_without_clock);
+    RUN_TEST(test_partial_batch_waits_for_flush_delay);
+    RUN_TEST(test_full_batch_due_at_once);
+    RUN_TEST(test_error_line_due_at_once);
+    RUN_TEST(test_link_activity_holds_off_upload);
+    RUN_TEST(test_min_interval_between_batches);
+    RUN_TEST(test_byte_budget_limits_rate);
+    RUN_TEST(test_snapshot_due_on_interval);
+
+    // Upload tests
+    RUN_TEST(test_batch_format);
+    RUN_TEST(test_message_escaped);
+    RUN_TEST(test_snapshot_leads_batch);
+    RUN_TEST(test_upload_limited_to_batch_size);
+    RUN_TEST(test_upload_limited_to_buffer);
+    RUN_TEST(test_delivered_lines_removed);
+    RUN_TEST(test_failed_batch_resent_after_retry_delay);
+    RUN_TEST(test_lines_during_upload_wait_for_next_batch);
+    RUN_TEST(test_overflow_while_in_flight);
+
+    return UNITY_END();
+}
@@ -0,0 +1,229 @@
+/**
+ * Unit Tests for the Rasterised Text Cache
+ *
+ * Tests slot lookup, LRU eviction, strip keys and datum anchoring used to
+ * blit cached climb name and grade strips instead of re-rendering glyphs.
+ */
+
+#include <Arduino.h>
+
+#include <text_cache.h>
+#include <unity.h>
+
+static const int FONT_A = 0;
+static const int FONT_B = 1;
+
+// Distinct strip key per number, for the slot tests
+static TextCacheKey key(uint32_t n) {
+    char text[16];
+    snprintf(text, sizeof(text), "Climb %u", (unsigned)n);
+    return textCacheKey(text, &FONT_A, 0xFFFF, 0, 200, 24, 4);
+}
+
+void setUp(void) {}
+
+void tearDown(void) {}
+
+// =============================================================================
+// Key Tests
+// =============================================================================
+
+void test_key_is_stable(void) {
+    TEST_ASSERT_TRUE(textCacheKey("Crimpy", &FONT_A, 0xFFFF, 0, 200, 24, 4) ==
+                     textCacheKey("Crimpy", &FONT_A, 0xFFFF, 0, 200, 24, 4));
+}
+
+void test_key_covers_every_input(void) {
+    TextCacheKey base = textCacheKey("Crimpy", &FONT_A, 0xFFFF, 0, 200, 24, 4);
+    TEST_ASSERT_TRUE(base != textCacheKey("Crimpz", &FONT_A, 0xFFFF, 0, 200, 24, 4));
+    TEST_ASSERT_TRUE(base != textCacheKey("Crimpy", &FONT_B, 0xFFFF, 0, 200, 24, 4));
+    TEST_ASSERT_TRUE(base != textCacheKey("Crimpy", &FONT_A, 0x8410, 0, 200, 24, 4));
+    TEST_ASSERT_TRUE(base != textCacheKey("Crimpy", &FONT_A, 0xFFFF, 0x2104, 200, 24, 4));
+    TEST_ASSERT_TRUE(base != textCacheKey("Crimpy", &FONT_A, 0xFFFF, 0, 201, 24, 4));
+    TEST_ASSERT_TRUE(base != textCacheKey("Crimpy", &FONT_A, 0xFFFF, 0, 200, 25, 4));
+    TEST_ASSERT_TRUE(base != textCacheKey("Crimpy", &FONT_A, 0xFFFF, 0, 200, 24, 6));
+}
+
+// =============================================================================
+// Anchor Tests
+// =============================================================================
+
+void test_anchor_horizontal(void) {
+    int16_t x, y;
+    textDatumAnchor(0, 200, 24, x, y);  // top_left
+    TEST_ASSERT_EQUAL(0, x);
+    textDatumAnchor(1, 200, 24, x, y);  // top_center
+    TEST_ASSERT_EQUAL(100, x);
+    textDatumAnchor(2, 200, 24, x, y);  // top_right
+    TEST_ASSERT_EQUAL(200, x);
+}
+
+void test_anchor_vertical(void) {
+    int16_t x, y;
+    textDatumAnchor(0, 200, 24, x, y);  // top_left
+    TEST_ASSERT_EQUAL(0, y);
+    textDatumAnchor(4, 200, 24, x, y);  // middle_left
+    TEST_ASSERT_EQUAL(12, y);
+    textDatumAnchor(10, 200, 24, x, y);  // bottom_right
+    TEST_ASSERT_EQUAL(24, y);
+    TEST_ASSERT_EQUAL(200, x);
+}
+
+// =============================================================================
+// Lookup / LRU Tests
+// =============================================================================
+
+void test_miss_then_hit(void) {
+    TextCache cache(4);
+    bool hit = true;
+    int slot = cache.acquire(key(100), hit);
+    TEST_ASSERT_FALSE(hit);
+
+    int again = cache.acquire(key(100), hit);
+    TEST_ASSERT_TRUE(hit);
+    TEST_ASSERT_EQUAL(slot, again);
+    TEST_ASSERT_EQUAL(1, cache.getStats().hits);
+    TEST_ASSERT_EQUAL(1, cache.getStats().misses);
+}
+
+void test_fills_empty_slots_before_evicting(void) {
+    TextCache cache(4);
+    bool hit;
+    bool seen[4] = {false, false, false, false};
+    for (uint32_t n = 1; n <= 4; n++) {
+        seen[cache.acquire(key(n), hit)] = true;
+    }
+    for (int i = 0; i < 4; i++) {
+        TEST_ASSERT_TRUE(seen[i]);
+    }
+    TEST_ASSERT_EQUAL(4, cache.size());
+    TEST_ASSERT_EQUAL(0, cache.getStats().evictions);
+}
+
+void test_evicts_least_recently_used(void) {
+    TextCache cache(3);
+    bool hit;
+    int slot1 = cache.acquire(key(1), hit);
+    cache.acquire(key(2), hit);
+    cache.acquire(key(3), hit);
+
+    // Touch 1 so 2 becomes the oldest
+    cache.acquire(key(1), hit);
+    int slot4 = cache.acquire(key(4), hit);
+    TEST_ASSERT_FALSE(hit);
+    TEST_ASSERT_TRUE(slot1 != slot4);
+    TEST_ASSERT_EQUAL(1, cache.getStats().evictions);
+
+    cache.acquire(key(1), hit);
+    TEST_ASSERT_TRUE(hit);
+    cache.acquire(key(3), hit);
+    TEST_ASSERT_TRUE(hit);
+    cache.acquire(key(2), hit);
+    TEST_ASSERT_FALSE(hit);
+}
+
+void test_scrolling_window_hits_after_first_pass(void) {
+    // 9 visible rows x (name + grade) scrolled back and forth over 12 items
+    TextCache cache(40);
+    bool hit;
+    for (int pass = 0; pass < 3; pass++) {
+        for (int offset = 0; offset <= 3; offset++) {
+            for (int row = 0; row < 9; row++) {
+                cache.acquire(key((offset + row) * 2), hit);
+                cache.acquire(key((offset + row) * 2 + 1), hit);
+            }
+        }
+    }
+    TEST_ASSERT_EQUAL(24, cache.getStats().misses);
+    TEST_ASSERT_EQUAL(0, cache.getStats().evictions);
+}
+
+void test_hash_collision_is_a_miss(void) {
+    // Same primary hash, different text: the second hash must tell them apart
+    TextCache cache(4);
+    bool hit;
+    TextCacheKey a = textCacheKey("Crimpy", &FONT_A, 0xFFFF, 0, 200, 24, 4);
+    TextCacheKey b = textCacheKey("Slopey", &FONT_A, 0xFFFF, 0, 200, 24, 4);
+    b.hash = a.hash;
+
+    int slotA = cache.acquire(a, hit);
+    int slotB = cache.acquire(b, hit);
+    TEST_ASSERT_FALSE(hit);
+    TEST_ASSERT_TRUE(slotA != slotB);
+
+    b.check = a.check;
+    b.length = a.length + 1;
+    cache.acquire(b, hit);
+    TEST_ASSERT_FALSE(hit);
+}
+
+void test_evict_oldest_skips_keep(void) {
+    TextCache cache(3);
+    bool hit;
+    int slot1 = cache.acquire(key(1), hit);
+    int slot2 = cache.acquire(key(2), hit);
+    int slot3 = cache.acquire(key(3), hit);
+
+    TEST_ASSERT_EQUAL(slot2, cache.evictOldest(slot1));
+    TEST_ASSERT_EQUAL(slot3, cache.evictOldest(slot1));
+    TEST_ASSERT_EQUAL(-1, cache.evictOldest(slot1));
+    TEST_ASSERT_EQUAL(1, cache.size());
+    TEST_ASSERT_EQUAL(2, cache.getStats().evictions);
+
+    cache.acquire(key(1), hit);
+    TEST_ASSERT_TRUE(hit);
+    cache.acquire(key(2), hit);
+    TEST_ASSERT_FALSE(hit);
+}
+
+void test_release_frees_slot(void) {
+    TextCache cache(2);
+    bool hit;
+    int slot = cache.acquire(key(7), hit);
+    cache.release(slot);
+    TEST_ASSERT_EQUAL(0, cache.size());
+
+    cache.acquire(key(7), hit);
+    TEST_ASSERT_FALSE(hit);
+}
+
+void test_capacity_is_clamped(void) {
+    TEST_ASSERT_EQUAL(TEXT_CACHE_MAX_ENTRIES, TextCache(255).capacity());
+    TEST_ASSERT_EQUAL(1, TextCache(0).capacity());
+}
+
+void test_clear_drops_everything(void) {
+    TextCache cache(4);
+    bool hit;
+    cache.acquire(key(1), hit);
+    cache.acquire(key(2), hit);
+    cache.clear();
+    TEST_ASSERT_EQUAL(0, cache.size());
+    cache.acquire(key(1), hit);
+    TEST_ASSERT_FALSE(hit);
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+
+    // Key tests
+    RUN_TEST(test_key_is_stable);
+    RUN_TEST(test_key_covers_every_input);
+
+    // Anchor tests
+    RUN_TEST(test_anchor_horizontal);
+    RUN_TEST(test_anchor_vertical);
+
+    // Lookup / LRU tests
+    RUN_TEST(test_miss_then_hit);
+    RUN_TEST(test_fills_empty_slots_before_evicting);
+    RUN_TEST(test_evicts_least_recently_used);
+    RUN_TEST(test_scrolling_window_hits_after_first_pass);
+    RUN_TEST(test_hash_collision_is_a_miss);
+    RUN_TEST(test_evict_oldest_skips_keep);
+    RUN_TEST(test_release_frees_slot);
+    RUN_TEST(test_capacity_is_clamped);
+    RUN_TEST(test_clear_drops_everything);
+
+    return UNITY_END();
+}
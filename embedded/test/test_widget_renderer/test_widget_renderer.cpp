@@ -0,0 +1,491 @@
+/**
+ * Unit Tests for the Retained-Mode Widget Renderer
+ *
+ * Tests content-hash dirty tracking, overlap and damage handling, clipping
+ * and per-refresh statistics with a fake display host.
+ */
+
+#include <Arduino.h>
+
+#include <unity.h>
+#include <vector>
+#include <widget_renderer.h>
+
+// =============================================================================
+// Fake display host
+// =============================================================================
+
+class FakeHost : public WidgetHost {
+  public:
+    uint32_t hashes[WIDGET_MAX_WIDGETS];
+    unsigned long drawMs[WIDGET_MAX_WIDGETS];  // Mock time each draw takes
+    std::vector<uint8_t> drawn;
+    std::vector<bool> retained;
+    std::vector<WidgetRect> clips;
+    int clipClears;
+
+    FakeHost() { reset(); }
+
+    void reset() {
+        memset(hashes, 0, sizeof(hashes));
+        memset(drawMs, 0, sizeof(drawMs));
+        drawn.clear();
+        retained.clear();
+        clips.clear();
+        clipClears = 0;
+    }
+
+    void resetDraws() {
+        drawn.clear();
+        retained.clear();
+        clips.clear();
+        clipClears = 0;
+    }
+
+    bool wasDrawn(uint8_t id) const {
+        for (uint8_t d : drawn) {
+            if (d == id) return true;
+        }
+        return false;
+    }
+
+    uint32_t widgetHash(uint8_t id) override { return hashes[id]; }
+    void drawWidget(uint8_t id, const WidgetRect& rect, bool wasRetained) override {
+        drawn.push_back(id);
+        retained.push_back(wasRetained);
+        mockAdvanceMillis(drawMs[id]);
+    }
+    void setWidgetClip(const WidgetRect* rect) override {
+        if (rect) {
+            clips.push_back(*rect);
+        } else {
+            clipClears++;
+        }
+    }
+};
+
+static FakeHost host;
+static WidgetRenderer* renderer = nullptr;
+
+// Landscape-like layout: status bar, board panel, QR overlaid on the board, queue rows
+enum { STATUS = 0, BOARD, QR, HEADER, ROW_0 };
+static const int ROWS = 9;
+
+static void setupLayout() {
+    renderer->setRect(STATUS, WidgetRect(0, 0, 800, 40));
+    renderer->setRect(BOARD, WidgetRect(0, 40, 533, 380));
+    renderer->setRect(QR, WidgetRect(4, 390, 86, 86));
+    renderer->setRect(HEADER, WidgetRect(533, 40, 267, 24));
+    for (int i = 0; i < ROWS; i++) {
+        renderer->setRect(ROW_0 + i, WidgetRect(533, 64 + i * 48, 267, 48));
+    }
+}
+
+void setUp(void) {
+    host.reset();
+    delete renderer;
+    renderer = new WidgetRenderer(host);
+    mockSetMillis(1000);
+}
+
+void tearDown(void) {}
+
+// =============================================================================
+// WidgetRect / ContentHash Tests
+// =============================================================================
+
+void test_rect_intersects_overlapping(void) {
+    TEST_ASSERT_TRUE(WidgetRect(0, 0, 10, 10).intersects(WidgetRect(5, 5, 10, 10)));
+}
+
+void test_rect_touching_edges_do_not_intersect(void) {
+    TEST_ASSERT_FALSE(WidgetRect(0, 0, 10, 10).intersects(WidgetRect(10, 0, 10, 10)));
+    TEST_ASSERT_FALSE(WidgetRect(0, 0, 10, 10).intersects(WidgetRect(0, 10, 10, 10)));
+}
+
+void test_empty_rect_never_intersects(void) {
+    TEST_ASSERT_FALSE(WidgetRect(0, 0, 10, 10).intersects(WidgetRect()));
+    TEST_ASSERT_EQUAL_UINT32(0, WidgetRect(5, 5, 0, 10).area());
+}
+
+void test_rect_intersection(void) {
+    WidgetRect r = WidgetRect(0, 0, 10, 10).intersection(WidgetRect(5, 2, 10, 4));
+    TEST_ASSERT_TRUE(r == WidgetRect(5, 2, 5, 4));
+    TEST_ASSERT_TRUE(WidgetRect(0, 0, 10, 10).intersection(WidgetRect(20, 20, 5, 5)).isEmpty());
+}
+
+void test_content_hash_is_deterministic(void) {
+    uint32_t a = ContentHash().add("Climb").add((int32_t)5).add(true).value();
+    uint32_t b = ContentHash().add("Climb").add((int32_t)5).add(true).value();
+    TEST_ASSERT_EQUAL_UINT32(a, b);
+}
+
+void test_content_hash_separates_string_boundaries(void) {
+    uint32_t a = ContentHash().add("ab").add("c").value();
+    uint32_t b = ContentHash().add("a").add("bc").value();
+    TEST_ASSERT_TRUE(a != b);
+}
+
+void test_content_hash_changes_with_value(void) {
+    uint32_t a = ContentHash().add(String("V5")).value();
+    uint32_t b = ContentHash().add(String("V6")).value();
+    TEST_ASSERT_TRUE(a != b);
+}
+
+// =============================================================================
+// Dirty Tracking Tests
+// =============================================================================
+
+void test_first_render_draws_every_widget(void) {
+    setupLayout();
+    renderer->render();
+    TEST_ASSERT_EQUAL(4 + ROWS, (int)host.drawn.size());
+    TEST_ASSERT_EQUAL(4 + ROWS, renderer->widgetCount());
+}
+
+void test_unchanged_render_draws_nothing(void) {
+    setupLayout();
+    renderer->render();
+    host.resetDraws();
+
+    renderer->render();
+    TEST_ASSERT_EQUAL(0, (int)host.drawn.size());
+    TEST_ASSERT_EQUAL_UINT32(0, renderer->getLastStats().pixelsDrawn);
+    TEST_ASSERT_EQUAL(4 + ROWS, renderer->getLastStats().widgetsChecked);
+}
+
+void test_hash_change_redraws_only_that_widget(void) {
+    setupLayout();
+    renderer->render();
+    host.resetDraws();
+
+    host.hashes[STATUS] = 42;
+    renderer->render();
+    TEST_ASSERT_EQUAL(1, (int)host.drawn.size());
+    TEST_ASSERT_EQUAL(STATUS, host.drawn[0]);
+    TEST_ASSERT_EQUAL_UINT32(800 * 40, renderer->getLastStats().pixelsDrawn);
+}
+
+void test_draw_is_clipped_to_widget_rect(void) {
+    setupLayout();
+    renderer->render();
+    host.resetDraws();
+
+    host.hashes[HEADER] = 7;
+    renderer->render();
+    TEST_ASSERT_EQUAL(1, (int)host.clips.size());
+    TEST_ASSERT_TRUE(host.clips[0] == WidgetRect(533, 40, 267, 24));
+    TEST_ASSERT_EQUAL(1, host.clipClears);
+}
+
+void test_no_clip_calls_when_nothing_drawn(void) {
+    setupLayout();
+    renderer->render();
+    host.resetDraws();
+
+    renderer->render();
+    TEST_ASSERT_EQUAL(0, (int)host.clips.size());
+    TEST_ASSERT_EQUAL(0, host.clipClears);
+}
+
+void test_invalidate_forces_redraw(void) {
+    setupLayout();
+    renderer->render();
+    host.resetDraws();
+
+    renderer->invalidate(ROW_0 + 3);
+    renderer->render();
+    TEST_ASSERT_EQUAL(1, (int)host.drawn.size());
+    TEST_ASSERT_EQUAL(ROW_0 + 3, host.drawn[0]);
+}
+
+void test_invalidate_all_redraws_everything(void) {
+    setupLayout();
+    renderer->render();
+    host.resetDraws();
+
+    renderer->invalidateAll();
+    renderer->render();
+    TEST_ASSERT_EQUAL(4 + ROWS, (int)host.drawn.size());
+}
+
+// =============================================================================
+// Overlap and Damage Tests
+// =============================================================================
+
+void test_redrawn_widget_repaints_widgets_above_it(void) {
+    setupLayout();
+    renderer->render();
+    host.resetDraws();
+
+    // Board image changes; the QR overlaid on it must be redrawn on top
+    host.hashes[BOARD] = 99;
+    renderer->render();
+    TEST_ASSERT_EQUAL(2, (int)host.drawn.size());
+    TEST_ASSERT_EQUAL(BOARD, host.drawn[0]);
+    TEST_ASSERT_EQUAL(QR, host.drawn[1]);
+}
+
+void test_redrawn_widget_does_not_repaint_widgets_below_it(void) {
+    setupLayout();
+    renderer->render();
+    host.resetDraws();
+
+    host.hashes[QR] = 5;
+    renderer->render();
+    TEST_ASSERT_EQUAL(1, (int)host.drawn.size());
+    TEST_ASSERT_EQUAL(QR, host.drawn[0]);
+}
+
+void test_removed_widget_damages_widgets_underneath(void) {
+    setupLayout();
+    renderer->render();
+    host.resetDraws();
+
+    // QR hidden: the board must repaint the area it covered
+    renderer->setRect(QR, WidgetRect());
+    renderer->render();
+    TEST_ASSERT_TRUE(host.wasDrawn(BOARD));
+    TEST_ASSERT_FALSE(host.wasDrawn(QR));
+    TEST_ASSERT_FALSE(host.wasDrawn(STATUS));
+}
+
+void test_damage_is_cleared_after_render(void) {
+    setupLayout();
+    renderer->render();
+    renderer->setRect(QR, WidgetRect());
+    renderer->render();
+    host.resetDraws();
+
+    renderer->render();
+    TEST_ASSERT_EQUAL(0, (int)host.drawn.size());
+}
+
+void test_damage_overflow_keeps_old_area(void) {
+    setupLayout();
+    renderer->render();
+
+    // Fill the damage list by nudging queue rows down a pixel
+    for (int i = 0; i < WIDGET_MAX_DAMAGE; i++) {
+        renderer->setRect(ROW_0 + i, WidgetRect(533, 65 + i * 48, 267, 48));
+    }
+    renderer->render();
+    for (int i = 0; i < WIDGET_MAX_DAMAGE; i++) {
+        renderer->setRect(ROW_0 + i, WidgetRect(533, 64 + i * 48, 267, 48));
+    }
+    host.resetDraws();
+
+    // The QR's old area no longer fits as its own entry but must still repaint
+    renderer->setRect(QR, WidgetRect());
+    renderer->render();
+    TEST_ASSERT_TRUE(host.wasDrawn(BOARD));
+    TEST_ASSERT_FALSE(host.wasDrawn(STATUS));
+}
+
+void test_same_rect_is_not_damage(void) {
+    setupLayout();
+    renderer->render();
+    host.resetDraws();
+
+    setupLayout();
+    renderer->render();
+    TEST_ASSERT_EQUAL(0, (int)host.drawn.size());
+}
+
+void test_clear_removes_all_widgets(void) {
+    setupLayout();
+    renderer->clear();
+    TEST_ASSERT_EQUAL(0, renderer->widgetCount());
+    TEST_ASSERT_FALSE(renderer->hasWidget(STATUS));
+}
+
+void test_out_of_range_id_is_ignored(void) {
+    renderer->setRect(WIDGET_MAX_WIDGETS, WidgetRect(0, 0, 10, 10));
+    TEST_ASSERT_EQUAL(0, renderer->widgetCount());
+}
+
+void test_content_change_is_drawn_retained(void) {
+    setupLayout();
+    renderer->render();
+    host.resetDraws();
+
+    host.hashes[BOARD] = 99;
+    renderer->render();
+    TEST_ASSERT_EQUAL(BOARD, host.drawn[0]);
+    TEST_ASSERT_TRUE(host.retained[0]);
+    // The QR on top lost its pixels to the board redraw
+    TEST_ASSERT_EQUAL(QR, host.drawn[1]);
+    TEST_ASSERT_FALSE(host.retained[1]);
+}
+
+void test_first_draw_is_not_retained(void) {
+    setupLayout();
+    renderer->render();
+    TEST_ASSERT_FALSE(host.retained[0]);
+}
+
+void test_damaged_widget_is_not_retained(void) {
+    setupLayout();
+    renderer->render();
+    host.resetDraws();
+
+    host.hashes[BOARD] = 99;
+    renderer->setRect(QR, WidgetRect());
+    renderer->render();
+    TEST_ASSERT_EQUAL(BOARD, host.drawn[0]);
+    TEST_ASSERT_FALSE(host.retained[0]);
+}
+
+// =============================================================================
+// Skip Mask Tests
+// =============================================================================
+
+void test_skip_mask_leaves_widget_untouched(void) {
+    setupLayout();
+    renderer->render();
+    host.resetDraws();
+
+    host.hashes[BOARD] = 1;
+    host.hashes[STATUS] = 1;
+    renderer->render(1u << BOARD);
+    TEST_ASSERT_TRUE(host.wasDrawn(STATUS));
+    TEST_ASSERT_FALSE(host.wasDrawn(BOARD));
+}
+
+void test_skipped_widget_redraws_on_next_full_render(void) {
+    setupLayout();
+    renderer->render();
+    host.hashes[BOARD] = 1;
+    renderer->render(1u << BOARD);
+    host.resetDraws();
+
+    renderer->render();
+    TEST_ASSERT_TRUE(host.wasDrawn(BOARD));
+}
+
+void test_skipped_widget_under_damage_is_invalidated(void) {
+    setupLayout();
+    renderer->render();
+    renderer->setRect(QR, WidgetRect());
+    renderer->render(1u << BOARD);
+    host.resetDraws();
+
+    renderer->render();
+    TEST_ASSERT_TRUE(host.wasDrawn(BOARD));
+}
+
+// =============================================================================
+// Statistics Tests
+// =============================================================================
+
+void test_queue_step_touches_two_rows_and_header(void) {
+    setupLayout();
+    renderer->render();
+    host.resetDraws();
+
+    // Current item moves from row 3 to row 4
+    host.hashes[HEADER] = 2;
+    host.hashes[ROW_0 + 3] = 2;
+    host.hashes[ROW_0 + 4] = 2;
+    renderer->render();
+
+    const WidgetRenderStats& stats = renderer->getLastStats();
+    TEST_ASSERT_EQUAL(3, stats.widgetsDrawn);
+    TEST_ASSERT_EQUAL_UINT32(267 * 24 + 2 * 267 * 48, stats.pixelsDrawn);
+    TEST_ASSERT_EQUAL_UINT32((1u << HEADER) | (1u << (ROW_0 + 3)) | (1u << (ROW_0 + 4)), stats.drawnMask);
+    // Well under a tenth of the 800x480 frame
+    TEST_ASSERT_TRUE(stats.pixelsDrawn < 800 * 480 / 10);
+}
+
+void test_totals_accumulate_across_frames(void) {
+    setupLayout();
+    renderer->render();
+    uint32_t firstPixels = renderer->getLastStats().pixelsDrawn;
+
+    host.hashes[STATUS] = 3;
+    renderer->render();
+
+    const WidgetRenderTotals& totals = renderer->getTotals();
+    TEST_ASSERT_EQUAL_UINT32(2, totals.frames);
+    TEST_ASSERT_EQUAL_UINT32(4 + ROWS + 1, totals.widgetsDrawn);
+    TEST_ASSERT_TRUE(totals.pixelsDrawn == (uint64_t)firstPixels + 800 * 40);
+    TEST_ASSERT_EQUAL_UINT32(firstPixels, totals.maxFramePixels);
+}
+
+void test_reset_totals(void) {
+    setupLayout();
+    renderer->render();
+    renderer->resetTotals();
+    TEST_ASSERT_EQUAL_UINT32(0, renderer->getTotals().frames);
+    TEST_ASSERT_EQUAL_UINT32(0, renderer->getTiming(STATUS).draws);
+}
+
+void test_timing_is_tracked_per_widget(void) {
+    setupLayout();
+    host.drawMs[QR] = 3;
+    host.drawMs[HEADER] = 1;
+    renderer->render();
+
+    host.drawMs[QR] = 1;
+    host.hashes[QR] = 7;
+    renderer->render();
+
+    const WidgetTiming& qr = renderer->getTiming(QR);
+    TEST_ASSERT_EQUAL_UINT32(2, qr.draws);
+    TEST_ASSERT_EQUAL_UINT32(1000, qr.lastUs);
+    TEST_ASSERT_EQUAL_UINT32(3000, qr.maxUs);
+    TEST_ASSERT_EQUAL_UINT32(2000, qr.avgUs());
+
+    // Undrawn widgets keep their first-frame time
+    TEST_ASSERT_EQUAL_UINT32(1, renderer->getTiming(HEADER).draws);
+    TEST_ASSERT_EQUAL_UINT32(1000, renderer->getTiming(HEADER).lastUs);
+    TEST_ASSERT_EQUAL_UINT32(0, renderer->getTiming(STATUS).lastUs);
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+
+    // WidgetRect / ContentHash tests
+    RUN_TEST(test_rect_intersects_overlapping);
+    RUN_TEST(test_rect_touching_edges_do_not_intersect);
+    RUN_TEST(test_empty_rect_never_intersects);
+    RUN_TEST(test_rect_intersection);
+    RUN_TEST(test_content_hash_is_deterministic);
+    RUN_TEST(test_content_hash_separates_string_boundaries);
+    RUN_TEST(test_content_hash_changes_with_value);
+
+    // Dirty tracking tests
+    RUN_TEST(test_first_render_draws_every_widget);
+    RUN_TEST(test_unchanged_render_draws_nothing);
+    RUN_TEST(test_hash_change_redraws_only_that_widget);
+    RUN_TEST(test_draw_is_clipped_to_widget_rect);
+    RUN_TEST(test_no_clip_calls_when_nothing_drawn);
+    RUN_TEST(test_invalidate_forces_redraw);
+    RUN_TEST(test_invalidate_all_redraws_everything);
+
+    // Overlap and damage tests
+    RUN_TEST(test_redrawn_widget_repaints_widgets_above_it);
+    RUN_TEST(test_redrawn_widget_does_not_repaint_widgets_below_it);
+    RUN_TEST(test_removed_widget_damages_widgets_underneath);
+    RUN_TEST(test_damage_is_cleared_after_render);
+    RUN_TEST(test_damage_overflow_keeps_old_area);
+    RUN_TEST(test_same_rect_is_not_damage);
+    RUN_TEST(test_clear_removes_all_widgets);
+    RUN_TEST(test_out_of_range_id_is_ignored);
+    RUN_TEST(test_content_change_is_drawn_retained);
+    RUN_TEST(test_first_draw_is_not_retained);
+    RUN_TEST(test_damaged_widget_is_not_retained);
+
+    // Skip mask tests
+    RUN_TEST(test_skip_mask_leaves_widget_untouched);
+    RUN_TEST(test_skipped_widget_redraws_on_next_full_render);
+    RUN_TEST(test_skipped_widget_under_damage_is_invalidated);
+
+    // Statistics tests
+    RUN_TEST(test_queue_step_touches_two_rows_and_header);
+    RUN_TEST(test_totals_accumulate_across_frames);
+    RUN_TEST(test_reset_totals);
+    RUN_TEST(test_timing_is_tracked_per_widget);
+
+    return UNITY_END();
+}
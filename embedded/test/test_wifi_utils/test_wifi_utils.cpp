@@ -16,6 +16,7 @@ static WiFiUtils* wifiMgr;
 
 void setUp(void) {
     Preferences::resetAll();  // Clear config storage
+    Config.reset();           // Drop cached config values
     WiFi.mockReset();         // Reset WiFi mock state
     wifiMgr = new WiFiUtils();
 }